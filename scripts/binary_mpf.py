@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+
+import argparse
+import array
+import gzip
+import struct
+import sys
+import zlib
+
+MAGIC = b'SSMPFBIN'
+VERSION = 1
+
+# record types
+START_TRANSACTION = 0
+END_TRANSACTION = 1
+MESSAGE = 2
+
+def read_blocks(fd):
+  # yields the uncompressed payload of each block
+  magic = fd.read(len(MAGIC))
+  assert magic == MAGIC, 'not a binary message log'
+  version, = struct.unpack('<I', fd.read(4))
+  assert version == VERSION, \
+    'unsupported binary message log version {0}'.format(version)
+  while True:
+    sizes = fd.read(16)
+    if len(sizes) == 0:
+      break
+    raw_size, compressed_size = struct.unpack('<QQ', sizes)
+    raw = zlib.decompress(fd.read(compressed_size))
+    assert len(raw) == raw_size
+    yield raw
+
+def parse_block(raw):
+  # returns the columns of a block
+  counts = struct.unpack_from('<5Q', raw, 0)
+  num_records, num_trans, num_msgs, num_pkts, num_flits = counts
+  offset = 5 * 8
+  columns = []
+  layout = [('B', num_records),
+            ('Q', num_trans), ('Q', num_trans),
+            ('I', num_msgs), ('I', num_msgs), ('I', num_msgs),
+            ('Q', num_msgs), ('I', num_msgs), ('I', num_msgs),
+            ('I', num_msgs), ('I', num_msgs),
+            ('I', num_pkts), ('I', num_pkts), ('I', num_pkts),
+            ('I', num_flits), ('Q', num_flits), ('Q', num_flits)]
+  for code, count in layout:
+    column = array.array(code)
+    assert column.itemsize == struct.calcsize('<' + code)
+    size = column.itemsize * count
+    column.frombytes(raw[offset:offset + size])
+    if sys.byteorder != 'little':
+      column.byteswap()
+    columns.append(column)
+    offset += size
+  assert offset == len(raw)
+  return columns
+
+def write_text(raw, out):
+  # writes a block in the text message log format
+  (records, trans_ids, trans_times, msg_ids, msg_srcs, msg_dsts, msg_trans,
+   msg_pcs, msg_min_hops, msg_opcodes, msg_num_pkts, pkt_ids, pkt_hops,
+   pkt_num_flits, flit_ids, flit_sends, flit_recvs) = parse_block(raw)
+  lines = []
+  trans = 0
+  msg = 0
+  pkt = 0
+  flit = 0
+  for record in records:
+    if record == START_TRANSACTION or record == END_TRANSACTION:
+      sign = '+' if record == START_TRANSACTION else '-'
+      lines.append('{0}T,{1},{2}\n'.format(
+        sign, trans_ids[trans], trans_times[trans]))
+      trans += 1
+    else:
+      assert record == MESSAGE
+      lines.append('+M,{0},{1},{2},{3},{4},{5},{6}\n'.format(
+        msg_ids[msg], msg_srcs[msg], msg_dsts[msg], msg_trans[msg],
+        msg_pcs[msg], msg_min_hops[msg], msg_opcodes[msg]))
+      for _ in range(msg_num_pkts[msg]):
+        lines.append(' +P,{0},{1}\n'.format(pkt_ids[pkt], pkt_hops[pkt]))
+        for _ in range(pkt_num_flits[pkt]):
+          lines.append('   F,{0},{1},{2}\n'.format(
+            flit_ids[flit], flit_sends[flit], flit_recvs[flit]))
+          flit += 1
+        lines.append(' -P\n')
+        pkt += 1
+      lines.append('-M\n')
+      msg += 1
+  out.write(''.join(lines))
+
+def open_input(filename):
+  # logs written before .gz was rejected for the binary format are gzipped
+  with open(filename, 'rb') as fd:
+    gzipped = fd.read(2) == b'\x1f\x8b'
+  if gzipped:
+    return gzip.open(filename, 'rb')
+  return open(filename, 'rb')
+
+def main(args):
+  if args.output.endswith('.gz'):
+    out = gzip.open(args.output, 'wt')
+  elif args.output == '-':
+    out = sys.stdout
+  else:
+    out = open(args.output, 'w')
+  with open_input(args.input) as fd:
+    for raw in read_blocks(fd):
+      write_text(raw, out)
+  if out is not sys.stdout:
+    out.close()
+  return 0
+
+if __name__ == '__main__':
+  ap = argparse.ArgumentParser(
+    description='converts a binary message log to the text format (e.g., '
+                'for ssparse)')
+  ap.add_argument('input', type=str,
+                  help='binary message log file')
+  ap.add_argument('output', type=str,
+                  help='text message log file (.gz to compress, - for stdout)')
+  args = ap.parse_args()
+  sys.exit(main(args))
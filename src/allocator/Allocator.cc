@@ -17,10 +17,11 @@
 #include <cassert>
 
 #include "factory/ObjectFactory.h"
+#include "util/Bitset.h"
 
 Allocator::Allocator(const std::string& _name, const Component* _parent,
                      u32 _numClients, u32 _numResources,
-                     nlohmann::json _settings)
+                     const nlohmann::json& _settings)
     : Component(_name, _parent),
       numClients_(_numClients),
       numResources_(_numResources) {
@@ -32,7 +33,7 @@ Allocator::~Allocator() {}
 
 Allocator* Allocator::create(const std::string& _name, const Component* _parent,
                              u32 _numClients, u32 _numResources,
-                             nlohmann::json _settings) {
+                             const nlohmann::json& _settings) {
   // retrieve the allocator type
   const std::string& type = _settings["type"].get<std::string>();
 
@@ -55,3 +56,45 @@ u32 Allocator::numClients() const {
 u32 Allocator::numResources() const {
   return numResources_;
 }
+
+void Allocator::setRequests(bool* _requests) {
+  for (u32 c = 0; c < numClients_; c++) {
+    for (u32 r = 0; r < numResources_; r++) {
+      setRequest(c, r, &_requests[(c * numResources_) + r]);
+    }
+  }
+}
+
+void Allocator::setMetadatas(u64* _metadatas) {
+  for (u32 c = 0; c < numClients_; c++) {
+    for (u32 r = 0; r < numResources_; r++) {
+      setMetadata(c, r, &_metadatas[(c * numResources_) + r]);
+    }
+  }
+}
+
+void Allocator::setGrants(bool* _grants) {
+  for (u32 c = 0; c < numClients_; c++) {
+    for (u32 r = 0; r < numResources_; r++) {
+      setGrant(c, r, &_grants[(c * numResources_) + r]);
+    }
+  }
+}
+
+bool Allocator::packed() const {
+  return false;
+}
+
+u32 Allocator::packedWords() const {
+  return bitsetWords(numClients_);
+}
+
+void Allocator::setPackedRequests(u64* _requests) {
+  fprintf(stderr, "%s does not support packed requests\n", fullName().c_str());
+  assert(false);
+}
+
+void Allocator::setPackedGrants(u64* _grants) {
+  fprintf(stderr, "%s does not support packed grants\n", fullName().c_str());
+  assert(false);
+}
@@ -24,12 +24,12 @@
 #include "prim/prim.h"
 
 #define ALLOCATOR_ARGS \
-  const std::string&, const Component*, u32, u32, nlohmann::json
+  const std::string&, const Component*, u32, u32, const nlohmann::json&
 
 class Allocator : public Component {
  public:
   Allocator(const std::string& _name, const Component* _parent, u32 _numClients,
-            u32 _numResources, nlohmann::json _settings);
+            u32 _numResources, const nlohmann::json& _settings);
   virtual ~Allocator();
 
   // this is the factory for allocators
@@ -45,11 +45,27 @@ class Allocator : public Component {
   virtual void setMetadata(u32 _client, u32 _resource, u64* _metadata) = 0;
   // maps the grant to the specified client and resource
   virtual void setGrant(u32 _client, u32 _resource, bool* _grant) = 0;
+  // these map all clients and resources at once, client 'c' and resource 'r'
+  //  are at ((c * numResources()) + r), override when faster than mapping
+  //  them one at a time
+  virtual void setRequests(bool* _requests);
+  virtual void setMetadatas(u64* _metadatas);
+  virtual void setGrants(bool* _grants);
 
   // computes the allocation logic, must be overridden
   //  should only set grants true (logically OR)
   virtual void allocate() = 0;
 
+  // returns true if this allocator uses packed requests and grants instead
+  //  of setRequest() and setGrant()
+  virtual bool packed() const;
+  // returns the number of u64 words in each packed row
+  u32 packedWords() const;
+  // maps the packed requests and grants, each is numResources() rows of
+  //  packedWords() words, bit 'c' of row 'r' is client 'c' for resource 'r'
+  virtual void setPackedRequests(u64* _requests);
+  virtual void setPackedGrants(u64* _grants);
+
  protected:
   const u32 numClients_;
   const u32 numResources_;
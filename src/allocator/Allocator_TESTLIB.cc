@@ -14,13 +14,16 @@
  */
 #include "allocator/Allocator_TESTLIB.h"
 
+#include <random>
 #include <sstream>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 #include "allocator/Allocator.h"
 #include "gtest/gtest.h"
 #include "test/TestSetup_TESTLIB.h"
+#include "util/Bitset.h"
 
 u64 AllocatorIndex(u64 _numClients, u64 _client, u64 _resource) {
   return _numClients * _resource + _client;
@@ -38,6 +41,70 @@ static std::string ppp(bool* _bools, u64 _len) {
   return ss.str();
 }
 
+// maps I/O to the allocator, packed allocators use the packed rows
+static void mapAllocator(Allocator* _alloc, u32 _numClients, u32 _numResources,
+                         bool* _request, u64* _metadata, bool* _grant,
+                         std::vector<u64>* _packedRequest,
+                         std::vector<u64>* _packedGrant) {
+  for (u32 c = 0; c < _numClients; c++) {
+    for (u32 r = 0; r < _numResources; r++) {
+      u64 idx = AllocatorIndex(_numClients, c, r);
+      if (!_alloc->packed()) {
+        _alloc->setRequest(c, r, &_request[idx]);
+        _alloc->setGrant(c, r, &_grant[idx]);
+      }
+      _alloc->setMetadata(c, r, &_metadata[idx]);
+    }
+  }
+  if (_alloc->packed()) {
+    _packedRequest->resize(_numResources * _alloc->packedWords());
+    _packedGrant->resize(_numResources * _alloc->packedWords());
+    _alloc->setPackedRequests(_packedRequest->data());
+    _alloc->setPackedGrants(_packedGrant->data());
+  }
+}
+
+// runs the allocator, packing the requests and grants in and out of the
+//  packed rows if needed
+static void runAllocator(Allocator* _alloc, u32 _numClients, u32 _numResources,
+                         bool* _request, bool* _grant,
+                         std::vector<u64>* _packedRequest,
+                         std::vector<u64>* _packedGrant) {
+  if (!_alloc->packed()) {
+    _alloc->allocate();
+    return;
+  }
+
+  u32 words = _alloc->packedWords();
+  for (u32 r = 0; r < _numResources; r++) {
+    u64* requestRow = &_packedRequest->at(r * words);
+    u64* grantRow = &_packedGrant->at(r * words);
+    bitsetClearAll(requestRow, words);
+    bitsetClearAll(grantRow, words);
+    for (u32 c = 0; c < _numClients; c++) {
+      u64 idx = AllocatorIndex(_numClients, c, r);
+      if (_request[idx]) {
+        bitsetSet(requestRow, c);
+      }
+      if (_grant[idx]) {
+        bitsetSet(grantRow, c);
+      }
+    }
+  }
+
+  _alloc->allocate();
+
+  for (u32 r = 0; r < _numResources; r++) {
+    const u64* requestRow = &_packedRequest->at(r * words);
+    const u64* grantRow = &_packedGrant->at(r * words);
+    for (u32 c = 0; c < _numClients; c++) {
+      u64 idx = AllocatorIndex(_numClients, c, r);
+      _request[idx] = bitsetTest(requestRow, c);
+      _grant[idx] = bitsetTest(grantRow, c);
+    }
+  }
+}
+
 void AllocatorTest(nlohmann::json _settings, AllocatorVerifier _verifier,
                    bool _singleRequest) {
   for (u32 C = 1; C < 16; C++) {
@@ -54,14 +121,10 @@ void AllocatorTest(nlohmann::json _settings, AllocatorVerifier _verifier,
       Allocator* alloc = Allocator::create("Alloc", nullptr, C, R, _settings);
 
       // map I/O to the allocator
-      for (u32 c = 0; c < C; c++) {
-        for (u32 r = 0; r < R; r++) {
-          u64 idx = AllocatorIndex(C, c, r);
-          alloc->setRequest(c, r, &request[idx]);
-          alloc->setMetadata(c, r, &metadata[idx]);
-          alloc->setGrant(c, r, &grant[idx]);
-        }
-      }
+      std::vector<u64> packedRequest;
+      std::vector<u64> packedGrant;
+      mapAllocator(alloc, C, R, request, metadata, grant, &packedRequest,
+                   &packedGrant);
 
       // run the test numerous times
       for (u32 run = 0; run < 100; run++) {
@@ -97,7 +160,7 @@ void AllocatorTest(nlohmann::json _settings, AllocatorVerifier _verifier,
         if (false) {
           printf("r %s\n", ppp(request, C * R).c_str());
         }
-        alloc->allocate();
+        runAllocator(alloc, C, R, request, grant, &packedRequest, &packedGrant);
         if (false) {
           printf("g %s\n", ppp(grant, C * R).c_str());
         }
@@ -155,14 +218,10 @@ void AllocatorLoadBalanceTest(nlohmann::json _settings) {
   Allocator* alloc = Allocator::create("Alloc", nullptr, C, R, _settings);
 
   // map I/O to the allocator
-  for (u32 c = 0; c < C; c++) {
-    for (u32 r = 0; r < R; r++) {
-      u64 idx = AllocatorIndex(C, c, r);
-      alloc->setRequest(c, r, &request[idx]);
-      alloc->setMetadata(c, r, &metadata[idx]);
-      alloc->setGrant(c, r, &grant[idx]);
-    }
-  }
+  std::vector<u64> packedRequest;
+  std::vector<u64> packedGrant;
+  mapAllocator(alloc, C, R, request, metadata, grant, &packedRequest,
+               &packedGrant);
 
   // run the test numerous times
   for (u32 test = 0; test < 1; test++) {
@@ -220,7 +279,7 @@ void AllocatorLoadBalanceTest(nlohmann::json _settings) {
       if (DBG) {
         printf("r %s\n", ppp(request, C * R).c_str());
       }
-      alloc->allocate();
+      runAllocator(alloc, C, R, request, grant, &packedRequest, &packedGrant);
       if (DBG) {
         printf("g %s\n", ppp(grant, C * R).c_str());
       }
@@ -274,3 +333,151 @@ void AllocatorLoadBalanceTest(nlohmann::json _settings) {
   delete[] clientGrantCounts;
   delete alloc;
 }
+
+void AllocatorEquivalenceTest(nlohmann::json _referenceSettings,
+                              nlohmann::json _packedSettings) {
+  const u32 kSizes[] = {1, 2, 7, 16, 63, 64, 65, 130};
+  const u32 kRuns = 50;
+  const u64 kSeed = 456;
+
+  for (u32 C : kSizes) {
+    for (u32 R : kSizes) {
+      u64 size = (u64)C * R;
+      std::vector<bool> expected;
+
+      for (u32 pass = 0; pass < 2; pass++) {
+        // both passes see the same random numbers for the arbiters
+        TestSetup testSetup(1, 1, 1, 1, kSeed);
+
+        // the stimulus has its own generator to not disturb the arbiters
+        std::mt19937_64 stimulus(C * 1000 + R);
+
+        bool* request = new bool[size];
+        u64* metadata = new u64[size];
+        bool* grant = new bool[size];
+
+        // create the allocator
+        Allocator* alloc = Allocator::create(
+            "Alloc", nullptr, C, R,
+            pass == 0 ? _referenceSettings : _packedSettings);
+        ASSERT_EQ(alloc->packed(), pass == 1);
+
+        // map I/O to the allocator
+        std::vector<u64> packedRequest;
+        std::vector<u64> packedGrant;
+        mapAllocator(alloc, C, R, request, metadata, grant, &packedRequest,
+                     &packedGrant);
+
+        // run the test numerous times
+        u64 check = 0;
+        for (u32 run = 0; run < kRuns; run++) {
+          // randomize the inputs, metadata has few values to create ties
+          u32 density = stimulus() % 4;
+          for (u64 idx = 0; idx < size; idx++) {
+            request[idx] = (stimulus() % 4) <= density;
+            metadata[idx] = stimulus() % 3;
+            grant[idx] = false;
+          }
+
+          // allocate
+          runAllocator(alloc, C, R, request, grant, &packedRequest,
+                       &packedGrant);
+
+          // record or compare the grants and the remaining requests
+          for (u64 idx = 0; idx < size; idx++) {
+            if (pass == 0) {
+              expected.push_back(grant[idx]);
+              expected.push_back(request[idx]);
+            } else {
+              ASSERT_EQ(grant[idx], expected.at(check++))
+                  << "C=" << C << " R=" << R << " run=" << run;
+              ASSERT_EQ(request[idx], expected.at(check++))
+                  << "C=" << C << " R=" << R << " run=" << run;
+            }
+          }
+        }
+
+        // cleanup
+        delete[] request;
+        delete[] metadata;
+        delete[] grant;
+        delete alloc;
+      }
+    }
+  }
+}
+
+void AllocatorMappingTest(nlohmann::json _settings) {
+  const u32 kSizes[] = {1, 3, 16, 65};
+  const u32 kRuns = 50;
+  const u64 kSeed = 789;
+
+  for (u32 C : kSizes) {
+    for (u32 R : kSizes) {
+      u64 size = (u64)C * R;
+      std::vector<bool> expected;
+
+      for (u32 pass = 0; pass < 2; pass++) {
+        // both passes see the same random numbers for the arbiters
+        TestSetup testSetup(1, 1, 1, 1, kSeed);
+
+        // the stimulus has its own generator to not disturb the arbiters
+        std::mt19937_64 stimulus(C * 1000 + R);
+
+        // the bulk mapping uses client major order
+        bool* request = new bool[size];
+        u64* metadata = new u64[size];
+        bool* grant = new bool[size];
+
+        // create the allocator and map I/O to it
+        Allocator* alloc = Allocator::create("Alloc", nullptr, C, R, _settings);
+        ASSERT_FALSE(alloc->packed());
+        if (pass == 0) {
+          for (u32 c = 0; c < C; c++) {
+            for (u32 r = 0; r < R; r++) {
+              u64 idx = (c * R) + r;
+              alloc->setRequest(c, r, &request[idx]);
+              alloc->setMetadata(c, r, &metadata[idx]);
+              alloc->setGrant(c, r, &grant[idx]);
+            }
+          }
+        } else {
+          alloc->setRequests(request);
+          alloc->setMetadatas(metadata);
+          alloc->setGrants(grant);
+        }
+
+        // run the test numerous times
+        u64 check = 0;
+        for (u32 run = 0; run < kRuns; run++) {
+          // randomize the inputs, metadata has few values to create ties
+          u32 density = stimulus() % 4;
+          for (u64 idx = 0; idx < size; idx++) {
+            request[idx] = (stimulus() % 4) <= density;
+            metadata[idx] = stimulus() % 3;
+            grant[idx] = false;
+          }
+
+          // allocate
+          alloc->allocate();
+
+          // record or compare the grants
+          for (u64 idx = 0; idx < size; idx++) {
+            if (pass == 0) {
+              expected.push_back(grant[idx]);
+            } else {
+              ASSERT_EQ(grant[idx], expected.at(check++))
+                  << "C=" << C << " R=" << R << " run=" << run;
+            }
+          }
+        }
+
+        // cleanup
+        delete[] request;
+        delete[] metadata;
+        delete[] grant;
+        delete alloc;
+      }
+    }
+  }
+}
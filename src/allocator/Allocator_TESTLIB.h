@@ -28,4 +28,14 @@ void AllocatorTest(nlohmann::json _settings, AllocatorVerifier _verifier,
                    bool _singleRequest);
 void AllocatorLoadBalanceTest(nlohmann::json _settings);
 
+// runs the packed allocator and the reference allocator with the same random
+//  numbers and stimulus, verifies they produce identical grants
+void AllocatorEquivalenceTest(nlohmann::json _referenceSettings,
+                              nlohmann::json _packedSettings);
+
+// runs the allocator mapped one client and resource at a time and mapped all
+//  at once with the same random numbers and stimulus, verifies they produce
+//  identical grants
+void AllocatorMappingTest(nlohmann::json _settings);
+
 #endif  // ALLOCATOR_ALLOCATOR_TESTLIB_H_
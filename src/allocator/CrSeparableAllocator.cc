@@ -22,13 +22,11 @@
 CrSeparableAllocator::CrSeparableAllocator(const std::string& _name,
                                            const Component* _parent,
                                            u32 _numClients, u32 _numResources,
-                                           nlohmann::json _settings)
-    : Allocator(_name, _parent, _numClients, _numResources, _settings) {
-  // pointer arrays
-  requests_.resize(numClients_ * numResources_, nullptr);
-  metadatas_.resize(numClients_ * numResources_, nullptr);
+                                           const nlohmann::json& _settings)
+    : Allocator(_name, _parent, _numClients, _numResources, _settings),
+      requests_(_numClients * _numResources) {
+  // intermediate signals
   intermediates_ = new bool[numClients_ * numResources_];
-  grants_.resize(numClients_ * numResources_, nullptr);
 
   // use vector to hold arbiter pointers
   clientArbiters_.resize(numClients_, nullptr);
@@ -50,11 +48,11 @@ CrSeparableAllocator::CrSeparableAllocator(const std::string& _name,
 
   // map intermediate request signals to arbiters
   for (u32 c = 0; c < numClients_; c++) {
-    for (u32 r = 0; r < numResources_; r++) {
-      bool* i = &intermediates_[index(c, r)];
-      clientArbiters_[c]->setGrant(r, i);
-      resourceArbiters_[r]->setRequest(c, i);
-    }
+    clientArbiters_[c]->setGrants(&intermediates_[index(c, 0)], 1);
+  }
+  for (u32 r = 0; r < numResources_; r++) {
+    resourceArbiters_[r]->setRequests(&intermediates_[index(0, r)],
+                                      numResources_);
   }
 
   // parse settings
@@ -75,22 +73,43 @@ CrSeparableAllocator::~CrSeparableAllocator() {
 
 void CrSeparableAllocator::setRequest(u32 _client, u32 _resource,
                                       bool* _request) {
-  requests_.at(index(_client, _resource)) = _request;
+  requests_.set(index(_client, _resource), _request);
   clientArbiters_.at(_client)->setRequest(_resource, _request);
 }
 
 void CrSeparableAllocator::setMetadata(u32 _client, u32 _resource,
                                        u64* _metadata) {
-  metadatas_.at(index(_client, _resource)) = _metadata;
   clientArbiters_.at(_client)->setMetadata(_resource, _metadata);
   resourceArbiters_.at(_resource)->setMetadata(_client, _metadata);
 }
 
 void CrSeparableAllocator::setGrant(u32 _client, u32 _resource, bool* _grant) {
-  grants_.at(index(_client, _resource)) = _grant;
   resourceArbiters_.at(_resource)->setGrant(_client, _grant);
 }
 
+void CrSeparableAllocator::setRequests(bool* _requests) {
+  requests_.setAll(_requests, 1);
+  for (u32 c = 0; c < numClients_; c++) {
+    clientArbiters_[c]->setRequests(&_requests[index(c, 0)], 1);
+  }
+}
+
+void CrSeparableAllocator::setMetadatas(u64* _metadatas) {
+  for (u32 c = 0; c < numClients_; c++) {
+    clientArbiters_[c]->setMetadatas(&_metadatas[index(c, 0)], 1);
+  }
+  for (u32 r = 0; r < numResources_; r++) {
+    resourceArbiters_[r]->setMetadatas(&_metadatas[index(0, r)],
+                                       numResources_);
+  }
+}
+
+void CrSeparableAllocator::setGrants(bool* _grants) {
+  for (u32 r = 0; r < numResources_; r++) {
+    resourceArbiters_[r]->setGrants(&_grants[index(0, r)], numResources_);
+  }
+}
+
 void CrSeparableAllocator::allocate() {
   for (u32 remaining = iterations_; remaining > 0; remaining--) {
     // clear the intermediate stage
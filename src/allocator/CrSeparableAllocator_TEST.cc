@@ -51,6 +51,7 @@ TEST(CrSeparableAllocator, greater) {
   // test
   AllocatorTest(allocSettings, nullptr, false);
   AllocatorLoadBalanceTest(allocSettings);
+  AllocatorMappingTest(allocSettings);
 }
 
 TEST(CrSeparableAllocator, lesser) {
@@ -0,0 +1,163 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "allocator/PackedCrSeparableAllocator.h"
+
+#include <cassert>
+
+#include "arbiter/Arbiter.h"
+#include "factory/ObjectFactory.h"
+#include "util/Bitset.h"
+
+PackedCrSeparableAllocator::PackedCrSeparableAllocator(
+    const std::string& _name, const Component* _parent, u32 _numClients,
+    u32 _numResources, const nlohmann::json& _settings)
+    : Allocator(_name, _parent, _numClients, _numResources, _settings),
+      clientWords_(packedWords()),
+      resourceWords_(bitsetWords(_numResources)),
+      requests_(nullptr),
+      grants_(nullptr) {
+  // packed arrays
+  clientRequests_.resize(numClients_ * resourceWords_, 0);
+  intermediates_.resize(numResources_ * clientWords_, 0);
+
+  // use vector to hold arbiter pointers
+  clientArbiters_.resize(numClients_, nullptr);
+  resourceArbiters_.resize(numResources_, nullptr);
+
+  // instantiate the client arbiters
+  for (u32 c = 0; c < numClients_; c++) {
+    std::string name = "ArbiterC" + std::to_string(c);
+    clientArbiters_[c] =
+        Arbiter::create(name, this, numResources_, _settings["client_arbiter"]);
+    assert(clientArbiters_[c]->supportsPacked());
+  }
+
+  // instantiate the resource arbiters
+  for (u32 r = 0; r < numResources_; r++) {
+    std::string name = "ArbiterR" + std::to_string(r);
+    resourceArbiters_[r] =
+        Arbiter::create(name, this, numClients_, _settings["resource_arbiter"]);
+    assert(resourceArbiters_[r]->supportsPacked());
+  }
+
+  // parse settings
+  iterations_ = _settings["iterations"].get<u32>();
+  assert(iterations_ > 0);
+  slipLatch_ = _settings["slip_latch"].get<bool>();
+}
+
+PackedCrSeparableAllocator::~PackedCrSeparableAllocator() {
+  for (u32 c = 0; c < numClients_; c++) {
+    delete clientArbiters_[c];
+  }
+  for (u32 r = 0; r < numResources_; r++) {
+    delete resourceArbiters_[r];
+  }
+}
+
+void PackedCrSeparableAllocator::setRequest(u32 _client, u32 _resource,
+                                            bool* _request) {
+  assert(false);  // use setPackedRequests()
+}
+
+void PackedCrSeparableAllocator::setMetadata(u32 _client, u32 _resource,
+                                             u64* _metadata) {
+  clientArbiters_.at(_client)->setMetadata(_resource, _metadata);
+  resourceArbiters_.at(_resource)->setMetadata(_client, _metadata);
+}
+
+void PackedCrSeparableAllocator::setGrant(u32 _client, u32 _resource,
+                                          bool* _grant) {
+  assert(false);  // use setPackedGrants()
+}
+
+void PackedCrSeparableAllocator::allocate() {
+  for (u32 remaining = iterations_; remaining > 0; remaining--) {
+    // transpose the requests into client rows, clear the intermediate stage
+    bitsetClearAll(clientRequests_.data(), clientRequests_.size());
+    for (u32 r = 0; r < numResources_; r++) {
+      const u64* row = &requests_[r * clientWords_];
+      for (u32 w = 0; w < clientWords_; w++) {
+        for (u64 word = row[w]; word != 0; word &= word - 1) {
+          u32 c = (w * 64) + __builtin_ctzll(word);
+          bitsetSet(&clientRequests_[c * resourceWords_], r);
+        }
+      }
+    }
+    bitsetClearAll(intermediates_.data(), intermediates_.size());
+
+    // run the client arbiters
+    for (u32 c = 0; c < numClients_; c++) {
+      const u64* row = &clientRequests_[c * resourceWords_];
+      if (bitsetAny(row, resourceWords_)) {
+        u32 winningResource = clientArbiters_[c]->arbitratePacked(row);
+        if (winningResource != U32_MAX) {
+          bitsetSet(&intermediates_[winningResource * clientWords_], c);
+        }
+      }
+
+      // perform arbiter state latching
+      if (!slipLatch_) {
+        // regular latch always algorithm
+        clientArbiters_[c]->latch();
+      }
+    }
+
+    // run the resource arbiters
+    for (u32 r = 0; r < numResources_; r++) {
+      const u64* row = &intermediates_[r * clientWords_];
+      u32 winningClient = U32_MAX;
+      if (bitsetAny(row, clientWords_)) {
+        winningClient = resourceArbiters_[r]->arbitratePacked(row);
+      }
+      if (winningClient != U32_MAX) {
+        bitsetSet(&grants_[r * clientWords_], winningClient);
+        // remove the requests from this client
+        for (u32 r2 = 0; r2 < numResources_; r2++) {
+          bitsetClear(&requests_[r2 * clientWords_], winningClient);
+        }
+        // remove the requests for this resource
+        bitsetClearAll(&requests_[r * clientWords_], clientWords_);
+      }
+
+      // perform arbiter state latching
+      if (slipLatch_) {
+        // slip latching (iSLIP algorithm)
+        if (winningClient != U32_MAX) {
+          resourceArbiters_[r]->latch();
+          clientArbiters_[winningClient]->latch();
+        }
+      } else {
+        // regular latch always algorithm
+        resourceArbiters_[r]->latch();
+      }
+    }
+  }
+}
+
+bool PackedCrSeparableAllocator::packed() const {
+  return true;
+}
+
+void PackedCrSeparableAllocator::setPackedRequests(u64* _requests) {
+  requests_ = _requests;
+}
+
+void PackedCrSeparableAllocator::setPackedGrants(u64* _grants) {
+  grants_ = _grants;
+}
+
+registerWithObjectFactory("packed_cr_separable", Allocator,
+                          PackedCrSeparableAllocator, ALLOCATOR_ARGS);
@@ -0,0 +1,98 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "allocator/PackedRSeparableAllocator.h"
+
+#include <cassert>
+
+#include "arbiter/Arbiter.h"
+#include "factory/ObjectFactory.h"
+#include "util/Bitset.h"
+
+PackedRSeparableAllocator::PackedRSeparableAllocator(
+    const std::string& _name, const Component* _parent, u32 _numClients,
+    u32 _numResources, const nlohmann::json& _settings)
+    : Allocator(_name, _parent, _numClients, _numResources, _settings),
+      words_(packedWords()),
+      requests_(nullptr),
+      grants_(nullptr) {
+  // use vector to hold arbiter pointers
+  resourceArbiters_.resize(numResources_, nullptr);
+
+  // instantiate the resource arbiters
+  for (u32 r = 0; r < numResources_; r++) {
+    std::string name = "ArbiterR" + std::to_string(r);
+    resourceArbiters_[r] =
+        Arbiter::create(name, this, numClients_, _settings["resource_arbiter"]);
+    assert(resourceArbiters_[r]->supportsPacked());
+  }
+
+  // parse settings
+  slipLatch_ = _settings["slip_latch"].get<bool>();
+}
+
+PackedRSeparableAllocator::~PackedRSeparableAllocator() {
+  for (u32 r = 0; r < numResources_; r++) {
+    delete resourceArbiters_[r];
+  }
+}
+
+void PackedRSeparableAllocator::setRequest(u32 _client, u32 _resource,
+                                           bool* _request) {
+  assert(false);  // use setPackedRequests()
+}
+
+void PackedRSeparableAllocator::setMetadata(u32 _client, u32 _resource,
+                                            u64* _metadata) {
+  resourceArbiters_.at(_resource)->setMetadata(_client, _metadata);
+}
+
+void PackedRSeparableAllocator::setGrant(u32 _client, u32 _resource,
+                                         bool* _grant) {
+  assert(false);  // use setPackedGrants()
+}
+
+void PackedRSeparableAllocator::allocate() {
+  // run the resource arbiters
+  for (u32 r = 0; r < numResources_; r++) {
+    const u64* row = &requests_[r * words_];
+    u32 winningClient = U32_MAX;
+    if (bitsetAny(row, words_)) {
+      winningClient = resourceArbiters_[r]->arbitratePacked(row);
+      if (winningClient != U32_MAX) {
+        bitsetSet(&grants_[r * words_], winningClient);
+      }
+    }
+
+    // perform arbiter state latching
+    if (!slipLatch_ || winningClient != U32_MAX) {
+      resourceArbiters_[r]->latch();
+    }
+  }
+}
+
+bool PackedRSeparableAllocator::packed() const {
+  return true;
+}
+
+void PackedRSeparableAllocator::setPackedRequests(u64* _requests) {
+  requests_ = _requests;
+}
+
+void PackedRSeparableAllocator::setPackedGrants(u64* _grants) {
+  grants_ = _grants;
+}
+
+registerWithObjectFactory("packed_r_separable", Allocator,
+                          PackedRSeparableAllocator, ALLOCATOR_ARGS);
@@ -0,0 +1,153 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "allocator/PackedRcSeparableAllocator.h"
+
+#include <cassert>
+
+#include "arbiter/Arbiter.h"
+#include "factory/ObjectFactory.h"
+#include "util/Bitset.h"
+
+PackedRcSeparableAllocator::PackedRcSeparableAllocator(
+    const std::string& _name, const Component* _parent, u32 _numClients,
+    u32 _numResources, const nlohmann::json& _settings)
+    : Allocator(_name, _parent, _numClients, _numResources, _settings),
+      clientWords_(packedWords()),
+      resourceWords_(bitsetWords(_numResources)),
+      requests_(nullptr),
+      grants_(nullptr) {
+  // packed arrays
+  intermediates_.resize(numClients_ * resourceWords_, 0);
+
+  // use vector to hold arbiter pointers
+  resourceArbiters_.resize(numResources_, nullptr);
+  clientArbiters_.resize(numClients_, nullptr);
+
+  // instantiate the resource arbiters
+  for (u32 r = 0; r < numResources_; r++) {
+    std::string name = "ArbiterR" + std::to_string(r);
+    resourceArbiters_[r] =
+        Arbiter::create(name, this, numClients_, _settings["resource_arbiter"]);
+    assert(resourceArbiters_[r]->supportsPacked());
+  }
+
+  // instantiate the client arbiters
+  for (u32 c = 0; c < numClients_; c++) {
+    std::string name = "ArbiterC" + std::to_string(c);
+    clientArbiters_[c] =
+        Arbiter::create(name, this, numResources_, _settings["client_arbiter"]);
+    assert(clientArbiters_[c]->supportsPacked());
+  }
+
+  // parse settings
+  iterations_ = _settings["iterations"].get<u32>();
+  assert(iterations_ > 0);
+  slipLatch_ = _settings["slip_latch"].get<bool>();
+}
+
+PackedRcSeparableAllocator::~PackedRcSeparableAllocator() {
+  for (u32 r = 0; r < numResources_; r++) {
+    delete resourceArbiters_[r];
+  }
+  for (u32 c = 0; c < numClients_; c++) {
+    delete clientArbiters_[c];
+  }
+}
+
+void PackedRcSeparableAllocator::setRequest(u32 _client, u32 _resource,
+                                            bool* _request) {
+  assert(false);  // use setPackedRequests()
+}
+
+void PackedRcSeparableAllocator::setMetadata(u32 _client, u32 _resource,
+                                             u64* _metadata) {
+  resourceArbiters_.at(_resource)->setMetadata(_client, _metadata);
+  clientArbiters_.at(_client)->setMetadata(_resource, _metadata);
+}
+
+void PackedRcSeparableAllocator::setGrant(u32 _client, u32 _resource,
+                                          bool* _grant) {
+  assert(false);  // use setPackedGrants()
+}
+
+void PackedRcSeparableAllocator::allocate() {
+  for (u32 remaining = iterations_; remaining > 0; remaining--) {
+    // clear the intermediate stage
+    bitsetClearAll(intermediates_.data(), intermediates_.size());
+
+    // run the resource arbiters
+    for (u32 r = 0; r < numResources_; r++) {
+      const u64* row = &requests_[r * clientWords_];
+      if (bitsetAny(row, clientWords_)) {
+        u32 winningClient = resourceArbiters_[r]->arbitratePacked(row);
+        if (winningClient != U32_MAX) {
+          bitsetSet(&intermediates_[winningClient * resourceWords_], r);
+        }
+      }
+
+      // perform arbiter state latching
+      if (!slipLatch_) {
+        // regular latch always algorithm
+        resourceArbiters_[r]->latch();
+      }
+    }
+
+    // run the client arbiters
+    for (u32 c = 0; c < numClients_; c++) {
+      const u64* row = &intermediates_[c * resourceWords_];
+      u32 winningResource = U32_MAX;
+      if (bitsetAny(row, resourceWords_)) {
+        winningResource = clientArbiters_[c]->arbitratePacked(row);
+      }
+      if (winningResource != U32_MAX) {
+        bitsetSet(&grants_[winningResource * clientWords_], c);
+        // remove the requests from this client
+        for (u32 r = 0; r < numResources_; r++) {
+          bitsetClear(&requests_[r * clientWords_], c);
+        }
+        // remove the requests for this resource
+        bitsetClearAll(&requests_[winningResource * clientWords_],
+                       clientWords_);
+      }
+
+      // perform arbiter state latching
+      if (slipLatch_) {
+        // slip latching (iSLIP algorithm)
+        if (winningResource != U32_MAX) {
+          clientArbiters_[c]->latch();
+          resourceArbiters_[winningResource]->latch();
+        }
+      } else {
+        // regular latch always algorithm
+        clientArbiters_[c]->latch();
+      }
+    }
+  }
+}
+
+bool PackedRcSeparableAllocator::packed() const {
+  return true;
+}
+
+void PackedRcSeparableAllocator::setPackedRequests(u64* _requests) {
+  requests_ = _requests;
+}
+
+void PackedRcSeparableAllocator::setPackedGrants(u64* _grants) {
+  grants_ = _grants;
+}
+
+registerWithObjectFactory("packed_rc_separable", Allocator,
+                          PackedRcSeparableAllocator, ALLOCATOR_ARGS);
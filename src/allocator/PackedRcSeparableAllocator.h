@@ -0,0 +1,58 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef ALLOCATOR_PACKEDRCSEPARABLEALLOCATOR_H_
+#define ALLOCATOR_PACKEDRCSEPARABLEALLOCATOR_H_
+
+#include <string>
+#include <vector>
+
+#include "allocator/Allocator.h"
+#include "arbiter/Arbiter.h"
+#include "event/Component.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+
+// this is the RcSeparableAllocator operating on packed request and grant rows
+class PackedRcSeparableAllocator : public Allocator {
+ public:
+  PackedRcSeparableAllocator(const std::string& _name, const Component* _parent,
+                             u32 _numClients, u32 _numResources,
+                             const nlohmann::json& _settings);
+  ~PackedRcSeparableAllocator();
+
+  void setRequest(u32 _client, u32 _resource, bool* _request) override;
+  void setMetadata(u32 _client, u32 _resource, u64* _metadata) override;
+  void setGrant(u32 _client, u32 _resource, bool* _grant) override;
+  void allocate() override;
+
+  bool packed() const override;
+  void setPackedRequests(u64* _requests) override;
+  void setPackedGrants(u64* _grants) override;
+
+ private:
+  std::vector<Arbiter*> resourceArbiters_;
+  std::vector<Arbiter*> clientArbiters_;
+
+  const u32 clientWords_;    // words per resource row (bits are clients)
+  const u32 resourceWords_;  // words per client row (bits are resources)
+  u64* requests_;
+  std::vector<u64> intermediates_;  // client rows
+  u64* grants_;
+
+  u32 iterations_;
+  bool slipLatch_;  // iSLIP selective priority latching
+};
+
+#endif  // ALLOCATOR_PACKEDRCSEPARABLEALLOCATOR_H_
@@ -0,0 +1,189 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "allocator/PackedWavefrontAllocator.h"
+
+#include <cassert>
+
+#include "event/Simulator.h"
+#include "factory/ObjectFactory.h"
+#include "util/Bitset.h"
+
+PackedWavefrontAllocator::PackedWavefrontAllocator(
+    const std::string& _name, const Component* _parent, u32 _numClients,
+    u32 _numResources, const nlohmann::json& _settings)
+    : Allocator(_name, _parent, _numClients, _numResources, _settings),
+      clientWords_(packedWords()),
+      requests_(nullptr),
+      grants_(nullptr) {
+  // shape
+  if (numClients_ > numResources_) {
+    rows_ = numClients_;
+    cols_ = numResources_;
+  } else {
+    rows_ = numResources_;
+    cols_ = numClients_;
+  }
+  colWords_ = bitsetWords(cols_);
+
+  // priority scheme
+  std::string scheme = _settings["scheme"].get<std::string>();
+  if (scheme == "sequential") {
+    scheme_ = PackedWavefrontAllocator::PriorityScheme::kSequential;
+  } else if (scheme == "random") {
+    scheme_ = PackedWavefrontAllocator::PriorityScheme::kRandom;
+  } else {
+    fprintf(stderr, "invalid wavefront priority scheme: %s\n", scheme.c_str());
+    assert(false);
+  }
+
+  // packed arrays, the row grant window may read one word past the end
+  diagonals_.resize(rows_ * colWords_, 0);
+  colGrants_.resize(colWords_, 0);
+  rowGrants_.resize(bitsetWords(2 * rows_) + 1, 0);
+
+  // init priority state
+  startingLine_ = gSim->rnd.nextU64(0, rows_ - 1);
+}
+
+PackedWavefrontAllocator::~PackedWavefrontAllocator() {}
+
+void PackedWavefrontAllocator::setRequest(u32 _client, u32 _resource,
+                                          bool* _request) {
+  assert(false);  // use setPackedRequests()
+}
+
+void PackedWavefrontAllocator::setMetadata(u32 _client, u32 _resource,
+                                           u64* _metadata) {}
+
+void PackedWavefrontAllocator::setGrant(u32 _client, u32 _resource,
+                                        bool* _grant) {
+  assert(false);  // use setPackedGrants()
+}
+
+void PackedWavefrontAllocator::allocate() {
+  // regroup the requests by diagonal
+  bitsetClearAll(diagonals_.data(), diagonals_.size());
+  u32 numRequests = 0;
+  for (u32 resource = 0; resource < numResources_; resource++) {
+    const u64* row = &requests_[resource * clientWords_];
+    for (u32 w = 0; w < clientWords_; w++) {
+      for (u64 word = row[w]; word != 0; word &= word - 1) {
+        u32 client = (w * 64) + __builtin_ctzll(word);
+        u32 row, col;
+        toRowCol(client, resource, &row, &col);
+        u32 line = (row + col) % rows_;
+        bitsetSet(&diagonals_[line * colWords_], col);
+        numRequests++;
+      }
+    }
+  }
+
+  // reset the grant vectors
+  bitsetClearAll(colGrants_.data(), colGrants_.size());
+  bitsetClearAll(rowGrants_.data(), rowGrants_.size());
+
+  // perform wavefront allocation, at most one grant per column
+  u32 remaining = numRequests < cols_ ? numRequests : cols_;
+  for (u32 rOffset = 0; rOffset < rows_ && remaining > 0; rOffset++) {
+    u32 line = (startingLine_ + rOffset) % rows_;
+    const u64* diagonal = &diagonals_[line * colWords_];
+
+    // the row of column 'col' on this line is found at bit 'start + col' of
+    //  the reversed and duplicated row grants
+    u32 start = rows_ - 1 - line;
+
+    for (u32 w = 0; w < colWords_; w++) {
+      // grant all requests whose column and row are still free
+      u64 granted = diagonal[w] & ~colGrants_[w] & ~rowGrantWindow(start, w);
+      colGrants_[w] |= granted;
+
+      // mark the rows and deliver the grants
+      for (; granted != 0; granted &= granted - 1) {
+        u32 col = (w * 64) + __builtin_ctzll(granted);
+        u32 row = toRow(line, col);
+        bitsetSet(rowGrants_.data(), rows_ - 1 - row);
+        bitsetSet(rowGrants_.data(), 2 * rows_ - 1 - row);
+        u32 client, resource;
+        toClientResource(row, col, &client, &resource);
+        bitsetSet(&grants_[resource * clientWords_], client);
+        remaining--;
+      }
+    }
+  }
+
+  // update the row for the allocation
+  switch (scheme_) {
+    case PackedWavefrontAllocator::PriorityScheme::kSequential:
+      startingLine_ = (startingLine_ + 1) % rows_;
+      break;
+    case PackedWavefrontAllocator::PriorityScheme::kRandom:
+      startingLine_ = gSim->rnd.nextU64(0, rows_ - 1);
+      break;
+    default:
+      assert(false);
+  }
+}
+
+bool PackedWavefrontAllocator::packed() const {
+  return true;
+}
+
+void PackedWavefrontAllocator::setPackedRequests(u64* _requests) {
+  requests_ = _requests;
+}
+
+void PackedWavefrontAllocator::setPackedGrants(u64* _grants) {
+  grants_ = _grants;
+}
+
+void PackedWavefrontAllocator::toRowCol(u32 _client, u32 _resource, u32* _row,
+                                        u32* _col) const {
+  if (numClients_ > numResources_) {
+    *_row = _client;
+    *_col = _resource;
+  } else {
+    *_row = _resource;
+    *_col = _client;
+  }
+}
+
+void PackedWavefrontAllocator::toClientResource(u32 _row, u32 _col,
+                                                u32* _client,
+                                                u32* _resource) const {
+  if (numClients_ > numResources_) {
+    *_client = _row;
+    *_resource = _col;
+  } else {
+    *_resource = _row;
+    *_client = _col;
+  }
+}
+
+u32 PackedWavefrontAllocator::toRow(u32 _line, u32 _col) const {
+  return (_col > _line) ? (_line + rows_ - _col) : (_line - _col);
+}
+
+u64 PackedWavefrontAllocator::rowGrantWindow(u32 _start, u32 _word) const {
+  u32 base = (_start / 64) + _word;
+  u32 shift = _start % 64;
+  if (shift == 0) {
+    return rowGrants_[base];
+  } else {
+    return (rowGrants_[base] >> shift) | (rowGrants_[base + 1] << (64 - shift));
+  }
+}
+
+registerWithObjectFactory("packed_wavefront", Allocator,
+                          PackedWavefrontAllocator, ALLOCATOR_ARGS);
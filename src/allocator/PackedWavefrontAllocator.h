@@ -0,0 +1,76 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef ALLOCATOR_PACKEDWAVEFRONTALLOCATOR_H_
+#define ALLOCATOR_PACKEDWAVEFRONTALLOCATOR_H_
+
+#include <string>
+#include <vector>
+
+#include "allocator/Allocator.h"
+#include "event/Component.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+
+/*
+ * This is the WavefrontAllocator operating on packed request and grant rows.
+ *  The requests are regrouped by diagonal so that each diagonal of the
+ *  wavefront is a bitset over the columns. The cells of a diagonal never
+ *  share a row or a column, therefore a whole word of a diagonal is granted
+ *  with one operation against the column and row grant masks. The row grant
+ *  mask is kept reversed and duplicated so the rows along any diagonal form
+ *  a contiguous window of bits.
+ */
+class PackedWavefrontAllocator : public Allocator {
+ public:
+  PackedWavefrontAllocator(const std::string& _name, const Component* _parent,
+                           u32 _numClients, u32 _numResources,
+                           const nlohmann::json& _settings);
+  ~PackedWavefrontAllocator();
+
+  void setRequest(u32 _client, u32 _resource, bool* _request) override;
+  void setMetadata(u32 _client, u32 _resource, u64* _metadata) override;
+  void setGrant(u32 _client, u32 _resource, bool* _grant) override;
+  void allocate() override;
+
+  bool packed() const override;
+  void setPackedRequests(u64* _requests) override;
+  void setPackedGrants(u64* _grants) override;
+
+ private:
+  enum class PriorityScheme { kSequential, kRandom };
+
+  void toRowCol(u32 _client, u32 _resource, u32* _row, u32* _col) const;
+  void toClientResource(u32 _row, u32 _col, u32* _client,
+                        u32* _resource) const;
+  u32 toRow(u32 _line, u32 _col) const;
+  // returns word '_word' of the row grant window starting at bit '_start'
+  u64 rowGrantWindow(u32 _start, u32 _word) const;
+
+  const u32 clientWords_;
+  u64* requests_;
+  u64* grants_;
+
+  u32 rows_;
+  u32 cols_;
+  u32 colWords_;
+  PriorityScheme scheme_;
+
+  std::vector<u64> diagonals_;  // rows_ lines of colWords_ words
+  std::vector<u64> colGrants_;
+  std::vector<u64> rowGrants_;  // bit (rows_ - 1 - row) and its duplicate
+  u32 startingLine_;
+};
+
+#endif  // ALLOCATOR_PACKEDWAVEFRONTALLOCATOR_H_
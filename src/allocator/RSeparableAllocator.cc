@@ -22,13 +22,8 @@
 RSeparableAllocator::RSeparableAllocator(const std::string& _name,
                                          const Component* _parent,
                                          u32 _numClients, u32 _numResources,
-                                         nlohmann::json _settings)
+                                         const nlohmann::json& _settings)
     : Allocator(_name, _parent, _numClients, _numResources, _settings) {
-  // pointer arrays
-  requests_.resize(numClients_ * numResources_, nullptr);
-  metadatas_.resize(numClients_ * numResources_, nullptr);
-  grants_.resize(numClients_ * numResources_, nullptr);
-
   // use vector to hold arbiter pointers
   resourceArbiters_.resize(numResources_, nullptr);
 
@@ -51,21 +46,36 @@ RSeparableAllocator::~RSeparableAllocator() {
 
 void RSeparableAllocator::setRequest(u32 _client, u32 _resource,
                                      bool* _request) {
-  requests_.at(index(_client, _resource)) = _request;
   resourceArbiters_.at(_resource)->setRequest(_client, _request);
 }
 
 void RSeparableAllocator::setMetadata(u32 _client, u32 _resource,
                                       u64* _metadata) {
-  metadatas_.at(index(_client, _resource)) = _metadata;
   resourceArbiters_.at(_resource)->setMetadata(_client, _metadata);
 }
 
 void RSeparableAllocator::setGrant(u32 _client, u32 _resource, bool* _grant) {
-  grants_.at(index(_client, _resource)) = _grant;
   resourceArbiters_.at(_resource)->setGrant(_client, _grant);
 }
 
+void RSeparableAllocator::setRequests(bool* _requests) {
+  for (u32 r = 0; r < numResources_; r++) {
+    resourceArbiters_[r]->setRequests(&_requests[r], numResources_);
+  }
+}
+
+void RSeparableAllocator::setMetadatas(u64* _metadatas) {
+  for (u32 r = 0; r < numResources_; r++) {
+    resourceArbiters_[r]->setMetadatas(&_metadatas[r], numResources_);
+  }
+}
+
+void RSeparableAllocator::setGrants(bool* _grants) {
+  for (u32 r = 0; r < numResources_; r++) {
+    resourceArbiters_[r]->setGrants(&_grants[r], numResources_);
+  }
+}
+
 void RSeparableAllocator::allocate() {
   // run the resource arbiters
   for (u32 r = 0; r < numResources_; r++) {
@@ -78,9 +88,5 @@ void RSeparableAllocator::allocate() {
   }
 }
 
-u64 RSeparableAllocator::index(u64 _client, u64 _resource) const {
-  return (numClients_ * _resource) + _client;
-}
-
 registerWithObjectFactory("r_separable", Allocator, RSeparableAllocator,
                           ALLOCATOR_ARGS);
@@ -28,24 +28,22 @@ class RSeparableAllocator : public Allocator {
  public:
   RSeparableAllocator(const std::string& _name, const Component* _parent,
                       u32 _numClients, u32 _numResources,
-                      nlohmann::json _settings);
+                      const nlohmann::json& _settings);
   ~RSeparableAllocator();
 
   void setRequest(u32 _client, u32 _resource, bool* _request) override;
   void setMetadata(u32 _client, u32 _resource, u64* _metadata) override;
   void setGrant(u32 _client, u32 _resource, bool* _grant) override;
+  void setRequests(bool* _requests) override;
+  void setMetadatas(u64* _metadatas) override;
+  void setGrants(bool* _grants) override;
   void allocate() override;
 
  private:
+  // the resource arbiters hold the only mapping of requests and grants
   std::vector<Arbiter*> resourceArbiters_;
 
-  std::vector<bool*> requests_;
-  std::vector<u64*> metadatas_;
-  std::vector<bool*> grants_;
-
   bool slipLatch_;  // iSLIP selective priority latching
-
-  u64 index(u64 _client, u64 _resource) const;
 };
 
 #endif  // ALLOCATOR_RSEPARABLEALLOCATOR_H_
@@ -45,6 +45,7 @@ TEST(RSeparableAllocator, greater) {
 
   // test
   AllocatorTest(allocSettings, nullptr, true);
+  AllocatorMappingTest(allocSettings);
 }
 
 TEST(RSeparableAllocator, lesser) {
@@ -22,13 +22,11 @@
 RcSeparableAllocator::RcSeparableAllocator(const std::string& _name,
                                            const Component* _parent,
                                            u32 _numClients, u32 _numResources,
-                                           nlohmann::json _settings)
-    : Allocator(_name, _parent, _numClients, _numResources, _settings) {
-  // pointer arrays
-  requests_.resize(numClients_ * numResources_, nullptr);
-  metadatas_.resize(numClients_ * numResources_, nullptr);
+                                           const nlohmann::json& _settings)
+    : Allocator(_name, _parent, _numClients, _numResources, _settings),
+      requests_(_numClients * _numResources) {
+  // intermediate signals
   intermediates_ = new bool[numClients_ * numResources_];
-  grants_.resize(numClients_ * numResources_, nullptr);
 
   // use vector to hold arbiter pointers
   resourceArbiters_.resize(numResources_, nullptr);
@@ -50,11 +48,11 @@ RcSeparableAllocator::RcSeparableAllocator(const std::string& _name,
 
   // map intermediate request signals to arbiters
   for (u32 r = 0; r < numResources_; r++) {
-    for (u32 c = 0; c < numClients_; c++) {
-      bool* i = &intermediates_[index(c, r)];
-      resourceArbiters_[r]->setGrant(c, i);
-      clientArbiters_[c]->setRequest(r, i);
-    }
+    resourceArbiters_[r]->setGrants(&intermediates_[index(0, r)],
+                                    numResources_);
+  }
+  for (u32 c = 0; c < numClients_; c++) {
+    clientArbiters_[c]->setRequests(&intermediates_[index(c, 0)], 1);
   }
 
   // parse settings
@@ -75,22 +73,43 @@ RcSeparableAllocator::~RcSeparableAllocator() {
 
 void RcSeparableAllocator::setRequest(u32 _client, u32 _resource,
                                       bool* _request) {
-  requests_.at(index(_client, _resource)) = _request;
+  requests_.set(index(_client, _resource), _request);
   resourceArbiters_.at(_resource)->setRequest(_client, _request);
 }
 
 void RcSeparableAllocator::setMetadata(u32 _client, u32 _resource,
                                        u64* _metadata) {
-  metadatas_.at(index(_client, _resource)) = _metadata;
   resourceArbiters_.at(_resource)->setMetadata(_client, _metadata);
   clientArbiters_.at(_client)->setMetadata(_resource, _metadata);
 }
 
 void RcSeparableAllocator::setGrant(u32 _client, u32 _resource, bool* _grant) {
-  grants_.at(index(_client, _resource)) = _grant;
   clientArbiters_.at(_client)->setGrant(_resource, _grant);
 }
 
+void RcSeparableAllocator::setRequests(bool* _requests) {
+  requests_.setAll(_requests, 1);
+  for (u32 r = 0; r < numResources_; r++) {
+    resourceArbiters_[r]->setRequests(&_requests[index(0, r)], numResources_);
+  }
+}
+
+void RcSeparableAllocator::setMetadatas(u64* _metadatas) {
+  for (u32 r = 0; r < numResources_; r++) {
+    resourceArbiters_[r]->setMetadatas(&_metadatas[index(0, r)],
+                                       numResources_);
+  }
+  for (u32 c = 0; c < numClients_; c++) {
+    clientArbiters_[c]->setMetadatas(&_metadatas[index(c, 0)], 1);
+  }
+}
+
+void RcSeparableAllocator::setGrants(bool* _grants) {
+  for (u32 c = 0; c < numClients_; c++) {
+    clientArbiters_[c]->setGrants(&_grants[index(c, 0)], 1);
+  }
+}
+
 void RcSeparableAllocator::allocate() {
   for (u32 remaining = iterations_; remaining > 0; remaining--) {
     // clear the intermediate stage
@@ -141,7 +160,8 @@ void RcSeparableAllocator::allocate() {
 }
 
 u64 RcSeparableAllocator::index(u64 _client, u64 _resource) const {
-  return (numClients_ * _resource) + _client;
+  // this matches the order in which the schedulers map their requests
+  return (numResources_ * _client) + _resource;
 }
 
 registerWithObjectFactory("rc_separable", Allocator, RcSeparableAllocator,
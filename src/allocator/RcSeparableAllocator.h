@@ -23,27 +23,30 @@
 #include "event/Component.h"
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
+#include "util/PointerTable.h"
 
 class RcSeparableAllocator : public Allocator {
  public:
   RcSeparableAllocator(const std::string& _name, const Component* _parent,
                        u32 _numClients, u32 _numResources,
-                       nlohmann::json _settings);
+                       const nlohmann::json& _settings);
   ~RcSeparableAllocator();
 
   void setRequest(u32 _client, u32 _resource, bool* _request) override;
   void setMetadata(u32 _client, u32 _resource, u64* _metadata) override;
   void setGrant(u32 _client, u32 _resource, bool* _grant) override;
+  void setRequests(bool* _requests) override;
+  void setMetadatas(u64* _metadatas) override;
+  void setGrants(bool* _grants) override;
   void allocate() override;
 
  private:
   std::vector<Arbiter*> resourceArbiters_;
   std::vector<Arbiter*> clientArbiters_;
 
-  std::vector<bool*> requests_;
-  std::vector<u64*> metadatas_;
+  // the arbiters hold the mapping of metadata and grants
+  PointerTable<bool> requests_;
   bool* intermediates_;
-  std::vector<bool*> grants_;
 
   u32 iterations_;
   bool slipLatch_;  // iSLIP selective priority latching
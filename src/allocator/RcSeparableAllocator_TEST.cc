@@ -51,6 +51,7 @@ TEST(RcSeparableAllocator, greater) {
   // test
   AllocatorTest(allocSettings, nullptr, false);
   AllocatorLoadBalanceTest(allocSettings);
+  AllocatorMappingTest(allocSettings);
 }
 
 TEST(RcSeparableAllocator, lesser) {
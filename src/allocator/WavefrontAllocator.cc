@@ -22,12 +22,10 @@
 WavefrontAllocator::WavefrontAllocator(const std::string& _name,
                                        const Component* _parent,
                                        u32 _numClients, u32 _numResources,
-                                       nlohmann::json _settings)
-    : Allocator(_name, _parent, _numClients, _numResources, _settings) {
-  // pointer vectors
-  requests_.resize(numClients_ * numResources_, nullptr);
-  grants_.resize(numClients_ * numResources_, nullptr);
-
+                                       const nlohmann::json& _settings)
+    : Allocator(_name, _parent, _numClients, _numResources, _settings),
+      requests_(_numClients * _numResources),
+      grants_(_numClients * _numResources) {
   // shape
   if (numClients_ > numResources_) {
     rows_ = numClients_;
@@ -60,18 +58,24 @@ WavefrontAllocator::~WavefrontAllocator() {}
 
 void WavefrontAllocator::setRequest(u32 _client, u32 _resource,
                                     bool* _request) {
-  u32 row, col;
-  toRowCol(_client, _resource, &row, &col);
-  requests_[toIndex(row, col)] = _request;
+  requests_.set(index(_client, _resource), _request);
 }
 
 void WavefrontAllocator::setMetadata(u32 _client, u32 _resource,
                                      u64* _metadata) {}
 
 void WavefrontAllocator::setGrant(u32 _client, u32 _resource, bool* _grant) {
-  u32 row, col;
-  toRowCol(_client, _resource, &row, &col);
-  grants_[toIndex(row, col)] = _grant;
+  grants_.set(index(_client, _resource), _grant);
+}
+
+void WavefrontAllocator::setRequests(bool* _requests) {
+  requests_.setAll(_requests, 1);
+}
+
+void WavefrontAllocator::setMetadatas(u64* _metadatas) {}
+
+void WavefrontAllocator::setGrants(bool* _grants) {
+  grants_.setAll(_grants, 1);
 }
 
 void WavefrontAllocator::allocate() {
@@ -100,8 +104,8 @@ void WavefrontAllocator::allocate() {
       u32 index = toIndex(row, col);
 
       // allocate if requested
-      if (*(requests_.at(index))) {
-        *(grants_.at(index)) = true;
+      if (*requests_[index]) {
+        *grants_[index] = true;
         colGrants_.at(col) = true;
         rowGrants_.at(row) = true;
       }
@@ -121,23 +125,17 @@ void WavefrontAllocator::allocate() {
   }
 }
 
-void WavefrontAllocator::toRowCol(u32 _client, u32 _resource, u32* _row,
-                                  u32* _col) const {
-  if (numClients_ > numResources_) {
-    *_row = _client;
-    *_col = _resource;
-  } else {
-    *_row = _resource;
-    *_col = _client;
-  }
+u32 WavefrontAllocator::index(u32 _client, u32 _resource) const {
+  // this matches the order in which the schedulers map their requests
+  return (_client * numResources_) + _resource;
 }
 
 u32 WavefrontAllocator::toIndex(u32 _row, u32 _col) const {
-  u32 line = (_row + _col) % rows_;
-  u32 base = line * cols_;
-  u32 index = base + _col;
-  assert(index < cols_ * rows_);  // REMOVE ME
-  return index;
+  if (numClients_ > numResources_) {
+    return index(_row, _col);
+  } else {
+    return index(_col, _row);
+  }
 }
 
 u32 WavefrontAllocator::toRow(u32 _line, u32 _col) const {
@@ -22,28 +22,32 @@
 #include "event/Component.h"
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
+#include "util/PointerTable.h"
 
 class WavefrontAllocator : public Allocator {
  public:
   WavefrontAllocator(const std::string& _name, const Component* _parent,
                      u32 _numClients, u32 _numResources,
-                     nlohmann::json _settings);
+                     const nlohmann::json& _settings);
   ~WavefrontAllocator();
 
   void setRequest(u32 _client, u32 _resource, bool* _request) override;
   void setMetadata(u32 _client, u32 _resource, u64* _metadata) override;
   void setGrant(u32 _client, u32 _resource, bool* _grant) override;
+  void setRequests(bool* _requests) override;
+  void setMetadatas(u64* _metadatas) override;
+  void setGrants(bool* _grants) override;
   void allocate() override;
 
  private:
   enum class PriorityScheme { kSequential, kRandom };
 
-  void toRowCol(u32 _client, u32 _resource, u32* _row, u32* _col) const;
+  u32 index(u32 _client, u32 _resource) const;
   u32 toIndex(u32 _row, u32 _col) const;
   u32 toRow(u32 _line, u32 _col) const;
 
-  std::vector<bool*> requests_;
-  std::vector<bool*> grants_;
+  PointerTable<bool> requests_;
+  PointerTable<bool> grants_;
 
   u32 rows_;
   u32 cols_;
@@ -41,4 +41,5 @@ TEST(WavefrontAllocator, random) {
   // test
   AllocatorTest(allocSettings, nullptr, false);
   AllocatorLoadBalanceTest(allocSettings);
+  AllocatorMappingTest(allocSettings);
 }
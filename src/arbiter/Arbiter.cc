@@ -19,18 +19,19 @@
 #include "factory/ObjectFactory.h"
 
 Arbiter::Arbiter(const std::string& _name, const Component* _parent, u32 _size,
-                 nlohmann::json _settings)
-    : Component(_name, _parent), size_(_size) {
+                 const nlohmann::json& _settings)
+    : Component(_name, _parent),
+      requests_(_size),
+      metadatas_(_size),
+      grants_(_size),
+      size_(_size) {
   assert(size_ > 0);
-  requests_.resize(size_, nullptr);
-  metadatas_.resize(size_, nullptr);
-  grants_.resize(size_, nullptr);
 }
 
 Arbiter::~Arbiter() {}
 
 Arbiter* Arbiter::create(const std::string& _name, const Component* _parent,
-                         u32 _size, nlohmann::json _settings) {
+                         u32 _size, const nlohmann::json& _settings) {
   // retrieve the arbiter type
   const std::string& type = _settings["type"].get<std::string>();
 
@@ -51,15 +52,37 @@ u32 Arbiter::size() const {
 }
 
 void Arbiter::setRequest(u32 _port, const bool* _request) {
-  requests_.at(_port) = _request;
+  requests_.set(_port, _request);
 }
 
 void Arbiter::setMetadata(u32 _port, const u64* _metadata) {
-  metadatas_.at(_port) = _metadata;
+  metadatas_.set(_port, _metadata);
 }
 
 void Arbiter::setGrant(u32 _port, bool* _grant) {
-  grants_.at(_port) = _grant;
+  grants_.set(_port, _grant);
+}
+
+void Arbiter::setRequests(const bool* _first, u32 _stride) {
+  requests_.setAll(_first, _stride);
+}
+
+void Arbiter::setMetadatas(const u64* _first, u32 _stride) {
+  metadatas_.setAll(_first, _stride);
+}
+
+void Arbiter::setGrants(bool* _first, u32 _stride) {
+  grants_.setAll(_first, _stride);
 }
 
 void Arbiter::latch() {}
+
+u32 Arbiter::arbitratePacked(const u64* _requests) {
+  fprintf(stderr, "%s does not support packed requests\n", fullName().c_str());
+  assert(false);
+  return U32_MAX;
+}
+
+bool Arbiter::supportsPacked() const {
+  return false;
+}
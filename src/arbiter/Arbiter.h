@@ -21,14 +21,16 @@
 #include "event/Component.h"
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
+#include "util/PointerTable.h"
 
-#define ARBITER_ARGS const std::string&, const Component*, u32, nlohmann::json
+#define ARBITER_ARGS \
+  const std::string&, const Component*, u32, const nlohmann::json&
 
 class Arbiter : public Component {
  public:
   // constructor
   Arbiter(const std::string& _name, const Component* _parent, u32 _size,
-          nlohmann::json _settings);
+          const nlohmann::json& _settings);
   virtual ~Arbiter();
 
   // this defines the arbiter factory
@@ -42,6 +44,10 @@ class Arbiter : public Component {
   virtual void setMetadata(u32 _port, const u64* _metadata);
   // maps the output to the specified port
   virtual void setGrant(u32 _port, bool* _grant);
+  // these map all ports at once, port 'p' is at (_first + (p * _stride))
+  virtual void setRequests(const bool* _first, u32 _stride);
+  virtual void setMetadatas(const u64* _first, u32 _stride);
+  virtual void setGrants(bool* _first, u32 _stride);
 
   // latches any state from the last cycle
   //  override when necessary
@@ -52,10 +58,20 @@ class Arbiter : public Component {
   //  returns the winner, or U32_MAX when nothing granted
   virtual u32 arbitrate() = 0;
 
+  // computes the arbitration logic on a packed request row where bit 'p' is
+  //  the request of port 'p', metadata is still taken from setMetadata()
+  //  no grants are set, returns the winner, or U32_MAX when nothing granted
+  //  this must consume random numbers exactly as arbitrate() does
+  //  override when supported
+  virtual u32 arbitratePacked(const u64* _requests);
+
+  // returns true when arbitratePacked() is supported
+  virtual bool supportsPacked() const;
+
  protected:
-  std::vector<const bool*> requests_;
-  std::vector<const u64*> metadatas_;
-  std::vector<bool*> grants_;
+  PointerTable<const bool> requests_;
+  PointerTable<const u64> metadatas_;
+  PointerTable<bool> grants_;
   const u32 size_;
 };
 
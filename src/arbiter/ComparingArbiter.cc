@@ -15,10 +15,11 @@
 #include "arbiter/ComparingArbiter.h"
 
 #include "factory/ObjectFactory.h"
+#include "util/Bitset.h"
 
 ComparingArbiter::ComparingArbiter(const std::string& _name,
                                    const Component* _parent, u32 _size,
-                                   nlohmann::json _settings)
+                                   const nlohmann::json& _settings)
     : Arbiter(_name, _parent, _size, _settings) {
   assert(_settings.contains("greater") && _settings["greater"].is_boolean());
   greater_ = _settings["greater"].get<bool>();
@@ -64,4 +65,38 @@ u32 ComparingArbiter::arbitrate() {
   return winner;
 }
 
+u32 ComparingArbiter::arbitratePacked(const u64* _requests) {
+  u32 words = bitsetWords(size_);
+  u64 best = greater_ ? 0 : U64_MAX;
+  for (u32 w = 0; w < words; w++) {
+    for (u64 word = _requests[w]; word != 0; word &= word - 1) {
+      u32 client = (w * 64) + __builtin_ctzll(word);
+      u64 cmeta = *metadatas_[client];
+      if (temp_.empty() || ((greater_) && (cmeta > best)) ||
+          ((!greater_) && (cmeta < best))) {
+        // first or new best
+        best = cmeta;
+        temp_.clear();
+        temp_.push_back(client);
+      } else if (cmeta == best) {
+        // match best
+        temp_.push_back(client);
+      }
+    }
+  }
+
+  // randomly choose winner from compared best set
+  u32 winner = U32_MAX;
+  if (temp_.size() > 0) {
+    u32 idx = gSim->rnd.nextU64(0, temp_.size() - 1);
+    winner = temp_.at(idx);
+  }
+  temp_.clear();
+  return winner;
+}
+
+bool ComparingArbiter::supportsPacked() const {
+  return true;
+}
+
 registerWithObjectFactory("comparing", Arbiter, ComparingArbiter, ARBITER_ARGS);
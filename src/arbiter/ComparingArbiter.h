@@ -27,10 +27,12 @@
 class ComparingArbiter : public Arbiter {
  public:
   ComparingArbiter(const std::string& _name, const Component* _parent,
-                   u32 _size, nlohmann::json _settings);
+                   u32 _size, const nlohmann::json& _settings);
   ~ComparingArbiter();
 
   u32 arbitrate() override;
+  u32 arbitratePacked(const u64* _requests) override;
+  bool supportsPacked() const override;
 
  private:
   bool greater_;
@@ -23,7 +23,7 @@
 DualStageClassArbiter::DualStageClassArbiter(const std::string& _name,
                                              const Component* _parent,
                                              u32 _size,
-                                             nlohmann::json _settings)
+                                             const nlohmann::json& _settings)
     : Arbiter(_name, _parent, _size, _settings) {
   // parse the classes settings to get stage 1 size and class assignments
   assert(_settings.contains("classes") &&
@@ -112,6 +112,16 @@ void DualStageClassArbiter::setGrant(u32 _client, bool* _grant) {
   stage2Arbiter_->setGrant(_client, grants_[_client]);
 }
 
+void DualStageClassArbiter::setMetadatas(const u64* _first, u32 _stride) {
+  Arbiter::setMetadatas(_first, _stride);
+  stage2Arbiter_->setMetadatas(_first, _stride);
+}
+
+void DualStageClassArbiter::setGrants(bool* _first, u32 _stride) {
+  Arbiter::setGrants(_first, _stride);
+  stage2Arbiter_->setGrants(_first, _stride);
+}
+
 void DualStageClassArbiter::latch() {
   stage1Arbiter_->latch();
   stage2Arbiter_->latch();
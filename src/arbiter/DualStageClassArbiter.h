@@ -28,11 +28,13 @@
 class DualStageClassArbiter : public Arbiter {
  public:
   DualStageClassArbiter(const std::string& _name, const Component* _parent,
-                        u32 _size, nlohmann::json _settings);
+                        u32 _size, const nlohmann::json& _settings);
   ~DualStageClassArbiter();
 
   void setMetadata(u32 _port, const u64* _metadata) override;
   void setGrant(u32 _port, bool* _grant) override;
+  void setMetadatas(const u64* _first, u32 _stride) override;
+  void setGrants(bool* _first, u32 _stride) override;
 
   void latch() override;
   u32 arbitrate() override;
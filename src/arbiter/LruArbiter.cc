@@ -19,7 +19,7 @@
 #include "factory/ObjectFactory.h"
 
 LruArbiter::LruArbiter(const std::string& _name, const Component* _parent,
-                       u32 _size, nlohmann::json _settings)
+                       u32 _size, const nlohmann::json& _settings)
     : Arbiter(_name, _parent, _size, _settings) {
   // create a random ordered priority list
   std::vector<u32> clients(size_);
@@ -27,7 +27,7 @@
 class LruArbiter : public Arbiter {
  public:
   LruArbiter(const std::string& _name, const Component* _parent, u32 _size,
-             nlohmann::json _settings);
+             const nlohmann::json& _settings);
   ~LruArbiter();
 
   void latch() override;
@@ -15,9 +15,10 @@
 #include "arbiter/LslpArbiter.h"
 
 #include "factory/ObjectFactory.h"
+#include "util/Bitset.h"
 
 LslpArbiter::LslpArbiter(const std::string& _name, const Component* _parent,
-                         u32 _size, nlohmann::json _settings)
+                         u32 _size, const nlohmann::json& _settings)
     : Arbiter(_name, _parent, _size, _settings) {
   nextPriority_ = gSim->rnd.nextU64(0, size_ - 1);
   latch();
@@ -43,4 +44,16 @@ u32 LslpArbiter::arbitrate() {
   return winner;
 }
 
+u32 LslpArbiter::arbitratePacked(const u64* _requests) {
+  u32 winner = bitsetNextCyclic(_requests, size_, priority_);
+  if (winner != U32_MAX) {
+    nextPriority_ = (winner + 1) % size_;
+  }
+  return winner;
+}
+
+bool LslpArbiter::supportsPacked() const {
+  return true;
+}
+
 registerWithObjectFactory("lslp", Arbiter, LslpArbiter, ARBITER_ARGS);
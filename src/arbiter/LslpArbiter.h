@@ -26,11 +26,13 @@
 class LslpArbiter : public Arbiter {
  public:
   LslpArbiter(const std::string& _name, const Component* _parent, u32 _size,
-              nlohmann::json _settings);
+              const nlohmann::json& _settings);
   ~LslpArbiter();
 
   void latch() override;
   u32 arbitrate() override;
+  u32 arbitratePacked(const u64* _requests) override;
+  bool supportsPacked() const override;
 
  private:
   u32 priority_;
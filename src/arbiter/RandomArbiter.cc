@@ -15,9 +15,10 @@
 #include "arbiter/RandomArbiter.h"
 
 #include "factory/ObjectFactory.h"
+#include "util/Bitset.h"
 
 RandomArbiter::RandomArbiter(const std::string& _name, const Component* _parent,
-                             u32 _size, nlohmann::json _settings)
+                             u32 _size, const nlohmann::json& _settings)
     : Arbiter(_name, _parent, _size, _settings) {
   temp_.reserve(size_);
 }
@@ -40,4 +41,19 @@ u32 RandomArbiter::arbitrate() {
   return winner;
 }
 
+u32 RandomArbiter::arbitratePacked(const u64* _requests) {
+  u32 words = bitsetWords(size_);
+  u32 count = bitsetCount(_requests, words);
+  u32 winner = U32_MAX;
+  if (count > 0) {
+    u32 idx = gSim->rnd.nextU64(0, count - 1);
+    winner = bitsetSelect(_requests, words, idx);
+  }
+  return winner;
+}
+
+bool RandomArbiter::supportsPacked() const {
+  return true;
+}
+
 registerWithObjectFactory("random", Arbiter, RandomArbiter, ARBITER_ARGS);
@@ -27,10 +27,12 @@
 class RandomArbiter : public Arbiter {
  public:
   RandomArbiter(const std::string& _name, const Component* _parent, u32 _size,
-                nlohmann::json _settings);
+                const nlohmann::json& _settings);
   ~RandomArbiter();
 
   u32 arbitrate() override;
+  u32 arbitratePacked(const u64* _requests) override;
+  bool supportsPacked() const override;
 
  private:
   std::vector<u32> temp_;
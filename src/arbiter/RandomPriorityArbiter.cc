@@ -19,7 +19,7 @@
 RandomPriorityArbiter::RandomPriorityArbiter(const std::string& _name,
                                              const Component* _parent,
                                              u32 _size,
-                                             nlohmann::json _settings)
+                                             const nlohmann::json& _settings)
     : Arbiter(_name, _parent, _size, _settings) {}
 
 RandomPriorityArbiter::~RandomPriorityArbiter() {}
@@ -26,7 +26,7 @@
 class RandomPriorityArbiter : public Arbiter {
  public:
   RandomPriorityArbiter(const std::string& _name, const Component* _parent,
-                        u32 _size, nlohmann::json _settings);
+                        u32 _size, const nlohmann::json& _settings);
   ~RandomPriorityArbiter();
 
   u32 arbitrate() override;
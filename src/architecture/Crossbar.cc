@@ -20,7 +20,7 @@
 
 Crossbar::Crossbar(const std::string& _name, const Component* _parent,
                    u32 _numInputs, u32 _numOutputs, Simulator::Clock _clock,
-                   nlohmann::json _settings)
+                   const nlohmann::json& _settings)
     : Component(_name, _parent),
       clock_(_clock),
       latency_(_settings["latency"].get<u32>()),
@@ -29,7 +29,8 @@
 class Crossbar : public Component {
  public:
   Crossbar(const std::string& _name, const Component* _parent, u32 _numInputs,
-           u32 _numOutputs, Simulator::Clock _clock, nlohmann::json _settings);
+           u32 _numOutputs, Simulator::Clock _clock,
+           const nlohmann::json& _settings);
   ~Crossbar();
   u32 numInputs() const;
   u32 numOutputs() const;
@@ -14,11 +14,13 @@
  */
 #include "architecture/CrossbarScheduler.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 
 #include "allocator/Allocator.h"
 #include "types/Packet.h"
+#include "util/Bitset.h"
 
 static bool warningIssued = false;
 
@@ -31,31 +33,17 @@ CrossbarScheduler::CrossbarScheduler(const std::string& _name,
                                      u32 _totalVcs, u32 _crossbarPorts,
                                      u32 _globalVcOffset,
                                      Simulator::Clock _clock,
-                                     nlohmann::json _settings)
+                                     const nlohmann::json& _settings)
     : Component(_name, _parent),
       numClients_(_numClients),
       totalVcs_(_totalVcs),
       crossbarPorts_(_crossbarPorts),
       globalVcOffset_(_globalVcOffset),
       clock_(_clock),
-      fullPacket_(_settings["full_packet"].get<bool>()),
-      packetLock_(_settings["packet_lock"].get<bool>()),
-      idleUnlock_(_settings["idle_unlock"].get<bool>()) {
-  assert(!_settings["full_packet"].is_null());
-  assert(!_settings["packet_lock"].is_null());
-  assert(!_settings["idle_unlock"].is_null());
-  if (!warningIssued && !fullPacket_ && packetLock_ && !idleUnlock_) {
-    printf(
-        "**************************************************************\n"
-        "** WARNING!!!!!!! Packet-Channel Flit-Buffer Flow Control   **\n"
-        "** causes deadlock if VCs are being used to avoid deadlock. **\n"
-        "**************************************************************\n");
-    warningIssued = true;
-  }
-  if (idleUnlock_) {
-    assert(packetLock_);
-  }
-
+      settings_(_settings),
+      fullPacket_(settings_->fullPacket),
+      packetLock_(settings_->packetLock),
+      idleUnlock_(settings_->idleUnlock) {
   assert(numClients_ > 0 && numClients_ != U32_MAX);
   assert(totalVcs_ > 0 && totalVcs_ != U32_MAX);
   assert(crossbarPorts_ > 0 && crossbarPorts_ != U32_MAX);
@@ -69,12 +57,7 @@ CrossbarScheduler::CrossbarScheduler(const std::string& _name,
   // create the credit counters
   credits_.resize(totalVcs_, 0);
   maxCredits_.resize(totalVcs_, 0);
-
-  // create arrays for allocator inputs and outputs
-  requests_ = new bool[crossbarPorts_ * numClients_];
-  memset(requests_, false, crossbarPorts_ * numClients_);
-  metadatas_ = new u64[crossbarPorts_ * numClients_];
-  grants_ = new bool[crossbarPorts_ * numClients_];
+  incrCredits_.resize(totalVcs_, 0);
 
   // create arrays for handling port locks
   anyRequests_.resize(crossbarPorts_, false);
@@ -83,24 +66,67 @@ CrossbarScheduler::CrossbarScheduler(const std::string& _name,
   // create the allocator
   allocator_ = Allocator::create("Allocator", this, numClients_, crossbarPorts_,
                                  _settings["allocator"]);
+  packed_ = allocator_->packed();
+  packedWords_ = allocator_->packedWords();
 
-  // map inputs and outputs to allocator
-  for (u32 c = 0; c < numClients_; c++) {
-    for (u32 p = 0; p < crossbarPorts_; p++) {
-      allocator_->setRequest(c, p, &requests_[index(c, p)]);
-      allocator_->setMetadata(c, p, &metadatas_[index(c, p)]);
-      allocator_->setGrant(c, p, &grants_[index(c, p)]);
-    }
+  // create arrays for allocator inputs and outputs
+  metadatas_ = new u64[crossbarPorts_ * numClients_];
+  if (packed_) {
+    requests_ = nullptr;
+    grants_ = nullptr;
+    packedRequests_ = new u64[crossbarPorts_ * packedWords_];
+    bitsetClearAll(packedRequests_, crossbarPorts_ * packedWords_);
+    packedGrants_ = new u64[crossbarPorts_ * packedWords_];
+    bitsetClearAll(packedGrants_, crossbarPorts_ * packedWords_);
+    allocator_->setPackedRequests(packedRequests_);
+    allocator_->setPackedGrants(packedGrants_);
+  } else {
+    requests_ = new bool[crossbarPorts_ * numClients_];
+    memset(requests_, false, crossbarPorts_ * numClients_);
+    grants_ = new bool[crossbarPorts_ * numClients_];
+    memset(grants_, false, crossbarPorts_ * numClients_);
+    packedRequests_ = nullptr;
+    packedGrants_ = nullptr;
+  }
+
+  // map inputs and outputs to allocator, the arrays are laid out as the
+  //  allocator expects them
+  if (!packed_) {
+    allocator_->setRequests(requests_);
+    allocator_->setGrants(grants_);
   }
+  allocator_->setMetadatas(metadatas_);
 
   // initialize state variables
   eventAction_ = EventAction::NONE;
 }
 
+CrossbarScheduler::Settings::Settings(const nlohmann::json& _settings)
+    : fullPacket(_settings["full_packet"].get<bool>()),
+      packetLock(_settings["packet_lock"].get<bool>()),
+      idleUnlock(_settings["idle_unlock"].get<bool>()) {
+  assert(!_settings["full_packet"].is_null());
+  assert(!_settings["packet_lock"].is_null());
+  assert(!_settings["idle_unlock"].is_null());
+  if (!warningIssued && !fullPacket && packetLock && !idleUnlock) {
+    printf(
+        "**************************************************************\n"
+        "** WARNING!!!!!!! Packet-Channel Flit-Buffer Flow Control   **\n"
+        "** causes deadlock if VCs are being used to avoid deadlock. **\n"
+        "**************************************************************\n");
+    warningIssued = true;
+  }
+  if (idleUnlock) {
+    assert(packetLock);
+  }
+}
+
 CrossbarScheduler::~CrossbarScheduler() {
   delete[] requests_;
   delete[] metadatas_;
   delete[] grants_;
+  delete[] packedRequests_;
+  delete[] packedGrants_;
   delete allocator_;
 }
 
@@ -135,10 +161,13 @@ void CrossbarScheduler::request(u32 _client, u32 _port, u32 _vcIdx,
   clientRequestPorts_[_client] = _port;
   clientRequestVcs_[_client] = _vcIdx;
   clientRequestFlits_[_client] = _flit;
-  anyRequests_[_port] = true;
-  u64 idx = index(_client, _port);
-  requests_[idx] = true;
-  metadatas_[idx] = _flit->packet()->getMetadata();
+  activeClients_.push_back(_client);
+  if (!anyRequests_[_port]) {
+    anyRequests_[_port] = true;
+    activePorts_.push_back(_port);
+  }
+  setRequest(_client, _port, true);
+  metadatas_[index(_client, _port)] = _flit->packet()->getMetadata();
 
   // upgrade event
   if (eventAction_ == EventAction::NONE) {
@@ -160,6 +189,9 @@ void CrossbarScheduler::incrementCredit(u32 _vcIdx) {
   assert(_vcIdx < totalVcs_);
 
   // add increment value to VC
+  if (incrCredits_[_vcIdx] == 0) {
+    incrCreditVcs_.push_back(_vcIdx);
+  }
   incrCredits_[_vcIdx]++;
 
   // upgrade event
@@ -187,112 +219,104 @@ void CrossbarScheduler::processEvent(void* _event, s32 _type) {
   assert(eventAction_ != EventAction::NONE);
 
   // apply all credit incrementations needed
-  for (auto it = incrCredits_.cbegin(); it != incrCredits_.cend(); ++it) {
-    u32 vc = it->first;
-    u32 incr = it->second;
-    assert(vc < totalVcs_);
-    credits_[vc] += incr;
+  for (u32 vc : incrCreditVcs_) {
+    credits_[vc] += incrCredits_[vc];
+    incrCredits_[vc] = 0;
     assert(credits_[vc] <= maxCredits_[vc]);
   }
-  incrCredits_.clear();
+  incrCreditVcs_.clear();
 
   // if required, run the allocator
   if (eventAction_ == EventAction::RUNALLOC) {
+    // only the clients that requested are visited, in client order
+    std::sort(activeClients_.begin(), activeClients_.end());
+
     // check credit counts for each request
     //  when credits aren't sufficient, disable the request
-    for (u32 c = 0; c < numClients_; c++) {
-      if (clientRequestPorts_[c] != U32_MAX) {
-        u32 port = clientRequestPorts_[c];
-        u32 vc = clientRequestVcs_[c];
-        u64 idx = index(c, port);
-
-        if (fullPacket_) {
-          // packet-buffer flow control
-          const Flit* flit = clientRequestFlits_[c];
-          if (flit->isHead()) {
-            u32 packetSize = flit->packet()->numFlits();
-            assert(maxCredits_[vc] >= packetSize);  // buffer is large enough
-            if (requests_[idx] && credits_[vc] < packetSize) {
-              requests_[idx] = false;
-            }
-          }
-        } else {
-          // flit-buffer flow control
-          if (requests_[idx] && credits_[vc] == 0) {
-            requests_[idx] = false;
+    for (u32 c : activeClients_) {
+      u32 port = clientRequestPorts_[c];
+      u32 vc = clientRequestVcs_[c];
+
+      if (fullPacket_) {
+        // packet-buffer flow control
+        const Flit* flit = clientRequestFlits_[c];
+        if (flit->isHead()) {
+          u32 packetSize = flit->packet()->numFlits();
+          assert(maxCredits_[vc] >= packetSize);  // buffer is large enough
+          if (getRequest(c, port) && credits_[vc] < packetSize) {
+            setRequest(c, port, false);
           }
         }
+      } else {
+        // flit-buffer flow control
+        if (getRequest(c, port) && credits_[vc] == 0) {
+          setRequest(c, port, false);
+        }
       }
     }
 
     if (packetLock_) {
       // perform the lock request filtering algorithm
-      for (u32 p = 0; p < crossbarPorts_; p++) {
-        // the lock has to be active and there must be at least one request
-        if (portLocks_[p] != U32_MAX && anyRequests_[p]) {
-          // retrieve the lock owner's info
-          u32 owner = portLocks_[p];
-          u32 ownerIndex = index(owner, p);
-
-          // determine if idle unlock is applicable
-          if (idleUnlock_ && !requests_[ownerIndex]) {
-            // the owner isn't requesting and idle unlock is enabled
-            //  disable the port lock
-            portLocks_[p] = U32_MAX;
-          }
+      //  only ports with at least one request are considered
+      for (u32 p : activePorts_) {
+        // determine if idle unlock is applicable
+        u32 owner = portLocks_[p];
+        if (owner != U32_MAX && idleUnlock_ && !getRequest(owner, p)) {
+          // the owner isn't requesting and idle unlock is enabled
+          //  disable the port lock
+          portLocks_[p] = U32_MAX;
+        }
+      }
 
-          // determine if the requests need to be deactivated
-          if (portLocks_[p] != U32_MAX) {
-            // deactivate other requests
-            for (u32 c = 0; c < numClients_; c++) {
-              if (c != owner) {
-                u32 otherIndex = index(c, p);
-                requests_[otherIndex] = false;
-              }
-            }
-          }
+      // deactivate requests to ports locked by other clients
+      for (u32 c : activeClients_) {
+        u32 port = clientRequestPorts_[c];
+        if (portLocks_[port] != U32_MAX && portLocks_[port] != c) {
+          setRequest(c, port, false);
         }
       }
     }
 
     // clear the any request vector
-    for (u32 p = 0; p < crossbarPorts_; p++) {
+    for (u32 p : activePorts_) {
       anyRequests_[p] = false;
     }
+    activePorts_.clear();
 
     // clear the grants (must do before allocate() call)
-    memset(grants_, false, sizeof(bool) * numClients_ * crossbarPorts_);
+    //  grants are only ever set where requests were made
+    for (u32 c : activeClients_) {
+      setGrant(c, clientRequestPorts_[c], false);
+    }
 
     // run the allocator
     allocator_->allocate();
 
     // deliver responses, reset requests, if required lock ports
-    for (u32 c = 0; c < numClients_; c++) {
-      if (clientRequestPorts_[c] != U32_MAX) {
-        u32 port = clientRequestPorts_[c];
-        clientRequestPorts_[c] = U32_MAX;
-        u32 vc = clientRequestVcs_[c];
-        clientRequestVcs_[c] = U32_MAX;
-        const Flit* flit = clientRequestFlits_[c];
-        clientRequestFlits_[c] = nullptr;
-        u64 idx = index(c, port);
-
-        u32 granted = U32_MAX;
-        if (grants_[idx]) {
-          granted = port;
-          assert(credits_[vc] > 0);
-
-          // if needed, lock the port
-          if (packetLock_) {
-            // handle port locking
-            portLocks_[port] = flit->isTail() ? U32_MAX : c;
-          }
+    for (u32 c : activeClients_) {
+      u32 port = clientRequestPorts_[c];
+      clientRequestPorts_[c] = U32_MAX;
+      u32 vc = clientRequestVcs_[c];
+      clientRequestVcs_[c] = U32_MAX;
+      const Flit* flit = clientRequestFlits_[c];
+      clientRequestFlits_[c] = nullptr;
+
+      u32 granted = U32_MAX;
+      if (getGrant(c, port)) {
+        granted = port;
+        assert(credits_[vc] > 0);
+
+        // if needed, lock the port
+        if (packetLock_) {
+          // handle port locking
+          portLocks_[port] = flit->isTail() ? U32_MAX : c;
         }
-        requests_[idx] = false;
-
-        clients_[c]->crossbarSchedulerResponse(granted, vc);
       }
+      setRequest(c, port, false);
+
+      clients_[c]->crossbarSchedulerResponse(granted, vc);
     }
+    activeClients_.clear();
   }
 
   // reset event
@@ -303,3 +327,43 @@ u64 CrossbarScheduler::index(u64 _client, u64 _port) const {
   // this indexing contiguously places resources
   return (crossbarPorts_ * _client) + _port;
 }
+
+bool CrossbarScheduler::getRequest(u32 _client, u32 _port) const {
+  if (packed_) {
+    return bitsetTest(&packedRequests_[_port * packedWords_], _client);
+  } else {
+    return requests_[index(_client, _port)];
+  }
+}
+
+void CrossbarScheduler::setRequest(u32 _client, u32 _port, bool _request) {
+  if (packed_) {
+    if (_request) {
+      bitsetSet(&packedRequests_[_port * packedWords_], _client);
+    } else {
+      bitsetClear(&packedRequests_[_port * packedWords_], _client);
+    }
+  } else {
+    requests_[index(_client, _port)] = _request;
+  }
+}
+
+bool CrossbarScheduler::getGrant(u32 _client, u32 _port) const {
+  if (packed_) {
+    return bitsetTest(&packedGrants_[_port * packedWords_], _client);
+  } else {
+    return grants_[index(_client, _port)];
+  }
+}
+
+void CrossbarScheduler::setGrant(u32 _client, u32 _port, bool _grant) {
+  if (packed_) {
+    if (_grant) {
+      bitsetSet(&packedGrants_[_port * packedWords_], _client);
+    } else {
+      bitsetClear(&packedGrants_[_port * packedWords_], _client);
+    }
+  } else {
+    grants_[index(_client, _port)] = _grant;
+  }
+}
@@ -16,7 +16,6 @@
 #define ARCHITECTURE_CROSSBARSCHEDULER_H_
 
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 #include "allocator/Allocator.h"
@@ -25,6 +24,7 @@
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
 #include "types/Flit.h"
+#include "util/SharedSettings.h"
 
 class CrossbarScheduler : public Component, public CreditWatcher {
  public:
@@ -48,7 +48,7 @@ class CrossbarScheduler : public Component, public CreditWatcher {
   CrossbarScheduler(const std::string& _name, const Component* _parent,
                     u32 _numClients, u32 _totalVcs, u32 _crossbarPorts,
                     u32 _globalVcOffset, Simulator::Clock _clock,
-                    nlohmann::json _settings);
+                    const nlohmann::json& _settings);
   ~CrossbarScheduler();
 
   // constant attributes
@@ -72,6 +72,13 @@ class CrossbarScheduler : public Component, public CreditWatcher {
   void processEvent(void* _event, s32 _type) override;
 
  private:
+  struct Settings {
+    explicit Settings(const nlohmann::json& _settings);
+    bool fullPacket;
+    bool packetLock;
+    bool idleUnlock;
+  };
+
   const u32 numClients_;
   const u32 totalVcs_;
   const u32 crossbarPorts_;
@@ -85,17 +92,31 @@ class CrossbarScheduler : public Component, public CreditWatcher {
 
   std::vector<u32> credits_;
   std::vector<u32> maxCredits_;
-  std::unordered_map<u32, u32> incrCredits_;
+  std::vector<u32> incrCredits_;  // pending increments per VC
+  std::vector<u32> incrCreditVcs_;  // VCs with pending increments
 
   bool* requests_;
   u64* metadatas_;
   bool* grants_;
 
+  // packed allocators use rows of bits per port instead of requests_ and
+  //  grants_
+  bool packed_;
+  u32 packedWords_;
+  u64* packedRequests_;
+  u64* packedGrants_;
+
   std::vector<bool> anyRequests_;  // someone has requested port
   std::vector<u32> portLocks_;     // output port locks
 
+  // the clients and ports with requests in the current cycle
+  std::vector<u32> activeClients_;
+  std::vector<u32> activePorts_;
+
   Allocator* allocator_;
 
+  // parsed once for all schedulers with the same settings
+  const SharedSettings<Settings> settings_;
   const bool fullPacket_;  // head packets need full packet downstream space
   const bool packetLock_;  // packets lock the channel
   const bool idleUnlock_;  // locks are deactivated when idle (others want)
@@ -105,6 +126,11 @@ class CrossbarScheduler : public Component, public CreditWatcher {
 
   // this creates an index for requests_, metadatas_, vcs_, and grants_
   u64 index(u64 _client, u64 _port) const;
+  // these access the request and grant of the client for the port
+  bool getRequest(u32 _client, u32 _port) const;
+  void setRequest(u32 _client, u32 _port, bool _request);
+  bool getGrant(u32 _client, u32 _port) const;
+  void setGrant(u32 _client, u32 _port, bool _grant);
 };
 
 #endif  // ARCHITECTURE_CROSSBARSCHEDULER_H_
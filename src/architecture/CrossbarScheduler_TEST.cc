@@ -82,9 +82,8 @@ class CrossbarSchedulerTestClient : public CrossbarScheduler::Client,
       u64 metadata = gSim->rnd.nextU64(1000, 2000 - 1);
 
       // we have to make a packet and flit to have some metadata
-      Packet* packet = new Packet(0, 1, nullptr);
-      Flit* flit = new Flit(0, true, true, packet);
-      packet->setFlit(0, flit);
+      Packet* packet = Packet::create(0, 1, nullptr);
+      Flit* flit = packet->getFlit(0);
       packet->setMetadata(metadata);
 
       // make the request
@@ -161,49 +160,52 @@ TEST(CrossbarScheduler, basic) {
       // packet-buffer flow control with packet interleaving
       std::make_tuple(true, false, false)};
 
-  for (auto style : styles) {
-    for (u32 C = 1; C < 16; C++) {
-      for (u32 P = 1; P < 16; P++) {
-        for (u32 Vd = 1; Vd < 4; Vd++) {
-          u32 V = P * Vd;
-
-          // setup
-          TestSetup testSetup(12, 12, 12, 12, 0x1234567890abcdf);
-          nlohmann::json arbSettings;
-          arbSettings["type"] = "random";
-          nlohmann::json allocSettings;
-          allocSettings["type"] = "r_separable";
-          allocSettings["resource_arbiter"] = arbSettings;
-          allocSettings["slip_latch"] = true;
-          nlohmann::json schSettings;
-          schSettings["allocator"] = allocSettings;
-          schSettings["full_packet"] = std::get<0>(style);
-          schSettings["packet_lock"] = std::get<1>(style);
-          schSettings["idle_unlock"] = std::get<2>(style);
-          CrossbarScheduler* xbarSch =
-              new CrossbarScheduler("XbarSch", nullptr, C, V, P, 0,
-                                    Simulator::Clock::ROUTER, schSettings);
-          assert(xbarSch->numClients() == C);
-          assert(xbarSch->totalVcs() == V);
-          assert(xbarSch->crossbarPorts() == P);
-          for (u32 v = 0; v < V; v++) {
-            xbarSch->initCredits(v, 3);
-          }
-
-          std::vector<CrossbarSchedulerTestClient*> clients(C);
-          for (u32 c = 0; c < C; c++) {
-            clients[c] = new CrossbarSchedulerTestClient(
-                c, xbarSch, V, P, Simulator::Clock::ROUTER, ALLOCS_PER_CLIENT);
-          }
-
-          // run the simulator
-          gSim->initialize();
-          gSim->simulate();
-
-          // tear down
-          delete xbarSch;
-          for (u32 c = 0; c < C; c++) {
-            delete clients[c];
+  for (const char* allocType : {"r_separable", "packed_r_separable"}) {
+    for (auto style : styles) {
+      for (u32 C = 1; C < 16; C++) {
+        for (u32 P = 1; P < 16; P++) {
+          for (u32 Vd = 1; Vd < 4; Vd++) {
+            u32 V = P * Vd;
+
+            // setup
+            TestSetup testSetup(12, 12, 12, 12, 0x1234567890abcdf);
+            nlohmann::json arbSettings;
+            arbSettings["type"] = "random";
+            nlohmann::json allocSettings;
+            allocSettings["type"] = allocType;
+            allocSettings["resource_arbiter"] = arbSettings;
+            allocSettings["slip_latch"] = true;
+            nlohmann::json schSettings;
+            schSettings["allocator"] = allocSettings;
+            schSettings["full_packet"] = std::get<0>(style);
+            schSettings["packet_lock"] = std::get<1>(style);
+            schSettings["idle_unlock"] = std::get<2>(style);
+            CrossbarScheduler* xbarSch =
+                new CrossbarScheduler("XbarSch", nullptr, C, V, P, 0,
+                                      Simulator::Clock::ROUTER, schSettings);
+            assert(xbarSch->numClients() == C);
+            assert(xbarSch->totalVcs() == V);
+            assert(xbarSch->crossbarPorts() == P);
+            for (u32 v = 0; v < V; v++) {
+              xbarSch->initCredits(v, 3);
+            }
+
+            std::vector<CrossbarSchedulerTestClient*> clients(C);
+            for (u32 c = 0; c < C; c++) {
+              clients[c] = new CrossbarSchedulerTestClient(
+                  c, xbarSch, V, P, Simulator::Clock::ROUTER,
+                  ALLOCS_PER_CLIENT);
+            }
+
+            // run the simulator
+            gSim->initialize();
+            gSim->simulate();
+
+            // tear down
+            delete xbarSch;
+            for (u32 c = 0; c < C; c++) {
+              delete clients[c];
+            }
           }
         }
       }
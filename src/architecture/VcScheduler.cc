@@ -14,10 +14,12 @@
  */
 #include "architecture/VcScheduler.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 
 #include "allocator/Allocator.h"
+#include "util/Bitset.h"
 
 VcScheduler::Client::Client() {}
 
@@ -27,7 +29,8 @@ const s32 kAllocEvent = 123;
 
 VcScheduler::VcScheduler(const std::string& _name, const Component* _parent,
                          u32 _numClients, u32 _totalVcs,
-                         Simulator::Clock _clock, nlohmann::json _settings)
+                         Simulator::Clock _clock,
+                         const nlohmann::json& _settings)
     : Component(_name, _parent),
       numClients_(_numClients),
       totalVcs_(_totalVcs),
@@ -38,29 +41,48 @@ VcScheduler::VcScheduler(const std::string& _name, const Component* _parent,
   // create Client pointers and requested flags
   clients_.resize(numClients_, nullptr);
   clientRequested_.resize(numClients_, false);
+  clientGrants_.resize(numClients_, U32_MAX);
 
-  // create the VC used flags
-  vcTaken_.resize(totalVcs_, false);
-
-  // create arrays for allocator inputs and outputs
-  requests_ = new bool[totalVcs_ * numClients_];
-  memset(requests_, 0, sizeof(bool) * totalVcs_ * numClients_);
-  metadatas_ = new u64[totalVcs_ * numClients_];
-  grants_ = new bool[totalVcs_ * numClients_];
+  // create the free VC bitset, all VCs start out free
+  vcFree_.resize(bitsetWords(totalVcs_), 0);
+  for (u32 v = 0; v < totalVcs_; v++) {
+    bitsetSet(vcFree_.data(), v);
+  }
 
   // create the allocator
   allocator_ = Allocator::create("Allocator", this, numClients_, totalVcs_,
                                  _settings["allocator"]);
+  packed_ = allocator_->packed();
+  packedWords_ = allocator_->packedWords();
 
-  // map inputs and outputs to allocator
-  for (u32 c = 0; c < numClients_; c++) {
-    for (u32 v = 0; v < totalVcs_; v++) {
-      allocator_->setRequest(c, v, &requests_[index(c, v)]);
-      allocator_->setMetadata(c, v, &metadatas_[index(c, v)]);
-      allocator_->setGrant(c, v, &grants_[index(c, v)]);
-    }
+  // create arrays for allocator inputs and outputs
+  metadatas_ = new u64[totalVcs_ * numClients_];
+  if (packed_) {
+    requests_ = nullptr;
+    grants_ = nullptr;
+    packedRequests_ = new u64[totalVcs_ * packedWords_];
+    bitsetClearAll(packedRequests_, totalVcs_ * packedWords_);
+    packedGrants_ = new u64[totalVcs_ * packedWords_];
+    bitsetClearAll(packedGrants_, totalVcs_ * packedWords_);
+    allocator_->setPackedRequests(packedRequests_);
+    allocator_->setPackedGrants(packedGrants_);
+  } else {
+    requests_ = new bool[totalVcs_ * numClients_];
+    memset(requests_, 0, sizeof(bool) * totalVcs_ * numClients_);
+    grants_ = new bool[totalVcs_ * numClients_];
+    memset(grants_, 0, sizeof(bool) * totalVcs_ * numClients_);
+    packedRequests_ = nullptr;
+    packedGrants_ = nullptr;
   }
 
+  // map inputs and outputs to allocator, the arrays are laid out as the
+  //  allocator expects them
+  if (!packed_) {
+    allocator_->setRequests(requests_);
+    allocator_->setGrants(grants_);
+  }
+  allocator_->setMetadatas(metadatas_);
+
   // initialize state variables
   allocEventSet_ = false;
 }
@@ -69,6 +91,8 @@ VcScheduler::~VcScheduler() {
   delete[] requests_;
   delete[] metadatas_;
   delete[] grants_;
+  delete[] packedRequests_;
+  delete[] packedGrants_;
   delete allocator_;
 }
 
@@ -91,10 +115,15 @@ void VcScheduler::request(u32 _client, u32 _vcIdx, u64 _metadata) {
   assert(_vcIdx < totalVcs_);
 
   // set the request
-  u64 idx = index(_client, _vcIdx);
-  requests_[idx] = true;
-  metadatas_[idx] = _metadata;
-  clientRequested_[_client] = true;
+  if (!getRequest(_client, _vcIdx)) {
+    setRequest(_client, _vcIdx, true);
+    activeRequests_.push_back(std::make_pair(_client, _vcIdx));
+  }
+  metadatas_[index(_client, _vcIdx)] = _metadata;
+  if (!clientRequested_[_client]) {
+    clientRequested_[_client] = true;
+    activeClients_.push_back(_client);
+  }
 
   // ensure there is an event set to perform scheduling
   if (!allocEventSet_) {
@@ -105,8 +134,9 @@ void VcScheduler::request(u32 _client, u32 _vcIdx, u64 _metadata) {
 
 void VcScheduler::releaseVc(u32 _vcIdx) {
   assert(gSim->epsilon() >= 1);
-  assert(vcTaken_.at(_vcIdx) == true);
-  vcTaken_.at(_vcIdx) = false;
+  assert(_vcIdx < totalVcs_);
+  assert(!bitsetTest(vcFree_.data(), _vcIdx));
+  bitsetSet(vcFree_.data(), _vcIdx);
 }
 
 void VcScheduler::processEvent(void* _event, s32 _type) {
@@ -115,48 +145,84 @@ void VcScheduler::processEvent(void* _event, s32 _type) {
   allocEventSet_ = false;
 
   // check VC availability, mask out unavailable VC requests
-  for (u32 c = 0; c < numClients_; c++) {
-    if (clientRequested_[c]) {
-      for (u32 v = 0; v < totalVcs_; v++) {
-        u64 idx = index(c, v);
-        if (requests_[idx] && vcTaken_[v]) {
-          requests_[idx] = false;
-        }
-      }
+  //  only the active requests are touched, grants are only ever set on them
+  for (const auto& request : activeRequests_) {
+    if (!bitsetTest(vcFree_.data(), request.second)) {
+      setRequest(request.first, request.second, false);
     }
+    setGrant(request.first, request.second, false);
   }
 
-  // clear the grants (must do before allocate() call)
-  memset(grants_, false, sizeof(bool) * totalVcs_ * numClients_);
-
   // run the allocator
   allocator_->allocate();
 
-  // deliver responses, mark used VCs, reset requests
-  for (u32 c = 0; c < numClients_; c++) {
-    if (clientRequested_[c]) {
-      clientRequested_[c] = false;
-      u32 granted = U32_MAX;
-      for (u32 v = 0; v < totalVcs_; v++) {
-        u64 idx = index(c, v);
-
-        // multiple grants to the same client? BAD
-        assert(!((granted != U32_MAX) && (grants_[idx])));
-
-        // check for granted
-        if ((granted == U32_MAX) && (grants_[idx])) {
-          granted = v;
-          assert(vcTaken_[v] == false);
-          vcTaken_[v] = true;
-        }
-        requests_[idx] = false;
-      }
-      clients_[c]->vcSchedulerResponse(granted);
+  // collect grants, mark used VCs, reset requests
+  for (const auto& request : activeRequests_) {
+    u32 c = request.first;
+    u32 v = request.second;
+    if (getGrant(c, v)) {
+      // multiple grants to the same client? BAD
+      assert(clientGrants_[c] == U32_MAX);
+      clientGrants_[c] = v;
+      assert(bitsetTest(vcFree_.data(), v));
+      bitsetClear(vcFree_.data(), v);
     }
+    setRequest(c, v, false);
+  }
+  activeRequests_.clear();
+
+  // deliver responses in client order
+  std::sort(activeClients_.begin(), activeClients_.end());
+  for (u32 c : activeClients_) {
+    clientRequested_[c] = false;
+    u32 granted = clientGrants_[c];
+    clientGrants_[c] = U32_MAX;
+    clients_[c]->vcSchedulerResponse(granted);
   }
+  activeClients_.clear();
 }
 
 u64 VcScheduler::index(u64 _client, u64 _vcIdx) const {
   // this indexing contiguously places resources
   return (totalVcs_ * _client) + _vcIdx;
 }
+
+bool VcScheduler::getRequest(u32 _client, u32 _vcIdx) const {
+  if (packed_) {
+    return bitsetTest(&packedRequests_[_vcIdx * packedWords_], _client);
+  } else {
+    return requests_[index(_client, _vcIdx)];
+  }
+}
+
+void VcScheduler::setRequest(u32 _client, u32 _vcIdx, bool _request) {
+  if (packed_) {
+    if (_request) {
+      bitsetSet(&packedRequests_[_vcIdx * packedWords_], _client);
+    } else {
+      bitsetClear(&packedRequests_[_vcIdx * packedWords_], _client);
+    }
+  } else {
+    requests_[index(_client, _vcIdx)] = _request;
+  }
+}
+
+bool VcScheduler::getGrant(u32 _client, u32 _vcIdx) const {
+  if (packed_) {
+    return bitsetTest(&packedGrants_[_vcIdx * packedWords_], _client);
+  } else {
+    return grants_[index(_client, _vcIdx)];
+  }
+}
+
+void VcScheduler::setGrant(u32 _client, u32 _vcIdx, bool _grant) {
+  if (packed_) {
+    if (_grant) {
+      bitsetSet(&packedGrants_[_vcIdx * packedWords_], _client);
+    } else {
+      bitsetClear(&packedGrants_[_vcIdx * packedWords_], _client);
+    }
+  } else {
+    grants_[index(_client, _vcIdx)] = _grant;
+  }
+}
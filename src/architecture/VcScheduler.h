@@ -17,6 +17,7 @@
 
 #include <string>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "allocator/Allocator.h"
@@ -42,7 +43,7 @@ class VcScheduler : public Component {
   // constructor and destructor
   VcScheduler(const std::string& _name, const Component* _parent,
               u32 _numClients, u32 _totalVcs, Simulator::Clock _clock,
-              nlohmann::json _settings);
+              const nlohmann::json& _settings);
   ~VcScheduler();
 
   // constant attributes
@@ -66,8 +67,14 @@ class VcScheduler : public Component {
 
   std::vector<Client*> clients_;
   std::vector<bool> clientRequested_;
+  std::vector<u32> clientGrants_;
 
-  std::vector<bool> vcTaken_;
+  // the clients and the (client, VC) requests of the current cycle
+  std::vector<u32> activeClients_;
+  std::vector<std::pair<u32, u32> > activeRequests_;
+
+  // one bit per VC, set while the VC is free
+  std::vector<u64> vcFree_;
 
   bool* requests_;
   u64* metadatas_;
@@ -75,8 +82,19 @@ class VcScheduler : public Component {
   Allocator* allocator_;
   bool allocEventSet_;
 
+  // packed allocators use rows of bits per VC instead of requests_ and grants_
+  bool packed_;
+  u32 packedWords_;
+  u64* packedRequests_;
+  u64* packedGrants_;
+
   // this creates an index for requests_, metadatas_, and grants_
   u64 index(u64 _client, u64 _vcIdx) const;
+  // these access the request and grant of the client for the VC
+  bool getRequest(u32 _client, u32 _vcIdx) const;
+  void setRequest(u32 _client, u32 _vcIdx, bool _request);
+  bool getGrant(u32 _client, u32 _vcIdx) const;
+  void setGrant(u32 _client, u32 _vcIdx, bool _grant);
 };
 
 #endif  // ARCHITECTURE_VCSCHEDULER_H_
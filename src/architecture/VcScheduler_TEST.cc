@@ -184,45 +184,47 @@ class VcSchedulerTestClient : public VcScheduler::Client, public Component {
 TEST(VcScheduler, basic) {
   const u32 ALLOCS_PER_CLIENT = 100;
 
-  for (u32 C = 1; C < 16; C += 2) {
-    for (u32 V = 1; V < 16; V += 2) {
-      for (u32 R = 1; R < V; R += 2) {
-        // setup
-        TestSetup testSetup(12, 12, 12, 12, 0x1234567890abcdf);
+  for (const char* allocType : {"rc_separable", "packed_rc_separable"}) {
+    for (u32 C = 1; C < 16; C += 2) {
+      for (u32 V = 1; V < 16; V += 2) {
+        for (u32 R = 1; R < V; R += 2) {
+          // setup
+          TestSetup testSetup(12, 12, 12, 12, 0x1234567890abcdf);
 
-        std::unordered_set<u32> requests;
+          std::unordered_set<u32> requests;
 
-        nlohmann::json arbSettings;
-        arbSettings["type"] = "random";
-        nlohmann::json allocSettings;
-        allocSettings["type"] = "rc_separable";
-        allocSettings["resource_arbiter"] = arbSettings;
-        allocSettings["client_arbiter"] = arbSettings;
-        allocSettings["iterations"] = 1;
-        allocSettings["slip_latch"] = true;
-        nlohmann::json schSettings;
-        schSettings["allocator"] = allocSettings;
-        VcScheduler* vcSch = new VcScheduler(
-            "VcSch", nullptr, C, V, Simulator::Clock::ROUTER, schSettings);
-        assert(vcSch->numClients() == C);
-        assert(vcSch->totalVcs() == V);
+          nlohmann::json arbSettings;
+          arbSettings["type"] = "random";
+          nlohmann::json allocSettings;
+          allocSettings["type"] = allocType;
+          allocSettings["resource_arbiter"] = arbSettings;
+          allocSettings["client_arbiter"] = arbSettings;
+          allocSettings["iterations"] = 1;
+          allocSettings["slip_latch"] = true;
+          nlohmann::json schSettings;
+          schSettings["allocator"] = allocSettings;
+          VcScheduler* vcSch = new VcScheduler(
+              "VcSch", nullptr, C, V, Simulator::Clock::ROUTER, schSettings);
+          assert(vcSch->numClients() == C);
+          assert(vcSch->totalVcs() == V);
 
-        std::vector<VcSchedulerTestClient*> clients(C);
-        std::unordered_map<u32, u32> holdingCount;
-        for (u32 c = 0; c < C; c++) {
-          clients[c] = new VcSchedulerTestClient(
-              c, vcSch, V, Simulator::Clock::ROUTER, ALLOCS_PER_CLIENT, R,
-              requests, &holdingCount);
-        }
+          std::vector<VcSchedulerTestClient*> clients(C);
+          std::unordered_map<u32, u32> holdingCount;
+          for (u32 c = 0; c < C; c++) {
+            clients[c] = new VcSchedulerTestClient(
+                c, vcSch, V, Simulator::Clock::ROUTER, ALLOCS_PER_CLIENT, R,
+                requests, &holdingCount);
+          }
 
-        // run the simulator
-        gSim->initialize();
-        gSim->simulate();
+          // run the simulator
+          gSim->initialize();
+          gSim->simulate();
 
-        // tear down
-        delete vcSch;
-        for (u32 c = 0; c < C; c++) {
-          delete clients[c];
+          // tear down
+          delete vcSch;
+          for (u32 c = 0; c < C; c++) {
+            delete clients[c];
+          }
         }
       }
     }
@@ -29,14 +29,36 @@ const s32 PHANTOM = 0x87;
 BufferOccupancy::BufferOccupancy(const std::string& _name,
                                  const Component* _parent,
                                  PortedDevice* _device,
-                                 nlohmann::json _settings)
+                                 const nlohmann::json& _settings)
     : CongestionSensor(_name, _parent, _device, _settings),
       latency_(_settings["latency"].get<u32>()),
-      mode_(parseMode(_settings["mode"].get<std::string>())) {
+      mode_(parseMode(_settings["mode"].get<std::string>())),
+      propagation_(parsePropagation(
+          !_settings.contains("propagation") ||
+                  _settings["propagation"].is_null()
+              ? "event"
+              : _settings["propagation"].get<std::string>())) {
   assert(latency_ > 0);
   u32 totalVcs = numPorts_ * numVcs_;
   normalizationDivisors_.resize(totalVcs, 0);
   outstandingFlits_.resize(totalVcs, 0);
+  portFlits_.resize(numPorts_, {0, 0, numVcs_, 0, numVcs_});
+  portDivisors_.resize(numPorts_, 0);
+
+  // updates are at most 'latency_ - 1' cycles in the future
+  if (propagation_ == Propagation::kDelayLine) {
+    delayLine_.resize(latency_);
+    for (auto& bucket : delayLine_) {
+      bucket.reserve(totalVcs);
+    }
+  }
+
+  // validation is an optional setting
+  validate_ = false;
+  if (_settings.contains("validate")) {
+    assert(_settings["validate"].is_boolean());
+    validate_ = _settings["validate"].get<bool>();
+  }
 
   // phantom is an optional setting
   phantom_ = false;
@@ -74,6 +96,16 @@ void BufferOccupancy::initCredits(u32 _vcIdx, u32 _credits) {
   }
 
   normalizationDivisors_.at(_vcIdx) = _credits;
+
+  // determine if all VCs of the port share the same divisor
+  s64 divisor = _credits;
+  for (u32 ovc = 0; ovc < numVcs_; ovc++) {
+    if (normalizationDivisors_.at(device_->vcIndex(port, ovc)) != divisor) {
+      divisor = 0;
+      break;
+    }
+  }
+  portDivisors_.at(port) = divisor;
 }
 
 void BufferOccupancy::incrementCredit(u32 _vcIdx) {
@@ -87,18 +119,10 @@ void BufferOccupancy::decrementCredit(u32 _vcIdx) {
 void BufferOccupancy::processEvent(void* _event, s32 _type) {
   assert(gSim->epsilon() > 0);
   u32 vcIdx = static_cast<u32>(reinterpret_cast<u64>(_event));
-  switch (_type) {
-    case INCR:
-      performIncrementCredit(vcIdx);
-      break;
-    case DECR:
-      performDecrementCredit(vcIdx);
-      break;
-    case PHANTOM:
-      performDecrementWindow(vcIdx);
-      break;
-    default:
-      assert(false);
+  if (_type == PHANTOM) {
+    performDecrementWindow(vcIdx);
+  } else {
+    performUpdate(vcIdx, _type);
   }
 }
 
@@ -189,6 +213,73 @@ f64 BufferOccupancy::computeStatus(u32 _inputPort, u32 _inputVc,
   }
 }
 
+f64 BufferOccupancy::computePortStatus(u32 _inputPort, u32 _inputVc,
+                                       u32 _outputPort,
+                                       Aggregate _aggregate) const {
+  bool normalize = style() == CongestionSensor::Style::kNormalized;
+  if (!useAggregates(_outputPort, normalize)) {
+    return CongestionSensor::computePortStatus(_inputPort, _inputVc,
+                                               _outputPort, _aggregate);
+  }
+  if (validate_) {
+    validateAggregates(_outputPort);
+  }
+
+  // combine the per VC statuses of computeStatus() using the aggregates
+  const PortFlits& portFlits = portFlits_.at(_outputPort);
+  f64 average = portAverageStatus(_outputPort, normalize);
+  f64 minimum = aggregateStatus(_outputPort, portFlits.minimum, normalize);
+  f64 maximum = aggregateStatus(_outputPort, portFlits.maximum, normalize);
+  switch (mode_) {
+    case BufferOccupancy::Mode::kVcNorm:
+    case BufferOccupancy::Mode::kVcAbs:
+      switch (_aggregate) {
+        case Aggregate::kAverage:
+          return average;
+        case Aggregate::kMinimum:
+          return minimum;
+        case Aggregate::kMaximum:
+          return maximum;
+        default:
+          assert(false);
+      }
+      break;
+    case BufferOccupancy::Mode::kPortNorm:
+    case BufferOccupancy::Mode::kPortAbs:
+      return average;
+      break;
+    case BufferOccupancy::Mode::kMinNorm:
+    case BufferOccupancy::Mode::kMinAbs:
+      switch (_aggregate) {
+        case Aggregate::kMinimum:
+          return std::min(minimum, average);
+        case Aggregate::kMaximum:
+          return std::min(maximum, average);
+        default:
+          // the average of per VC minimums must visit every VC
+          return CongestionSensor::computePortStatus(_inputPort, _inputVc,
+                                                     _outputPort, _aggregate);
+      }
+      break;
+    case BufferOccupancy::Mode::kMaxNorm:
+    case BufferOccupancy::Mode::kMaxAbs:
+      switch (_aggregate) {
+        case Aggregate::kMinimum:
+          return std::max(minimum, average);
+        case Aggregate::kMaximum:
+          return std::max(maximum, average);
+        default:
+          // the average of per VC maximums must visit every VC
+          return CongestionSensor::computePortStatus(_inputPort, _inputVc,
+                                                     _outputPort, _aggregate);
+      }
+      break;
+    default:
+      assert(false);
+      break;
+  }
+}
+
 BufferOccupancy::Mode BufferOccupancy::parseMode(const std::string& _mode) {
   if (_mode == "normalized_vc") {
     return BufferOccupancy::Mode::kVcNorm;
@@ -211,20 +302,77 @@ BufferOccupancy::Mode BufferOccupancy::parseMode(const std::string& _mode) {
   }
 }
 
+BufferOccupancy::Propagation BufferOccupancy::parsePropagation(
+    const std::string& _propagation) {
+  if (_propagation == "event") {
+    return BufferOccupancy::Propagation::kEvent;
+  } else if (_propagation == "delay_line") {
+    return BufferOccupancy::Propagation::kDelayLine;
+  } else {
+    fprintf(stderr, "invalid propagation: %s\n", _propagation.c_str());
+    assert(false);
+  }
+}
+
 void BufferOccupancy::createEvent(u32 _vcIdx, s32 _type) {
   assert(gSim->epsilon() > 0);
+  if (propagation_ == Propagation::kDelayLine) {
+    if (latency_ == 1) {
+      // statuses are only observed on epsilon 0, so the update can be
+      //  performed now instead of on a later epsilon of this time
+      performUpdate(_vcIdx, _type);
+    } else {
+      // statuses are only observed on epsilon 0, so all updates due at a
+      //  cycle can be performed together on epsilon 1
+      u64 cycle = gSim->cycle(Simulator::Clock::ROUTER) + latency_ - 1;
+      std::vector<std::pair<u32, s32>>& bucket =
+          delayLine_.at(cycle % latency_);
+      if (bucket.empty()) {
+        addEvent<&BufferOccupancy::drainDelayLine>(
+            gSim->futureCycle(Simulator::Clock::ROUTER, latency_ - 1), 1,
+            nullptr);
+      }
+      bucket.push_back(std::make_pair(_vcIdx, _type));
+    }
+    return;
+  }
+
   u64 time = latency_ == 1
                  ? gSim->time()
                  : gSim->futureCycle(Simulator::Clock::ROUTER, latency_ - 1);
   addEvent(time, gSim->epsilon() + 1, reinterpret_cast<void*>(_vcIdx), _type);
 }
 
+void BufferOccupancy::performUpdate(u32 _vcIdx, s32 _type) {
+  switch (_type) {
+    case INCR:
+      performIncrementCredit(_vcIdx);
+      break;
+    case DECR:
+      performDecrementCredit(_vcIdx);
+      break;
+    default:
+      assert(false);
+  }
+}
+
+void BufferOccupancy::drainDelayLine() {
+  assert(gSim->epsilon() == 1);
+  std::vector<std::pair<u32, s32>>& bucket =
+      delayLine_.at(gSim->cycle(Simulator::Clock::ROUTER) % latency_);
+  assert(!bucket.empty());
+  for (const std::pair<u32, s32>& update : bucket) {
+    performUpdate(update.first, update.second);
+  }
+  bucket.clear();
+}
+
 void BufferOccupancy::performIncrementCredit(u32 _vcIdx) {
-  outstandingFlits_.at(_vcIdx)--;
+  addFlits(_vcIdx, -1);
 }
 
 void BufferOccupancy::performDecrementCredit(u32 _vcIdx) {
-  outstandingFlits_.at(_vcIdx)++;
+  addFlits(_vcIdx, 1);
 
   if (phantom_) {
     windows_.at(_vcIdx)++;
@@ -243,6 +391,96 @@ void BufferOccupancy::performDecrementWindow(u32 _vcIdx) {
   windows_.at(_vcIdx)--;
 }
 
+void BufferOccupancy::addFlits(u32 _vcIdx, s64 _flits) {
+  s64 prev = outstandingFlits_.at(_vcIdx);
+  s64 next = prev + _flits;
+  outstandingFlits_.at(_vcIdx) = next;
+
+  u32 port, vc;
+  device_->vcIndexInv(_vcIdx, &port, &vc);
+  PortFlits& portFlits = portFlits_.at(port);
+  portFlits.sum += _flits;
+
+  // remove the previous value
+  if (prev == portFlits.minimum) {
+    portFlits.minimumCount--;
+  }
+  if (prev == portFlits.maximum) {
+    portFlits.maximumCount--;
+  }
+
+  // add the next value, the VCs are only scanned when the last VC holding
+  //  the minimum or maximum moved away from it
+  if (next < portFlits.minimum) {
+    portFlits.minimum = next;
+    portFlits.minimumCount = 1;
+  } else if (next == portFlits.minimum) {
+    portFlits.minimumCount++;
+  }
+  if (next > portFlits.maximum) {
+    portFlits.maximum = next;
+    portFlits.maximumCount = 1;
+  } else if (next == portFlits.maximum) {
+    portFlits.maximumCount++;
+  }
+  if (portFlits.minimumCount == 0 || portFlits.maximumCount == 0) {
+    scanPort(port, &portFlits);
+  }
+}
+
+void BufferOccupancy::scanPort(u32 _port, PortFlits* _portFlits) const {
+  s64 first = outstandingFlits_.at(device_->vcIndex(_port, 0));
+  _portFlits->sum = 0;
+  _portFlits->minimum = first;
+  _portFlits->minimumCount = 0;
+  _portFlits->maximum = first;
+  _portFlits->maximumCount = 0;
+  for (u32 vc = 0; vc < numVcs_; vc++) {
+    s64 flits = outstandingFlits_.at(device_->vcIndex(_port, vc));
+    _portFlits->sum += flits;
+    if (flits < _portFlits->minimum) {
+      _portFlits->minimum = flits;
+      _portFlits->minimumCount = 1;
+    } else if (flits == _portFlits->minimum) {
+      _portFlits->minimumCount++;
+    }
+    if (flits > _portFlits->maximum) {
+      _portFlits->maximum = flits;
+      _portFlits->maximumCount = 1;
+    } else if (flits == _portFlits->maximum) {
+      _portFlits->maximumCount++;
+    }
+  }
+}
+
+bool BufferOccupancy::useAggregates(u32 _outputPort, bool _normalize) const {
+  return !phantom_ && (!_normalize || portDivisors_.at(_outputPort) > 0);
+}
+
+f64 BufferOccupancy::aggregateStatus(u32 _outputPort, s64 _flits,
+                                     bool _normalize) const {
+  // this matches vcStatus() for a VC holding '_flits'
+  f64 status = _flits;
+  if (_normalize) {
+    status /= portDivisors_.at(_outputPort);
+  }
+  return status;
+}
+
+void BufferOccupancy::validateAggregates(u32 _outputPort) const {
+  PortFlits expected;
+  scanPort(_outputPort, &expected);
+  const PortFlits& actual = portFlits_.at(_outputPort);
+  if (actual.sum != expected.sum || actual.minimum != expected.minimum ||
+      actual.minimumCount != expected.minimumCount ||
+      actual.maximum != expected.maximum ||
+      actual.maximumCount != expected.maximumCount) {
+    fprintf(stderr, "%s: port %u aggregates are invalid\n",
+            fullName().c_str(), _outputPort);
+    assert(false);
+  }
+}
+
 f64 BufferOccupancy::vcStatus(u32 _outputPort, u32 _outputVc,
                               bool _normalize) const {
   // return this VC's status
@@ -259,6 +497,16 @@ f64 BufferOccupancy::vcStatus(u32 _outputPort, u32 _outputVc,
 }
 
 f64 BufferOccupancy::portAverageStatus(u32 _outputPort, bool _normalize) const {
+  // use the aggregate sum when possible
+  if (useAggregates(_outputPort, _normalize)) {
+    if (validate_) {
+      validateAggregates(_outputPort);
+    }
+    return aggregateStatus(_outputPort, portFlits_.at(_outputPort).sum,
+                           _normalize) /
+           numVcs_;
+  }
+
   // return the average status of all VCs in this port (normalized)
   f64 status = 0.0;
   for (u32 vc = 0; vc < numVcs_; vc++) {
@@ -16,6 +16,7 @@
 #define CONGESTION_BUFFEROCCUPANCY_H_
 
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "congestion/CongestionSensor.h"
@@ -25,7 +26,7 @@
 class BufferOccupancy : public CongestionSensor {
  public:
   BufferOccupancy(const std::string& _name, const Component* _parent,
-                  PortedDevice* _device, nlohmann::json _settings);
+                  PortedDevice* _device, const nlohmann::json& _settings);
   ~BufferOccupancy();
 
   // CreditWatcher interface
@@ -35,6 +36,7 @@ class BufferOccupancy : public CongestionSensor {
 
   // this creates INCR and DECR events to simulate a fixed latency between all
   //  input and output ports (IOW, input port and VC are ignored in the calc).
+  //  in delay line mode, these are batched per router cycle instead.
   void processEvent(void* _event, s32 _type) override;
 
   // style and resolution reporting
@@ -46,6 +48,10 @@ class BufferOccupancy : public CongestionSensor {
   f64 computeStatus(u32 _inputPort, u32 _inputVc, u32 _outputPort,
                     u32 _outputVc) const override;
 
+  // see CongestionSensor::computePortStatus
+  f64 computePortStatus(u32 _inputPort, u32 _inputVc, u32 _outputPort,
+                        Aggregate _aggregate) const override;
+
  private:
   enum class Mode {
     kVcNorm,
@@ -58,23 +64,61 @@ class BufferOccupancy : public CongestionSensor {
     kMaxAbs
   };
 
+  // Defines how credit updates are delayed by the latency
+  enum class Propagation {
+    kEvent,     // one event per update
+    kDelayLine  // a ring of per cycle buckets drained by one event per cycle
+  };
+
+  // aggregates of the outstanding flits of all VCs of a port
+  struct PortFlits {
+    s64 sum;
+    s64 minimum;
+    u32 minimumCount;  // number of VCs holding the minimum
+    s64 maximum;
+    u32 maximumCount;  // number of VCs holding the maximum
+  };
+
   static Mode parseMode(const std::string& _mode);
+  static Propagation parsePropagation(const std::string& _propagation);
 
   void createEvent(u32 _vcIdx, s32 _type);
+  void performUpdate(u32 _vcIdx, s32 _type);
+  void drainDelayLine();
   void performIncrementCredit(u32 _vcIdx);
   void performDecrementCredit(u32 _vcIdx);
   void performDecrementWindow(u32 _vcIdx);
 
+  // this changes the outstanding flits of a VC and updates its port's
+  //  aggregates
+  void addFlits(u32 _vcIdx, s64 _flits);
+  void scanPort(u32 _port, PortFlits* _portFlits) const;
+
+  // port statuses can be derived from the aggregates unless phantom
+  //  congestion is enabled or the VCs have different normalization divisors
+  bool useAggregates(u32 _outputPort, bool _normalize) const;
+  f64 aggregateStatus(u32 _outputPort, s64 _flits, bool _normalize) const;
+  void validateAggregates(u32 _outputPort) const;
+
   f64 vcStatus(u32 _outputPort, u32 _outputVc, bool _normalize) const;
   f64 portAverageStatus(u32 _outputPort, bool _normalize) const;
 
   const u32 latency_;
   const Mode mode_;
+  const Propagation propagation_;
+
+  // delay line mode, {vcIdx, type} updates bucketed by router cycle
+  std::vector<std::vector<std::pair<u32, s32>>> delayLine_;
 
   // 64-bit to hold U32_MAX
   std::vector<s64> normalizationDivisors_;
   std::vector<s64> outstandingFlits_;
 
+  // incrementally maintained port aggregates
+  std::vector<PortFlits> portFlits_;
+  std::vector<s64> portDivisors_;  // 0 when the port's VCs differ
+  bool validate_;  // cross-checks aggregates against a full recomputation
+
   // phantom congestion awareness
   bool phantom_;
   f64 valueCoeff_;
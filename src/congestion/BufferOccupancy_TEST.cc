@@ -14,6 +14,10 @@
  */
 #include "congestion/BufferOccupancy.h"
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
 #include "congestion/CongestionSensor.h"
 #include "congestion/Congestion_TESTLIB.h"
 #include "gtest/gtest.h"
@@ -477,3 +481,268 @@ TEST(BufferOccupancy, phantomAbsVc) {
     }
   }
 }
+
+namespace {
+
+// this compares port statuses against combining the status of every VC
+class PortStatusCheck : public Component {
+ public:
+  PortStatusCheck(const std::string& _name, const Component* _parent,
+                  CongestionSensor* _congestionSensor, u32 _numPorts,
+                  u32 _numVcs)
+      : Component(_name, _parent),
+        congestionSensor_(_congestionSensor),
+        numPorts_(_numPorts),
+        numVcs_(_numVcs),
+        checks_(0) {}
+
+  void setEvent(u64 _time) {
+    addEvent(_time, 0, nullptr, 0);
+  }
+
+  void processEvent(void* _event, s32 _type) override {
+    for (u32 port = 0; port < numPorts_; port++) {
+      f64 sum = 0.0;
+      f64 minimum = F64_POS_INF;
+      f64 maximum = F64_NEG_INF;
+      for (u32 vc = 0; vc < numVcs_; vc++) {
+        f64 sts = congestionSensor_->status(0, 0, port, vc);
+        sum += sts;
+        minimum = std::min(minimum, sts);
+        maximum = std::max(maximum, sts);
+      }
+      ASSERT_NEAR(congestionSensor_->portStatus(
+                      0, 0, port, CongestionSensor::Aggregate::kAverage),
+                  sum / numVcs_, 1e-9);
+      ASSERT_EQ(congestionSensor_->portStatus(
+                    0, 0, port, CongestionSensor::Aggregate::kMinimum),
+                minimum);
+      ASSERT_EQ(congestionSensor_->portStatus(
+                    0, 0, port, CongestionSensor::Aggregate::kMaximum),
+                maximum);
+      checks_++;
+    }
+  }
+
+  u32 checks() const {
+    return checks_;
+  }
+
+ private:
+  CongestionSensor* congestionSensor_;
+  const u32 numPorts_;
+  const u32 numVcs_;
+  u32 checks_;
+};
+
+}  // namespace
+
+TEST(BufferOccupancy, portAggregates) {
+  const u32 numPorts = 5;
+  const u32 numVcs = 4;
+  const u32 latency = 3;
+
+  for (const char* mode :
+       {"normalized_vc", "absolute_vc", "normalized_port", "absolute_port",
+        "normalized_min", "absolute_min", "normalized_max", "absolute_max"}) {
+    TestSetup test(1, 1, 1, 1, 1234);
+
+    nlohmann::json routerSettings;
+    CongestionTestRouter router("Router", nullptr, nullptr, 0,
+                                std::vector<u32>(), numPorts, numVcs, nullptr,
+                                routerSettings);
+
+    nlohmann::json sensorSettings;
+    sensorSettings["latency"] = latency;
+    sensorSettings["granularity"] = 0;
+    sensorSettings["mode"] = mode;
+    sensorSettings["minimum"] = 0.0;
+    sensorSettings["offset"] = 0.5;
+    sensorSettings["validate"] = true;
+    BufferOccupancy sensor("CongestionSensor", &router, &router,
+                           sensorSettings);
+
+    // the last port has different divisors per VC
+    for (u32 port = 0; port < numPorts; port++) {
+      for (u32 vc = 0; vc < numVcs; vc++) {
+        u32 max = port < numPorts - 1 ? port * 3 + 10 : vc + 10;
+        sensor.initCredits(router.vcIndex(port, vc), max);
+      }
+    }
+
+    CreditHandler crediter("CreditHandler", nullptr, &sensor, &router);
+    PortStatusCheck check("PortStatusCheck", nullptr, &sensor, numPorts,
+                          numVcs);
+
+    // consume a random number of credits on each VC, check, then return
+    //  them in a different order while checking along the way
+    std::vector<u32> consumed(numPorts * numVcs);
+    u64 time = 100;
+    for (u32 port = 0; port < numPorts; port++) {
+      for (u32 vc = 0; vc < numVcs; vc++) {
+        u32 vcIdx = router.vcIndex(port, vc);
+        consumed.at(vcIdx) = gSim->rnd.nextU64(0, 8);
+        for (u32 c = 0; c < consumed.at(vcIdx); c++) {
+          crediter.setEvent(port, vc, time++, 1, CreditHandler::Type::DECR);
+        }
+      }
+    }
+    time += latency;
+    u32 checks = 0;
+    check.setEvent(time++);
+    checks++;
+    for (u32 vc = numVcs; vc > 0; vc--) {
+      for (u32 port = 0; port < numPorts; port++) {
+        u32 vcIdx = router.vcIndex(port, vc - 1);
+        for (u32 c = 0; c < consumed.at(vcIdx); c++) {
+          crediter.setEvent(port, vc - 1, time++, 1, CreditHandler::Type::INCR);
+          if (c % 3 == 0) {
+            check.setEvent(time + latency);
+            checks++;
+          }
+        }
+      }
+    }
+    check.setEvent(time + latency);
+    checks++;
+
+    gSim->initialize();
+    gSim->simulate();
+    ASSERT_EQ(check.checks(), checks * numPorts);
+  }
+}
+
+namespace {
+
+// this records the status of every VC each time it is triggered
+class StatusRecorder : public Component {
+ public:
+  StatusRecorder(const std::string& _name, const Component* _parent,
+                 CongestionSensor* _congestionSensor, u32 _numPorts,
+                 u32 _numVcs, std::vector<f64>* _statuses)
+      : Component(_name, _parent),
+        congestionSensor_(_congestionSensor),
+        numPorts_(_numPorts),
+        numVcs_(_numVcs),
+        statuses_(_statuses) {}
+
+  void setEvent(u64 _time) {
+    addEvent(_time, 0, nullptr, 0);
+  }
+
+  void processEvent(void* _event, s32 _type) override {
+    for (u32 port = 0; port < numPorts_; port++) {
+      for (u32 vc = 0; vc < numVcs_; vc++) {
+        statuses_->push_back(congestionSensor_->status(0, 0, port, vc));
+      }
+    }
+  }
+
+ private:
+  CongestionSensor* congestionSensor_;
+  const u32 numPorts_;
+  const u32 numVcs_;
+  std::vector<f64>* statuses_;
+};
+
+// this runs a random credit sequence and returns all observed statuses
+std::vector<f64> delayLineStatuses(const std::string& _propagation,
+                                   u32 _latency, bool _phantom) {
+  const u32 numPorts = 3;
+  const u32 numVcs = 2;
+  const u32 bufferDepth = 6;
+  const u64 endTime = 600;
+
+  // the router clock is slower than the channel clock so that updates are
+  //  created between router cycles
+  TestSetup test(1, 3, 1, 1, 1234);
+
+  nlohmann::json routerSettings;
+  CongestionTestRouter router("Router", nullptr, nullptr, 0,
+                              std::vector<u32>(), numPorts, numVcs, nullptr,
+                              routerSettings);
+
+  std::vector<Channel*> channels;
+  for (u32 port = 0; port < numPorts; port++) {
+    nlohmann::json channelSettings;
+    channelSettings["latency"] = 4 + port;
+    channels.push_back(new Channel("Channel_" + std::to_string(port),
+                                   nullptr, 8, channelSettings));
+    router.setOutputChannel(port, channels.back());
+  }
+
+  nlohmann::json sensorSettings;
+  sensorSettings["latency"] = _latency;
+  sensorSettings["granularity"] = 0;
+  sensorSettings["mode"] = "absolute_vc";
+  sensorSettings["minimum"] = 0.0;
+  sensorSettings["offset"] = 0.0;
+  sensorSettings["propagation"] = _propagation;
+  if (_phantom) {
+    sensorSettings["phantom"] = true;
+    sensorSettings["value_coeff"] = 0.5;
+    sensorSettings["length_coeff"] = 1.0;
+  }
+  BufferOccupancy sensor("CongestionSensor", &router, &router, sensorSettings);
+  for (u32 port = 0; port < numPorts; port++) {
+    for (u32 vc = 0; vc < numVcs; vc++) {
+      sensor.initCredits(router.vcIndex(port, vc), bufferDepth);
+    }
+  }
+
+  CreditHandler crediter("CreditHandler", nullptr, &sensor, &router);
+  std::vector<f64> statuses;
+  StatusRecorder recorder("StatusRecorder", nullptr, &sensor, numPorts,
+                          numVcs, &statuses);
+
+  // randomly send and return flits while keeping the credit counts legal
+  std::vector<u32> outstanding(numPorts * numVcs, 0);
+  for (u64 time = 1; time < endTime; time++) {
+    for (u32 port = 0; port < numPorts; port++) {
+      for (u32 vc = 0; vc < numVcs; vc++) {
+        u32 vcIdx = router.vcIndex(port, vc);
+        u64 action = gSim->rnd.nextU64(0, 3);
+        if (action == 0 && outstanding.at(vcIdx) < bufferDepth) {
+          crediter.setEvent(port, vc, time, 1, CreditHandler::Type::DECR);
+          outstanding.at(vcIdx)++;
+        } else if (action == 1 && outstanding.at(vcIdx) > 0) {
+          crediter.setEvent(port, vc, time, 1, CreditHandler::Type::INCR);
+          outstanding.at(vcIdx)--;
+        }
+      }
+    }
+    recorder.setEvent(time);
+  }
+
+  // return all remaining credits
+  for (u32 port = 0; port < numPorts; port++) {
+    for (u32 vc = 0; vc < numVcs; vc++) {
+      u32 vcIdx = router.vcIndex(port, vc);
+      for (u32 c = 0; c < outstanding.at(vcIdx); c++) {
+        crediter.setEvent(port, vc, endTime, 1, CreditHandler::Type::INCR);
+      }
+    }
+  }
+
+  gSim->initialize();
+  gSim->simulate();
+
+  for (Channel* channel : channels) {
+    delete channel;
+  }
+  return statuses;
+}
+
+}  // namespace
+
+TEST(BufferOccupancy, delayLine) {
+  for (bool phantom : {false, true}) {
+    for (u32 latency : {1, 2, 3, 5}) {
+      std::vector<f64> expected = delayLineStatuses("event", latency, phantom);
+      std::vector<f64> actual =
+          delayLineStatuses("delay_line", latency, phantom);
+      ASSERT_GT(expected.size(), 0u);
+      ASSERT_EQ(expected, actual);
+    }
+  }
+}
@@ -24,7 +24,7 @@
 CongestionSensor::CongestionSensor(const std::string& _name,
                                    const Component* _parent,
                                    PortedDevice* _device,
-                                   nlohmann::json _settings)
+                                   const nlohmann::json& _settings)
     : Component(_name, _parent),
       device_(_device),
       numPorts_(device_->numPorts()),
@@ -44,7 +44,7 @@ CongestionSensor::~CongestionSensor() {}
 CongestionSensor* CongestionSensor::create(const std::string& _name,
                                            const Component* _parent,
                                            PortedDevice* _device,
-                                           nlohmann::json _settings) {
+                                           const nlohmann::json& _settings) {
   // retrieve the algorithm
   const std::string& algorithm = _settings["algorithm"].get<std::string>();
 
@@ -68,17 +68,72 @@ f64 CongestionSensor::status(u32 _inputPort, u32 _inputVc, u32 _outputPort,
 
   // gather value from subclass
   f64 value = computeStatus(_inputPort, _inputVc, _outputPort, _outputVc);
+  return finalize(value);
+}
+
+f64 CongestionSensor::portStatus(u32 _inputPort, u32 _inputVc,
+                                 u32 _outputPort, Aggregate _aggregate) const {
+  assert(gSim->epsilon() == 0);
+
+  switch (_aggregate) {
+    case Aggregate::kAverage: {
+      // finalization is linear when it only adds the offset
+      if (granularity_ == 0 && minimum_ == 0.0) {
+        f64 value = computePortStatus(_inputPort, _inputVc, _outputPort,
+                                      _aggregate);
+        return finalize(value);
+      }
+      f64 sum = 0.0;
+      for (u32 vc = 0; vc < numVcs_; vc++) {
+        sum += status(_inputPort, _inputVc, _outputPort, vc);
+      }
+      return sum / numVcs_;
+    }
+    case Aggregate::kMinimum:
+    case Aggregate::kMaximum: {
+      // finalization is monotonic, so it preserves the minimum and maximum
+      f64 value =
+          computePortStatus(_inputPort, _inputVc, _outputPort, _aggregate);
+      return finalize(value);
+    }
+    default:
+      assert(false);
+  }
+}
 
+f64 CongestionSensor::computePortStatus(u32 _inputPort, u32 _inputVc,
+                                        u32 _outputPort,
+                                        Aggregate _aggregate) const {
+  f64 sum = 0.0;
+  f64 minimum = F64_POS_INF;
+  f64 maximum = F64_NEG_INF;
+  for (u32 vc = 0; vc < numVcs_; vc++) {
+    f64 value = computeStatus(_inputPort, _inputVc, _outputPort, vc);
+    sum += value;
+    minimum = std::min(minimum, value);
+    maximum = std::max(maximum, value);
+  }
+  switch (_aggregate) {
+    case Aggregate::kAverage:
+      return sum / numVcs_;
+    case Aggregate::kMinimum:
+      return minimum;
+    case Aggregate::kMaximum:
+      return maximum;
+    default:
+      assert(false);
+  }
+}
+
+f64 CongestionSensor::finalize(f64 _value) const {
   // check bounds
-  assert(value >= 0.0);
+  assert(_value >= 0.0);
 
   // apply granularization
   if (granularity_ > 0) {
-    value = std::round(value * granularity_) / granularity_;
+    _value = std::round(_value * granularity_) / granularity_;
   }
 
   // apply offset and minimum constraints
-  value = offset_ + std::max(minimum_, value);
-
-  return value;
+  return offset_ + std::max(minimum_, _value);
 }
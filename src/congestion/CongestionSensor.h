@@ -25,7 +25,7 @@
 #include "prim/prim.h"
 
 #define CONGESTIONSENSOR_ARGS \
-  const std::string&, const Component*, PortedDevice*, nlohmann::json
+  const std::string&, const Component*, PortedDevice*, const nlohmann::json&
 
 class CongestionSensor : public Component, public CreditWatcher {
  public:
@@ -43,8 +43,15 @@ class CongestionSensor : public Component, public CreditWatcher {
     kPort   // values specified per port (_outputVc is meaningless)
   };
 
+  // Defines how the statuses of all VCs of a port are combined
+  enum class Aggregate {
+    kAverage,
+    kMinimum,
+    kMaximum
+  };
+
   CongestionSensor(const std::string& _name, const Component* _parent,
-                   PortedDevice* _device, nlohmann::json _settings);
+                   PortedDevice* _device, const nlohmann::json& _settings);
   virtual ~CongestionSensor();
 
   // this is a congestion status factory
@@ -54,6 +61,10 @@ class CongestionSensor : public Component, public CreditWatcher {
   f64 status(u32 _inputPort, u32 _inputVc, u32 _outputPort,
              u32 _outputVc) const;  // (must be epsilon >= 1)
 
+  // this returns the combined status() of all VCs of an output port
+  f64 portStatus(u32 _inputPort, u32 _inputVc, u32 _outputPort,
+                 Aggregate _aggregate) const;  // (must be epsilon >= 1)
+
   // must tell your style and mode
   virtual Style style() const = 0;
   virtual Resolution resolution() const = 0;
@@ -64,11 +75,19 @@ class CongestionSensor : public Component, public CreditWatcher {
   virtual f64 computeStatus(u32 _inputPort, u32 _inputVc, u32 _outputPort,
                             u32 _outputVc) const = 0;
 
+  // this combines computeStatus() of all VCs of an output port
+  //  subclasses can override this to avoid visiting every VC
+  virtual f64 computePortStatus(u32 _inputPort, u32 _inputVc, u32 _outputPort,
+                                Aggregate _aggregate) const;
+
   PortedDevice* device_;
   const u32 numPorts_;
   const u32 numVcs_;
 
  private:
+  // applies granularity, minimum, and offset to a computed status
+  f64 finalize(f64 _value) const;
+
   const u32 granularity_;
   const f64 minimum_;
   const f64 offset_;
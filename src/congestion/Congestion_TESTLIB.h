@@ -36,7 +36,7 @@ class CongestionTestRouter : public Router {
                        Network* _network, u32 _id,
                        const std::vector<u32>& _address, u32 _numPorts,
                        u32 _numVcs, MetadataHandler* _metadataHandler,
-                       nlohmann::json _settings);
+                       const nlohmann::json& _settings);
   ~CongestionTestRouter();
 
   void setCongestionSensor(CongestionSensor* _congestionSensor);
@@ -111,7 +111,7 @@ class StatusCheck : public Component {
 class CongestionTestSensor : public CongestionSensor {
  public:
   CongestionTestSensor(const std::string& _name, const Component* _parent,
-                       PortedDevice* _device, nlohmann::json _settings,
+                       PortedDevice* _device, const nlohmann::json& _settings,
                        const std::vector<f64>* _congestion);
   ~CongestionTestSensor();
 
@@ -19,7 +19,7 @@
 #include "factory/ObjectFactory.h"
 
 NullSensor::NullSensor(const std::string& _name, const Component* _parent,
-                       PortedDevice* _device, nlohmann::json _settings)
+                       PortedDevice* _device, const nlohmann::json& _settings)
     : CongestionSensor(_name, _parent, _device, _settings) {}
 
 NullSensor::~NullSensor() {}
@@ -25,7 +25,7 @@
 class NullSensor : public CongestionSensor {
  public:
   NullSensor(const std::string& _name, const Component* _parent,
-             PortedDevice* _device, nlohmann::json _settings);
+             PortedDevice* _device, const nlohmann::json& _settings);
   ~NullSensor();
 
   // CreditWatcher interface
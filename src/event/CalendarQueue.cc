@@ -0,0 +1,154 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "event/CalendarQueue.h"
+
+#include <cassert>
+
+#include "bits/bits.h"
+#include "factory/ObjectFactory.h"
+
+CalendarQueue::CalendarQueue(nlohmann::json _settings)
+    : Simulator(_settings),
+      numBuckets_(_settings["buckets"].get<u64>()),
+      bucketMask_(numBuckets_ - 1),
+      windowTime_(0),
+      windowEpsilon_(0),
+      windowIndex_(0),
+      wheelSize_(0) {
+  assert(!_settings["buckets"].is_null());
+  assert(numBuckets_ > 0);
+  assert(bits::isPow2(numBuckets_));
+
+  buckets_.resize(numBuckets_);
+  for (Bucket& bucket : buckets_) {
+    bucket.count = 0;
+  }
+}
+
+CalendarQueue::~CalendarQueue() {}
+
+void CalendarQueue::addEvent(u64 _time, u8 _epsilon, Component* _component,
+                             EventHandler _handler, void* _event, s32 _type) {
+  assert((_time > time_) ||                              // future by time
+         ((_time == time_) && (_epsilon > epsilon_)) ||  // future by epsilon
+         (initial()));                                   // has not yet run
+
+  // create a bundle object
+  CalendarQueue::EventBundle bundle;
+  bundle.time = _time;
+  bundle.epsilon = _epsilon;
+  bundle.component = _component;
+  bundle.handler = _handler;
+  bundle.event = _event;
+  bundle.type = _type;
+
+  // events within the window go directly into the wheel
+  if (_time < windowTime_ + numBuckets_) {
+    insertWheel(bundle);
+  } else {
+    overflow_.push(bundle);
+  }
+}
+
+u64 CalendarQueue::queueSize() const {
+  return wheelSize_ + overflow_.size();
+}
+
+void CalendarQueue::runNextEvent() {
+  // if there is an event to run, run it
+  if (queueSize() > 0) {
+    // find the next non-empty bucket
+    while (buckets_[windowTime_ & bucketMask_].count == 0) {
+      advanceWindow();
+    }
+    Bucket& bucket = buckets_[windowTime_ & bucketMask_];
+
+    // find the next non-empty epsilon within the bucket
+    while (windowIndex_ == bucket.epsilons[windowEpsilon_].size()) {
+      bucket.epsilons[windowEpsilon_].clear();
+      windowEpsilon_++;
+      windowIndex_ = 0;
+    }
+
+    // remove the event before processing it, processing may add events
+    CalendarQueue::EventBundle bundle =
+        bucket.epsilons[windowEpsilon_][windowIndex_];
+    windowIndex_++;
+    bucket.count--;
+    wheelSize_--;
+
+    // process the event
+    time_ = bundle.time;
+    epsilon_ = bundle.epsilon;
+    bundle.handler(bundle.component, bundle.event, bundle.type);
+  }
+
+  // set the quit_ status
+  quit_ = queueSize() < 1;
+}
+
+void CalendarQueue::insertWheel(const EventBundle& _bundle) {
+  assert(_bundle.time >= windowTime_);
+  assert(_bundle.time < windowTime_ + numBuckets_);
+  Bucket& bucket = buckets_[_bundle.time & bucketMask_];
+  if (bucket.epsilons.size() <= _bundle.epsilon) {
+    bucket.epsilons.resize(_bundle.epsilon + 1);
+  }
+  bucket.epsilons[_bundle.epsilon].push_back(_bundle);
+  bucket.count++;
+  wheelSize_++;
+}
+
+void CalendarQueue::advanceWindow() {
+  // the current bucket is empty, clear the partially consumed epsilon list
+  Bucket& bucket = buckets_[windowTime_ & bucketMask_];
+  assert(bucket.count == 0);
+  if (windowEpsilon_ < bucket.epsilons.size()) {
+    bucket.epsilons[windowEpsilon_].clear();
+  }
+  windowEpsilon_ = 0;
+  windowIndex_ = 0;
+
+  // move to the next time, jump directly to the overflow when the wheel is
+  //  empty
+  if (wheelSize_ == 0) {
+    assert(!overflow_.empty());
+    windowTime_ = overflow_.top().time;
+  } else {
+    windowTime_++;
+  }
+
+  // migrate overflow events that are now within the window
+  while (!overflow_.empty() &&
+         (overflow_.top().time < windowTime_ + numBuckets_)) {
+    insertWheel(overflow_.top());
+    overflow_.pop();
+  }
+}
+
+/** EventBundleComparator sub-class **/
+CalendarQueue::EventBundleComparator::EventBundleComparator() {}
+
+CalendarQueue::EventBundleComparator::~EventBundleComparator() {}
+
+bool CalendarQueue::EventBundleComparator::operator()(
+    const CalendarQueue::EventBundle _lhs,
+    const CalendarQueue::EventBundle _rhs) const {
+  return (_lhs.time == _rhs.time) ? (_lhs.epsilon > _rhs.epsilon)
+                                  : (_lhs.time > _rhs.time);
+}
+
+registerWithObjectFactory("calendar", Simulator, CalendarQueue,
+                          SIMULATOR_ARGS);
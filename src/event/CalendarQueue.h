@@ -0,0 +1,87 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef EVENT_CALENDARQUEUE_H_
+#define EVENT_CALENDARQUEUE_H_
+
+#include <queue>
+#include <vector>
+
+#include "event/Component.h"
+#include "event/Simulator.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+
+/*
+ * This is a timing wheel event queue. The wheel holds one bucket per time
+ * unit for a window of 'buckets' time units starting at the current time.
+ * Each bucket holds one FIFO list of events per epsilon. Events scheduled
+ * beyond the window are kept in a priority queue and migrated into the wheel
+ * as the window advances. Insertion and removal of events within the window
+ * are amortized O(1).
+ */
+class CalendarQueue : public Simulator {
+ public:
+  explicit CalendarQueue(nlohmann::json _settings);
+  ~CalendarQueue();
+  void addEvent(u64 _time, u8 _epsilon, Component* _component,
+                EventHandler _handler, void* _event, s32 _type) override;
+  u64 queueSize() const override;
+
+ protected:
+  void runNextEvent() override;
+
+ private:
+  class EventBundle {
+   public:
+    u64 time;
+    u8 epsilon;
+    Component* component;
+    EventHandler handler;
+    void* event;
+    s32 type;
+  };
+
+  class EventBundleComparator {
+   public:
+    EventBundleComparator();
+    ~EventBundleComparator();
+    bool operator()(const EventBundle _lhs, const EventBundle _rhs) const;
+  };
+
+  struct Bucket {
+    // indexed by epsilon, the lists keep their capacity once cleared
+    std::vector<std::vector<EventBundle>> epsilons;
+    u64 count;
+  };
+
+  void insertWheel(const EventBundle& _bundle);
+  void advanceWindow();
+
+  const u64 numBuckets_;
+  const u64 bucketMask_;
+  std::vector<Bucket> buckets_;
+
+  // position of the next event to be run
+  u64 windowTime_;
+  u32 windowEpsilon_;
+  u64 windowIndex_;
+
+  u64 wheelSize_;
+  std::priority_queue<EventBundle, std::vector<EventBundle>,
+                      EventBundleComparator>
+      overflow_;
+};
+
+#endif  // EVENT_CALENDARQUEUE_H_
@@ -0,0 +1,107 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "event/CalendarQueue.h"
+
+#include <string>
+
+#include "event/Component.h"
+#include "gtest/gtest.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+#include "settings/settings.h"
+
+namespace {
+class OrderCheck : public Component {
+ public:
+  OrderCheck(const std::string& _name, const Component* _parent)
+      : Component(_name, _parent),
+        lastTime_(0),
+        lastEpsilon_(0),
+        added_(0),
+        processed_(0) {}
+  ~OrderCheck() {}
+
+  void setEvent(u64 _time, u8 _epsilon, u32 _spawns) {
+    added_++;
+    addEvent(_time, _epsilon, reinterpret_cast<void*>((u64)_spawns), 0);
+  }
+
+  void processEvent(void* _event, s32 _type) {
+    u64 time = gSim->time();
+    u8 epsilon = gSim->epsilon();
+    ASSERT_TRUE((time > lastTime_) ||
+                ((time == lastTime_) && (epsilon >= lastEpsilon_)));
+    lastTime_ = time;
+    lastEpsilon_ = epsilon;
+    processed_++;
+
+    // spawn more events, some within and some beyond the window
+    u32 spawns = (u32)reinterpret_cast<u64>(_event);
+    if (spawns > 0) {
+      u64 delta = gSim->rnd.nextU64(0, 40);
+      u8 eps = (u8)gSim->rnd.nextU64(0, 3);
+      if (delta == 0) {
+        eps = epsilon + 1;
+      }
+      setEvent(time + delta, eps, spawns - 1);
+    }
+  }
+
+  u64 added() const { return added_; }
+  u64 processed() const { return processed_; }
+
+ private:
+  u64 lastTime_;
+  u8 lastEpsilon_;
+  u64 added_;
+  u64 processed_;
+};
+}  // namespace
+
+TEST(CalendarQueue, order) {
+  for (u64 buckets : {1, 8, 64}) {
+    std::string str = std::string("{\n") +
+                      "  \"channel_cycle_time\": 1,\n" +
+                      "  \"router_cycle_time\": 1,\n" +
+                      "  \"interface_cycle_time\": 1,\n" +
+                      "  \"terminal_cycle_time\": 1,\n" +
+                      "  \"print_progress\": false,\n" +
+                      "  \"print_interval\": 1.0,\n" +
+                      "  \"random_seed\": 12345,\n" +
+                      "  \"queue\": \"calendar\",\n" +
+                      "  \"buckets\": " + std::to_string(buckets) + "\n" +
+                      "}\n";
+    nlohmann::json settings;
+    settings::initString(str.c_str(), &settings);
+    gSim = new CalendarQueue(settings);
+
+    OrderCheck checker("checker", nullptr);
+    for (u32 e = 0; e < 500; e++) {
+      checker.setEvent(gSim->rnd.nextU64(0, 200), gSim->rnd.nextU64(0, 3),
+                       gSim->rnd.nextU64(0, 10));
+    }
+    ASSERT_EQ(gSim->queueSize(), checker.added());
+
+    gSim->initialize();
+    gSim->simulate();
+
+    ASSERT_EQ(gSim->queueSize(), 0u);
+    ASSERT_EQ(checker.processed(), checker.added());
+
+    delete gSim;
+    gSim = nullptr;
+  }
+  Component::clearNames();
+}
@@ -23,38 +23,63 @@
 
 // this is some weird C++ syntax declaration of previously declared
 //  static member variables.
-std::unordered_map<std::string, Component*> Component::components_;
+Component::Siblings Component::roots_;
+u64 Component::numComponents_ = 0;
+std::vector<Component*> Component::created_;
 std::unordered_set<std::string> Component::toBeDebugged_;
 
 Component::Component(const std::string& _name, const Component* _parent)
-    : debug_(false), name_(_name), parent_(_parent) {
-  if (components_.insert({fullName(), this}).second == false) {
-    fprintf(stderr, "duplicate component name detected: %s\n",
-            fullName().c_str());
-    assert(false);
-  }
-  if (toBeDebugged_.count(fullName()) == 1) {
-    setDebug(true);
-    u64 res = toBeDebugged_.erase(fullName());
-    assert(res == 1);
+    : debug_(false),
+      name_(_name),
+      parent_(_parent),
+      children_(nullptr),
+      siblings_(nullptr),
+      createdIndex_(created_.size()) {
+  created_.push_back(this);
+  registerName();
+  if (!toBeDebugged_.empty()) {
+    // the names are compared in place, building the full name of every
+    //  component is too slow for large networks
+    for (auto it = toBeDebugged_.begin(); it != toBeDebugged_.end(); ++it) {
+      if (matchesFullName(*it)) {
+        setDebug(true);
+        toBeDebugged_.erase(it);
+        break;
+      }
+    }
   }
 }
 
 Component::~Component() {
-  u64 res = Component::components_.erase(fullName());
-  assert(res == 1);
+  unregisterName();
+  if (children_ != nullptr) {
+    if (children_->names.empty()) {
+      delete children_;
+    } else {
+      children_->orphaned = true;
+    }
+  }
+  if (createdIndex_ < created_.size() && created_[createdIndex_] == this) {
+    created_[createdIndex_] = nullptr;
+  }
 }
 
 void Component::setName(const std::string& _name) {
+  unregisterName();
   name_ = _name;
+  registerName();
 }
 
 void Component::prependName(std::string _prefix) {
+  unregisterName();
   name_ = _prefix + name_;
+  registerName();
 }
 
 void Component::appendName(std::string _postfix) {
+  unregisterName();
   name_ = name_ + _postfix;
+  registerName();
 }
 
 std::string Component::name() const {
@@ -62,15 +87,21 @@ std::string Component::name() const {
 }
 
 std::string Component::fullName() const {
-  if (parent_) {
-    return parent_->fullName() + "." + name_;
-  } else {
-    return name_;
+  // size the result once instead of concatenating at every level
+  u64 size = 0;
+  for (const Component* c = this; c != nullptr; c = c->parent_) {
+    size += c->name_.size() + 1;
   }
+  std::string fullName;
+  fullName.reserve(size);
+  appendFullName(&fullName);
+  return fullName;
 }
 
 void Component::setParent(const Component* _parent) {
+  unregisterName();
   parent_ = _parent;
+  registerName();
 }
 
 const Component* Component::getParent() const {
@@ -81,6 +112,11 @@ void Component::addEvent(u64 _time, u8 _epsilon, void* _event, s32 _type) {
   gSim->addEvent(_time, _epsilon, this, _event, _type);
 }
 
+void Component::processEventHandler(Component* _component, void* _event,
+                                    s32 _type) {
+  _component->processEvent(_event, _type);
+}
+
 void Component::initialize() {
   // this function can be overridden if a component needs to be initialized
 }
@@ -110,15 +146,29 @@ s32 Component::debugPrint(const char* _func, s32 _line, const char* _name,
 }
 
 Component* Component::findComponentByName(std::string _fullName) {
-  auto iter = components_.find(_fullName);
-  if (iter == components_.end()) {
-    return nullptr;
+  // walk down the hierarchy one name at a time
+  const Siblings* siblings = &roots_;
+  std::string_view remaining(_fullName);
+  while (true) {
+    u64 dot = remaining.find('.');
+    auto iter = siblings->names.find(remaining.substr(0, dot));
+    if (iter == siblings->names.end()) {
+      return nullptr;
+    }
+    Component* component = iter->second;
+    if (dot == std::string_view::npos) {
+      return component;
+    }
+    siblings = component->children_;
+    if (siblings == nullptr) {
+      return nullptr;
+    }
+    remaining.remove_prefix(dot + 1);
   }
-  return iter->second;
 }
 
 u64 Component::numComponents() {
-  return components_.size();
+  return numComponents_;
 }
 
 void Component::addDebugName(std::string _fullname) {
@@ -135,5 +185,61 @@ void Component::debugCheck() {
 }
 
 void Component::clearNames() {
-  components_.clear();
+  roots_.names.clear();
+  numComponents_ = 0;
+  created_.clear();
+}
+
+void Component::registerName() {
+  if (parent_ == nullptr) {
+    siblings_ = &roots_;
+  } else {
+    if (parent_->children_ == nullptr) {
+      parent_->children_ = new Siblings();
+    }
+    siblings_ = parent_->children_;
+  }
+  if (siblings_->names.insert({name_, this}).second == false) {
+    fprintf(stderr, "duplicate component name detected: %s\n",
+            fullName().c_str());
+    assert(false);
+  }
+  numComponents_++;
+}
+
+void Component::unregisterName() {
+  assert(siblings_ != nullptr);
+  u64 res = siblings_->names.erase(name_);
+  assert(res == 1);
+  if (siblings_->orphaned && siblings_->names.empty()) {
+    delete siblings_;
+  }
+  siblings_ = nullptr;
+  numComponents_--;
+}
+
+bool Component::matchesFullName(std::string_view _fullName) const {
+  // compare names from this component up to the root
+  for (const Component* c = this; c != nullptr; c = c->parent_) {
+    if (_fullName.size() < c->name_.size() ||
+        _fullName.substr(_fullName.size() - c->name_.size()) != c->name_) {
+      return false;
+    }
+    _fullName.remove_suffix(c->name_.size());
+    if (c->parent_ != nullptr) {
+      if (_fullName.empty() || _fullName.back() != '.') {
+        return false;
+      }
+      _fullName.remove_suffix(1);
+    }
+  }
+  return _fullName.empty();
+}
+
+void Component::appendFullName(std::string* _fullName) const {
+  if (parent_) {
+    parent_->appendFullName(_fullName);
+    *_fullName += '.';
+  }
+  *_fullName += name_;
 }
@@ -15,13 +15,39 @@
 #ifndef EVENT_COMPONENT_H_
 #define EVENT_COMPONENT_H_
 
+#include <cassert>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "event/Simulator.h"
 #include "prim/prim.h"
 
+// this deduces the component and event types of a typed event handler
+template <typename H>
+struct EventHandlerTraits;
+
+template <typename C, typename E>
+struct EventHandlerTraits<void (C::*)(E*)> {
+  typedef C Owner;
+  typedef E Event;
+  static void invoke(C* _owner, void (C::*_handler)(E*), void* _event) {
+    (_owner->*_handler)(static_cast<E*>(_event));
+  }
+};
+
+template <typename C>
+struct EventHandlerTraits<void (C::*)()> {
+  typedef C Owner;
+  typedef void Event;
+  static void invoke(C* _owner, void (C::*_handler)(), void* _event) {
+    assert(_event == nullptr);
+    (_owner->*_handler)();
+  }
+};
+
 class Component {
  public:
   Component(const std::string& _name, const Component* _parent);
@@ -44,8 +70,28 @@ class Component {
   static void debugCheck();
   static void clearNames();
 
+  // this dispatches an event to processEvent()
+  static void processEventHandler(Component* _component, void* _event,
+                                  s32 _type);
+
  protected:
+  // this adds an event that is dispatched to processEvent()
   void addEvent(u64 _time, u8 _epsilon, void* _event, s32 _type);
+
+  /*
+   * This adds an event that is dispatched directly to the member function
+   * 'Handler' of the derived component, bypassing processEvent() and its
+   * event type switch. 'Handler' must have one of the forms:
+   *   void Derived::handler(Event* _event);
+   *   void Derived::handler();  // '_event' must be nullptr
+   * where 'Event' can be any type.
+   * Example:
+   *   addEvent<&Channel::deliverFlit>(time, 1, flit);
+   */
+  template <auto Handler>
+  void addEvent(u64 _time, u8 _epsilon,
+                typename EventHandlerTraits<decltype(Handler)>::Event* _event);
+
   s32 debugPrint(const char* _func, s32 _line, const char* _name, u64 _time,
                  u8 _epsilon, const char* _format, ...) const;
   bool debug_;
@@ -53,10 +99,36 @@ class Component {
  private:
   friend class Simulator;
 
+  template <auto Handler>
+  static void typedEventHandler(Component* _component, void* _event, s32 _type);
+
+  void registerName();
+  void unregisterName();
+  bool matchesFullName(std::string_view _fullName) const;
+  void appendFullName(std::string* _fullName) const;
+
   std::string name_;
   const Component* parent_;
 
-  static std::unordered_map<std::string, Component*> components_;
+  // components are registered by their parent and their own name instead of
+  //  their full name which would have to be built for every component. the
+  //  names of siblings are kept in one small table owned by their parent
+  //  which stays cached while the parent creates or destroys its children.
+  //  a table outlives its parent until its last child is unregistered.
+  struct Siblings {
+    std::unordered_map<std::string_view, Component*> names;
+    bool orphaned = false;
+  };
+  mutable Siblings* children_;
+  Siblings* siblings_;
+  static Siblings roots_;
+  static u64 numComponents_;
+
+  // components are initialized in the order they were created, unlike the
+  //  order of the registry this doesn't depend on their addresses.
+  //  destroyed components leave a nullptr.
+  static std::vector<Component*> created_;
+  u64 createdIndex_;
   static std::unordered_set<std::string> toBeDebugged_;
 };
 
@@ -66,4 +138,6 @@ class Component {
                            gSim->time(), gSim->epsilon(), __VA_ARGS__))  \
        : (0))
 
+#include "event/Component.tcc"
+
 #endif  // EVENT_COMPONENT_H_
@@ -0,0 +1,39 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef EVENT_COMPONENT_TCC_
+#define EVENT_COMPONENT_TCC_
+
+#ifndef EVENT_COMPONENT_H_
+#error "don't include this file directly. use the .h file instead"
+#else  // EVENT_COMPONENT_H_
+
+template <auto Handler>
+void Component::addEvent(
+    u64 _time, u8 _epsilon,
+    typename EventHandlerTraits<decltype(Handler)>::Event* _event) {
+  gSim->addEvent(_time, _epsilon, this, &Component::typedEventHandler<Handler>,
+                 _event, 0);
+}
+
+template <auto Handler>
+void Component::typedEventHandler(Component* _component, void* _event,
+                                  s32 _type) {
+  typedef EventHandlerTraits<decltype(Handler)> Traits;
+  Traits::invoke(static_cast<typename Traits::Owner*>(_component), Handler,
+                 _event);
+}
+
+#endif  // EVENT_COMPONENT_H_
+#endif  // EVENT_COMPONENT_TCC_
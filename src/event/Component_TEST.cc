@@ -0,0 +1,163 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "event/Component.h"
+
+#include <string>
+#include <vector>
+
+#include "event/Simulator.h"
+#include "gtest/gtest.h"
+#include "prim/prim.h"
+#include "test/TestSetup_TESTLIB.h"
+
+namespace {
+class Dispatcher : public Component {
+ public:
+  Dispatcher(const std::string& _name, const Component* _parent)
+      : Component(_name, _parent) {}
+  ~Dispatcher() {}
+
+  void setEvents() {
+    addEvent(10, 0, &values_[0], 0xA);
+    addEvent<&Dispatcher::typedEvent>(10, 1, &values_[1]);
+    addEvent<&Dispatcher::emptyEvent>(10, 2, nullptr);
+    addEvent(20, 0, &values_[3], 0xB);
+    addEvent<&Dispatcher::typedEvent>(30, 0, &values_[4]);
+  }
+
+  void processEvent(void* _event, s32 _type) override {
+    u32* value = reinterpret_cast<u32*>(_event);
+    log_.push_back(*value + _type);
+  }
+
+  const std::vector<u32>& log() const { return log_; }
+
+ private:
+  void typedEvent(u32* _value) {
+    log_.push_back(*_value);
+  }
+
+  void emptyEvent() {
+    log_.push_back(values_[2]);
+  }
+
+  u32 values_[5] = {100, 200, 300, 400, 500};
+  std::vector<u32> log_;
+};
+
+class Initialized : public Component {
+ public:
+  Initialized(const std::string& _name, const Component* _parent,
+              std::vector<std::string>* _log)
+      : Component(_name, _parent), log_(_log) {}
+  ~Initialized() {}
+
+  void initialize() override {
+    log_->push_back(fullName());
+  }
+
+ private:
+  std::vector<std::string>* log_;
+};
+}  // namespace
+
+TEST(Component, typedEvents) {
+  TestSetup ts(1, 1, 1, 1, 0x1234);
+
+  Dispatcher dispatcher("dispatcher", nullptr);
+  dispatcher.setEvents();
+
+  gSim->initialize();
+  gSim->simulate();
+
+  std::vector<u32> exp = {100 + 0xA, 200, 300, 400 + 0xB, 500};
+  ASSERT_EQ(dispatcher.log(), exp);
+}
+
+TEST(Component, names) {
+  TestSetup ts(1, 1, 1, 1, 0x1234);
+
+  Dispatcher top("top", nullptr);
+  Dispatcher a("a", &top);
+  Dispatcher b("b", &top);
+  Dispatcher c("c", &a);
+  ASSERT_EQ(c.fullName(), "top.a.c");
+  ASSERT_EQ(Component::numComponents(), 4u);
+
+  ASSERT_EQ(Component::findComponentByName("top"), &top);
+  ASSERT_EQ(Component::findComponentByName("top.b"), &b);
+  ASSERT_EQ(Component::findComponentByName("top.a.c"), &c);
+  ASSERT_EQ(Component::findComponentByName("top.b.c"), nullptr);
+  ASSERT_EQ(Component::findComponentByName("a"), nullptr);
+
+  // renaming and reparenting keep the lookup consistent
+  c.appendName("_0");
+  ASSERT_EQ(Component::findComponentByName("top.a.c"), nullptr);
+  ASSERT_EQ(Component::findComponentByName("top.a.c_0"), &c);
+  c.setParent(&b);
+  ASSERT_EQ(Component::findComponentByName("top.b.c_0"), &c);
+  ASSERT_EQ(c.fullName(), "top.b.c_0");
+  ASSERT_EQ(Component::numComponents(), 4u);
+
+  // a child can outlive its parent
+  Dispatcher* d = new Dispatcher("d", &top);
+  Dispatcher* e = new Dispatcher("e", d);
+  ASSERT_EQ(Component::findComponentByName("top.d.e"), e);
+  delete d;
+  ASSERT_EQ(Component::findComponentByName("top.d"), nullptr);
+  ASSERT_EQ(Component::numComponents(), 5u);
+  delete e;
+  ASSERT_EQ(Component::numComponents(), 4u);
+}
+
+TEST(Component, initializeOrder) {
+  TestSetup ts(1, 1, 1, 1, 0x1234);
+
+  std::vector<std::string> log;
+  Initialized top("top", nullptr, &log);
+  Initialized z("z", &top, &log);
+  Initialized* gone = new Initialized("gone", &top, &log);
+  Initialized a("a", &top, &log);
+  Initialized y("y", &a, &log);
+  delete gone;
+  z.setName("x");
+
+  // components are initialized in the order they were created
+  gSim->initialize();
+  std::vector<std::string> exp = {"top", "top.x", "top.a", "top.a.y"};
+  ASSERT_EQ(log, exp);
+}
+
+TEST(Component, debugNames) {
+  TestSetup ts(1, 1, 1, 1, 0x1234);
+
+  Component::addDebugName("top.a.c");
+  Component::addDebugName("top.b");
+  Dispatcher top("top", nullptr);
+  Dispatcher a("a", &top);
+  Dispatcher b("b", &top);
+  Dispatcher ac("c", &a);
+  Dispatcher bc("c", &b);
+  Dispatcher c("c", nullptr);
+
+  // only the components with matching full names are debugged
+  ASSERT_FALSE(top.getDebug());
+  ASSERT_FALSE(a.getDebug());
+  ASSERT_TRUE(b.getDebug());
+  ASSERT_TRUE(ac.getDebug());
+  ASSERT_FALSE(bc.getDebug());
+  ASSERT_FALSE(c.getDebug());
+  Component::debugCheck();
+}
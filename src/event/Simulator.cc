@@ -21,6 +21,8 @@
 #include <string>
 #include <utility>
 
+#include "event/Component.h"
+#include "factory/ObjectFactory.h"
 #include "network/Network.h"
 #include "workload/Application.h"
 #include "workload/Workload.h"
@@ -59,11 +61,42 @@ Simulator::Simulator(nlohmann::json _settings)
 
 Simulator::~Simulator() {}
 
+Simulator* Simulator::create(nlohmann::json _settings) {
+  // retrieve the event queue implementation, the default is the vector queue
+  std::string queue = "vector";
+  if (!_settings["queue"].is_null()) {
+    queue = _settings["queue"].get<std::string>();
+  }
+
+  // attempt to build the simulator
+  Simulator* simulator =
+      factory::ObjectFactory<Simulator, SIMULATOR_ARGS>::create(queue,
+                                                                _settings);
+
+  // check that the factory had the queue
+  if (simulator == nullptr) {
+    fprintf(stderr, "unknown event queue: %s\n", queue.c_str());
+    assert(false);
+  }
+  simulator->infoLog.logInfo("Event queue", queue);
+  return simulator;
+}
+
+void Simulator::addEvent(u64 _time, u8 _epsilon, Component* _component,
+                         void* _event, s32 _type) {
+  addEvent(_time, _epsilon, _component, &Component::processEventHandler,
+           _event, _type);
+}
+
 void Simulator::initialize() {
   assert(!initialized_);
 
-  for (std::pair<std::string, Component*> comp : Component::components_) {
-    comp.second->initialize();
+  // components are initialized in the order they were created, this also
+  //  covers components that are created during initialization
+  for (u64 idx = 0; idx < Component::created_.size(); idx++) {
+    if (Component::created_[idx] != nullptr) {
+      Component::created_[idx]->initialize();
+    }
   }
 
   initialized_ = true;
@@ -24,14 +24,26 @@ class Component;
 class Network;
 class Workload;
 
+#define SIMULATOR_ARGS nlohmann::json
+
+// this is the function that dispatches an event to its component
+typedef void (*EventHandler)(Component* _component, void* _event, s32 _type);
+
 class Simulator {
  public:
   explicit Simulator(nlohmann::json _settings);
   virtual ~Simulator();
 
-  // this adds an event to the queue
+  // this is a simulator factory
+  static Simulator* create(SIMULATOR_ARGS);
+
+  // this adds an event to the queue, it is dispatched to processEvent()
+  void addEvent(u64 _time, u8 _epsilon, Component* _component, void* _event,
+                s32 _type);
+
+  // this adds an event to the queue, it is dispatched to '_handler'
   virtual void addEvent(u64 _time, u8 _epsilon, Component* _component,
-                        void* _event, s32 _type) = 0;
+                        EventHandler _handler, void* _event, s32 _type) = 0;
 
   // this function must return the current size of the queue
   virtual u64 queueSize() const = 0;
@@ -16,12 +16,14 @@
 
 #include <cassert>
 
+#include "factory/ObjectFactory.h"
+
 VectorQueue::VectorQueue(nlohmann::json _settings) : Simulator(_settings) {}
 
 VectorQueue::~VectorQueue() {}
 
 void VectorQueue::addEvent(u64 _time, u8 _epsilon, Component* _component,
-                           void* _event, s32 _type) {
+                           EventHandler _handler, void* _event, s32 _type) {
   assert((_time > time_) ||                              // future by time
          ((_time == time_) && (_epsilon > epsilon_)) ||  // future by epsilon
          (initial()));                                   // has not yet run
@@ -31,6 +33,7 @@ void VectorQueue::addEvent(u64 _time, u8 _epsilon, Component* _component,
   bundle.time = _time;
   bundle.epsilon = _epsilon;
   bundle.component = _component;
+  bundle.handler = _handler;
   bundle.event = _event;
   bundle.type = _type;
 
@@ -49,7 +52,7 @@ void VectorQueue::runNextEvent() {
     VectorQueue::EventBundle bundle = eventQueue_.top();
     time_ = bundle.time;
     epsilon_ = bundle.epsilon;
-    bundle.component->processEvent(bundle.event, bundle.type);
+    bundle.handler(bundle.component, bundle.event, bundle.type);
     eventQueue_.pop();
   }
 
@@ -68,3 +71,5 @@ bool VectorQueue::EventBundleComparator::operator()(
   return (_lhs.time == _rhs.time) ? (_lhs.epsilon > _rhs.epsilon)
                                   : (_lhs.time > _rhs.time);
 }
+
+registerWithObjectFactory("vector", Simulator, VectorQueue, SIMULATOR_ARGS);
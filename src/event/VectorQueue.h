@@ -27,8 +27,8 @@ class VectorQueue : public Simulator {
  public:
   explicit VectorQueue(nlohmann::json _settings);
   ~VectorQueue();
-  void addEvent(u64 _time, u8 _epsilon, Component* _component, void* _event,
-                s32 _type) override;
+  void addEvent(u64 _time, u8 _epsilon, Component* _component,
+                EventHandler _handler, void* _event, s32 _type) override;
   u64 queueSize() const override;
 
  protected:
@@ -40,6 +40,7 @@ class VectorQueue : public Simulator {
     u64 time;
     u8 epsilon;
     Component* component;
+    EventHandler handler;
     void* event;
     s32 type;
   };
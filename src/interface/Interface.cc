@@ -22,7 +22,7 @@ Interface::Interface(const std::string& _name, const Component* _parent,
                      Network* _network, u32 _id,
                      const std::vector<u32>& _address, u32 _numPorts,
                      u32 _numVcs, MetadataHandler* _metadataHandler,
-                     nlohmann::json _settings)
+                     const nlohmann::json& _settings)
     : Component(_name, _parent),
       PortedDevice(_id, _address, _numPorts, _numVcs),
       network_(_network),
@@ -35,7 +35,7 @@ Interface* Interface::create(const std::string& _name, const Component* _parent,
                              Network* _network, u32 _id,
                              const std::vector<u32>& _address, u32 _numPorts,
                              u32 _numVcs, MetadataHandler* _metadataHandler,
-                             nlohmann::json _settings) {
+                             const nlohmann::json& _settings) {
   // retrieve the type
   const std::string& type = _settings["type"].get<std::string>();
 
@@ -37,7 +37,7 @@ class MessageReassembler;
 
 #define INTERFACE_ARGS                                 \
   const std::string&, const Component*, Network*, u32, \
-      const std::vector<u32>&, u32, u32, MetadataHandler*, nlohmann::json
+      const std::vector<u32>&, u32, u32, MetadataHandler*, const nlohmann::json&
 
 class Interface : public Component,
                   public PortedDevice,
@@ -50,7 +50,7 @@ class Interface : public Component,
   Interface(const std::string& _name, const Component* _parent,
             Network* _network, u32 _id, const std::vector<u32>& _address,
             u32 _numPorts, u32 _numVcs, MetadataHandler* _metadataHandler,
-            nlohmann::json _settings);
+            const nlohmann::json& _settings);
   virtual ~Interface();
 
   // this is an interface factory
@@ -36,7 +36,7 @@ Interface::Interface(const std::string& _name, const Component* _parent,
                      Network* _network, u32 _id,
                      const std::vector<u32>& _address, u32 _numPorts,
                      u32 _numVcs, MetadataHandler* _metadataHandler,
-                     nlohmann::json _settings)
+                     const nlohmann::json& _settings)
     : ::Interface(_name, _parent, _network, _id, _address, _numPorts, _numVcs,
                   _metadataHandler, _settings) {
   // init credits
@@ -286,8 +286,7 @@ void Interface::sendCredit(u32 _port, u32 _vc) {
   // send credit
   Credit* credit = inputChannels_.at(_port)->getNextCredit();
   if (credit == nullptr) {
-    credit = new Credit(numVcs_);
-    inputChannels_.at(_port)->setNextCredit(credit);
+    credit = inputChannels_.at(_port)->setNextCredit();
   }
   credit->putNum(_vc);
 }
@@ -298,7 +297,6 @@ void Interface::receiveCredit(u32 _port, Credit* _credit) {
     u32 vc = _credit->getNum();
     crossbarSchedulers_.at(_port)->incrementCredit(vc);
   }
-  delete _credit;
 }
 
 void Interface::incrementCredit(u32 _port, u32 _vc) {
@@ -49,7 +49,7 @@ class Interface : public ::Interface {
   Interface(const std::string& _name, const Component* _parent,
             Network* _network, u32 _id, const std::vector<u32>& _address,
             u32 _numPorts, u32 _numVcs, MetadataHandler* _metadataHandler,
-            nlohmann::json _settings);
+            const nlohmann::json& _settings);
   ~Interface();
 
   void setInputChannel(u32 _port, Channel* _channel) override;
@@ -15,7 +15,6 @@
 #ifndef INTERFACE_STANDARD_OUTPUTQUEUE_H_
 #define INTERFACE_STANDARD_OUTPUTQUEUE_H_
 
-#include <queue>
 #include <string>
 #include <vector>
 
@@ -25,6 +24,7 @@
 #include "prim/prim.h"
 #include "types/Flit.h"
 #include "types/FlitReceiver.h"
+#include "util/CircularQueue.h"
 
 namespace Standard {
 
@@ -81,7 +81,7 @@ class OutputQueue : public Component,
   // The following variables represent the pipeline registers
 
   // buffer
-  std::queue<Flit*> buffer_;  // insertion time & inserted flit
+  CircularQueue<Flit*> buffer_;  // insertion time & inserted flit
 
   // Switch allocation [swa_] pipeline stage
   struct {
@@ -13,17 +13,20 @@
  * limitations under the License.
  */
 #include <cassert>
+#include <chrono>  // NOLINT
 #include <cstdio>
 #include <cstring>
 #include <string>
 #include <vector>
 
 #include "event/Simulator.h"
-#include "event/VectorQueue.h"
 #include "metadata/MetadataHandler.h"
 #include "network/Network.h"
 #include "nlohmann/json.hpp"
 #include "settings/settings.h"
+#include "stats/AsyncOutFile.h"
+#include "types/Message.h"
+#include "types/Packet.h"
 #include "workload/Terminal.h"
 #include "workload/Workload.h"
 
@@ -46,15 +49,20 @@ s32 main(s32 _argc, char** _argv) {
 
   // initialize the discrete event simulator
   printf("Building components\n");
-  gSim = new VectorQueue(settings["simulator"]);
+  gSim = Simulator::create(settings["simulator"]);
 
   // create a metadata handler
   MetadataHandler* metadataHandler =
       MetadataHandler::create(settings["metadata_handler"]);
 
   // create a network
+  std::chrono::steady_clock::time_point buildTime =
+      std::chrono::steady_clock::now();
   Network* network =
       Network::create("Network", nullptr, metadataHandler, settings["network"]);
+  std::chrono::duration<f64> networkTime =
+      std::chrono::duration_cast<std::chrono::duration<f64>>(
+          std::chrono::steady_clock::now() - buildTime);
   gSim->setNetwork(network);
   u32 numInterfaces = network->numInterfaces();
   u32 numRouters = network->numRouters();
@@ -73,11 +81,19 @@ s32 main(s32 _argc, char** _argv) {
   }
   gSim->infoLog.logInfo("VCs", std::to_string(numVcs));
   gSim->infoLog.logInfo("Components", std::to_string(numComponents));
+  gSim->infoLog.logInfo("Network construction seconds",
+                        std::to_string(networkTime.count()));
 
   // create the workload
+  buildTime = std::chrono::steady_clock::now();
   Workload* workload =
       new Workload("Workload", nullptr, metadataHandler, settings["workload"]);
   gSim->setWorkload(workload);
+  std::chrono::duration<f64> workloadTime =
+      std::chrono::duration_cast<std::chrono::duration<f64>>(
+          std::chrono::steady_clock::now() - buildTime);
+  gSim->infoLog.logInfo("Workload construction seconds",
+                        std::to_string(workloadTime.count()));
 
   // check that all debug names were authentic
   Component::debugCheck();
@@ -91,6 +107,13 @@ s32 main(s32 _argc, char** _argv) {
     printf("Simulation beginning\n");
     gSim->simulate();
     printf("Simulation complete\n");
+
+    gSim->infoLog.logInfo("Peak live messages",
+                          std::to_string(Message::peakLive()));
+    gSim->infoLog.logInfo("Peak live packets",
+                          std::to_string(Packet::peakLive()));
+    gSim->infoLog.logInfo("Peak live flits",
+                          std::to_string(Packet::peakLiveFlits()));
   } else {
     printf("Simulation skipped\n");
   }
@@ -100,6 +123,10 @@ s32 main(s32 _argc, char** _argv) {
   delete workload;
   delete metadataHandler;
 
+  // the logs of the network and workload have been flushed by now
+  gSim->infoLog.logInfo("Stalled log writes",
+                        std::to_string(AsyncOutFile::totalStalls()));
+
   // cleanup the global simulator components
   delete gSim;
 
@@ -14,36 +14,63 @@
  */
 #include "network/Channel.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cstdio>
 
 #include "event/Simulator.h"
+#include "stats/ChannelLog.h"
 #include "types/Credit.h"
 #include "types/CreditReceiver.h"
 #include "types/Flit.h"
 #include "types/FlitReceiver.h"
 #include "types/Packet.h"
 
-#define FLIT 0xBE
-#define CRDT 0xEF
-
 Channel::Channel(const std::string& _name, const Component* _parent,
-                 u32 _numVcs, nlohmann::json _settings)
-    : Channel(_name, _parent, _numVcs, _settings["latency"].get<u32>()) {}
+                 u32 _numVcs, const nlohmann::json& _settings)
+    : Channel(_name, _parent, _numVcs, _settings["latency"].get<u32>(),
+              parseMode(!_settings.contains("mode") ||
+                                _settings["mode"].is_null()
+                            ? "event"
+                            : _settings["mode"].get<std::string>())) {}
 
 Channel::Channel(const std::string& _name, const Component* _parent,
-                 u32 _numVcs, u32 _latency)
-    : Component(_name, _parent), latency_(_latency), numVcs_(_numVcs) {
+                 u32 _numVcs, u32 _latency, Mode _mode)
+    : Component(_name, _parent),
+      latency_(_latency),
+      numVcs_(_numVcs),
+      mode_(_mode) {
   assert(latency_ > 0);
   assert(numVcs_ > 0);
+  assert(numVcs_ <= Credit::kMaxVcs);
 
   nextFlitTime_ = U64_MAX;
   nextFlit_ = nullptr;
   nextCreditTime_ = U64_MAX;
-  nextCredit_ = nullptr;
+
+  // at most one flit or credit per cycle of latency plus the one being set
+  //  can be in flight at any time
+  if (mode_ == Mode::kDelayLine) {
+    flits_.resize(latency_ + 1, nullptr);
+    flitTimes_.resize(latency_ + 1, U64_MAX);
+  }
+  flitHead_ = 0;
+  flitCount_ = 0;
+  credits_.resize(latency_ + 1);
+  creditTimes_.resize(latency_ + 1, U64_MAX);
+  creditHead_ = 0;
+  creditCount_ = 0;
+  wakeTime_ = U64_MAX;
 
   monitoring_ = false;
   monitorTime_ = U64_MAX;
   monitorCounts_.resize(_numVcs + 1);
+  windowLog_ = nullptr;
+  windowLength_ = 0;
+  windowStart_ = U64_MAX;
+  windowEnd_ = U64_MAX;
+  windowFlits_ = 0;
+  windowCounts_.resize(_numVcs, 0);
 }
 
 Channel::~Channel() {}
@@ -52,6 +79,10 @@ u32 Channel::latency() const {
   return latency_;
 }
 
+Channel::Mode Channel::mode() const {
+  return mode_;
+}
+
 void Channel::setSource(CreditReceiver* _source, u32 _port) {
   source_ = _source;
   sourcePort_ = _port;
@@ -62,7 +93,7 @@ void Channel::setSink(FlitReceiver* _sink, u32 _port) {
   sinkPort_ = _port;
 }
 
-void Channel::startMonitoring() {
+void Channel::startMonitoring(ChannelLog* _windowLog) {
   assert(monitoring_ == false);
   assert(monitorTime_ == U64_MAX);
   monitoring_ = true;
@@ -70,6 +101,13 @@ void Channel::startMonitoring() {
   for (auto& mc : monitorCounts_) {
     mc = 0;
   }
+  windowLog_ = _windowLog;
+  if (windowLog_) {
+    windowLength_ = windowLog_->windowLength();
+    assert(windowLength_ > 0);
+    windowStart_ = monitorTime_;
+    windowEnd_ = (monitorTime_ / windowLength_ + 1) * windowLength_;
+  }
 }
 
 void Channel::endMonitoring() {
@@ -77,6 +115,11 @@ void Channel::endMonitoring() {
   assert(monitorTime_ != U64_MAX);
   monitoring_ = false;
   monitorTime_ = gSim->time() - monitorTime_;  // delta time
+  if (windowLog_) {
+    // the last window is clipped to the end of monitoring
+    flushWindow(gSim->time());
+    windowLog_ = nullptr;
+  }
 }
 
 f64 Channel::utilization(u32 _vc) const {
@@ -93,19 +136,90 @@ f64 Channel::utilization(u32 _vc) const {
          ((f64)monitorTime_ / gSim->cycleTime(Simulator::Clock::CHANNEL));
 }
 
-void Channel::processEvent(void* _event, s32 _type) {
+void Channel::flushWindow(u64 _windowEnd) {
+  // only windows with flits are logged
+  if (windowFlits_ > 0) {
+    // a flit counted at the moment monitoring ended occupies one cycle
+    _windowEnd = std::max(
+        _windowEnd,
+        windowStart_ + gSim->cycleTime(Simulator::Clock::CHANNEL));
+    windowLog_->logWindow(this, windowStart_, _windowEnd, windowCounts_);
+    for (u64& count : windowCounts_) {
+      count = 0;
+    }
+    windowFlits_ = 0;
+  }
+}
+
+Channel::Mode Channel::parseMode(const std::string& _mode) {
+  if (_mode == "event") {
+    return Channel::Mode::kEvent;
+  } else if (_mode == "delay_line") {
+    return Channel::Mode::kDelayLine;
+  } else {
+    fprintf(stderr, "invalid channel mode: %s\n", _mode.c_str());
+    assert(false);
+  }
+}
+
+void Channel::deliverFlit(Flit* _flit) {
   assert(gSim->epsilon() == 1);
-  switch (_type) {
-    case FLIT: {
-      Flit* flit = reinterpret_cast<Flit*>(_event);
-      sink_->receiveFlit(sinkPort_, flit);
-    } break;
-    case CRDT: {
-      Credit* credit = reinterpret_cast<Credit*>(_event);
-      source_->receiveCredit(sourcePort_, credit);
-    } break;
-    default:
-      assert(false);
+  sink_->receiveFlit(sinkPort_, _flit);
+}
+
+void Channel::deliverCredit(Credit* _credit) {
+  assert(gSim->epsilon() == 1);
+  assert(creditCount_ > 0);
+  assert(_credit == &credits_.at(creditHead_));
+  source_->receiveCredit(sourcePort_, _credit);
+
+  // recycle the credit
+  _credit->clear();
+  creditTimes_.at(creditHead_) = U64_MAX;
+  creditHead_ = (creditHead_ + 1) % credits_.size();
+  creditCount_--;
+}
+
+void Channel::scheduleWakeUp(u64 _time) {
+  // deliveries are in time order, thus a pending wake-up is never late
+  if (wakeTime_ == U64_MAX) {
+    wakeTime_ = _time;
+    addEvent<&Channel::wakeUp>(_time, 1, nullptr);
+  } else {
+    assert(wakeTime_ <= _time);
+  }
+}
+
+void Channel::wakeUp() {
+  u64 now = gSim->time();
+  assert(wakeTime_ == now);
+
+  // deliver all flits and credits that are due (the receivers might set new
+  //  ones, which are due in the future and are covered by the next wake-up)
+  while ((flitCount_ > 0) && (flitTimes_.at(flitHead_) == now)) {
+    Flit* flit = flits_.at(flitHead_);
+    flits_.at(flitHead_) = nullptr;
+    flitTimes_.at(flitHead_) = U64_MAX;
+    flitHead_ = (flitHead_ + 1) % flits_.size();
+    flitCount_--;
+    deliverFlit(flit);
+  }
+  while ((creditCount_ > 0) && (creditTimes_.at(creditHead_) == now)) {
+    deliverCredit(&credits_.at(creditHead_));
+  }
+
+  // schedule the next wake-up, if anything is still in flight
+  wakeTime_ = U64_MAX;
+  u64 nextTime = U64_MAX;
+  if (flitCount_ > 0) {
+    nextTime = flitTimes_.at(flitHead_);
+  }
+  if ((creditCount_ > 0) && (creditTimes_.at(creditHead_) < nextTime)) {
+    nextTime = creditTimes_.at(creditHead_);
+  }
+  if (nextTime != U64_MAX) {
+    assert(nextTime > now);
+    scheduleWakeUp(nextTime);
   }
 }
 
@@ -131,22 +245,42 @@ u64 Channel::setNextFlit(Flit* _flit) {
   nextFlitTime_ = nextSlot;
   nextFlit_ = _flit;
 
-  // add the event of when the flit will arrive on the other end
+  // add the event of when the flit will arrive on the other end, or put it
+  //  in the delay line
   u64 nextTime = gSim->futureCycle(Simulator::Clock::CHANNEL, latency_);
-  addEvent(nextTime, 1, _flit, FLIT);
+  if (mode_ == Mode::kEvent) {
+    addEvent<&Channel::deliverFlit>(nextTime, 1, _flit);
+  } else {
+    assert(flitCount_ < flits_.size());
+    u32 next = (flitHead_ + flitCount_) % flits_.size();
+    flitCount_++;
+    flits_.at(next) = _flit;
+    flitTimes_.at(next) = nextTime;
+    scheduleWakeUp(nextTime);
+  }
 
   // increment the count when monitoring
   assert(_flit->getVc() < numVcs_);
   if (monitoring_) {
     monitorCounts_.at(_flit->getVc())++;
     monitorCounts_.at(numVcs_)++;
+    if (windowLog_) {
+      if (gSim->time() >= windowEnd_) {
+        // move to the window holding this flit, skipping empty windows
+        flushWindow(windowEnd_);
+        windowStart_ = gSim->time() - (gSim->time() % windowLength_);
+        windowEnd_ = windowStart_ + windowLength_;
+      }
+      windowCounts_[_flit->getVc()]++;
+      windowFlits_++;
+    }
   }
 
   // return the injection time
   return nextFlitTime_;
 }
 
-Credit* Channel::getNextCredit() const {
+Credit* Channel::getNextCredit() {
   // determine the next time slot to send a credit
   u64 nextSlot = gSim->futureCycle(Simulator::Clock::CHANNEL, 1);
 
@@ -154,24 +288,35 @@ Credit* Channel::getNextCredit() const {
   if (nextCreditTime_ != nextSlot) {
     return nullptr;
   } else {
-    // if it was set, return it
-    return nextCredit_;
+    // if it was set, return it (the most recently reserved credit)
+    assert(creditCount_ > 0);
+    u32 last = (creditHead_ + creditCount_ - 1) % credits_.size();
+    return &credits_.at(last);
   }
 }
 
-u64 Channel::setNextCredit(Credit* _credit) {
+Credit* Channel::setNextCredit() {
   // determine the next time slot to send a credit
   u64 nextSlot = gSim->futureCycle(Simulator::Clock::CHANNEL, 1);
   assert(nextSlot != nextCreditTime_);
 
-  // set the time and value
+  // set the time and reserve the credit
   nextCreditTime_ = nextSlot;
-  nextCredit_ = _credit;
+  assert(creditCount_ < credits_.size());
+  u32 next = (creditHead_ + creditCount_) % credits_.size();
+  creditCount_++;
+  Credit* credit = &credits_.at(next);
+  assert(!credit->more());
 
-  // add the event of when the credit will arrive on the other end
+  // add the event of when the credit will arrive on the other end, or let
+  //  the delay line deliver it
   u64 nextTime = gSim->futureCycle(Simulator::Clock::CHANNEL, latency_);
-  addEvent(nextTime, 1, _credit, CRDT);
+  creditTimes_.at(next) = nextTime;
+  if (mode_ == Mode::kEvent) {
+    addEvent<&Channel::deliverCredit>(nextTime, 1, credit);
+  } else {
+    scheduleWakeUp(nextTime);
+  }
 
-  // return the injection time
-  return nextCreditTime_;
+  return credit;
 }
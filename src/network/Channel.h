@@ -21,26 +21,37 @@
 #include "event/Component.h"
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
+#include "types/Credit.h"
 
+class ChannelLog;
+class CreditReceiver;
 class Flit;
 class FlitReceiver;
-class Credit;
-class CreditReceiver;
 
 class Channel : public Component {
  public:
+  /*
+   * In event mode every flit and credit is its own event in the simulator's
+   * queue. In delay line mode the in-flight flits and credits are held in
+   * rings inside of the channel and the channel has at most one wake-up
+   * event in the queue at any time.
+   */
+  enum class Mode { kEvent, kDelayLine };
+
   Channel(const std::string& _name, const Component* _parent, u32 _numVcs,
-          nlohmann::json _settings);
+          const nlohmann::json& _settings);
   Channel(const std::string& _name, const Component* _parent, u32 _numVcs,
-          u32 _latency);
+          u32 _latency, Mode _mode);
   ~Channel();
   u32 latency() const;
+  Mode mode() const;
   void setSource(CreditReceiver* _source, u32 _port);
   void setSink(FlitReceiver* _sink, u32 _port);
-  void startMonitoring();
+  // when '_windowLog' isn't nullptr, per VC flit counts are also kept for
+  //  fixed length windows and given to it as each window completes
+  void startMonitoring(ChannelLog* _windowLog = nullptr);
   void endMonitoring();
   f64 utilization(u32 _vc) const;  // U32_MAX for total
-  void processEvent(void* _event, s32 _type) override;
 
   /*
    * This retrieves the flit that exists in the event queue for the next
@@ -61,28 +72,55 @@ class Channel : public Component {
    * This retrieves the credit that exists in the event queue for the next
    * credit time in the future. nullptr is returned if it has not been set.
    */
-  Credit* getNextCredit() const;
+  Credit* getNextCredit();
 
   /*
-   * Sets 'credit' to be the next credit to traverse the channel. This inserts
-   * an event into the event queue. If an existing credit is already set for
-   * this time, an assertion will fail!
-   * This returns the time the credit will be injected into the channel,
-   * which is guaranteed to be in the future.
+   * This reserves an empty credit to be the next credit to traverse the
+   * channel and returns it to be filled in. This inserts an event into the
+   * event queue. If an existing credit is already set for this time, an
+   * assertion will fail!
+   * The credit is owned by the channel and is only valid until it has been
+   * delivered to the source.
    */
-  u64 setNextCredit(Credit* _credit);
+  Credit* setNextCredit();
 
  private:
+  static Mode parseMode(const std::string& _mode);
+
+  void deliverFlit(Flit* _flit);
+  void deliverCredit(Credit* _credit);
+  void scheduleWakeUp(u64 _time);
+  void wakeUp();
+  void flushWindow(u64 _windowEnd);
+
   const u32 latency_;
   const u32 numVcs_;
+  const Mode mode_;
 
   u64 nextFlitTime_;
   Flit* nextFlit_;
   u64 nextCreditTime_;
-  Credit* nextCredit_;
+
+  // rings of in-flight flits and credits with their delivery times, the flit
+  //  ring is only used in delay line mode
+  std::vector<Flit*> flits_;
+  std::vector<u64> flitTimes_;
+  u32 flitHead_;  // next flit to be delivered
+  u32 flitCount_;
+  std::vector<Credit> credits_;
+  std::vector<u64> creditTimes_;
+  u32 creditHead_;  // next credit to be delivered
+  u32 creditCount_;
+  u64 wakeTime_;  // U64_MAX when no wake-up is scheduled
   bool monitoring_;
   u64 monitorTime_;
   std::vector<u64> monitorCounts_;
+  ChannelLog* windowLog_;
+  u64 windowLength_;
+  u64 windowStart_;  // clipped to the start of monitoring
+  u64 windowEnd_;
+  u64 windowFlits_;
+  std::vector<u64> windowCounts_;
 
   CreditReceiver* source_;  // sends flits, receives credits
   u32 sourcePort_;
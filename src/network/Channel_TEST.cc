@@ -15,18 +15,25 @@
 #include "network/Channel.h"
 
 #include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <new>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 #include "event/Component.h"
 #include "gtest/gtest.h"
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
+#include "stats/ChannelLog.h"
 #include "test/TestSetup_TESTLIB.h"
 #include "types/Credit.h"
 #include "types/CreditReceiver.h"
 #include "types/Flit.h"
 #include "types/FlitReceiver.h"
+#include "types/Packet.h"
 
 const bool DEBUG = false;
 
@@ -111,7 +118,7 @@ void Source::expect(u64 _time) {
 }
 
 void Source::processEvent(void* _event, s32 _type) {
-  Flit* flit = new Flit(0, false, false, nullptr);
+  Flit* flit = Packet::create(0, 1, nullptr)->getFlit(0);
   u32 vc = gSim->rnd.nextU64(0, 7);
   flit->setVc(vc);
   assert(channel_->getNextFlit() == nullptr);
@@ -124,7 +131,8 @@ void Source::receiveCredit(u32 _port, Credit* _credit) {
   assert(_port == port_);
   assert(expected_.count(gSim->time()) == 1);
   expected_.erase(gSim->time());
-  delete _credit;
+  assert(_credit->getNum() == 0);
+  assert(!_credit->more());
 }
 
 /* Sink impl */
@@ -170,9 +178,9 @@ void Sink::expect(u64 _time) {
 }
 
 void Sink::processEvent(void* _event, s32 _type) {
-  Credit* credit = new Credit(1);
   assert(channel_->getNextCredit() == nullptr);
-  channel_->setNextCredit(credit);
+  Credit* credit = channel_->setNextCredit();
+  credit->putNum(0);
   dbgprintf("sink injecting at %lu", gSim->time());
 }
 
@@ -181,7 +189,7 @@ void Sink::receiveFlit(u32 _port, Flit* _flit) {
   assert(_port == port_);
   assert(expected_.count(gSim->time()) == 1);
   expected_.erase(gSim->time());
-  delete _flit;
+  delete _flit->packet();
 }
 
 /* Monitoring */
@@ -209,34 +217,260 @@ class EndMonitoring : public Component {
 
 TEST(Channel, full) {
   u64 seed = 12345678;
-  for (u32 cycleTime = 1; cycleTime <= 100; cycleTime += 26) {
-    TestSetup setup(cycleTime, cycleTime, cycleTime, cycleTime, seed++);
+  for (const char* mode : {"event", "delay_line"}) {
+    for (u32 cycleTime = 1; cycleTime <= 100; cycleTime += 26) {
+      TestSetup setup(cycleTime, cycleTime, cycleTime, cycleTime, seed++);
+
+      const u32 latency = gSim->rnd.nextU64(1, 5);
+
+      nlohmann::json settings;
+      settings["latency"] = latency;
+      settings["mode"] = mode;
+      Channel c("TestChannel", nullptr, 8, settings);
+
+      Source source(&c);
+      Sink sink(&c);
+      source.setSink(&sink);
+      sink.setSource(&source);
+
+      const u32 clocks = 10000;
+      const u32 flits = gSim->rnd.nextU64(1, clocks);
+      const u32 credits = gSim->rnd.nextU64(1, clocks);
+      source.load(flits, clocks);
+      sink.load(credits, clocks);
+
+      EndMonitoring ender(&c, clocks);
+
+      gSim->initialize();
+      gSim->simulate();
+
+      f64 actUtil = c.utilization(U32_MAX);
+      f64 expUtil = static_cast<f64>(flits) / clocks;
+      f64 absDelta = std::abs(actUtil - expUtil);
+      ASSERT_LE(absDelta, 0.0001);
+    }
+  }
+}
+
+/* Windowed monitoring */
+
+class WindowDriver : public Component,
+                     public CreditReceiver,
+                     public FlitReceiver {
+ public:
+  enum Type : s32 { kStart, kEnd, kFlit };
+
+  WindowDriver(Channel* _channel, ChannelLog* _log, u64 _start, u64 _end,
+               u64 _cycles)
+      : Component("WindowDriver", nullptr), channel_(_channel), log_(_log) {
+    channel_->setSource(this, 0);
+    channel_->setSink(this, 0);
+    addEvent(gSim->futureCycle(Simulator::Clock::CHANNEL, _start), 0, nullptr,
+             kStart);
+    addEvent(gSim->futureCycle(Simulator::Clock::CHANNEL, _end), 0, nullptr,
+             kEnd);
+    // one flit per cycle, after monitoring starts or ends within that cycle
+    for (u64 cycle = 1; cycle <= _cycles; cycle++) {
+      addEvent(gSim->futureCycle(Simulator::Clock::CHANNEL, cycle), 1, nullptr,
+               kFlit);
+    }
+  }
+
+  ~WindowDriver() {}
+
+  void processEvent(void* _event, s32 _type) override {
+    switch (_type) {
+      case kStart:
+        channel_->startMonitoring(log_);
+        break;
+
+      case kEnd:
+        channel_->endMonitoring();
+        break;
+
+      case kFlit: {
+        Flit* flit = Packet::create(0, 1, nullptr)->getFlit(0);
+        flit->setVc(gSim->cycle(Simulator::Clock::CHANNEL) % 2);
+        channel_->setNextFlit(flit);
+        break;
+      }
+
+      default:
+        assert(false);
+    }
+  }
+
+  void receiveFlit(u32 _port, Flit* _flit) override {
+    delete _flit->packet();
+  }
+
+  void receiveCredit(u32 _port, Credit* _credit) override {}
+
+ private:
+  Channel* channel_;
+  ChannelLog* log_;
+};
+
+TEST(Channel, windows) {
+  TestSetup setup(1, 1, 1, 1, 0x5EED);
+  const std::string filename = "channel_windows_TEST.csv";
+
+  // monitoring covers cycles 5 through 24, neither end is on a window edge
+  nlohmann::json settings;
+  settings["window"] = 10;
+  settings["window_file"] = filename;
+  ChannelLog* log = new ChannelLog(2, settings);
+  Channel c("TestChannel", nullptr, 2, 1, Channel::Mode::kEvent);
+  WindowDriver driver(&c, log, 5, 25, 30);
+
+  gSim->initialize();
+  gSim->simulate();
+  delete log;
+
+  // the edge windows are divided by their clipped lengths
+  std::vector<std::string> exp = {
+      "time,name,0,1,total",
+      "5,TestChannel,0.400000,0.600000,1.000000",
+      "10,TestChannel,0.500000,0.500000,1.000000",
+      "20,TestChannel,0.600000,0.400000,1.000000"};
+  std::vector<std::string> act;
+  std::ifstream file(filename);
+  std::string line;
+  while (std::getline(file, line)) {
+    act.push_back(line);
+  }
+  std::remove(filename.c_str());
+  ASSERT_EQ(act, exp);
+
+  // the windows add up to the whole monitoring period
+  ASSERT_EQ(c.utilization(U32_MAX), 1.0);
+}
+
+/* Credit allocation benchmark */
 
-    const u32 latency = gSim->rnd.nextU64(1, 5);
+// this counts all heap allocations made in this test binary
+static u64 gAllocations = 0;
 
-    nlohmann::json settings;
-    settings["latency"] = latency;
-    Channel c("TestChannel", nullptr, 8, settings);
+void* operator new(std::size_t _size) {
+  gAllocations++;
+  void* memory = std::malloc(_size);
+  if (memory == nullptr) {
+    throw std::bad_alloc();
+  }
+  return memory;
+}
+
+void operator delete(void* _memory) noexcept {
+  std::free(_memory);
+}
+
+void operator delete(void* _memory, std::size_t _size) noexcept {
+  std::free(_memory);
+}
+
+class CreditStreamer : public Component, public CreditReceiver {
+ public:
+  CreditStreamer(Channel* _channel, u32 _numVcs, u64 _cycles, u64 _warmup)
+      : Component("CreditStreamer", nullptr),
+        channel_(_channel),
+        numVcs_(_numVcs),
+        cycles_(_cycles),
+        warmup_(_warmup),
+        cycle_(0),
+        received_(0),
+        startAllocations_(0),
+        endAllocations_(0),
+        maxQueueSize_(0) {
+    channel_->setSource(this, 0);
+    addEvent(gSim->futureCycle(Simulator::Clock::CHANNEL, 1), 0, nullptr, 0);
+  }
+
+  ~CreditStreamer() {}
+
+  void processEvent(void* _event, s32 _type) override {
+    cycle_++;
+    if (cycle_ == warmup_) {
+      startAllocations_ = gAllocations;
+    }
+    if (gSim->queueSize() > maxQueueSize_) {
+      maxQueueSize_ = gSim->queueSize();
+    }
+
+    // return a credit on every VC, this is the worst case for the channel
+    for (u32 vc = 0; vc < numVcs_; vc++) {
+      Credit* credit = channel_->getNextCredit();
+      if (credit == nullptr) {
+        credit = channel_->setNextCredit();
+      }
+      credit->putNum(vc);
+    }
+
+    if (cycle_ < cycles_) {
+      addEvent(gSim->futureCycle(Simulator::Clock::CHANNEL, 1), 0, nullptr, 0);
+    } else {
+      endAllocations_ = gAllocations;
+    }
+  }
+
+  void receiveCredit(u32 _port, Credit* _credit) override {
+    u32 expVc = 0;
+    while (_credit->more()) {
+      ASSERT_EQ(_credit->getNum(), expVc++);
+      received_++;
+    }
+  }
+
+  u64 received() const {
+    return received_;
+  }
+
+  f64 allocationsPerCycle() const {
+    return (f64)(endAllocations_ - startAllocations_) / (cycles_ - warmup_);
+  }
+
+  u64 maxQueueSize() const {
+    return maxQueueSize_;
+  }
 
-    Source source(&c);
-    Sink sink(&c);
-    source.setSink(&sink);
-    sink.setSource(&source);
+ private:
+  Channel* channel_;
+  const u32 numVcs_;
+  const u64 cycles_;
+  const u64 warmup_;
+  u64 cycle_;
+  u64 received_;
+  u64 startAllocations_;
+  u64 endAllocations_;
+  u64 maxQueueSize_;
+};
 
-    const u32 clocks = 10000;
-    const u32 flits = gSim->rnd.nextU64(1, clocks);
-    const u32 credits = gSim->rnd.nextU64(1, clocks);
-    source.load(flits, clocks);
-    sink.load(credits, clocks);
+TEST(Channel, creditAllocations) {
+  // before credits became value types this measured 2 allocations per cycle
+  const u32 numVcs = 8;
+  const u32 latency = 50;
+  const u64 cycles = 100000;
+  const u64 warmup = 1000;
 
-    EndMonitoring ender(&c, clocks);
+  for (Channel::Mode mode : {Channel::Mode::kEvent,
+                             Channel::Mode::kDelayLine}) {
+    TestSetup setup(1, 1, 1, 1, 0xBAADF00D);
+    Channel c("TestChannel", nullptr, numVcs, latency, mode);
+    CreditStreamer streamer(&c, numVcs, cycles, warmup);
 
     gSim->initialize();
     gSim->simulate();
 
-    f64 actUtil = c.utilization(U32_MAX);
-    f64 expUtil = static_cast<f64>(flits) / clocks;
-    f64 absDelta = std::abs(actUtil - expUtil);
-    ASSERT_LE(absDelta, 0.0001);
+    // all credits were received
+    ASSERT_EQ(streamer.received(), cycles * numVcs);
+
+    // no credit is allocated once the channel is warmed up
+    ASSERT_EQ(streamer.allocationsPerCycle(), 0.0);
+
+    // the delay line only holds the streamer's event and one wake-up
+    if (mode == Channel::Mode::kDelayLine) {
+      ASSERT_LE(streamer.maxQueueSize(), 2u);
+    } else {
+      ASSERT_GE(streamer.maxQueueSize(), latency);
+    }
   }
 }
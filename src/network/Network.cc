@@ -77,9 +77,11 @@ void Network::startMonitoring() {
   monitoring_ = true;
   std::vector<Channel*> channels;
   collectChannels(&channels);
+  ChannelLog* windowLog =
+      channelLog_->windowLength() > 0 ? channelLog_ : nullptr;
   for (auto it = channels.begin(); it != channels.end(); ++it) {
     Channel* c = *it;
-    c->startMonitoring();
+    c->startMonitoring(windowLog);
   }
 }
 
@@ -25,7 +25,8 @@ namespace Butterfly {
 DestTagRoutingAlgorithm::DestTagRoutingAlgorithm(
     const std::string& _name, const Component* _parent, Router* _router,
     u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc, u32 _numPorts,
-    u32 _numStages, u32 _interfacePorts, u32 _stage, nlohmann::json _settings)
+    u32 _numStages, u32 _interfacePorts, u32 _stage,
+    const nlohmann::json& _settings)
     : RoutingAlgorithm(_name, _parent, _router, _baseVc, _numVcs, _inputPort,
                        _inputVc, _numPorts, _numStages, _interfacePorts, _stage,
                        _settings) {}
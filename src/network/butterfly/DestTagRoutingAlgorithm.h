@@ -32,7 +32,7 @@ class DestTagRoutingAlgorithm : public RoutingAlgorithm {
                           Router* _router, u32 _baseVc, u32 _numVcs,
                           u32 _inputPort, u32 _inputVc, u32 _numPorts,
                           u32 _numStages, u32 _interfacePorts, u32 _stage,
-                          nlohmann::json _settings);
+                          const nlohmann::json& _settings);
   ~DestTagRoutingAlgorithm();
 
  protected:
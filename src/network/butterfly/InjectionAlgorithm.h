@@ -25,7 +25,7 @@
 
 #define BUTTERFLY_INJECTIONALGORITHM_ARGS                          \
   const std::string&, const Component*, Interface*, u32, u32, u32, \
-      nlohmann::json
+      const nlohmann::json&
 
 namespace Butterfly {
 
@@ -33,7 +33,7 @@ class InjectionAlgorithm : public ::InjectionAlgorithm {
  public:
   InjectionAlgorithm(const std::string& _name, const Component* _parent,
                      Interface* _interface, u32 _baseVc, u32 _numVcs,
-                     u32 _inputPc, nlohmann::json _settings);
+                     u32 _inputPc, const nlohmann::json& _settings);
   virtual ~InjectionAlgorithm();
 
   // this is a injection algorithm factory for the Butterfly topology
@@ -26,7 +26,7 @@
 
 #define BUTTERFLY_ROUTINGALGORITHM_ARGS                                        \
   const std::string&, const Component*, Router*, u32, u32, u32, u32, u32, u32, \
-      u32, u32, nlohmann::json
+      u32, u32, const nlohmann::json&
 
 namespace Butterfly {
 
@@ -35,7 +35,8 @@ class RoutingAlgorithm : public ::RoutingAlgorithm {
   RoutingAlgorithm(const std::string& _name, const Component* _parent,
                    Router* _router, u32 _baseVc, u32 _numVcs, u32 _inputPort,
                    u32 _inputVc, u32 _numPorts, u32 _numStages,
-                   u32 _interfacePorts, u32 _stage, nlohmann::json _settings);
+                   u32 _interfacePorts, u32 _stage,
+                   const nlohmann::json& _settings);
   virtual ~RoutingAlgorithm();
 
   // this is a routing algorithm factory for the butterfly topology
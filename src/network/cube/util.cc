@@ -126,4 +126,10 @@ u32 translateRouterAddressToId(const std::vector<u32>* _address,
   return sum;
 }
 
+u32 translateInterfaceIdToRouterId(u32 _id, u32 _concentration,
+                                   u32 _interfacePorts) {
+  // interface ids are little endian addresses, the concentration is lowest
+  return _id / (_concentration / _interfacePorts);
+}
+
 }  // namespace Cube
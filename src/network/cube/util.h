@@ -40,6 +40,10 @@ void translateRouterIdToAddress(const u32 _id, const std::vector<u32>& _widths,
 u32 translateRouterAddressToId(const std::vector<u32>* _address,
                                const std::vector<u32>& _widths);
 
+// this returns the id of the router an interface is attached to
+u32 translateInterfaceIdToRouterId(u32 _id, u32 _concentration,
+                                   u32 _interfacePorts);
+
 }  // namespace Cube
 
 #endif  // NETWORK_CUBE_UTIL_H_
@@ -195,3 +195,22 @@ TEST(CubeUtil, translateRouterAddressToId) {
   address = {2, 1, 2};
   ASSERT_EQ(17u, Cube::translateRouterAddressToId(&address, widths));
 }
+
+TEST(CubeUtil, translateInterfaceIdToRouterId) {
+  const std::vector<u32> widths({3, 2, 3});
+  const u32 concentration = 4;
+  const u32 interfacePorts = 2;
+
+  std::vector<u32> interfaceAddress;
+  std::vector<u32> routerAddress;
+  u32 numInterfaces =
+      Cube::computeNumInterfaces(widths, concentration, interfacePorts);
+  for (u32 id = 0; id < numInterfaces; id++) {
+    Cube::translateInterfaceIdToAddress(id, widths, concentration,
+                                        interfacePorts, &interfaceAddress);
+    routerAddress.assign(interfaceAddress.begin() + 1, interfaceAddress.end());
+    ASSERT_EQ(Cube::translateRouterAddressToId(&routerAddress, widths),
+              Cube::translateInterfaceIdToRouterId(id, concentration,
+                                                   interfacePorts));
+  }
+}
@@ -16,7 +16,6 @@
 
 #include <cassert>
 #include <tuple>
-#include <unordered_set>
 #include <vector>
 
 #include "factory/ObjectFactory.h"
@@ -36,7 +35,7 @@ static const u32 kGlobalMin = 5;
 static const u32 kDst1 = 6;
 
 std::vector<u32> AdaptiveRoutingAlgorithm::createRoutingClasses(
-    nlohmann::json _settings) {
+    const nlohmann::json& _settings) {
   assert(_settings.contains("progressive_adaptive"));
   bool par = _settings["progressive_adaptive"].get<bool>();
   assert(_settings.contains("valiant_node"));
@@ -60,7 +59,7 @@ AdaptiveRoutingAlgorithm::AdaptiveRoutingAlgorithm(
     u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc, u32 _localWidth,
     u32 _localWeight, u32 _globalWidth, u32 _globalWeight, u32 _concentration,
     u32 _interfacePorts, u32 _routerRadix, u32 _globalPortsPerRouter,
-    nlohmann::json _settings)
+    const nlohmann::json& _settings)
     : RoutingAlgorithm(_name, _parent, _router, _baseVc, _numVcs, _inputPort,
                        _inputVc, _localWidth, _localWeight, _globalWidth,
                        _globalWeight, _concentration, _interfacePorts,
@@ -251,7 +250,7 @@ void AdaptiveRoutingAlgorithm::processRequest(
   }
 
   // reduction phase
-  const std::unordered_set<std::tuple<u32, u32>>* outputs =
+  const std::vector<std::tuple<u32, u32>>* outputs =
       reduction_->reduce(nullptr);
   for (const auto& t : *outputs) {
     u32 port = std::get<0>(t);
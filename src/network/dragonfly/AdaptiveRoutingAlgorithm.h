@@ -36,7 +36,8 @@ class AdaptiveRoutingAlgorithm : public RoutingAlgorithm {
                            u32 _localWeight, u32 _globalWidth,
                            u32 _globalWeight, u32 _concentration,
                            u32 _interfacePorts, u32 _routerRadix,
-                           u32 _globalPortsPerRouter, nlohmann::json _settings);
+                           u32 _globalPortsPerRouter,
+                           const nlohmann::json& _settings);
   ~AdaptiveRoutingAlgorithm();
 
  protected:
@@ -44,7 +45,7 @@ class AdaptiveRoutingAlgorithm : public RoutingAlgorithm {
                       RoutingAlgorithm::Response* _response) override;
 
  private:
-  static std::vector<u32> createRoutingClasses(nlohmann::json _settings);
+  static std::vector<u32> createRoutingClasses(const nlohmann::json& _settings);
   void addPort(u32 _port, u32 _hops, u32 _routingClass);
 
   void addPortsToLocalRouter(u32 _src, u32 _dst, bool _minimalOnly, u32 _minRc,
@@ -36,7 +36,7 @@ class MinimalRoutingAlgorithm : public RoutingAlgorithm {
                           u32 _localWeight, u32 _globalWidth, u32 _globalWeight,
                           u32 _concentration, u32 _interfacePorts,
                           u32 _routerRadix, u32 _globalPortsPerRouter,
-                          nlohmann::json _settings);
+                          const nlohmann::json& _settings);
   ~MinimalRoutingAlgorithm();
 
  protected:
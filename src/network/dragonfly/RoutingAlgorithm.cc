@@ -25,7 +25,7 @@ RoutingAlgorithm::RoutingAlgorithm(
     u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc, u32 _localWidth,
     u32 _localWeight, u32 _globalWidth, u32 _globalWeight, u32 _concentration,
     u32 _interfacePorts, u32 _routerRadix, u32 _globalPortsPerRouter,
-    nlohmann::json _settings)
+    const nlohmann::json& _settings)
     : ::RoutingAlgorithm(_name, _parent, _router, _baseVc, _numVcs, _inputPort,
                          _inputVc, _settings),
       localWidth_(_localWidth),
@@ -44,7 +44,7 @@ RoutingAlgorithm* RoutingAlgorithm::create(
     u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc, u32 _localWidth,
     u32 _localWeight, u32 _globalWidth, u32 _globalWeight, u32 _concentration,
     u32 _interfacePorts, u32 _routerRadix, u32 _globalPortsPerRouter,
-    nlohmann::json _settings) {
+    const nlohmann::json& _settings) {
   // retrieve the algorithm
   const std::string& algorithm = _settings["algorithm"].get<std::string>();
 
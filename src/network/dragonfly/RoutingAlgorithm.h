@@ -26,7 +26,7 @@
 
 #define DRAGONFLY_ROUTINGALGORITHM_ARGS                                        \
   const std::string&, const Component*, Router*, u32, u32, u32, u32, u32, u32, \
-      u32, u32, u32, u32, u32, u32, nlohmann::json
+      u32, u32, u32, u32, u32, u32, const nlohmann::json&
 
 namespace Dragonfly {
 
@@ -37,7 +37,7 @@ class RoutingAlgorithm : public ::RoutingAlgorithm {
                    u32 _inputVc, u32 _localWidth, u32 _localWeight,
                    u32 _globalWidth, u32 _globalWeight, u32 _concentration,
                    u32 _interfacePorts, u32 _routerRadix,
-                   u32 _globalPortsPerRouter, nlohmann::json _settings);
+                   u32 _globalPortsPerRouter, const nlohmann::json& _settings);
   virtual ~RoutingAlgorithm();
 
   // this is a routing algorithm factory for the dragonfly topology
@@ -16,7 +16,6 @@
 
 #include <cassert>
 #include <tuple>
-#include <unordered_set>
 #include <vector>
 
 #include "factory/ObjectFactory.h"
@@ -31,7 +30,7 @@ CommonAncestorRoutingAlgorithm::CommonAncestorRoutingAlgorithm(
     const std::string& _name, const Component* _parent, Router* _router,
     u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc,
     const std::vector<std::tuple<u32, u32, u32>>* _radices, u32 _interfacePorts,
-    nlohmann::json _settings)
+    const nlohmann::json& _settings)
     : RoutingAlgorithm(_name, _parent, _router, _baseVc, _numVcs, _inputPort,
                        _inputVc, _radices, _interfacePorts, _settings),
       mode_(parseRoutingMode(_settings["mode"].get<std::string>())),
@@ -134,7 +133,7 @@ void CommonAncestorRoutingAlgorithm::processRequest(
   }
 
   // reduction phase
-  const std::unordered_set<std::tuple<u32, u32>>* outputs =
+  const std::vector<std::tuple<u32, u32>>* outputs =
       reduction_->reduce(nullptr);
   for (const auto& t : *outputs) {
     u32 port = std::get<0>(t);
@@ -38,7 +38,7 @@ class CommonAncestorRoutingAlgorithm : public RoutingAlgorithm {
       const std::string& _name, const Component* _parent, Router* _router,
       u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc,
       const std::vector<std::tuple<u32, u32, u32>>* _radices,
-      u32 _interfacePorts, nlohmann::json _settings);
+      u32 _interfacePorts, const nlohmann::json& _settings);
   ~CommonAncestorRoutingAlgorithm();
 
  protected:
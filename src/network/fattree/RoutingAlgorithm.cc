@@ -24,7 +24,7 @@ RoutingAlgorithm::RoutingAlgorithm(
     const std::string& _name, const Component* _parent, Router* _router,
     u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc,
     const std::vector<std::tuple<u32, u32, u32>>* _radices, u32 _interfacePorts,
-    nlohmann::json _settings)
+    const nlohmann::json& _settings)
     : ::RoutingAlgorithm(_name, _parent, _router, _baseVc, _numVcs, _inputPort,
                          _inputVc, _settings),
       radices_(_radices),
@@ -36,7 +36,7 @@ RoutingAlgorithm* RoutingAlgorithm::create(
     const std::string& _name, const Component* _parent, Router* _router,
     u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc,
     const std::vector<std::tuple<u32, u32, u32>>* _radices, u32 _interfacePorts,
-    nlohmann::json _settings) {
+    const nlohmann::json& _settings) {
   // retrieve the algorithm
   const std::string& algorithm = _settings["algorithm"].get<std::string>();
 
@@ -27,7 +27,7 @@
 
 #define FATTREE_ROUTINGALGORITHM_ARGS                                \
   const std::string&, const Component*, Router*, u32, u32, u32, u32, \
-      const std::vector<std::tuple<u32, u32, u32>>*, u32, nlohmann::json
+      const std::vector<std::tuple<u32, u32, u32>>*, u32, const nlohmann::json&
 
 namespace FatTree {
 
@@ -37,7 +37,7 @@ class RoutingAlgorithm : public ::RoutingAlgorithm {
                    Router* _router, u32 _baseVc, u32 _numVcs, u32 _inputPort,
                    u32 _inputVc,
                    const std::vector<std::tuple<u32, u32, u32>>* _radices,
-                   u32 _interfacePorts, nlohmann::json _settings);
+                   u32 _interfacePorts, const nlohmann::json& _settings);
   virtual ~RoutingAlgorithm();
 
   // this is a routing algorithm factory for the fat tree topology
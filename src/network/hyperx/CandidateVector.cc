@@ -0,0 +1,89 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "network/hyperx/CandidateVector.h"
+
+#include <cassert>
+
+namespace HyperX {
+
+CandidateVector::CandidateVector(u32 _capacity) : capacity_(_capacity) {
+  candidates_.reserve(capacity_);
+}
+
+CandidateVector::~CandidateVector() {}
+
+u32 CandidateVector::capacity() const {
+  return capacity_;
+}
+
+u32 CandidateVector::size() const {
+  return candidates_.size();
+}
+
+bool CandidateVector::empty() const {
+  return candidates_.empty();
+}
+
+void CandidateVector::clear() {
+  candidates_.clear();
+}
+
+void CandidateVector::add(const Candidate& _candidate) {
+  assert(candidates_.size() < capacity_);
+  candidates_.push_back(_candidate);
+}
+
+void CandidateVector::add(u32 _port, u32 _vc, f64 _congestion) {
+  assert(candidates_.size() < capacity_);
+  candidates_.emplace_back(_port, _vc, _congestion);
+}
+
+void CandidateVector::erase(const Candidate* _candidate) {
+  assert(_candidate >= begin() && _candidate < end());
+  candidates_.erase(candidates_.begin() + (_candidate - begin()));
+}
+
+void CandidateVector::assign(const CandidateVector& _other) {
+  assert(_other.size() <= capacity_);
+  candidates_.assign(_other.candidates_.begin(), _other.candidates_.end());
+}
+
+void CandidateVector::swap(CandidateVector* _other) {
+  assert(_other->capacity_ == capacity_);
+  candidates_.swap(_other->candidates_);
+}
+
+bool CandidateVector::contains(const Candidate& _candidate) const {
+  for (const Candidate& candidate : candidates_) {
+    if (candidate == _candidate) {
+      return true;
+    }
+  }
+  return false;
+}
+
+const CandidateVector::Candidate& CandidateVector::at(u32 _index) const {
+  return candidates_.at(_index);
+}
+
+const CandidateVector::Candidate* CandidateVector::begin() const {
+  return candidates_.data();
+}
+
+const CandidateVector::Candidate* CandidateVector::end() const {
+  return candidates_.data() + candidates_.size();
+}
+
+}  // namespace HyperX
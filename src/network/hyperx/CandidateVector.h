@@ -0,0 +1,62 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NETWORK_HYPERX_CANDIDATEVECTOR_H_
+#define NETWORK_HYPERX_CANDIDATEVECTOR_H_
+
+#include <tuple>
+#include <vector>
+
+#include "prim/prim.h"
+
+namespace HyperX {
+
+/*
+ * This is a fixed capacity pool of routing candidates {port, vc, congestion}.
+ *  The storage is allocated once at construction so clearing and refilling it
+ *  on every routing decision never touches the heap. Candidates are kept in
+ *  insertion order, making iteration and random selection deterministic.
+ *  Callers must not add the same candidate twice.
+ */
+class CandidateVector {
+ public:
+  typedef std::tuple<u32, u32, f64> Candidate;
+
+  explicit CandidateVector(u32 _capacity);
+  ~CandidateVector();
+
+  u32 capacity() const;
+  u32 size() const;
+  bool empty() const;
+  void clear();
+
+  void add(const Candidate& _candidate);
+  void add(u32 _port, u32 _vc, f64 _congestion);
+  void erase(const Candidate* _candidate);
+  void assign(const CandidateVector& _other);
+  void swap(CandidateVector* _other);
+  bool contains(const Candidate& _candidate) const;
+
+  const Candidate& at(u32 _index) const;
+  const Candidate* begin() const;
+  const Candidate* end() const;
+
+ private:
+  const u32 capacity_;
+  std::vector<Candidate> candidates_;
+};
+
+}  // namespace HyperX
+
+#endif  // NETWORK_HYPERX_CANDIDATEVECTOR_H_
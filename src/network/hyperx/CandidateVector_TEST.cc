@@ -0,0 +1,70 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "network/hyperx/CandidateVector.h"
+
+#include <tuple>
+
+#include "gtest/gtest.h"
+#include "prim/prim.h"
+
+TEST(HyperX_CandidateVector, order) {
+  HyperX::CandidateVector pool(8);
+  ASSERT_EQ(pool.capacity(), 8u);
+  ASSERT_TRUE(pool.empty());
+
+  for (u32 idx = 0; idx < 8; idx++) {
+    pool.add(7 - idx, idx, idx * 0.5);
+  }
+  ASSERT_EQ(pool.size(), 8u);
+  for (u32 idx = 0; idx < 8; idx++) {
+    ASSERT_EQ(pool.at(idx), std::make_tuple(7 - idx, idx, idx * 0.5));
+  }
+
+  // erasing keeps the remaining candidates in insertion order
+  pool.erase(pool.begin() + 2);
+  pool.erase(pool.begin());
+  ASSERT_EQ(pool.size(), 6u);
+  u32 exp[] = {1, 3, 4, 5, 6, 7};
+  u32 idx = 0;
+  for (const auto& c : pool) {
+    ASSERT_EQ(std::get<1>(c), exp[idx]);
+    idx++;
+  }
+  ASSERT_TRUE(pool.contains(std::make_tuple(4u, 3u, 1.5)));
+  ASSERT_FALSE(pool.contains(std::make_tuple(7u, 0u, 0.0)));
+
+  pool.clear();
+  ASSERT_TRUE(pool.empty());
+  ASSERT_EQ(pool.capacity(), 8u);
+}
+
+TEST(HyperX_CandidateVector, assignSwap) {
+  HyperX::CandidateVector a(4);
+  HyperX::CandidateVector b(4);
+  a.add(1, 2, 0.25);
+  a.add(3, 4, 0.75);
+  b.add(5, 6, 1.0);
+
+  a.swap(&b);
+  ASSERT_EQ(a.size(), 1u);
+  ASSERT_EQ(a.at(0), std::make_tuple(5u, 6u, 1.0));
+  ASSERT_EQ(b.size(), 2u);
+  ASSERT_EQ(b.at(1), std::make_tuple(3u, 4u, 0.75));
+
+  a.assign(b);
+  ASSERT_EQ(a.size(), 2u);
+  ASSERT_EQ(a.at(0), std::make_tuple(1u, 2u, 0.25));
+  ASSERT_EQ(a.at(1), std::make_tuple(3u, 4u, 0.75));
+}
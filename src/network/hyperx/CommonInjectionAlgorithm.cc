@@ -21,7 +21,7 @@ namespace HyperX {
 
 CommonInjectionAlgorithm::CommonInjectionAlgorithm(
     const std::string& _name, const Component* _parent, Interface* _interface,
-    u32 _baseVc, u32 _numVcs, u32 _inputPc, nlohmann::json _settings)
+    u32 _baseVc, u32 _numVcs, u32 _inputPc, const nlohmann::json& _settings)
     : InjectionAlgorithm(_name, _parent, _interface, _baseVc, _numVcs, _inputPc,
                          _settings) {
   assert(_settings.contains("adaptive"));
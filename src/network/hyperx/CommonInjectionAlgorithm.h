@@ -27,7 +27,7 @@ class CommonInjectionAlgorithm : public InjectionAlgorithm {
  public:
   CommonInjectionAlgorithm(const std::string& _name, const Component* _parent,
                            Interface* _interface, u32 _baseVc, u32 _numVcs,
-                           u32 _inputPc, nlohmann::json _settings);
+                           u32 _inputPc, const nlohmann::json& _settings);
   ~CommonInjectionAlgorithm();
 
   void processMessage(Message* _message) override;
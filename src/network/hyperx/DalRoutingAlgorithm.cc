@@ -27,10 +27,53 @@ DalRoutingAlgorithm::DalRoutingAlgorithm(
     u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, nlohmann::json _settings)
+    u32 _interfacePorts, const nlohmann::json& _settings)
     : RoutingAlgorithm(_name, _parent, _router, _baseVc, _numVcs, _inputPort,
                        _inputVc, _dimensionWidths, _dimensionWeights,
-                       _concentration, _interfacePorts, _settings) {
+                       _concentration, _interfacePorts, _settings),
+      settings_(_settings),
+      maxOutputs_(settings_->maxOutputs),
+      outputAlg_(settings_->outputAlg),
+      thresholdMin_(settings_->thresholdMin),
+      thresholdNonMin_(settings_->thresholdNonMin),
+      threshold_(settings_->threshold),
+      iBias_(settings_->iBias),
+      cBias_(settings_->cBias),
+      biasMode_(settings_->biasMode),
+      hopCountMode_(settings_->hopCountMode),
+      outputTypePort_(settings_->outputTypePort),
+      adaptivityType_(settings_->adaptivityType),
+      decisionScheme_(settings_->decisionScheme),
+      multiDeroute_(settings_->multiDeroute),
+      maxDeroutesAllowed_(settings_->maxDeroutesAllowed),
+      outputVcsMin_(scratch(0)),
+      outputVcsDer_(scratch(1)),
+      vcPool_(scratch(2)),
+      outputPorts_(scratch(3)) {
+  if ((adaptivityType_ == AdaptiveRoutingAlg::DOALV) ||
+      (adaptivityType_ == AdaptiveRoutingAlg::DOALP)) {
+    assert(numVcs_ >= 2);
+  } else if ((adaptivityType_ == AdaptiveRoutingAlg::DDALV) ||
+             (adaptivityType_ == AdaptiveRoutingAlg::DDALP)) {
+    assert(numVcs_ >= dimensionWidths_.size() * 2);
+  } else if ((adaptivityType_ == AdaptiveRoutingAlg::VDALV) ||
+             (adaptivityType_ == AdaptiveRoutingAlg::VDALP)) {
+    assert(numVcs_ >= dimensionWidths_.size() + maxDeroutesAllowed_);
+  }
+
+  if ((adaptivityType_ == AdaptiveRoutingAlg::DOALP) ||
+      (adaptivityType_ == AdaptiveRoutingAlg::DOALV)) {
+    numVcSets_ = 2;
+  } else if ((adaptivityType_ == AdaptiveRoutingAlg::DDALP) ||
+             (adaptivityType_ == AdaptiveRoutingAlg::DDALV)) {
+    numVcSets_ = 2 * dimensionWidths_.size();
+  } else if ((adaptivityType_ == AdaptiveRoutingAlg::VDALP) ||
+             (adaptivityType_ == AdaptiveRoutingAlg::VDALV)) {
+    numVcSets_ = dimensionWidths_.size() + maxDeroutesAllowed_;
+  }
+}
+
+DalRoutingAlgorithm::Settings::Settings(const nlohmann::json& _settings) {
   assert(_settings.contains("adaptivity_type") &&
          _settings["adaptivity_type"].is_string());
   assert(_settings.contains("output_type") &&
@@ -40,14 +83,14 @@ DalRoutingAlgorithm::DalRoutingAlgorithm(
 
   assert(_settings.contains("max_outputs") &&
          _settings["max_outputs"].is_number_integer());
-  maxOutputs_ = _settings["max_outputs"].get<u32>();
+  maxOutputs = _settings["max_outputs"].get<u32>();
 
   assert(_settings.contains("output_algorithm") &&
          _settings["output_algorithm"].is_string());
   if (_settings["output_algorithm"].get<std::string>() == "random") {
-    outputAlg_ = OutputAlg::Rand;
+    outputAlg = OutputAlg::Rand;
   } else if (_settings["output_algorithm"].get<std::string>() == "minimal") {
-    outputAlg_ = OutputAlg::Min;
+    outputAlg = OutputAlg::Min;
   } else {
     fprintf(stderr, "Unknown output algorithm:");
     fprintf(stderr, " '%s'\n",
@@ -57,9 +100,9 @@ DalRoutingAlgorithm::DalRoutingAlgorithm(
 
   std::string outputType = _settings["output_type"].get<std::string>();
   if (outputType == "port") {
-    outputTypePort_ = true;
+    outputTypePort = true;
   } else if (outputType == "vc") {
-    outputTypePort_ = false;
+    outputTypePort = false;
   } else {
     fprintf(stderr, "Unknown output type:");
     fprintf(stderr, " '%s'\n", outputType.c_str());
@@ -68,9 +111,9 @@ DalRoutingAlgorithm::DalRoutingAlgorithm(
 
   if (_settings["adaptivity_type"].get<std::string>() == "dimension_adaptive") {
     if (outputType == "vc") {
-      adaptivityType_ = AdaptiveRoutingAlg::DDALV;
+      adaptivityType = AdaptiveRoutingAlg::DDALV;
     } else if (outputType == "port") {
-      adaptivityType_ = AdaptiveRoutingAlg::DDALP;
+      adaptivityType = AdaptiveRoutingAlg::DDALP;
     } else {
       fprintf(stderr, "Unknown output type:");
       fprintf(stderr, " '%s'\n", outputType.c_str());
@@ -79,9 +122,9 @@ DalRoutingAlgorithm::DalRoutingAlgorithm(
   } else if (_settings["adaptivity_type"].get<std::string>() ==
              "dimension_order") {
     if (outputType == "vc") {
-      adaptivityType_ = AdaptiveRoutingAlg::DOALV;
+      adaptivityType = AdaptiveRoutingAlg::DOALV;
     } else if (outputType == "port") {
-      adaptivityType_ = AdaptiveRoutingAlg::DOALP;
+      adaptivityType = AdaptiveRoutingAlg::DOALP;
     } else {
       fprintf(stderr, "Unknown output type:");
       fprintf(stderr, " '%s'\n", outputType.c_str());
@@ -89,13 +132,13 @@ DalRoutingAlgorithm::DalRoutingAlgorithm(
     }
   } else if (_settings["adaptivity_type"].get<std::string>() == "variable") {
     assert(_settings.contains("max_deroutes"));
-    maxDeroutesAllowed_ = _settings["max_deroutes"].get<u32>();
+    maxDeroutesAllowed = _settings["max_deroutes"].get<u32>();
     assert(_settings.contains("multi_deroute"));
-    multiDeroute_ = _settings["multi_deroute"].get<bool>();
+    multiDeroute = _settings["multi_deroute"].get<bool>();
     if (outputType == "vc") {
-      adaptivityType_ = AdaptiveRoutingAlg::VDALV;
+      adaptivityType = AdaptiveRoutingAlg::VDALV;
     } else if (outputType == "port") {
-      adaptivityType_ = AdaptiveRoutingAlg::VDALP;
+      adaptivityType = AdaptiveRoutingAlg::VDALP;
     } else {
       fprintf(stderr, "Unknown output type:");
       fprintf(stderr, " '%s'\n", outputType.c_str());
@@ -110,24 +153,24 @@ DalRoutingAlgorithm::DalRoutingAlgorithm(
 
   if (_settings["decision_scheme"].get<std::string>() ==
       "monolithic_weighted") {
-    decisionScheme_ = DecisionScheme::MW;
+    decisionScheme = DecisionScheme::MW;
     assert(_settings.contains("independent_bias"));
-    iBias_ = _settings["independent_bias"].get<f64>();
+    iBias = _settings["independent_bias"].get<f64>();
     assert(_settings.contains("congestion_bias"));
-    cBias_ = _settings["congestion_bias"].get<f64>();
+    cBias = _settings["congestion_bias"].get<f64>();
     if (!_settings.contains("bias_mode")) {
-      biasMode_ = BiasScheme::REGULAR;
+      biasMode = BiasScheme::REGULAR;
     } else if (_settings["bias_mode"].get<std::string>() == "regular") {
-      biasMode_ = BiasScheme::REGULAR;
+      biasMode = BiasScheme::REGULAR;
     } else if (_settings["bias_mode"].get<std::string>() == "bimodal") {
-      biasMode_ = BiasScheme::BIMODAL;
+      biasMode = BiasScheme::BIMODAL;
     } else if (_settings["bias_mode"].get<std::string>() == "proportional") {
-      biasMode_ = BiasScheme::PROPORTIONAL;
+      biasMode = BiasScheme::PROPORTIONAL;
     } else if (_settings["bias_mode"].get<std::string>() == "differential") {
-      biasMode_ = BiasScheme::DIFFERENTIAL;
+      biasMode = BiasScheme::DIFFERENTIAL;
     } else if (_settings["bias_mode"].get<std::string>() ==
                "proportional_differential") {
-      biasMode_ = BiasScheme::PROPORTIONALDIF;
+      biasMode = BiasScheme::PROPORTIONALDIF;
     } else {
       fprintf(stderr, "Unknown weighting scheme:");
       fprintf(stderr, " '%s'\n",
@@ -136,16 +179,16 @@ DalRoutingAlgorithm::DalRoutingAlgorithm(
     }
   } else if (_settings["decision_scheme"].get<std::string>() ==
              "staged_threshold") {
-    decisionScheme_ = DecisionScheme::ST;
+    decisionScheme = DecisionScheme::ST;
     assert(_settings.contains("threshold_min"));
     assert(_settings.contains("threshold_nonmin"));
-    thresholdMin_ = _settings["threshold_min"].get<f64>();
-    thresholdNonMin_ = _settings["threshold_nonmin"].get<f64>();
+    thresholdMin = _settings["threshold_min"].get<f64>();
+    thresholdNonMin = _settings["threshold_nonmin"].get<f64>();
   } else if (_settings["decision_scheme"].get<std::string>() ==
              "threshold_weighted") {
-    decisionScheme_ = DecisionScheme::TW;
+    decisionScheme = DecisionScheme::TW;
     assert(_settings.contains("threshold"));
-    threshold_ = _settings["threshold"].get<f64>();
+    threshold = _settings["threshold"].get<f64>();
   } else {
     fprintf(stderr, "Unknown decision scheme:");
     fprintf(stderr, " '%s'\n",
@@ -153,15 +196,15 @@ DalRoutingAlgorithm::DalRoutingAlgorithm(
     assert(false);
   }
 
-  if (decisionScheme_ == DecisionScheme::MW ||
-      decisionScheme_ == DecisionScheme::TW) {
+  if (decisionScheme == DecisionScheme::MW ||
+      decisionScheme == DecisionScheme::TW) {
     // ensure hop_count_mode if using weights
 
     assert(_settings.contains("hop_count_mode"));
     if (_settings["hop_count_mode"].get<std::string>() == "absolute") {
-      hopCountMode_ = HopCountMode::ABS;
+      hopCountMode = HopCountMode::ABS;
     } else if (_settings["hop_count_mode"].get<std::string>() == "normalized") {
-      hopCountMode_ = HopCountMode::NORM;
+      hopCountMode = HopCountMode::NORM;
     } else {
       fprintf(stderr, "Unknown hop_count scheme:");
       fprintf(stderr, " '%s'\n",
@@ -169,28 +212,6 @@ DalRoutingAlgorithm::DalRoutingAlgorithm(
       assert(false);
     }
   }
-
-  if ((adaptivityType_ == AdaptiveRoutingAlg::DOALV) ||
-      (adaptivityType_ == AdaptiveRoutingAlg::DOALP)) {
-    assert(numVcs_ >= 2);
-  } else if ((adaptivityType_ == AdaptiveRoutingAlg::DDALV) ||
-             (adaptivityType_ == AdaptiveRoutingAlg::DDALP)) {
-    assert(numVcs_ >= dimensionWidths_.size() * 2);
-  } else if ((adaptivityType_ == AdaptiveRoutingAlg::VDALV) ||
-             (adaptivityType_ == AdaptiveRoutingAlg::VDALP)) {
-    assert(numVcs_ >= dimensionWidths_.size() + maxDeroutesAllowed_);
-  }
-
-  if ((adaptivityType_ == AdaptiveRoutingAlg::DOALP) ||
-      (adaptivityType_ == AdaptiveRoutingAlg::DOALV)) {
-    numVcSets_ = 2;
-  } else if ((adaptivityType_ == AdaptiveRoutingAlg::DDALP) ||
-             (adaptivityType_ == AdaptiveRoutingAlg::DDALV)) {
-    numVcSets_ = 2 * dimensionWidths_.size();
-  } else if ((adaptivityType_ == AdaptiveRoutingAlg::VDALP) ||
-             (adaptivityType_ == AdaptiveRoutingAlg::VDALV)) {
-    numVcSets_ = dimensionWidths_.size() + maxDeroutesAllowed_;
-  }
 }
 
 DalRoutingAlgorithm::~DalRoutingAlgorithm() {}
@@ -281,7 +302,7 @@ void DalRoutingAlgorithm::processRequest(
     monolithicWeighted(outputVcsMin_, outputVcsDer_, hops, hopIncr, iBias_,
                        cBias_, biasMode_, &vcPool_, &takingDeroute);
     if (outputTypePort_) {
-      makeOutputPortSet(&vcPool_, {vcSet}, numVcSets_, baseVc_ + numVcs_,
+      makeOutputPortSet(&vcPool_, &vcSet, 1, numVcSets_, baseVc_ + numVcs_,
                         maxOutputs_, outputAlg_, &outputPorts_);
     } else {
       makeOutputVcSet(&vcPool_, maxOutputs_, outputAlg_, &outputPorts_);
@@ -290,7 +311,7 @@ void DalRoutingAlgorithm::processRequest(
     stagedThreshold(outputVcsMin_, outputVcsDer_, thresholdMin_,
                     thresholdNonMin_, &vcPool_, &takingDeroute);
     if (outputTypePort_) {
-      makeOutputPortSet(&vcPool_, {vcSet}, numVcSets_, baseVc_ + numVcs_,
+      makeOutputPortSet(&vcPool_, &vcSet, 1, numVcSets_, baseVc_ + numVcs_,
                         maxOutputs_, outputAlg_, &outputPorts_);
     } else {
       makeOutputVcSet(&vcPool_, maxOutputs_, outputAlg_, &outputPorts_);
@@ -299,7 +320,7 @@ void DalRoutingAlgorithm::processRequest(
     thresholdWeighted(outputVcsMin_, outputVcsDer_, hops, hopIncr, threshold_,
                       &vcPool_, &takingDeroute);
     if (outputTypePort_) {
-      makeOutputPortSet(&vcPool_, {vcSet}, numVcSets_, baseVc_ + numVcs_,
+      makeOutputPortSet(&vcPool_, &vcSet, 1, numVcSets_, baseVc_ + numVcs_,
                         maxOutputs_, outputAlg_, &outputPorts_);
     } else {
       makeOutputVcSet(&vcPool_, maxOutputs_, outputAlg_, &outputPorts_);
@@ -319,9 +340,7 @@ void DalRoutingAlgorithm::processRequest(
     }
     if ((adaptivityType_ == AdaptiveRoutingAlg::DDALP) ||
         (adaptivityType_ == AdaptiveRoutingAlg::DDALV)) {
-      delete reinterpret_cast<const std::vector<u32>*>(
-          packet->getRoutingExtension());
-      packet->setRoutingExtension(nullptr);
+      releaseRoutingExtension(packet);
     }
   } else {
     for (auto& it : outputPorts_) {
@@ -16,17 +16,16 @@
 #define NETWORK_HYPERX_DALROUTINGALGORITHM_H_
 
 #include <string>
-#include <tuple>
-#include <unordered_set>
 #include <vector>
 
-#include "colhash/tuplehash.h"
 #include "event/Component.h"
+#include "network/hyperx/CandidateVector.h"
 #include "network/hyperx/RoutingAlgorithm.h"
 #include "network/hyperx/util.h"
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
 #include "router/Router.h"
+#include "util/SharedSettings.h"
 
 namespace HyperX {
 
@@ -37,7 +36,7 @@ class DalRoutingAlgorithm : public RoutingAlgorithm {
                       u32 _inputVc, const std::vector<u32>& _dimensionWidths,
                       const std::vector<u32>& _dimensionWeights,
                       u32 _concentration, u32 _interfacePorts,
-                      nlohmann::json _settings);
+                      const nlohmann::json& _settings);
   ~DalRoutingAlgorithm();
 
   void vcScheduled(Flit* _flit, u32 _port, u32 _vc);
@@ -47,27 +46,47 @@ class DalRoutingAlgorithm : public RoutingAlgorithm {
                       RoutingAlgorithm::Response* _response) override;
 
  private:
-  u32 numVcSets_;
-  u32 maxOutputs_;
-  OutputAlg outputAlg_;
-  f64 thresholdMin_;
-  f64 thresholdNonMin_;
-  f64 threshold_;
-  f64 iBias_;
-  f64 cBias_;
-  BiasScheme biasMode_;
-  HopCountMode hopCountMode_;
+  struct Settings {
+    explicit Settings(const nlohmann::json& _settings);
+    u32 maxOutputs;
+    OutputAlg outputAlg;
+    f64 thresholdMin = 0.0;
+    f64 thresholdNonMin = 0.0;
+    f64 threshold = 0.0;
+    f64 iBias = 0.0;
+    f64 cBias = 0.0;
+    BiasScheme biasMode = BiasScheme::REGULAR;
+    HopCountMode hopCountMode = HopCountMode::ABS;
+    bool outputTypePort;
+    AdaptiveRoutingAlg adaptivityType;
+    DecisionScheme decisionScheme;
+    bool multiDeroute = false;   // VDAL only
+    u32 maxDeroutesAllowed = 0;  // VDAL only
+  };
+
+  // parsed once for all instances with the same settings
+  const SharedSettings<Settings> settings_;
+  const u32 maxOutputs_;
+  const OutputAlg outputAlg_;
+  const f64 thresholdMin_;
+  const f64 thresholdNonMin_;
+  const f64 threshold_;
+  const f64 iBias_;
+  const f64 cBias_;
+  const BiasScheme biasMode_;
+  const HopCountMode hopCountMode_;
 
-  bool outputTypePort_;
-  AdaptiveRoutingAlg adaptivityType_;
-  DecisionScheme decisionScheme_;
-  bool multiDeroute_;       // VDAL only
-  u32 maxDeroutesAllowed_;  // VDAL only
+  const bool outputTypePort_;
+  const AdaptiveRoutingAlg adaptivityType_;
+  const DecisionScheme decisionScheme_;
+  const bool multiDeroute_;       // VDAL only
+  const u32 maxDeroutesAllowed_;  // VDAL only
 
-  std::unordered_set<std::tuple<u32, u32, f64>> outputVcsMin_;
-  std::unordered_set<std::tuple<u32, u32, f64>> outputVcsDer_;
-  std::unordered_set<std::tuple<u32, u32, f64>> vcPool_;
-  std::unordered_set<std::tuple<u32, u32, f64>> outputPorts_;
+  u32 numVcSets_;
+  CandidateVector& outputVcsMin_;
+  CandidateVector& outputVcsDer_;
+  CandidateVector& vcPool_;
+  CandidateVector& outputPorts_;
 };
 
 }  // namespace HyperX
@@ -14,10 +14,11 @@
  */
 #include "network/hyperx/DimOrderRoutingAlgorithm.h"
 
+#include <algorithm>
 #include <cassert>
-#include <unordered_set>
 
 #include "factory/ObjectFactory.h"
+#include "network/cube/util.h"
 #include "network/hyperx/util.h"
 #include "types/Message.h"
 #include "types/Packet.h"
@@ -29,10 +30,24 @@ DimOrderRoutingAlgorithm::DimOrderRoutingAlgorithm(
     u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, nlohmann::json _settings)
+    u32 _interfacePorts, const nlohmann::json& _settings)
     : RoutingAlgorithm(_name, _parent, _router, _baseVc, _numVcs, _inputPort,
                        _inputVc, _dimensionWidths, _dimensionWeights,
-                       _concentration, _interfacePorts, _settings) {
+                       _concentration, _interfacePorts, _settings),
+      settings_(_settings),
+      maxOutputs_(settings_->maxOutputs),
+      outputAlg_(settings_->outputAlg),
+      outputTypePort_(settings_->outputTypePort),
+      vcPool_(scratch(0)),
+      outputPorts_(scratch(1)),
+      table_(nullptr) {
+  u32 numRouters = Cube::computeNumRouters(dimensionWidths_);
+  useTable_ = RoutingTable::enabled(
+      _settings, numRouters, numRouters,
+      *std::max_element(dimensionWeights_.begin(), dimensionWeights_.end()));
+}
+
+DimOrderRoutingAlgorithm::Settings::Settings(const nlohmann::json& _settings) {
   assert(_settings.contains("output_type") &&
          _settings["output_type"].is_string());
   assert(_settings.contains("max_outputs") &&
@@ -41,9 +56,9 @@ DimOrderRoutingAlgorithm::DimOrderRoutingAlgorithm(
   assert(_settings.contains("output_algorithm") &&
          _settings["output_algorithm"].is_string());
   if (_settings["output_algorithm"].get<std::string>() == "random") {
-    outputAlg_ = OutputAlg::Rand;
+    outputAlg = OutputAlg::Rand;
   } else if (_settings["output_algorithm"].get<std::string>() == "minimal") {
-    outputAlg_ = OutputAlg::Min;
+    outputAlg = OutputAlg::Min;
   } else {
     fprintf(stderr, "Unknown output algorithm:");
     fprintf(stderr, " '%s'\n",
@@ -53,36 +68,88 @@ DimOrderRoutingAlgorithm::DimOrderRoutingAlgorithm(
 
   std::string outputType = _settings["output_type"].get<std::string>();
   if (outputType == "port") {
-    outputTypePort_ = true;
+    outputTypePort = true;
   } else if (outputType == "vc") {
-    outputTypePort_ = false;
+    outputTypePort = false;
   } else {
     fprintf(stderr, "Unknown output type:");
     fprintf(stderr, " '%s'\n", outputType.c_str());
     assert(false);
   }
 
-  maxOutputs_ = _settings["max_outputs"].get<u32>();
+  maxOutputs = _settings["max_outputs"].get<u32>();
+}
+
+DimOrderRoutingAlgorithm::~DimOrderRoutingAlgorithm() {
+  if (table_ != nullptr) {
+    RoutingTable::release(table_);
+  }
 }
 
-DimOrderRoutingAlgorithm::~DimOrderRoutingAlgorithm() {}
+void DimOrderRoutingAlgorithm::initialize() {
+  if (!useTable_) {
+    return;
+  }
+
+  // use the table of another instance on this router if it exists
+  const std::string key = "HyperX::DimOrderRoutingAlgorithm";
+  table_ = RoutingTable::acquire(router_, key);
+  if (table_ != nullptr) {
+    return;
+  }
+
+  // build the table for all destination routers, the route only depends on
+  //  the router address of the destination
+  u32 numRouters = Cube::computeNumRouters(dimensionWidths_);
+  table_ = new RoutingTable(numRouters);
+  std::vector<u32> routerAddress;
+  std::vector<u32> destinationAddress(1 + dimensionWidths_.size(), 0);
+  std::vector<u32> ports;
+  for (u32 id = 0; id < numRouters; id++) {
+    Cube::translateRouterIdToAddress(id, dimensionWidths_, &routerAddress);
+    std::copy(routerAddress.begin(), routerAddress.end(),
+              destinationAddress.begin() + 1);
+    computeRoute(&destinationAddress, &ports);
+    table_->addDestination(0);
+    for (u32 port : ports) {
+      table_->addPort(port);
+    }
+  }
+  RoutingTable::share(router_, key, table_);
+}
 
 void DimOrderRoutingAlgorithm::processRequest(
     Flit* _flit, RoutingAlgorithm::Response* _response) {
   const std::vector<u32>* destinationAddress =
       _flit->packet()->message()->getDestinationAddress();
-  if (outputTypePort_) {
+  if (table_ != nullptr) {
+    u32 destinationRouter = Cube::translateInterfaceIdToRouterId(
+        _flit->packet()->message()->getDestinationId(), concentration_,
+        interfacePorts_);
+    if (destinationRouter == router_->id()) {
+      // eject below
+      outputPorts_.clear();
+    } else {
+      tableRoutingOutput(destinationRouter);
+      if (outputTypePort_) {
+        makeOutputPortSet(&vcPool_, &baseVc_, 1, 1, baseVc_ + numVcs_,
+                          maxOutputs_, outputAlg_, &outputPorts_);
+      } else {
+        makeOutputVcSet(&vcPool_, maxOutputs_, outputAlg_, &outputPorts_);
+      }
+    }
+  } else if (outputTypePort_) {
     dimOrderPortRoutingOutput(router_, inputPort_, inputVc_, dimensionWidths_,
                               dimensionWeights_, concentration_,
-                              interfacePorts_, destinationAddress, {baseVc_}, 1,
-                              baseVc_ + numVcs_, &vcPool_);
-    makeOutputPortSet(&vcPool_, {baseVc_}, 1, baseVc_ + numVcs_, maxOutputs_,
+                              interfacePorts_, destinationAddress, &baseVc_, 1,
+                              1, baseVc_ + numVcs_, &vcPool_);
+    makeOutputPortSet(&vcPool_, &baseVc_, 1, 1, baseVc_ + numVcs_, maxOutputs_,
                       outputAlg_, &outputPorts_);
   } else {
     dimOrderVcRoutingOutput(router_, inputPort_, inputVc_, dimensionWidths_,
                             dimensionWeights_, concentration_, interfacePorts_,
-                            destinationAddress, {baseVc_}, 1, baseVc_ + numVcs_,
-                            &vcPool_);
+                            destinationAddress, &baseVc_, 1, 1,
+                            baseVc_ + numVcs_, &vcPool_);
     makeOutputVcSet(&vcPool_, maxOutputs_, outputAlg_, &outputPorts_);
   }
 
@@ -102,6 +169,61 @@ void DimOrderRoutingAlgorithm::processRequest(
   }
 }
 
+void DimOrderRoutingAlgorithm::computeRoute(
+    const std::vector<u32>* _destinationAddress,
+    std::vector<u32>* _ports) const {
+  _ports->clear();
+
+  // ex: [x,y,z] for router, [c,x,y,z] for destination
+  const std::vector<u32>& routerAddress = router_->address();
+  assert(routerAddress.size() == (_destinationAddress->size() - 1));
+
+  // determine the next dimension to work on
+  u32 dim;
+  u32 portBase = concentration_;
+  for (dim = 0; dim < routerAddress.size(); dim++) {
+    if (routerAddress.at(dim) != _destinationAddress->at(dim + 1)) {
+      break;
+    }
+    portBase += ((dimensionWidths_.at(dim) - 1) * dimensionWeights_.at(dim));
+  }
+
+  // no router-to-router ports at the destination router
+  if (dim != routerAddress.size()) {
+    u32 src = routerAddress.at(dim);
+    u32 dst = _destinationAddress->at(dim + 1);
+    u32 offset = computeSrcDstOffset(src, dst, dimensionWidths_.at(dim));
+
+    // add all ports where the two routers are connecting
+    for (u32 weight = 0; weight < dimensionWeights_.at(dim); weight++) {
+      _ports->push_back(computeOutputPort(
+          portBase, offset, dimensionWeights_.at(dim), weight));
+    }
+  }
+}
+
+void DimOrderRoutingAlgorithm::tableRoutingOutput(u32 _destinationRouter) {
+  // this matches dimOrderPortRoutingOutput() and dimOrderVcRoutingOutput()
+  vcPool_.clear();
+  const u32* ports = table_->ports(_destinationRouter);
+  u32 numPorts = table_->numPorts(_destinationRouter);
+  for (u32 idx = 0; idx < numPorts; idx++) {
+    u32 port = ports[idx];
+    if (outputTypePort_) {
+      f64 congestion =
+          getAveragePortCongestion(router_, inputPort_, inputVc_, port,
+                                   &baseVc_, 1, 1, baseVc_ + numVcs_);
+      vcPool_.add(port, 0, congestion);
+    } else {
+      for (u32 vc = baseVc_; vc < baseVc_ + numVcs_; vc++) {
+        f64 congestion =
+            router_->congestionStatus(inputPort_, inputVc_, port, vc);
+        vcPool_.add(port, vc, congestion);
+      }
+    }
+  }
+}
+
 }  // namespace HyperX
 
 registerWithObjectFactory("dimension_order", HyperX::RoutingAlgorithm,
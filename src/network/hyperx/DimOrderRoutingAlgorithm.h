@@ -16,17 +16,17 @@
 #define NETWORK_HYPERX_DIMORDERROUTINGALGORITHM_H_
 
 #include <string>
-#include <tuple>
-#include <unordered_set>
 #include <vector>
 
-#include "colhash/tuplehash.h"
 #include "event/Component.h"
+#include "network/hyperx/CandidateVector.h"
 #include "network/hyperx/RoutingAlgorithm.h"
 #include "network/hyperx/util.h"
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
 #include "router/Router.h"
+#include "routing/RoutingTable.h"
+#include "util/SharedSettings.h"
 
 namespace HyperX {
 
@@ -38,19 +38,39 @@ class DimOrderRoutingAlgorithm : public RoutingAlgorithm {
                            const std::vector<u32>& _dimensionWidths,
                            const std::vector<u32>& _dimensionWeights,
                            u32 _concentration, u32 _interfacePorts,
-                           nlohmann::json _settings);
+                           const nlohmann::json& _settings);
   ~DimOrderRoutingAlgorithm();
 
+  void initialize() override;
+
  protected:
   void processRequest(Flit* _flit,
                       RoutingAlgorithm::Response* _response) override;
 
  private:
-  u32 maxOutputs_;
-  OutputAlg outputAlg_;
-  bool outputTypePort_;
-  std::unordered_set<std::tuple<u32, u32, f64>> vcPool_;
-  std::unordered_set<std::tuple<u32, u32, f64>> outputPorts_;
+  struct Settings {
+    explicit Settings(const nlohmann::json& _settings);
+    u32 maxOutputs;
+    OutputAlg outputAlg;
+    bool outputTypePort;
+  };
+
+  // this computes the router-to-router candidate output ports
+  void computeRoute(const std::vector<u32>* _destinationAddress,
+                    std::vector<u32>* _ports) const;
+  // this fills the VC pool from the table entry of the destination router
+  void tableRoutingOutput(u32 _destinationRouter);
+
+  // parsed once for all instances with the same settings
+  const SharedSettings<Settings> settings_;
+  const u32 maxOutputs_;
+  const OutputAlg outputAlg_;
+  const bool outputTypePort_;
+  CandidateVector& vcPool_;
+  CandidateVector& outputPorts_;
+
+  bool useTable_;
+  RoutingTable* table_;
 };
 
 }  // namespace HyperX
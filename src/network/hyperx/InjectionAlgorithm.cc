@@ -22,7 +22,7 @@ InjectionAlgorithm::InjectionAlgorithm(const std::string& _name,
                                        const Component* _parent,
                                        Interface* _interface, u32 _baseVc,
                                        u32 _numVcs, u32 _inputPc,
-                                       nlohmann::json _settings)
+                                       const nlohmann::json& _settings)
     : ::InjectionAlgorithm(_name, _parent, _interface, _baseVc, _numVcs,
                            _inputPc, _settings) {}
 
@@ -30,7 +30,7 @@ InjectionAlgorithm::~InjectionAlgorithm() {}
 
 InjectionAlgorithm* InjectionAlgorithm::create(
     const std::string& _name, const Component* _parent, Interface* _interface,
-    u32 _baseVc, u32 _numVcs, u32 _inputPc, nlohmann::json _settings) {
+    u32 _baseVc, u32 _numVcs, u32 _inputPc, const nlohmann::json& _settings) {
   // retrieve the algorithm
   const std::string& algorithm = _settings["algorithm"].get<std::string>();
 
@@ -27,10 +27,18 @@ LeastCongestedQueueRoutingAlgorithm::LeastCongestedQueueRoutingAlgorithm(
     u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, nlohmann::json _settings)
+    u32 _interfacePorts, const nlohmann::json& _settings)
     : RoutingAlgorithm(_name, _parent, _router, _baseVc, _numVcs, _inputPort,
                        _inputVc, _dimensionWidths, _dimensionWeights,
-                       _concentration, _interfacePorts, _settings) {
+                       _concentration, _interfacePorts, _settings),
+      settings_(_settings),
+      maxOutputs_(settings_->maxOutputs),
+      outputAlg_(settings_->outputAlg),
+      outputTypePort_(settings_->outputTypePort),
+      routingAlg_(settings_->routingAlg),
+      shortCut_(settings_->shortCut),
+      vcPool_(scratch(0)),
+      outputPorts_(scratch(1)) {
   // VC set mapping:
   //  0 = injection from terminal port, to intermediate destination
   //  1 = first hop from intermediate to final destination
@@ -38,20 +46,30 @@ LeastCongestedQueueRoutingAlgorithm::LeastCongestedQueueRoutingAlgorithm(
   //  N + 1 = last hop to dimension N
   //  we can eject flit to destination terminal using any VC
 
+  if ((routingAlg_ == BaseRoutingAlg::DORV) ||
+      (routingAlg_ == BaseRoutingAlg::DORP)) {
+    assert(_numVcs >= 2);
+  } else {
+    assert(_numVcs >= _dimensionWidths.size() + 1);
+  }
+}
+
+LeastCongestedQueueRoutingAlgorithm::Settings::Settings(
+    const nlohmann::json& _settings) {
   assert(_settings.contains("minimal") && _settings["minimal"].is_string());
   assert(_settings.contains("output_type") &&
          _settings["output_type"].is_string());
   assert(_settings.contains("max_outputs") &&
          _settings["max_outputs"].is_number_integer());
 
-  maxOutputs_ = _settings["max_outputs"].get<u32>();
+  maxOutputs = _settings["max_outputs"].get<u32>();
 
   assert(_settings.contains("output_algorithm") &&
          _settings["output_algorithm"].is_string());
   if (_settings["output_algorithm"].get<std::string>() == "random") {
-    outputAlg_ = OutputAlg::Rand;
+    outputAlg = OutputAlg::Rand;
   } else if (_settings["output_algorithm"].get<std::string>() == "minimal") {
-    outputAlg_ = OutputAlg::Min;
+    outputAlg = OutputAlg::Min;
   } else {
     fprintf(stderr, "Unknown output algorithm:");
     fprintf(stderr, " '%s'\n",
@@ -62,22 +80,22 @@ LeastCongestedQueueRoutingAlgorithm::LeastCongestedQueueRoutingAlgorithm(
   std::string minimalType = _settings["minimal"].get<std::string>();
   std::string outputType = _settings["output_type"].get<std::string>();
   if (outputType == "port") {
-    outputTypePort_ = true;
+    outputTypePort = true;
   } else if (outputType == "vc") {
-    outputTypePort_ = false;
+    outputTypePort = false;
   } else {
     fprintf(stderr, "Unknown output type:");
     fprintf(stderr, " '%s'\n", outputType.c_str());
     assert(false);
   }
 
-  shortCut_ = _settings["short_cut"].get<bool>();
+  shortCut = _settings["short_cut"].get<bool>();
 
   if (minimalType == "dimension_order") {
     if (outputType == "vc") {
-      routingAlg_ = BaseRoutingAlg::DORV;
+      routingAlg = BaseRoutingAlg::DORV;
     } else if (outputType == "port") {
-      routingAlg_ = BaseRoutingAlg::DORP;
+      routingAlg = BaseRoutingAlg::DORP;
     } else {
       fprintf(stderr, "Unknown output type:");
       fprintf(stderr, " '%s'\n", outputType.c_str());
@@ -85,9 +103,9 @@ LeastCongestedQueueRoutingAlgorithm::LeastCongestedQueueRoutingAlgorithm(
     }
   } else if (minimalType == "random") {
     if (outputType == "vc") {
-      routingAlg_ = BaseRoutingAlg::RMINV;
+      routingAlg = BaseRoutingAlg::RMINV;
     } else if (outputType == "port") {
-      routingAlg_ = BaseRoutingAlg::RMINP;
+      routingAlg = BaseRoutingAlg::RMINP;
     } else {
       fprintf(stderr, "Unknown output type:");
       fprintf(stderr, " '%s'\n", outputType.c_str());
@@ -95,9 +113,9 @@ LeastCongestedQueueRoutingAlgorithm::LeastCongestedQueueRoutingAlgorithm(
     }
   } else if (minimalType == "adaptive") {
     if (outputType == "vc") {
-      routingAlg_ = BaseRoutingAlg::AMINV;
+      routingAlg = BaseRoutingAlg::AMINV;
     } else if (outputType == "port") {
-      routingAlg_ = BaseRoutingAlg::AMINP;
+      routingAlg = BaseRoutingAlg::AMINP;
     } else {
       fprintf(stderr, "Unknown output type:");
       fprintf(stderr, " '%s'\n", outputType.c_str());
@@ -108,12 +126,6 @@ LeastCongestedQueueRoutingAlgorithm::LeastCongestedQueueRoutingAlgorithm(
     fprintf(stderr, " '%s'\n", minimalType.c_str());
     assert(false);
   }
-
-  if (minimalType == "dimension_order") {
-    assert(_numVcs >= 2);
-  } else {
-    assert(_numVcs >= _dimensionWidths.size() + 1);
-  }
 }
 
 LeastCongestedQueueRoutingAlgorithm::~LeastCongestedQueueRoutingAlgorithm() {}
@@ -149,7 +161,7 @@ void LeastCongestedQueueRoutingAlgorithm::processRequest(
                            dimensionWeights_, concentration_, interfacePorts_,
                            destinationAddress, vcSet, numVcSets,
                            baseVc_ + numVcs_, shortCut_, &vcPool_);
-      makeOutputPortSet(&vcPool_, {vcSet}, numVcSets, baseVc_ + numVcs_,
+      makeOutputPortSet(&vcPool_, &vcSet, 1, numVcSets, baseVc_ + numVcs_,
                         maxOutputs_, outputAlg_, &outputPorts_);
     } else {
       lcqVcRoutingOutput(router_, inputPort_, inputVc_, dimensionWidths_,
@@ -163,7 +175,7 @@ void LeastCongestedQueueRoutingAlgorithm::processRequest(
       case BaseRoutingAlg::DORV: {
         dimOrderVcRoutingOutput(router_, inputPort_, inputVc_, dimensionWidths_,
                                 dimensionWeights_, concentration_,
-                                interfacePorts_, destinationAddress, {vcSet},
+                                interfacePorts_, destinationAddress, &vcSet, 1,
                                 numVcSets, baseVc_ + numVcs_, &vcPool_);
         makeOutputVcSet(&vcPool_, maxOutputs_, outputAlg_, &outputPorts_);
         break;
@@ -171,16 +183,16 @@ void LeastCongestedQueueRoutingAlgorithm::processRequest(
       case BaseRoutingAlg::DORP: {
         dimOrderPortRoutingOutput(
             router_, inputPort_, inputVc_, dimensionWidths_, dimensionWeights_,
-            concentration_, interfacePorts_, destinationAddress, {vcSet},
+            concentration_, interfacePorts_, destinationAddress, &vcSet, 1,
             numVcSets, baseVc_ + numVcs_, &vcPool_);
-        makeOutputPortSet(&vcPool_, {vcSet}, numVcSets, baseVc_ + numVcs_,
+        makeOutputPortSet(&vcPool_, &vcSet, 1, numVcSets, baseVc_ + numVcs_,
                           maxOutputs_, outputAlg_, &outputPorts_);
         break;
       }
       case BaseRoutingAlg::RMINV: {
         randMinVcRoutingOutput(router_, inputPort_, inputVc_, dimensionWidths_,
                                dimensionWeights_, concentration_,
-                               interfacePorts_, destinationAddress, {vcSet},
+                               interfacePorts_, destinationAddress, &vcSet, 1,
                                numVcSets, baseVc_ + numVcs_, &vcPool_);
         makeOutputVcSet(&vcPool_, maxOutputs_, outputAlg_, &outputPorts_);
         break;
@@ -188,16 +200,16 @@ void LeastCongestedQueueRoutingAlgorithm::processRequest(
       case BaseRoutingAlg::RMINP: {
         randMinPortRoutingOutput(
             router_, inputPort_, inputVc_, dimensionWidths_, dimensionWeights_,
-            concentration_, interfacePorts_, destinationAddress, {vcSet},
+            concentration_, interfacePorts_, destinationAddress, &vcSet, 1,
             numVcSets, baseVc_ + numVcs_, &vcPool_);
-        makeOutputPortSet(&vcPool_, {vcSet}, numVcSets, baseVc_ + numVcs_,
+        makeOutputPortSet(&vcPool_, &vcSet, 1, numVcSets, baseVc_ + numVcs_,
                           maxOutputs_, outputAlg_, &outputPorts_);
         break;
       }
       case BaseRoutingAlg::AMINV: {
         adaptiveMinVcRoutingOutput(
             router_, inputPort_, inputVc_, dimensionWidths_, dimensionWeights_,
-            concentration_, interfacePorts_, destinationAddress, {vcSet},
+            concentration_, interfacePorts_, destinationAddress, &vcSet, 1,
             numVcSets, baseVc_ + numVcs_, &vcPool_);
         makeOutputVcSet(&vcPool_, maxOutputs_, outputAlg_, &outputPorts_);
         break;
@@ -205,9 +217,9 @@ void LeastCongestedQueueRoutingAlgorithm::processRequest(
       case BaseRoutingAlg::AMINP: {
         adaptiveMinPortRoutingOutput(
             router_, inputPort_, inputVc_, dimensionWidths_, dimensionWeights_,
-            concentration_, interfacePorts_, destinationAddress, {vcSet},
+            concentration_, interfacePorts_, destinationAddress, &vcSet, 1,
             numVcSets, baseVc_ + numVcs_, &vcPool_);
-        makeOutputPortSet(&vcPool_, {vcSet}, numVcSets, baseVc_ + numVcs_,
+        makeOutputPortSet(&vcPool_, &vcSet, 1, numVcSets, baseVc_ + numVcs_,
                           maxOutputs_, outputAlg_, &outputPorts_);
         break;
       }
@@ -16,17 +16,16 @@
 #define NETWORK_HYPERX_LEASTCONGESTEDQUEUEROUTINGALGORITHM_H_
 
 #include <string>
-#include <tuple>
-#include <unordered_set>
 #include <vector>
 
-#include "colhash/tuplehash.h"
 #include "event/Component.h"
+#include "network/hyperx/CandidateVector.h"
 #include "network/hyperx/RoutingAlgorithm.h"
 #include "network/hyperx/util.h"
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
 #include "router/Router.h"
+#include "util/SharedSettings.h"
 
 namespace HyperX {
 
@@ -39,7 +38,7 @@ class LeastCongestedQueueRoutingAlgorithm : public RoutingAlgorithm {
                                       const std::vector<u32>& _dimensionWidths,
                                       const std::vector<u32>& _dimensionWeights,
                                       u32 _concentration, u32 _interfacePorts,
-                                      nlohmann::json _settings);
+                                      const nlohmann::json& _settings);
   ~LeastCongestedQueueRoutingAlgorithm();
 
  protected:
@@ -47,13 +46,24 @@ class LeastCongestedQueueRoutingAlgorithm : public RoutingAlgorithm {
                       RoutingAlgorithm::Response* _response) override;
 
  private:
-  u32 maxOutputs_;
-  OutputAlg outputAlg_;
-  std::unordered_set<std::tuple<u32, u32, f64>> vcPool_;
-  std::unordered_set<std::tuple<u32, u32, f64>> outputPorts_;
-  bool outputTypePort_;
-  BaseRoutingAlg routingAlg_;
-  bool shortCut_;
+  struct Settings {
+    explicit Settings(const nlohmann::json& _settings);
+    u32 maxOutputs;
+    OutputAlg outputAlg;
+    bool outputTypePort;
+    BaseRoutingAlg routingAlg;
+    bool shortCut;
+  };
+
+  // parsed once for all instances with the same settings
+  const SharedSettings<Settings> settings_;
+  const u32 maxOutputs_;
+  const OutputAlg outputAlg_;
+  const bool outputTypePort_;
+  const BaseRoutingAlg routingAlg_;
+  const bool shortCut_;
+  CandidateVector& vcPool_;
+  CandidateVector& outputPorts_;
 };
 
 }  // namespace HyperX
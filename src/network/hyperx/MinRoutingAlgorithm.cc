@@ -28,10 +28,16 @@ MinRoutingAlgorithm::MinRoutingAlgorithm(
     u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, nlohmann::json _settings)
+    u32 _interfacePorts, const nlohmann::json& _settings)
     : RoutingAlgorithm(_name, _parent, _router, _baseVc, _numVcs, _inputPort,
                        _inputVc, _dimensionWidths, _dimensionWeights,
-                       _concentration, _interfacePorts, _settings) {
+                       _concentration, _interfacePorts, _settings),
+      settings_(_settings),
+      maxOutputs_(settings_->maxOutputs),
+      outputAlg_(settings_->outputAlg),
+      routingAlg_(settings_->routingAlg),
+      vcPool_(scratch(0)),
+      outputPorts_(scratch(1)) {
   // VC set mapping:
   //  0 = injection from terminal port
   //  1 = switching dimension increments VC count
@@ -39,6 +45,9 @@ MinRoutingAlgorithm::MinRoutingAlgorithm(
   //  N = last hop to dimension N
   //  we can eject flit to destination terminal using any VC
   assert(_numVcs >= _dimensionWidths.size());
+}
+
+MinRoutingAlgorithm::Settings::Settings(const nlohmann::json& _settings) {
   assert(_settings.contains("minimal") && _settings["minimal"].is_string());
   assert(_settings.contains("output_type") &&
          _settings["output_type"].is_string());
@@ -48,9 +57,9 @@ MinRoutingAlgorithm::MinRoutingAlgorithm(
   assert(_settings.contains("output_algorithm") &&
          _settings["output_algorithm"].is_string());
   if (_settings["output_algorithm"].get<std::string>() == "random") {
-    outputAlg_ = OutputAlg::Rand;
+    outputAlg = OutputAlg::Rand;
   } else if (_settings["output_algorithm"].get<std::string>() == "minimal") {
-    outputAlg_ = OutputAlg::Min;
+    outputAlg = OutputAlg::Min;
   } else {
     fprintf(stderr, "Unknown output algorithm:");
     fprintf(stderr, " '%s'\n",
@@ -58,16 +67,16 @@ MinRoutingAlgorithm::MinRoutingAlgorithm(
     assert(false);
   }
 
-  maxOutputs_ = _settings["max_outputs"].get<u32>();
+  maxOutputs = _settings["max_outputs"].get<u32>();
 
   std::string minimalType = _settings["minimal"].get<std::string>();
   std::string outputType = _settings["output_type"].get<std::string>();
 
   if (minimalType == "random") {
     if (outputType == "vc") {
-      routingAlg_ = MinRoutingAlg::RMINV;
+      routingAlg = MinRoutingAlg::RMINV;
     } else if (outputType == "port") {
-      routingAlg_ = MinRoutingAlg::RMINP;
+      routingAlg = MinRoutingAlg::RMINP;
     } else {
       fprintf(stderr, "Unknown output type:");
       fprintf(stderr, " '%s'\n", outputType.c_str());
@@ -75,9 +84,9 @@ MinRoutingAlgorithm::MinRoutingAlgorithm(
     }
   } else if (minimalType == "adaptive") {
     if (outputType == "vc") {
-      routingAlg_ = MinRoutingAlg::AMINV;
+      routingAlg = MinRoutingAlg::AMINV;
     } else if (outputType == "port") {
-      routingAlg_ = MinRoutingAlg::AMINP;
+      routingAlg = MinRoutingAlg::AMINP;
     } else {
       fprintf(stderr, "Unknown output type:");
       fprintf(stderr, " '%s'\n", outputType.c_str());
@@ -113,7 +122,7 @@ void MinRoutingAlgorithm::processRequest(
     case MinRoutingAlg::RMINV: {
       randMinVcRoutingOutput(router_, inputPort_, inputVc_, dimensionWidths_,
                              dimensionWeights_, concentration_, interfacePorts_,
-                             destinationAddress, {vcSet}, numVcSets,
+                             destinationAddress, &vcSet, 1, numVcSets,
                              baseVc_ + numVcs_, &vcPool_);
       makeOutputVcSet(&vcPool_, maxOutputs_, outputAlg_, &outputPorts_);
       break;
@@ -121,16 +130,16 @@ void MinRoutingAlgorithm::processRequest(
     case MinRoutingAlg::RMINP: {
       randMinPortRoutingOutput(router_, inputPort_, inputVc_, dimensionWidths_,
                                dimensionWeights_, concentration_,
-                               interfacePorts_, destinationAddress, {vcSet},
+                               interfacePorts_, destinationAddress, &vcSet, 1,
                                numVcSets, baseVc_ + numVcs_, &vcPool_);
-      makeOutputPortSet(&vcPool_, {vcSet}, numVcSets, baseVc_ + numVcs_,
+      makeOutputPortSet(&vcPool_, &vcSet, 1, numVcSets, baseVc_ + numVcs_,
                         maxOutputs_, outputAlg_, &outputPorts_);
       break;
     }
     case MinRoutingAlg::AMINV: {
       adaptiveMinVcRoutingOutput(
           router_, inputPort_, inputVc_, dimensionWidths_, dimensionWeights_,
-          concentration_, interfacePorts_, destinationAddress, {vcSet},
+          concentration_, interfacePorts_, destinationAddress, &vcSet, 1,
           numVcSets, baseVc_ + numVcs_, &vcPool_);
       makeOutputVcSet(&vcPool_, maxOutputs_, outputAlg_, &outputPorts_);
       break;
@@ -138,9 +147,9 @@ void MinRoutingAlgorithm::processRequest(
     case MinRoutingAlg::AMINP: {
       adaptiveMinPortRoutingOutput(
           router_, inputPort_, inputVc_, dimensionWidths_, dimensionWeights_,
-          concentration_, interfacePorts_, destinationAddress, {vcSet},
+          concentration_, interfacePorts_, destinationAddress, &vcSet, 1,
           numVcSets, baseVc_ + numVcs_, &vcPool_);
-      makeOutputPortSet(&vcPool_, {vcSet}, numVcSets, baseVc_ + numVcs_,
+      makeOutputPortSet(&vcPool_, &vcSet, 1, numVcSets, baseVc_ + numVcs_,
                         maxOutputs_, outputAlg_, &outputPorts_);
       break;
     }
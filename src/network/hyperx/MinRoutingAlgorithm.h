@@ -16,17 +16,16 @@
 #define NETWORK_HYPERX_MINROUTINGALGORITHM_H_
 
 #include <string>
-#include <tuple>
-#include <unordered_set>
 #include <vector>
 
-#include "colhash/tuplehash.h"
 #include "event/Component.h"
+#include "network/hyperx/CandidateVector.h"
 #include "network/hyperx/RoutingAlgorithm.h"
 #include "network/hyperx/util.h"
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
 #include "router/Router.h"
+#include "util/SharedSettings.h"
 
 namespace HyperX {
 
@@ -37,7 +36,7 @@ class MinRoutingAlgorithm : public RoutingAlgorithm {
                       u32 _inputVc, const std::vector<u32>& _dimensionWidths,
                       const std::vector<u32>& _dimensionWeights,
                       u32 _concentration, u32 _interfacePorts,
-                      nlohmann::json _settings);
+                      const nlohmann::json& _settings);
   ~MinRoutingAlgorithm();
 
  protected:
@@ -45,11 +44,20 @@ class MinRoutingAlgorithm : public RoutingAlgorithm {
                       RoutingAlgorithm::Response* _response) override;
 
  private:
-  u32 maxOutputs_;
-  OutputAlg outputAlg_;
-  std::unordered_set<std::tuple<u32, u32, f64>> vcPool_;
-  std::unordered_set<std::tuple<u32, u32, f64>> outputPorts_;
-  MinRoutingAlg routingAlg_;
+  struct Settings {
+    explicit Settings(const nlohmann::json& _settings);
+    u32 maxOutputs;
+    OutputAlg outputAlg;
+    MinRoutingAlg routingAlg;
+  };
+
+  // parsed once for all instances with the same settings
+  const SharedSettings<Settings> settings_;
+  const u32 maxOutputs_;
+  const OutputAlg outputAlg_;
+  const MinRoutingAlg routingAlg_;
+  CandidateVector& vcPool_;
+  CandidateVector& outputPorts_;
 };
 
 }  // namespace HyperX
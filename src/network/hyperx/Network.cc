@@ -63,7 +63,9 @@ Network::Network(const std::string& _name, const Component* _parent,
   assert(_settings.contains("channel_mode"));
 
   // scalar
-  if (_settings["channel_mode"].get<std::string>() == "scalar") {
+  bool scalarChannels =
+      _settings["channel_mode"].get<std::string>() == "scalar";
+  if (scalarChannels) {
     assert(_settings["channel_scalars"].is_array());
     assert(_settings["channel_scalars"].size() == dimensions_);
     scalars.resize(dimensions_);
@@ -107,6 +109,8 @@ Network::Network(const std::string& _name, const Component* _parent,
   // link routers via channels
   routerIterator.reset();
   while (routerIterator.next(&routerAddress)) {
+    // the address strings are built once for all the channel names
+    std::string routerString = strop::vecString<u32>(routerAddress, '-');
     u32 portBase = concentration_;
     for (u32 dim = 0; dim < dimensions_; dim++) {
       u32 dimWidth = dimensionWidths_.at(dim);
@@ -121,9 +125,11 @@ Network::Network(const std::string& _name, const Component* _parent,
         std::vector<u32> destinationAddress(sourceAddress);
         destinationAddress.at(dim) =
             (sourceAddress.at(dim) + offset) % dimWidth;
+        std::string destinationString =
+            strop::vecString<u32>(destinationAddress, '-');
 
         // determine the channel latency for current dim and offset
-        if (_settings["channel_mode"].get<std::string>() == "scalar") {
+        if (scalarChannels) {
           f64 link_dist = fabs((s64)sourceAddress.at(dim) -
                                (s64)destinationAddress.at(dim));
           u32 channelLatency = (u32)(ceil(scalars[dim] * link_dist));
@@ -139,8 +145,7 @@ Network::Network(const std::string& _name, const Component* _parent,
         for (u32 weight = 0; weight < dimWeight; weight++) {
           // create the channel
           std::string channelName =
-              "Channel_" + strop::vecString<u32>(routerAddress, '-') + "-to-" +
-              strop::vecString<u32>(destinationAddress, '-') + "-" +
+              "Channel_" + routerString + "-to-" + destinationString + "-" +
               std::to_string(weight);
           Channel* channel = new Channel(channelName, this, numVcs_,
                                          _settings["internal_channel"]);
@@ -179,6 +184,7 @@ Network::Network(const std::string& _name, const Component* _parent,
   while (routerIterator.next(&routerAddress)) {
     // get the router now, for later linking with terminals
     Router* router = routers_.at(routerAddress);
+    std::string routerString = strop::vecString<u32>(routerAddress, '-');
 
     // loop over interfaces
     for (u32 iface = 0; iface < interfacesPerRouter; iface++) {
@@ -189,8 +195,9 @@ Network::Network(const std::string& _name, const Component* _parent,
                               routerAddress.begin(), routerAddress.end());
 
       // create an interface name
-      std::string interfaceName =
-          "Interface_" + strop::vecString<u32>(interfaceAddress, '-');
+      std::string interfaceString =
+          strop::vecString<u32>(interfaceAddress, '-');
+      std::string interfaceName = "Interface_" + interfaceString;
 
       // create the interface
       u32 interfaceId = translateInterfaceAddressToId(&interfaceAddress);
@@ -202,14 +209,10 @@ Network::Network(const std::string& _name, const Component* _parent,
       // create and link channels
       for (u32 ch = 0; ch < interfacePorts_; ch++) {
         // create I/O channels
-        std::string inChannelName =
-            "Channel_" + strop::vecString<u32>(interfaceAddress, '-') + "-to-" +
-            strop::vecString<u32>(routerAddress, '-') + "_" +
-            std::to_string(ch);
-        std::string outChannelName =
-            "Channel_" + strop::vecString<u32>(routerAddress, '-') + "-to-" +
-            strop::vecString<u32>(interfaceAddress, '-') + "_" +
-            std::to_string(ch);
+        std::string inChannelName = "Channel_" + interfaceString + "-to-" +
+                                    routerString + "_" + std::to_string(ch);
+        std::string outChannelName = "Channel_" + routerString + "-to-" +
+                                     interfaceString + "_" + std::to_string(ch);
         Channel* inChannel = new Channel(inChannelName, this, numVcs_,
                                          _settings["external_channel"]);
         Channel* outChannel = new Channel(outChannelName, this, numVcs_,
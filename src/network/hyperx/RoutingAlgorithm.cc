@@ -20,6 +20,9 @@
 
 namespace HyperX {
 
+SharedRegistry<const Router*, RoutingAlgorithm::Scratch>
+    RoutingAlgorithm::scratches_;
+
 RoutingAlgorithm::RoutingAlgorithm(const std::string& _name,
                                    const Component* _parent, Router* _router,
                                    u32 _baseVc, u32 _numVcs, u32 _inputPort,
@@ -27,22 +30,32 @@ RoutingAlgorithm::RoutingAlgorithm(const std::string& _name,
                                    const std::vector<u32>& _dimensionWidths,
                                    const std::vector<u32>& _dimensionWeights,
                                    u32 _concentration, u32 _interfacePorts,
-                                   nlohmann::json _settings)
+                                   const nlohmann::json& _settings)
     : ::RoutingAlgorithm(_name, _parent, _router, _baseVc, _numVcs, _inputPort,
                          _inputVc, _settings),
       dimensionWidths_(_dimensionWidths),
       dimensionWeights_(_dimensionWeights),
       concentration_(_concentration),
-      interfacePorts_(_interfacePorts) {}
+      interfacePorts_(_interfacePorts) {
+  scratch_ = scratches_.acquire(router_);
+  if (scratch_ == nullptr) {
+    scratch_ = new Scratch();
+    scratches_.share(router_, scratch_);
+  }
+}
 
-RoutingAlgorithm::~RoutingAlgorithm() {}
+RoutingAlgorithm::~RoutingAlgorithm() {
+  if (scratches_.release(router_)) {
+    delete scratch_;
+  }
+}
 
 RoutingAlgorithm* RoutingAlgorithm::create(
     const std::string& _name, const Component* _parent, Router* _router,
     u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, nlohmann::json _settings) {
+    u32 _interfacePorts, const nlohmann::json& _settings) {
   // retrieve the algorithm
   const std::string& algorithm = _settings["algorithm"].get<std::string>();
 
@@ -62,4 +75,18 @@ RoutingAlgorithm* RoutingAlgorithm::create(
   return ra;
 }
 
+CandidateVector& RoutingAlgorithm::scratch(u32 _index) {
+  while (scratch_->vectors.size() <= _index) {
+    scratch_->vectors.push_back(
+        new CandidateVector(router_->numPorts() * router_->numVcs()));
+  }
+  return *scratch_->vectors.at(_index);
+}
+
+RoutingAlgorithm::Scratch::~Scratch() {
+  for (CandidateVector* vector : vectors) {
+    delete vector;
+  }
+}
+
 }  // namespace HyperX
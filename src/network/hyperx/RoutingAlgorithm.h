@@ -19,15 +19,17 @@
 #include <vector>
 
 #include "event/Component.h"
+#include "network/hyperx/CandidateVector.h"
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
 #include "router/Router.h"
 #include "routing/RoutingAlgorithm.h"
+#include "util/SharedRegistry.h"
 
 #define HYPERX_ROUTINGALGORITHM_ARGS                                 \
   const std::string&, const Component*, Router*, u32, u32, u32, u32, \
       const std::vector<u32>&, const std::vector<u32>&, u32, u32,    \
-      nlohmann::json
+      const nlohmann::json&
 
 namespace HyperX {
 
@@ -38,17 +40,33 @@ class RoutingAlgorithm : public ::RoutingAlgorithm {
                    u32 _inputVc, const std::vector<u32>& _dimensionWidths,
                    const std::vector<u32>& _dimensionWeights,
                    u32 _concentration, u32 _interfacePorts,
-                   nlohmann::json _settings);
+                   const nlohmann::json& _settings);
   virtual ~RoutingAlgorithm();
 
   // this is a routing algorithm factory for the hyperx topology
   static RoutingAlgorithm* create(HYPERX_ROUTINGALGORITHM_ARGS);
 
  protected:
+  // this returns candidate vector '_index' of the router's scratch space.
+  //  routing decisions on a router never overlap, thus all algorithm
+  //  instances on the router share these vectors instead of each holding
+  //  its own
+  CandidateVector& scratch(u32 _index);
+
   const std::vector<u32> dimensionWidths_;
   const std::vector<u32> dimensionWeights_;
   const u32 concentration_;
   const u32 interfacePorts_;
+
+ private:
+  struct Scratch {
+    ~Scratch();
+    std::vector<CandidateVector*> vectors;
+  };
+
+  // scratch space shared by router
+  static SharedRegistry<const Router*, Scratch> scratches_;
+  Scratch* scratch_;
 };
 
 }  // namespace HyperX
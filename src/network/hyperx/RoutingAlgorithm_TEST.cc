@@ -0,0 +1,261 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "network/hyperx/RoutingAlgorithm.h"
+
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "network/cube/util.h"
+#include "network/hyperx/util.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+#include "router/Router.h"
+#include "test/TestSetup_TESTLIB.h"
+#include "types/Message.h"
+#include "types/Packet.h"
+
+namespace {
+
+// the number of heap allocations made while counting is on, this binary
+//  replaces the global allocation functions below
+bool countAllocations = false;
+u64 allocations = 0;
+
+}  // namespace
+
+void* operator new(std::size_t _size) {
+  if (countAllocations) {
+    allocations++;
+  }
+  void* ptr = std::malloc(_size == 0 ? 1 : _size);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void operator delete(void* _ptr) noexcept {
+  std::free(_ptr);
+}
+
+void operator delete(void* _ptr, std::size_t _size) noexcept {
+  std::free(_ptr);
+}
+
+namespace {
+
+class TestRouter : public Router {
+ public:
+  TestRouter(const std::vector<u32>& _address, u32 _numPorts, u32 _numVcs)
+      : Router("TestRouter", nullptr, nullptr, 0, _address, _numPorts, _numVcs,
+               nullptr, nlohmann::json()) {}
+  ~TestRouter() {}
+  void setInputChannel(u32 _port, Channel* _channel) override {}
+  Channel* getInputChannel(u32 _port) const override {
+    return nullptr;
+  }
+  void setOutputChannel(u32 port, Channel* _channel) override {}
+  Channel* getOutputChannel(u32 _port) const override {
+    return nullptr;
+  }
+  void sendCredit(u32 _port, u32 _vc) override {}
+  void receiveCredit(u32 _port, Credit* _credit) override {}
+  void sendFlit(u32 _port, Flit* _flit) override {}
+  void receiveFlit(u32 _port, Flit* _flit) override {}
+  f64 congestionStatus(u32 _inputPort, u32 _inputVc, u32 _outputPort,
+                       u32 _outputVc) const override {
+    // uneven but fixed congestion so that adaptive choices vary
+    return ((_outputPort * 7 + _outputVc * 3) % 10) / 10.0;
+  }
+};
+
+// this gives the test access to processRequest() so that requests don't go
+//  through the event queue
+class RequestAccess : public HyperX::RoutingAlgorithm {
+ public:
+  static void process(HyperX::RoutingAlgorithm* _algorithm, Flit* _flit,
+                      HyperX::RoutingAlgorithm::Response* _response) {
+    (_algorithm->*(&RequestAccess::processRequest))(_flit, _response);
+  }
+};
+
+// this routes packets to every destination, first from a terminal port then
+//  from a router port, and returns the heap allocations made doing so
+u64 routeAll(HyperX::RoutingAlgorithm* _algorithm,
+             HyperX::RoutingAlgorithm* _transitAlgorithm,
+             const std::vector<std::vector<u32>>& _addresses, u32 _rounds,
+             RoutingAlgorithm::Response* _response) {
+  // messages are made up front, their allocation isn't part of routing
+  std::vector<Message*> messages;
+  for (u32 round = 0; round < _rounds; round++) {
+    for (u32 id = 0; id < _addresses.size(); id++) {
+      Message* message = Message::create(1, 1, nullptr);
+      message->setSourceId(0);
+      message->setSourceAddress(&_addresses.at(0));
+      message->setDestinationId(id);
+      message->setDestinationAddress(&_addresses.at(id));
+      messages.push_back(message);
+    }
+  }
+  allocations = 0;
+  countAllocations = true;
+  for (Message* message : messages) {
+    Packet* packet = message->packet(0);
+    Flit* flit = packet->getFlit(0);
+
+    _response->clear();
+    _response->link(_algorithm);
+    flit->setVc(_algorithm->baseVc());
+    RequestAccess::process(_algorithm, flit, _response);
+
+    _response->clear();
+    _response->link(_transitAlgorithm);
+    packet->incrementHopCount();
+    RequestAccess::process(_transitAlgorithm, flit, _response);
+
+    HyperX::releaseRoutingExtension(packet);
+  }
+  countAllocations = false;
+
+  for (Message* message : messages) {
+    delete message;
+  }
+  return allocations;
+}
+
+}  // namespace
+
+TEST(HyperX_RoutingAlgorithm, allocationFree) {
+  const std::vector<u32> widths({3, 4});
+  const std::vector<u32> weights({1, 2});
+  const u32 concentration = 2;
+  const u32 interfacePorts = 1;
+  const u32 numVcs = 8;
+  u32 numPorts = concentration;
+  for (u32 dim = 0; dim < widths.size(); dim++) {
+    numPorts += (widths.at(dim) - 1) * weights.at(dim);
+  }
+
+  // all interface addresses
+  u32 numInterfaces =
+      Cube::computeNumInterfaces(widths, concentration, interfacePorts);
+  std::vector<std::vector<u32>> addresses(numInterfaces);
+  for (u32 id = 0; id < numInterfaces; id++) {
+    Cube::translateInterfaceIdToAddress(id, widths, concentration,
+                                        interfacePorts, &addresses.at(id));
+  }
+
+  std::vector<nlohmann::json> configs;
+  for (const char* outputType : {"vc", "port"}) {
+    nlohmann::json base;
+    base["latency"] = 1;
+    base["output_type"] = outputType;
+    base["output_algorithm"] = "random";
+    base["max_outputs"] = 0;
+
+    for (bool table : {false, true}) {
+      nlohmann::json settings = base;
+      settings["algorithm"] = "dimension_order";
+      settings["table"] = table;
+      configs.push_back(settings);
+    }
+    for (const char* minType : {"random", "adaptive"}) {
+      nlohmann::json settings = base;
+      settings["algorithm"] = "minimal";
+      settings["minimal"] = minType;
+      configs.push_back(settings);
+    }
+    for (const char* intNode : {"regular", "source", "dest", "source_dest",
+                                "unaligned", "minimal_vc", "minimal_port"}) {
+      nlohmann::json settings = base;
+      settings["algorithm"] = "valiants";
+      settings["intermediate_node"] = intNode;
+      settings["minimal"] = "adaptive";
+      settings["short_cut"] = true;
+      configs.push_back(settings);
+
+      settings["algorithm"] = "ugal";
+      settings["non_minimal"] = "valiants";
+      settings["min_all_vc_sets"] = true;
+      settings["independent_bias"] = 0.0;
+      settings["decision_scheme"] = "monolithic_weighted";
+      settings["congestion_bias"] = 0.1;
+      settings["bias_mode"] = "regular";
+      settings["hop_count_mode"] = "absolute";
+      configs.push_back(settings);
+    }
+    {
+      nlohmann::json settings = base;
+      settings["algorithm"] = "least_congested_queue";
+      settings["minimal"] = "random";
+      settings["short_cut"] = false;
+      configs.push_back(settings);
+    }
+    for (const char* adType :
+         {"dimension_adaptive", "dimension_order", "variable"}) {
+      nlohmann::json settings = base;
+      settings["algorithm"] = "dal";
+      settings["independent_bias"] = 0.0;
+      settings["decision_scheme"] = "monolithic_weighted";
+      settings["hop_count_mode"] = "absolute";
+      settings["congestion_bias"] = 0.1;
+      settings["adaptivity_type"] = adType;
+      settings["max_deroutes"] = 2;
+      settings["multi_deroute"] = true;
+      configs.push_back(settings);
+    }
+    {
+      nlohmann::json settings = base;
+      settings["algorithm"] = "skipping_dimensions";
+      settings["hop_count_mode"] = "absolute";
+      settings["independent_bias"] = 0.0;
+      settings["decision_scheme"] = "monolithic_weighted";
+      settings["congestion_bias"] = 0.1;
+      settings["skipping_algorithm"] = "dimension_adaptive";
+      settings["finishing_algorithm"] = "dimension_order";
+      settings["num_rounds"] = 2;
+      settings["step"] = 0.5;
+      configs.push_back(settings);
+    }
+  }
+
+  for (const nlohmann::json& settings : configs) {
+    TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
+    TestRouter router({1, 2}, numPorts, numVcs);
+    HyperX::RoutingAlgorithm* algorithm = HyperX::RoutingAlgorithm::create(
+        "RoutingAlgorithm", &router, &router, 0, numVcs, 0, 0, widths,
+        weights, concentration, interfacePorts, settings);
+    HyperX::RoutingAlgorithm* transitAlgorithm =
+        HyperX::RoutingAlgorithm::create(
+            "TransitRoutingAlgorithm", &router, &router, 0, numVcs,
+            concentration, 0, widths, weights, concentration, interfacePorts,
+            settings);
+    algorithm->initialize();
+    transitAlgorithm->initialize();
+
+    // the first rounds size the response and the routing extension pool
+    RoutingAlgorithm::Response response;
+    routeAll(algorithm, transitAlgorithm, addresses, 10, &response);
+    ASSERT_EQ(
+        routeAll(algorithm, transitAlgorithm, addresses, 100, &response), 0u)
+        << settings.dump();
+
+    delete transitAlgorithm;
+    delete algorithm;
+  }
+}
@@ -27,10 +27,39 @@ SkippingDimensionsRoutingAlgorithm::SkippingDimensionsRoutingAlgorithm(
     u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, nlohmann::json _settings)
+    u32 _interfacePorts, const nlohmann::json& _settings)
     : RoutingAlgorithm(_name, _parent, _router, _baseVc, _numVcs, _inputPort,
                        _inputVc, _dimensionWidths, _dimensionWeights,
-                       _concentration, _interfacePorts, _settings) {
+                       _concentration, _interfacePorts, _settings),
+      settings_(_settings),
+      maxOutputs_(settings_->maxOutputs),
+      outputAlg_(settings_->outputAlg),
+      thresholdMin_(settings_->thresholdMin),
+      thresholdNonMin_(settings_->thresholdNonMin),
+      threshold_(settings_->threshold),
+      iBias_(settings_->iBias),
+      cBias_(settings_->cBias),
+      biasMode_(settings_->biasMode),
+      hopCountMode_(settings_->hopCountMode),
+      step_(settings_->step),
+      outputTypePort_(settings_->outputTypePort),
+      skippingType_(settings_->skippingType),
+      finishingType_(settings_->finishingType),
+      decisionScheme_(settings_->decisionScheme),
+      numVcSets_(settings_->numVcSets),
+      numRounds_(settings_->numRounds),
+      outputVcs1_(scratch(0)),
+      outputVcs2_(scratch(1)),
+      outputVcs3_(scratch(2)),
+      vcPool_(scratch(3)),
+      outputPorts_(scratch(4)) {
+  fakeDestinationAddress_.reserve(1 + _dimensionWidths.size());
+
+  assert(_numVcs >= numVcSets_);
+}
+
+SkippingDimensionsRoutingAlgorithm::Settings::Settings(
+    const nlohmann::json& _settings) {
   assert(_settings.contains("output_type") &&
          _settings["output_type"].is_string());
   assert(_settings.contains("decision_scheme") &&
@@ -38,14 +67,14 @@ SkippingDimensionsRoutingAlgorithm::SkippingDimensionsRoutingAlgorithm(
 
   assert(_settings.contains("max_outputs") &&
          _settings["max_outputs"].is_number_integer());
-  maxOutputs_ = _settings["max_outputs"].get<u32>();
+  maxOutputs = _settings["max_outputs"].get<u32>();
 
   assert(_settings.contains("output_algorithm") &&
          _settings["output_algorithm"].is_string());
   if (_settings["output_algorithm"].get<std::string>() == "random") {
-    outputAlg_ = OutputAlg::Rand;
+    outputAlg = OutputAlg::Rand;
   } else if (_settings["output_algorithm"].get<std::string>() == "minimal") {
-    outputAlg_ = OutputAlg::Min;
+    outputAlg = OutputAlg::Min;
   } else {
     fprintf(stderr, "Unknown output algorithm:");
     fprintf(stderr, " '%s'\n",
@@ -56,18 +85,18 @@ SkippingDimensionsRoutingAlgorithm::SkippingDimensionsRoutingAlgorithm(
   // skipping rounds + finishing round
   assert(_settings.contains("num_rounds") &&
          _settings["num_rounds"].is_number_integer());
-  numRounds_ = _settings["num_rounds"].get<u32>();
-  assert(numRounds_ > 0);
+  numRounds = _settings["num_rounds"].get<u32>();
+  assert(numRounds > 0);
 
   // step = dimensional bias
   assert(_settings.contains("step"));
-  step_ = _settings["step"].get<f64>();
+  step = _settings["step"].get<f64>();
 
   assert(_settings.contains("hop_count_mode"));
   if (_settings["hop_count_mode"].get<std::string>() == "absolute") {
-    hopCountMode_ = HopCountMode::ABS;
+    hopCountMode = HopCountMode::ABS;
   } else if (_settings["hop_count_mode"].get<std::string>() == "normalized") {
-    hopCountMode_ = HopCountMode::NORM;
+    hopCountMode = HopCountMode::NORM;
   } else {
     fprintf(stderr, "Unknown hop_count scheme:");
     fprintf(stderr, " '%s'\n",
@@ -77,9 +106,9 @@ SkippingDimensionsRoutingAlgorithm::SkippingDimensionsRoutingAlgorithm(
 
   std::string outputType = _settings["output_type"].get<std::string>();
   if (outputType == "port") {
-    outputTypePort_ = true;
+    outputTypePort = true;
   } else if (outputType == "vc") {
-    outputTypePort_ = false;
+    outputTypePort = false;
   } else {
     fprintf(stderr, "Unknown output type:");
     fprintf(stderr, " '%s'\n", outputType.c_str());
@@ -90,9 +119,9 @@ SkippingDimensionsRoutingAlgorithm::SkippingDimensionsRoutingAlgorithm(
   if (_settings["skipping_algorithm"].get<std::string>() ==
       "dimension_adaptive") {
     if (outputType == "vc") {
-      skippingType_ = SkippingRoutingAlg::DOALV;
+      skippingType = SkippingRoutingAlg::DOALV;
     } else if (outputType == "port") {
-      skippingType_ = SkippingRoutingAlg::DOALP;
+      skippingType = SkippingRoutingAlg::DOALP;
     } else {
       fprintf(stderr, "Unknown output type:");
       fprintf(stderr, " '%s'\n", outputType.c_str());
@@ -101,9 +130,9 @@ SkippingDimensionsRoutingAlgorithm::SkippingDimensionsRoutingAlgorithm(
   } else if (_settings["skipping_algorithm"].get<std::string>() ==
              "dimension_order") {
     if (outputType == "vc") {
-      skippingType_ = SkippingRoutingAlg::DORV;
+      skippingType = SkippingRoutingAlg::DORV;
     } else if (outputType == "port") {
-      skippingType_ = SkippingRoutingAlg::DORP;
+      skippingType = SkippingRoutingAlg::DORP;
     } else {
       fprintf(stderr, "Unknown output type:");
       fprintf(stderr, " '%s'\n", outputType.c_str());
@@ -120,9 +149,9 @@ SkippingDimensionsRoutingAlgorithm::SkippingDimensionsRoutingAlgorithm(
   if (_settings["finishing_algorithm"].get<std::string>() ==
       "dimension_adaptive") {
     if (outputType == "vc") {
-      finishingType_ = SkippingRoutingAlg::DOALV;
+      finishingType = SkippingRoutingAlg::DOALV;
     } else if (outputType == "port") {
-      finishingType_ = SkippingRoutingAlg::DOALP;
+      finishingType = SkippingRoutingAlg::DOALP;
     } else {
       fprintf(stderr, "Unknown output type:");
       fprintf(stderr, " '%s'\n", outputType.c_str());
@@ -131,9 +160,9 @@ SkippingDimensionsRoutingAlgorithm::SkippingDimensionsRoutingAlgorithm(
   } else if (_settings["finishing_algorithm"].get<std::string>() ==
              "dimension_order") {
     if (outputType == "vc") {
-      finishingType_ = SkippingRoutingAlg::DORV;
+      finishingType = SkippingRoutingAlg::DORV;
     } else if (outputType == "port") {
-      finishingType_ = SkippingRoutingAlg::DORP;
+      finishingType = SkippingRoutingAlg::DORP;
     } else {
       fprintf(stderr, "Unknown output type:");
       fprintf(stderr, " '%s'\n", outputType.c_str());
@@ -148,24 +177,24 @@ SkippingDimensionsRoutingAlgorithm::SkippingDimensionsRoutingAlgorithm(
 
   if (_settings["decision_scheme"].get<std::string>() ==
       "monolithic_weighted") {
-    decisionScheme_ = DecisionScheme::MW;
+    decisionScheme = DecisionScheme::MW;
     assert(_settings.contains("independent_bias"));
-    iBias_ = _settings["independent_bias"].get<f64>();
+    iBias = _settings["independent_bias"].get<f64>();
     assert(_settings.contains("congestion_bias"));
-    cBias_ = _settings["congestion_bias"].get<f64>();
+    cBias = _settings["congestion_bias"].get<f64>();
     if (!_settings.contains("bias_mode")) {
-      biasMode_ = BiasScheme::REGULAR;
+      biasMode = BiasScheme::REGULAR;
     } else if (_settings["bias_mode"].get<std::string>() == "regular") {
-      biasMode_ = BiasScheme::REGULAR;
+      biasMode = BiasScheme::REGULAR;
     } else if (_settings["bias_mode"].get<std::string>() == "bimodal") {
-      biasMode_ = BiasScheme::BIMODAL;
+      biasMode = BiasScheme::BIMODAL;
     } else if (_settings["bias_mode"].get<std::string>() == "proportional") {
-      biasMode_ = BiasScheme::PROPORTIONAL;
+      biasMode = BiasScheme::PROPORTIONAL;
     } else if (_settings["bias_mode"].get<std::string>() == "differential") {
-      biasMode_ = BiasScheme::DIFFERENTIAL;
+      biasMode = BiasScheme::DIFFERENTIAL;
     } else if (_settings["bias_mode"].get<std::string>() ==
                "proportional_differential") {
-      biasMode_ = BiasScheme::PROPORTIONALDIF;
+      biasMode = BiasScheme::PROPORTIONALDIF;
     } else {
       fprintf(stderr, "Unknown weighting scheme:");
       fprintf(stderr, " '%s'\n",
@@ -174,16 +203,16 @@ SkippingDimensionsRoutingAlgorithm::SkippingDimensionsRoutingAlgorithm(
     }
   } else if (_settings["decision_scheme"].get<std::string>() ==
              "staged_threshold") {
-    decisionScheme_ = DecisionScheme::ST;
+    decisionScheme = DecisionScheme::ST;
     assert(_settings.contains("threshold_min"));
     assert(_settings.contains("threshold_nonmin"));
-    thresholdMin_ = _settings["threshold_min"].get<f64>();
-    thresholdNonMin_ = _settings["threshold_nonmin"].get<f64>();
+    thresholdMin = _settings["threshold_min"].get<f64>();
+    thresholdNonMin = _settings["threshold_nonmin"].get<f64>();
   } else if (_settings["decision_scheme"].get<std::string>() ==
              "threshold_weighted") {
-    decisionScheme_ = DecisionScheme::TW;
+    decisionScheme = DecisionScheme::TW;
     assert(_settings.contains("threshold"));
-    threshold_ = _settings["threshold"].get<f64>();
+    threshold = _settings["threshold"].get<f64>();
   } else {
     fprintf(stderr, "Unknown decision scheme:");
     fprintf(stderr, " '%s'\n",
@@ -191,29 +220,27 @@ SkippingDimensionsRoutingAlgorithm::SkippingDimensionsRoutingAlgorithm(
     assert(false);
   }
 
-  if ((skippingType_ == SkippingRoutingAlg::DORV) ||
-      (skippingType_ == SkippingRoutingAlg::DORP)) {
-    numVcSets_ = 1 * (numRounds_ - 1);
-  } else if ((skippingType_ == SkippingRoutingAlg::DOALV) ||
-             (skippingType_ == SkippingRoutingAlg::DOALP)) {
-    numVcSets_ = 2 * (numRounds_ - 1);
+  if ((skippingType == SkippingRoutingAlg::DORV) ||
+      (skippingType == SkippingRoutingAlg::DORP)) {
+    numVcSets = 1 * (numRounds - 1);
+  } else if ((skippingType == SkippingRoutingAlg::DOALV) ||
+             (skippingType == SkippingRoutingAlg::DOALP)) {
+    numVcSets = 2 * (numRounds - 1);
   } else {
     fprintf(stderr, "Unknown skipping algorithm\n");
     assert(false);
   }
 
-  if ((finishingType_ == SkippingRoutingAlg::DORV) ||
-      (finishingType_ == SkippingRoutingAlg::DORP)) {
-    numVcSets_ += 1;
-  } else if ((finishingType_ == SkippingRoutingAlg::DOALV) ||
-             (finishingType_ == SkippingRoutingAlg::DOALP)) {
-    numVcSets_ += 2;
+  if ((finishingType == SkippingRoutingAlg::DORV) ||
+      (finishingType == SkippingRoutingAlg::DORP)) {
+    numVcSets += 1;
+  } else if ((finishingType == SkippingRoutingAlg::DOALV) ||
+             (finishingType == SkippingRoutingAlg::DOALP)) {
+    numVcSets += 2;
   } else {
     fprintf(stderr, "Unknown skipping algorithm\n");
     assert(false);
   }
-
-  assert(_numVcs >= numVcSets_);
 }
 
 SkippingDimensionsRoutingAlgorithm::~SkippingDimensionsRoutingAlgorithm() {}
@@ -270,22 +297,23 @@ void SkippingDimensionsRoutingAlgorithm::processRequest(
             concentration_, interfacePorts_, destinationAddress, inDim, baseVc,
             vcSet, numVcSets_, baseVc_ + numVcs_, _flit, iBias_, cBias_, step_,
             threshold_, thresholdMin_, thresholdNonMin_, skippingType_,
-            decisionScheme_, hopCountMode_, &outputVcs1_, &outputVcs2_,
-            &outputVcs3_, &vcPool_);
+            decisionScheme_, hopCountMode_, &fakeDestinationAddress_,
+            &outputVcs1_, &outputVcs2_, &outputVcs3_, &vcPool_);
       } else {
         vcSet = baseVc + 1;
         // We need to use fake destination here the same way we use it in
         // skipping util function
-        std::vector<u32> fakeDestinationAddress(*destinationAddress);
+        fakeDestinationAddress_.assign(destinationAddress->begin(),
+                                       destinationAddress->end());
         if (inDim > 0) {
           for (u32 dim = 1; dim < inDim; dim++) {
-            fakeDestinationAddress.at(dim) = routerAddress.at(dim - 1);
+            fakeDestinationAddress_.at(dim) = routerAddress.at(dim - 1);
           }
         }
         if (skippingType_ == SkippingRoutingAlg::DOALV) {
           doalVcRoutingOutput(router_, inputPort_, inputVc_, dimensionWidths_,
                               dimensionWeights_, concentration_,
-                              interfacePorts_, &fakeDestinationAddress, baseVc,
+                              interfacePorts_, &fakeDestinationAddress_, baseVc,
                               vcSet, numVcSets_, baseVc_ + numVcs_, _flit,
                               &outputVcs1_, &outputVcs2_);
         } else if (skippingType_ == SkippingRoutingAlg::DOALP) {
@@ -324,8 +352,8 @@ void SkippingDimensionsRoutingAlgorithm::processRequest(
           concentration_, interfacePorts_, destinationAddress, inDim, baseVc,
           vcSet, numVcSets_, baseVc_ + numVcs_, _flit, iBias_, cBias_, step_,
           threshold_, thresholdMin_, thresholdNonMin_, skippingType_,
-          decisionScheme_, hopCountMode_, &outputVcs1_, &outputVcs2_,
-          &outputVcs3_, &vcPool_);
+          decisionScheme_, hopCountMode_, &fakeDestinationAddress_,
+          &outputVcs1_, &outputVcs2_, &outputVcs3_, &vcPool_);
     }
 
     // Round increment if out of dimensions in this round
@@ -349,8 +377,8 @@ void SkippingDimensionsRoutingAlgorithm::processRequest(
             concentration_, interfacePorts_, destinationAddress, 0, baseVc,
             vcSet, numVcSets_, baseVc_ + numVcs_, _flit, iBias_, cBias_, step_,
             threshold_, thresholdMin_, thresholdNonMin_, skippingType_,
-            decisionScheme_, hopCountMode_, &outputVcs1_, &outputVcs2_,
-            &outputVcs3_, &vcPool_);
+            decisionScheme_, hopCountMode_, &fakeDestinationAddress_,
+            &outputVcs1_, &outputVcs2_, &outputVcs3_, &vcPool_);
 
         bool NAtakingDeroute = false;
         if (decisionScheme_ == DecisionScheme::MW) {
@@ -430,7 +458,7 @@ void SkippingDimensionsRoutingAlgorithm::processRequest(
 
   if ((finishingType_ == SkippingRoutingAlg::DOALP) ||
       (finishingType_ == SkippingRoutingAlg::DORP)) {
-    makeOutputPortSet(&vcPool_, {vcSet}, numVcs_, baseVc_ + numVcs_,
+    makeOutputPortSet(&vcPool_, &vcSet, 1, numVcs_, baseVc_ + numVcs_,
                       maxOutputs_, outputAlg_, &outputPorts_);
   } else if ((finishingType_ == SkippingRoutingAlg::DOALV) ||
              (finishingType_ == SkippingRoutingAlg::DORV)) {
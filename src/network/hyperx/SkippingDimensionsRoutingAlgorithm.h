@@ -16,17 +16,16 @@
 #define NETWORK_HYPERX_SKIPPINGDIMENSIONSROUTINGALGORITHM_H_
 
 #include <string>
-#include <tuple>
-#include <unordered_set>
 #include <vector>
 
-#include "colhash/tuplehash.h"
 #include "event/Component.h"
+#include "network/hyperx/CandidateVector.h"
 #include "network/hyperx/RoutingAlgorithm.h"
 #include "network/hyperx/util.h"
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
 #include "router/Router.h"
+#include "util/SharedSettings.h"
 
 namespace HyperX {
 
@@ -39,7 +38,7 @@ class SkippingDimensionsRoutingAlgorithm : public RoutingAlgorithm {
                                      const std::vector<u32>& _dimensionWidths,
                                      const std::vector<u32>& _dimensionWeights,
                                      u32 _concentration, u32 _interfacePorts,
-                                     nlohmann::json _settings);
+                                     const nlohmann::json& _settings);
   ~SkippingDimensionsRoutingAlgorithm();
 
  protected:
@@ -47,30 +46,53 @@ class SkippingDimensionsRoutingAlgorithm : public RoutingAlgorithm {
                       RoutingAlgorithm::Response* _response) override;
 
  private:
-  u32 maxOutputs_;
-  OutputAlg outputAlg_;
-  f64 thresholdMin_;
-  f64 thresholdNonMin_;
-  f64 threshold_;
-  f64 iBias_;
-  f64 cBias_;
-  BiasScheme biasMode_;
-  HopCountMode hopCountMode_;
-  f64 step_;
+  struct Settings {
+    explicit Settings(const nlohmann::json& _settings);
+    u32 maxOutputs;
+    OutputAlg outputAlg;
+    f64 thresholdMin = 0.0;
+    f64 thresholdNonMin = 0.0;
+    f64 threshold = 0.0;
+    f64 iBias = 0.0;
+    f64 cBias = 0.0;
+    BiasScheme biasMode = BiasScheme::REGULAR;
+    HopCountMode hopCountMode;
+    f64 step;
+    bool outputTypePort;
+    SkippingRoutingAlg skippingType;
+    SkippingRoutingAlg finishingType;
+    DecisionScheme decisionScheme;
+    u32 numVcSets;
+    u32 numRounds;
+  };
 
-  bool outputTypePort_;
-  SkippingRoutingAlg skippingType_;
-  SkippingRoutingAlg finishingType_;
-  DecisionScheme decisionScheme_;
-  u32 numVcSets_;
+  // parsed once for all instances with the same settings
+  const SharedSettings<Settings> settings_;
+  const u32 maxOutputs_;
+  const OutputAlg outputAlg_;
+  const f64 thresholdMin_;
+  const f64 thresholdNonMin_;
+  const f64 threshold_;
+  const f64 iBias_;
+  const f64 cBias_;
+  const BiasScheme biasMode_;
+  const HopCountMode hopCountMode_;
+  const f64 step_;
+
+  const bool outputTypePort_;
+  const SkippingRoutingAlg skippingType_;
+  const SkippingRoutingAlg finishingType_;
+  const DecisionScheme decisionScheme_;
+  const u32 numVcSets_;
   // u32 finishVcs_;
-  u32 numRounds_;
+  const u32 numRounds_;
 
-  std::unordered_set<std::tuple<u32, u32, f64>> outputVcs1_;
-  std::unordered_set<std::tuple<u32, u32, f64>> outputVcs2_;
-  std::unordered_set<std::tuple<u32, u32, f64>> outputVcs3_;
-  std::unordered_set<std::tuple<u32, u32, f64>> vcPool_;
-  std::unordered_set<std::tuple<u32, u32, f64>> outputPorts_;
+  CandidateVector& outputVcs1_;
+  CandidateVector& outputVcs2_;
+  CandidateVector& outputVcs3_;
+  CandidateVector& vcPool_;
+  CandidateVector& outputPorts_;
+  std::vector<u32> fakeDestinationAddress_;
 };
 
 }  // namespace HyperX
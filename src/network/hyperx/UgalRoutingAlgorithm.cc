@@ -27,10 +27,39 @@ UgalRoutingAlgorithm::UgalRoutingAlgorithm(
     u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, nlohmann::json _settings)
+    u32 _interfacePorts, const nlohmann::json& _settings)
     : RoutingAlgorithm(_name, _parent, _router, _baseVc, _numVcs, _inputPort,
                        _inputVc, _dimensionWidths, _dimensionWeights,
-                       _concentration, _interfacePorts, _settings) {
+                       _concentration, _interfacePorts, _settings),
+      settings_(_settings),
+      maxOutputs_(settings_->maxOutputs),
+      outputAlg_(settings_->outputAlg),
+      thresholdMin_(settings_->thresholdMin),
+      thresholdNonMin_(settings_->thresholdNonMin),
+      threshold_(settings_->threshold),
+      iBias_(settings_->iBias),
+      cBias_(settings_->cBias),
+      biasMode_(settings_->biasMode),
+      outputTypePort_(settings_->outputTypePort),
+      decisionScheme_(settings_->decisionScheme),
+      hopCountMode_(settings_->hopCountMode),
+      minAllVcSets_(settings_->minAllVcSets),
+      intNodeAlg_(settings_->intNodeAlg),
+      routingAlg_(settings_->routingAlg),
+      nonMinimalAlg_(settings_->nonMinimalAlg),
+      shortCut_(settings_->shortCut),
+      vcPoolReg_(scratch(0)),
+      vcPoolVal_(scratch(1)),
+      vcPool_(scratch(2)),
+      outputPorts_(scratch(3)) {
+  // intermediate node candidates are at most one per output port and VC, or
+  //  two per router of each dimension
+  u32 maxIntNodeCandidates = _router->numPorts() * _router->numVcs();
+  for (u32 width : _dimensionWidths) {
+    maxIntNodeCandidates += 2 * width;
+  }
+  intNodeCandidates_.reserve(maxIntNodeCandidates);
+
   // VC set mapping:
   //  0 = injection from terminal port, to intermediate destination
   //  1 = switching dimension increments VC count
@@ -41,6 +70,18 @@ UgalRoutingAlgorithm::UgalRoutingAlgorithm(
   //  2N = last hop to dimension N
   //  we can eject flit to destination terminal using any VC
 
+  if ((routingAlg_ == BaseRoutingAlg::DORV) ||
+      (routingAlg_ == BaseRoutingAlg::DORP)) {
+    assert(_numVcs >= 2);
+  } else if ((intNodeAlg_ == IntNodeAlg::REG) ||
+             (intNodeAlg_ == IntNodeAlg::UNALIGNED)) {
+    assert(_numVcs >= _dimensionWidths.size() * 2);
+  } else {
+    assert(_numVcs >= _dimensionWidths.size() + 1);
+  }
+}
+
+UgalRoutingAlgorithm::Settings::Settings(const nlohmann::json& _settings) {
   assert(_settings.contains("minimal") && _settings["minimal"].is_string());
   assert(_settings.contains("non_minimal") &&
          _settings["non_minimal"].is_string());
@@ -52,9 +93,9 @@ UgalRoutingAlgorithm::UgalRoutingAlgorithm(
   assert(_settings.contains("output_algorithm") &&
          _settings["output_algorithm"].is_string());
   if (_settings["output_algorithm"].get<std::string>() == "random") {
-    outputAlg_ = OutputAlg::Rand;
+    outputAlg = OutputAlg::Rand;
   } else if (_settings["output_algorithm"].get<std::string>() == "minimal") {
-    outputAlg_ = OutputAlg::Min;
+    outputAlg = OutputAlg::Min;
   } else {
     fprintf(stderr, "Unknown output algorithm:");
     fprintf(stderr, " '%s'\n",
@@ -62,34 +103,34 @@ UgalRoutingAlgorithm::UgalRoutingAlgorithm(
     assert(false);
   }
 
-  maxOutputs_ = _settings["max_outputs"].get<u32>();
+  maxOutputs = _settings["max_outputs"].get<u32>();
 
   std::string minimalType = _settings["minimal"].get<std::string>();
   std::string outputType = _settings["output_type"].get<std::string>();
   std::string nonMinimalType = _settings["non_minimal"].get<std::string>();
   assert(_settings.contains("short_cut"));
-  shortCut_ = _settings["short_cut"].get<bool>();
+  shortCut = _settings["short_cut"].get<bool>();
 
   if (nonMinimalType == "valiants") {
-    nonMinimalAlg_ = NonMinRoutingAlg::VAL;
+    nonMinimalAlg = NonMinRoutingAlg::VAL;
     assert(_settings.contains("intermediate_node") &&
            _settings["intermediate_node"].is_string());
     std::string intermediateNode =
         _settings["intermediate_node"].get<std::string>();
     if (intermediateNode == "regular") {
-      intNodeAlg_ = IntNodeAlg::REG;
+      intNodeAlg = IntNodeAlg::REG;
     } else if (intermediateNode == "source") {
-      intNodeAlg_ = IntNodeAlg::SRC;
+      intNodeAlg = IntNodeAlg::SRC;
     } else if (intermediateNode == "dest") {
-      intNodeAlg_ = IntNodeAlg::DST;
+      intNodeAlg = IntNodeAlg::DST;
     } else if (intermediateNode == "source_dest") {
-      intNodeAlg_ = IntNodeAlg::SRCDST;
+      intNodeAlg = IntNodeAlg::SRCDST;
     } else if (intermediateNode == "unaligned") {
-      intNodeAlg_ = IntNodeAlg::UNALIGNED;
+      intNodeAlg = IntNodeAlg::UNALIGNED;
     } else if (intermediateNode == "minimal_vc") {
-      intNodeAlg_ = IntNodeAlg::MINV;
+      intNodeAlg = IntNodeAlg::MINV;
     } else if (intermediateNode == "minimal_port") {
-      intNodeAlg_ = IntNodeAlg::MINP;
+      intNodeAlg = IntNodeAlg::MINP;
     } else {
       fprintf(stderr, "Unknown inter node algorithm:");
       fprintf(stderr, " '%s'\n", intermediateNode.c_str());
@@ -97,11 +138,11 @@ UgalRoutingAlgorithm::UgalRoutingAlgorithm(
     }
   } else if (nonMinimalType == "least_congested_queue") {
     if (outputType == "vc") {
-      nonMinimalAlg_ = NonMinRoutingAlg::LCQV;
-      intNodeAlg_ = IntNodeAlg::NONE;
+      nonMinimalAlg = NonMinRoutingAlg::LCQV;
+      intNodeAlg = IntNodeAlg::NONE;
     } else if (outputType == "port") {
-      nonMinimalAlg_ = NonMinRoutingAlg::LCQP;
-      intNodeAlg_ = IntNodeAlg::NONE;
+      nonMinimalAlg = NonMinRoutingAlg::LCQP;
+      intNodeAlg = IntNodeAlg::NONE;
     } else {
       fprintf(stderr, "Unknown output type:");
       fprintf(stderr, " '%s'\n", outputType.c_str());
@@ -114,9 +155,9 @@ UgalRoutingAlgorithm::UgalRoutingAlgorithm(
   }
 
   if (outputType == "port") {
-    outputTypePort_ = true;
+    outputTypePort = true;
   } else if (outputType == "vc") {
-    outputTypePort_ = false;
+    outputTypePort = false;
   } else {
     fprintf(stderr, "Unknown output type:");
     fprintf(stderr, " '%s'\n", outputType.c_str());
@@ -125,9 +166,9 @@ UgalRoutingAlgorithm::UgalRoutingAlgorithm(
 
   if (minimalType == "dimension_order") {
     if (outputType == "vc") {
-      routingAlg_ = BaseRoutingAlg::DORV;
+      routingAlg = BaseRoutingAlg::DORV;
     } else if (outputType == "port") {
-      routingAlg_ = BaseRoutingAlg::DORP;
+      routingAlg = BaseRoutingAlg::DORP;
     } else {
       fprintf(stderr, "Unknown output type:");
       fprintf(stderr, " '%s'\n", outputType.c_str());
@@ -135,9 +176,9 @@ UgalRoutingAlgorithm::UgalRoutingAlgorithm(
     }
   } else if (minimalType == "random") {
     if (outputType == "vc") {
-      routingAlg_ = BaseRoutingAlg::RMINV;
+      routingAlg = BaseRoutingAlg::RMINV;
     } else if (outputType == "port") {
-      routingAlg_ = BaseRoutingAlg::RMINP;
+      routingAlg = BaseRoutingAlg::RMINP;
     } else {
       fprintf(stderr, "Unknown output type:");
       fprintf(stderr, " '%s'\n", outputType.c_str());
@@ -145,9 +186,9 @@ UgalRoutingAlgorithm::UgalRoutingAlgorithm(
     }
   } else if (minimalType == "adaptive") {
     if (outputType == "vc") {
-      routingAlg_ = BaseRoutingAlg::AMINV;
+      routingAlg = BaseRoutingAlg::AMINV;
     } else if (outputType == "port") {
-      routingAlg_ = BaseRoutingAlg::AMINP;
+      routingAlg = BaseRoutingAlg::AMINP;
     } else {
       fprintf(stderr, "Unknown output type:");
       fprintf(stderr, " '%s'\n", outputType.c_str());
@@ -162,23 +203,23 @@ UgalRoutingAlgorithm::UgalRoutingAlgorithm(
   if (_settings["decision_scheme"].get<std::string>() ==
       "monolithic_weighted") {
     assert(_settings.contains("independent_bias"));
-    iBias_ = _settings["independent_bias"].get<f32>();
-    decisionScheme_ = DecisionScheme::MW;
+    iBias = _settings["independent_bias"].get<f32>();
+    decisionScheme = DecisionScheme::MW;
     assert(_settings.contains("congestion_bias"));
-    cBias_ = _settings["congestion_bias"].get<f32>();
+    cBias = _settings["congestion_bias"].get<f32>();
 
     assert(_settings.contains("bias_mode"));
     if (_settings["bias_mode"].get<std::string>() == "regular") {
-      biasMode_ = BiasScheme::REGULAR;
+      biasMode = BiasScheme::REGULAR;
     } else if (_settings["bias_mode"].get<std::string>() == "bimodal") {
-      biasMode_ = BiasScheme::BIMODAL;
+      biasMode = BiasScheme::BIMODAL;
     } else if (_settings["bias_mode"].get<std::string>() == "proportional") {
-      biasMode_ = BiasScheme::PROPORTIONAL;
+      biasMode = BiasScheme::PROPORTIONAL;
     } else if (_settings["bias_mode"].get<std::string>() == "differential") {
-      biasMode_ = BiasScheme::DIFFERENTIAL;
+      biasMode = BiasScheme::DIFFERENTIAL;
     } else if (_settings["bias_mode"].get<std::string>() ==
                "proportional_differential") {
-      biasMode_ = BiasScheme::PROPORTIONALDIF;
+      biasMode = BiasScheme::PROPORTIONALDIF;
     } else {
       fprintf(stderr, "Unknown weighting scheme:");
       fprintf(stderr, " '%s'\n",
@@ -187,16 +228,16 @@ UgalRoutingAlgorithm::UgalRoutingAlgorithm(
     }
   } else if (_settings["decision_scheme"].get<std::string>() ==
              "staged_threshold") {
-    decisionScheme_ = DecisionScheme::ST;
+    decisionScheme = DecisionScheme::ST;
     assert(_settings.contains("threshold_min"));
     assert(_settings.contains("threshold_nonmin"));
-    thresholdMin_ = _settings["threshold_min"].get<f64>();
-    thresholdNonMin_ = _settings["threshold_nonmin"].get<f64>();
+    thresholdMin = _settings["threshold_min"].get<f64>();
+    thresholdNonMin = _settings["threshold_nonmin"].get<f64>();
   } else if (_settings["decision_scheme"].get<std::string>() ==
              "threshold_weighted") {
-    decisionScheme_ = DecisionScheme::TW;
+    decisionScheme = DecisionScheme::TW;
     assert(_settings.contains("threshold"));
-    threshold_ = _settings["threshold"].get<f64>();
+    threshold = _settings["threshold"].get<f64>();
   } else {
     fprintf(stderr, "Unknown decision scheme:");
     fprintf(stderr, " '%s'\n",
@@ -204,14 +245,14 @@ UgalRoutingAlgorithm::UgalRoutingAlgorithm(
     assert(false);
   }
 
-  if (decisionScheme_ == DecisionScheme::MW ||
-      decisionScheme_ == DecisionScheme::TW) {
+  if (decisionScheme == DecisionScheme::MW ||
+      decisionScheme == DecisionScheme::TW) {
     // ensure hop_count_mode if using weights
     assert(_settings.contains("hop_count_mode"));
     if (_settings["hop_count_mode"].get<std::string>() == "absolute") {
-      hopCountMode_ = HopCountMode::ABS;
+      hopCountMode = HopCountMode::ABS;
     } else if (_settings["hop_count_mode"].get<std::string>() == "normalized") {
-      hopCountMode_ = HopCountMode::NORM;
+      hopCountMode = HopCountMode::NORM;
     } else {
       fprintf(stderr, "Unknown hop_count scheme:");
       fprintf(stderr, " '%s'\n",
@@ -220,17 +261,8 @@ UgalRoutingAlgorithm::UgalRoutingAlgorithm(
     }
   }
 
-  if ((routingAlg_ == BaseRoutingAlg::DORV) ||
-      (routingAlg_ == BaseRoutingAlg::DORP)) {
-    assert(_numVcs >= 2);
-  } else if ((intNodeAlg_ == IntNodeAlg::REG) ||
-             (intNodeAlg_ == IntNodeAlg::UNALIGNED)) {
-    assert(_numVcs >= _dimensionWidths.size() * 2);
-  } else {
-    assert(_numVcs >= _dimensionWidths.size() + 1);
-  }
   assert(_settings.contains("min_all_vc_sets"));
-  minAllVcSets_ = _settings["min_all_vc_sets"].get<bool>();
+  minAllVcSets = _settings["min_all_vc_sets"].get<bool>();
 }
 
 UgalRoutingAlgorithm::~UgalRoutingAlgorithm() {}
@@ -269,8 +301,9 @@ void UgalRoutingAlgorithm::processRequest(
   ugalRoutingOutput(router_, inputPort_, inputVc_, dimensionWidths_,
                     dimensionWeights_, concentration_, interfacePorts_, vcSet,
                     numVcSets, baseVc_ + numVcs_, shortCut_, minAllVcSets_,
-                    intNodeAlg_, routingAlg_, nonMinimalAlg_, _flit, &weightReg,
-                    &weightVal, &vcPoolReg_, &vcPoolVal_);
+                    intNodeAlg_, routingAlg_, nonMinimalAlg_, _flit,
+                    &intNodeCandidates_, &weightReg, &weightVal, &vcPoolReg_,
+                    &vcPoolVal_);
 
   const std::vector<u32>* intermediateAddress =
       reinterpret_cast<const std::vector<u32>*>(packet->getRoutingExtension());
@@ -300,9 +333,8 @@ void UgalRoutingAlgorithm::processRequest(
         }
       }
       if (match) {
-        delete intermediateAddress;
+        releaseRoutingExtension(packet);
         intermediateAddress = nullptr;
-        packet->setRoutingExtension(nullptr);
         vcPoolVal_.clear();
       }
     }
@@ -312,8 +344,7 @@ void UgalRoutingAlgorithm::processRequest(
   if (((vcPoolReg_.empty()) && packet->getHopCount() == 0) ||
       ((vcPoolVal_.empty()) && packet->getHopCount() > 0)) {
     if (intermediateAddress) {
-      packet->setRoutingExtension(nullptr);
-      delete intermediateAddress;
+      releaseRoutingExtension(packet);
     }
     // assert is destination router
     const std::vector<u32>& routerAddress = router_->address();
@@ -404,9 +435,7 @@ void UgalRoutingAlgorithm::processRequest(
     }
 
     if (!nonMin) {  // minimal
-      delete reinterpret_cast<const std::vector<u32>*>(
-          packet->getRoutingExtension());
-      packet->setRoutingExtension(nullptr);
+      releaseRoutingExtension(packet);
     } else {
       if ((routingAlg_ == BaseRoutingAlg::DORP) ||
           (routingAlg_ == BaseRoutingAlg::DORV)) {
@@ -417,29 +446,32 @@ void UgalRoutingAlgorithm::processRequest(
     }
 
     if (outputTypePort_) {
-      std::vector<u32> vcSets;
+      u32 vcSets[2];
+      u32 vcSetsCount;
       if (!minAllVcSets_ || nonMin) {  // minAllVCsets off or going nonmin
-        vcSets.push_back(vcSet);
+        vcSets[0] = vcSet;
+        vcSetsCount = 1;
       } else {  // enable all vc sets for initial hop & minimal
         if ((routingAlg_ == BaseRoutingAlg::DORV) ||
             (routingAlg_ == BaseRoutingAlg::DORP)) {
           // DOR 2 vcSets (0 and 1)
-          vcSets.push_back(baseVc_ + 0);
-          vcSets.push_back(baseVc_ + 1);
+          vcSets[0] = baseVc_ + 0;
+          vcSets[1] = baseVc_ + 1;
         } else if ((intNodeAlg_ == IntNodeAlg::REG) ||
                    (intNodeAlg_ == IntNodeAlg::UNALIGNED)) {
           // distance class vcSets 0 and Dim
-          vcSets.push_back(baseVc_ + 0);
-          vcSets.push_back(baseVc_ + dimensionWidths_.size());
+          vcSets[0] = baseVc_ + 0;
+          vcSets[1] = baseVc_ + dimensionWidths_.size();
         } else {
           // 2 VcSets (0 and 1)
-          vcSets.push_back(baseVc_ + 0);
-          vcSets.push_back(baseVc_ + 1);
+          vcSets[0] = baseVc_ + 0;
+          vcSets[1] = baseVc_ + 1;
         }
+        vcSetsCount = 2;
       }
-      // vcSets is a vector
-      makeOutputPortSet(&vcPool_, vcSets, numVcSets, baseVc_ + numVcs_,
-                        maxOutputs_, outputAlg_, &outputPorts_);
+      makeOutputPortSet(&vcPool_, vcSets, vcSetsCount, numVcSets,
+                        baseVc_ + numVcs_, maxOutputs_, outputAlg_,
+                        &outputPorts_);
     } else {
       makeOutputVcSet(&vcPool_, maxOutputs_, outputAlg_, &outputPorts_);
     }
@@ -453,7 +485,7 @@ void UgalRoutingAlgorithm::processRequest(
       }
     }
     if (outputTypePort_) {
-      makeOutputPortSet(&vcPoolVal_, {vcSet}, numVcSets, baseVc_ + numVcs_,
+      makeOutputPortSet(&vcPoolVal_, &vcSet, 1, numVcSets, baseVc_ + numVcs_,
                         maxOutputs_, outputAlg_, &outputPorts_);
     } else {
       makeOutputVcSet(&vcPoolVal_, maxOutputs_, outputAlg_, &outputPorts_);
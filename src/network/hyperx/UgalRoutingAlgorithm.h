@@ -16,17 +16,16 @@
 #define NETWORK_HYPERX_UGALROUTINGALGORITHM_H_
 
 #include <string>
-#include <tuple>
-#include <unordered_set>
 #include <vector>
 
-#include "colhash/tuplehash.h"
 #include "event/Component.h"
+#include "network/hyperx/CandidateVector.h"
 #include "network/hyperx/RoutingAlgorithm.h"
 #include "network/hyperx/util.h"
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
 #include "router/Router.h"
+#include "util/SharedSettings.h"
 
 namespace HyperX {
 
@@ -38,7 +37,7 @@ class UgalRoutingAlgorithm : public RoutingAlgorithm {
                        const std::vector<u32>& _dimensionWidths,
                        const std::vector<u32>& _dimensionWeights,
                        u32 _concentration, u32 _interfacePorts,
-                       nlohmann::json _settings);
+                       const nlohmann::json& _settings);
   ~UgalRoutingAlgorithm();
 
  protected:
@@ -46,28 +45,51 @@ class UgalRoutingAlgorithm : public RoutingAlgorithm {
                       RoutingAlgorithm::Response* _response) override;
 
  private:
-  u32 maxOutputs_;
-  OutputAlg outputAlg_;
-  f64 thresholdMin_;
-  f64 thresholdNonMin_;
-  f64 threshold_;
-  f64 iBias_;
-  f64 cBias_;
-  BiasScheme biasMode_;
-  bool outputTypePort_;
-  DecisionScheme decisionScheme_;
-  HopCountMode hopCountMode_;
-  bool minAllVcSets_;
+  struct Settings {
+    explicit Settings(const nlohmann::json& _settings);
+    u32 maxOutputs;
+    OutputAlg outputAlg;
+    f64 thresholdMin = 0.0;
+    f64 thresholdNonMin = 0.0;
+    f64 threshold = 0.0;
+    f64 iBias = 0.0;
+    f64 cBias = 0.0;
+    BiasScheme biasMode = BiasScheme::REGULAR;
+    bool outputTypePort;
+    DecisionScheme decisionScheme;
+    HopCountMode hopCountMode = HopCountMode::ABS;
+    bool minAllVcSets;
+    IntNodeAlg intNodeAlg;
+    BaseRoutingAlg routingAlg;
+    NonMinRoutingAlg nonMinimalAlg;
+    bool shortCut;
+  };
 
-  std::unordered_set<std::tuple<u32, u32, f64>> vcPoolReg_;
-  std::unordered_set<std::tuple<u32, u32, f64>> vcPoolVal_;
-  std::unordered_set<std::tuple<u32, u32, f64>> vcPool_;
-  std::unordered_set<std::tuple<u32, u32, f64>> outputPorts_;
+  // parsed once for all instances with the same settings
+  const SharedSettings<Settings> settings_;
+  const u32 maxOutputs_;
+  const OutputAlg outputAlg_;
+  const f64 thresholdMin_;
+  const f64 thresholdNonMin_;
+  const f64 threshold_;
+  const f64 iBias_;
+  const f64 cBias_;
+  const BiasScheme biasMode_;
+  const bool outputTypePort_;
+  const DecisionScheme decisionScheme_;
+  const HopCountMode hopCountMode_;
+  const bool minAllVcSets_;
 
-  IntNodeAlg intNodeAlg_;
-  BaseRoutingAlg routingAlg_;
-  NonMinRoutingAlg nonMinimalAlg_;
-  bool shortCut_;
+  const IntNodeAlg intNodeAlg_;
+  const BaseRoutingAlg routingAlg_;
+  const NonMinRoutingAlg nonMinimalAlg_;
+  const bool shortCut_;
+
+  CandidateVector& vcPoolReg_;
+  CandidateVector& vcPoolVal_;
+  CandidateVector& vcPool_;
+  CandidateVector& outputPorts_;
+  std::vector<u32> intNodeCandidates_;
 };
 
 }  // namespace HyperX
@@ -27,10 +27,26 @@ ValiantsRoutingAlgorithm::ValiantsRoutingAlgorithm(
     u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, nlohmann::json _settings)
+    u32 _interfacePorts, const nlohmann::json& _settings)
     : RoutingAlgorithm(_name, _parent, _router, _baseVc, _numVcs, _inputPort,
                        _inputVc, _dimensionWidths, _dimensionWeights,
-                       _concentration, _interfacePorts, _settings) {
+                       _concentration, _interfacePorts, _settings),
+      settings_(_settings),
+      maxOutputs_(settings_->maxOutputs),
+      outputAlg_(settings_->outputAlg),
+      intNodeAlg_(settings_->intNodeAlg),
+      routingAlg_(settings_->routingAlg),
+      shortCut_(settings_->shortCut),
+      vcPool_(scratch(0)),
+      outputPorts_(scratch(1)) {
+  // intermediate node candidates are at most one per output port and VC, or
+  //  two per router of each dimension
+  u32 maxIntNodeCandidates = _router->numPorts() * _router->numVcs();
+  for (u32 width : _dimensionWidths) {
+    maxIntNodeCandidates += 2 * width;
+  }
+  intNodeCandidates_.reserve(maxIntNodeCandidates);
+
   // VC set mapping:
   //  0 = injection from terminal port, to intermediate destination
   //  1 = switching dimension increments VC count
@@ -41,6 +57,15 @@ ValiantsRoutingAlgorithm::ValiantsRoutingAlgorithm(
   //  2N = last hop to dimension N
   //  we can eject flit to destination terminal using any VC
 
+  if ((routingAlg_ == BaseRoutingAlg::DORV) ||
+      (routingAlg_ == BaseRoutingAlg::DORP)) {
+    assert(_numVcs >= 2);
+  } else {
+    assert(_numVcs >= _dimensionWidths.size() * 2);
+  }
+}
+
+ValiantsRoutingAlgorithm::Settings::Settings(const nlohmann::json& _settings) {
   assert(_settings.contains("intermediate_node") &&
          _settings["intermediate_node"].is_string());
   assert(_settings.contains("minimal") && _settings["minimal"].is_string());
@@ -52,9 +77,9 @@ ValiantsRoutingAlgorithm::ValiantsRoutingAlgorithm(
   assert(_settings.contains("output_algorithm") &&
          _settings["output_algorithm"].is_string());
   if (_settings["output_algorithm"].get<std::string>() == "random") {
-    outputAlg_ = OutputAlg::Rand;
+    outputAlg = OutputAlg::Rand;
   } else if (_settings["output_algorithm"].get<std::string>() == "minimal") {
-    outputAlg_ = OutputAlg::Min;
+    outputAlg = OutputAlg::Min;
   } else {
     fprintf(stderr, "Unknown output algorithm:");
     fprintf(stderr, " '%s'\n",
@@ -62,28 +87,28 @@ ValiantsRoutingAlgorithm::ValiantsRoutingAlgorithm(
     assert(false);
   }
 
-  maxOutputs_ = _settings["max_outputs"].get<u32>();
+  maxOutputs = _settings["max_outputs"].get<u32>();
 
   std::string intermediateNode =
       _settings["intermediate_node"].get<std::string>();
   std::string minimalType = _settings["minimal"].get<std::string>();
   std::string outputType = _settings["output_type"].get<std::string>();
-  shortCut_ = _settings["short_cut"].get<bool>();
+  shortCut = _settings["short_cut"].get<bool>();
 
   if (intermediateNode == "regular") {
-    intNodeAlg_ = IntNodeAlg::REG;
+    intNodeAlg = IntNodeAlg::REG;
   } else if (intermediateNode == "source") {
-    intNodeAlg_ = IntNodeAlg::SRC;
+    intNodeAlg = IntNodeAlg::SRC;
   } else if (intermediateNode == "dest") {
-    intNodeAlg_ = IntNodeAlg::DST;
+    intNodeAlg = IntNodeAlg::DST;
   } else if (intermediateNode == "source_dest") {
-    intNodeAlg_ = IntNodeAlg::SRCDST;
+    intNodeAlg = IntNodeAlg::SRCDST;
   } else if (intermediateNode == "unaligned") {
-    intNodeAlg_ = IntNodeAlg::UNALIGNED;
+    intNodeAlg = IntNodeAlg::UNALIGNED;
   } else if (intermediateNode == "minimal_vc") {
-    intNodeAlg_ = IntNodeAlg::MINV;
+    intNodeAlg = IntNodeAlg::MINV;
   } else if (intermediateNode == "minimal_port") {
-    intNodeAlg_ = IntNodeAlg::MINP;
+    intNodeAlg = IntNodeAlg::MINP;
   } else {
     fprintf(stderr, "Unknown inter node algorithm:");
     fprintf(stderr, " '%s'\n", intermediateNode.c_str());
@@ -91,33 +116,30 @@ ValiantsRoutingAlgorithm::ValiantsRoutingAlgorithm(
   }
 
   if (minimalType == "dimension_order") {
-    assert(numVcs_ >= 2);
     if (outputType == "vc") {
-      routingAlg_ = BaseRoutingAlg::DORV;
+      routingAlg = BaseRoutingAlg::DORV;
     } else if (outputType == "port") {
-      routingAlg_ = BaseRoutingAlg::DORP;
+      routingAlg = BaseRoutingAlg::DORP;
     } else {
       fprintf(stderr, "Unknown output type:");
       fprintf(stderr, " '%s'\n", outputType.c_str());
       assert(false);
     }
   } else if (minimalType == "random") {
-    assert(numVcs_ >= (2 * _dimensionWidths.size()));
     if (outputType == "vc") {
-      routingAlg_ = BaseRoutingAlg::RMINV;
+      routingAlg = BaseRoutingAlg::RMINV;
     } else if (outputType == "port") {
-      routingAlg_ = BaseRoutingAlg::RMINP;
+      routingAlg = BaseRoutingAlg::RMINP;
     } else {
       fprintf(stderr, "Unknown output type:");
       fprintf(stderr, " '%s'\n", outputType.c_str());
       assert(false);
     }
   } else if (minimalType == "adaptive") {
-    assert(numVcs_ >= (2 * _dimensionWidths.size()));
     if (outputType == "vc") {
-      routingAlg_ = BaseRoutingAlg::AMINV;
+      routingAlg = BaseRoutingAlg::AMINV;
     } else if (outputType == "port") {
-      routingAlg_ = BaseRoutingAlg::AMINP;
+      routingAlg = BaseRoutingAlg::AMINP;
     } else {
       fprintf(stderr, "Unknown output type:");
       fprintf(stderr, " '%s'\n", outputType.c_str());
@@ -128,16 +150,6 @@ ValiantsRoutingAlgorithm::ValiantsRoutingAlgorithm(
     fprintf(stderr, " '%s'\n", minimalType.c_str());
     assert(false);
   }
-
-  if ((routingAlg_ == BaseRoutingAlg::DORV) ||
-      (routingAlg_ == BaseRoutingAlg::DORP)) {
-    assert(_numVcs >= 2);
-  } else if ((intNodeAlg_ == IntNodeAlg::REG) ||
-             (intNodeAlg_ == IntNodeAlg::UNALIGNED)) {
-    assert(_numVcs >= _dimensionWidths.size() * 2);
-  } else {
-    assert(_numVcs >= _dimensionWidths.size() + 1);
-  }
 }
 
 ValiantsRoutingAlgorithm::~ValiantsRoutingAlgorithm() {}
@@ -179,7 +191,8 @@ void ValiantsRoutingAlgorithm::processRequest(
   valiantsRoutingOutput(router_, inputPort_, inputVc_, dimensionWidths_,
                         dimensionWeights_, concentration_, interfacePorts_,
                         destinationAddress, vcSet, numVcSets, baseVc_ + numVcs_,
-                        shortCut_, intNodeAlg_, routingAlg_, _flit, &vcPool_);
+                        shortCut_, intNodeAlg_, routingAlg_, _flit,
+                        &intNodeCandidates_, &vcPool_);
 
   if ((routingAlg_ == BaseRoutingAlg::DORP) ||
       (routingAlg_ == BaseRoutingAlg::DORV)) {
@@ -197,7 +210,7 @@ void ValiantsRoutingAlgorithm::processRequest(
   if ((routingAlg_ == BaseRoutingAlg::DORP) ||
       (routingAlg_ == BaseRoutingAlg::RMINP) ||
       (routingAlg_ == BaseRoutingAlg::AMINP)) {
-    makeOutputPortSet(&vcPool_, {vcSet}, numVcSets, baseVc_ + numVcs_,
+    makeOutputPortSet(&vcPool_, &vcSet, 1, numVcSets, baseVc_ + numVcs_,
                       maxOutputs_, outputAlg_, &outputPorts_);
   } else if ((routingAlg_ == BaseRoutingAlg::DORV) ||
              (routingAlg_ == BaseRoutingAlg::RMINV) ||
@@ -16,17 +16,16 @@
 #define NETWORK_HYPERX_VALIANTSROUTINGALGORITHM_H_
 
 #include <string>
-#include <tuple>
-#include <unordered_set>
 #include <vector>
 
-#include "colhash/tuplehash.h"
 #include "event/Component.h"
+#include "network/hyperx/CandidateVector.h"
 #include "network/hyperx/RoutingAlgorithm.h"
 #include "network/hyperx/util.h"
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
 #include "router/Router.h"
+#include "util/SharedSettings.h"
 
 namespace HyperX {
 
@@ -38,7 +37,7 @@ class ValiantsRoutingAlgorithm : public RoutingAlgorithm {
                            const std::vector<u32>& _dimensionWidths,
                            const std::vector<u32>& _dimensionWeights,
                            u32 _concentration, u32 _interfacePorts,
-                           nlohmann::json _settings);
+                           const nlohmann::json& _settings);
   ~ValiantsRoutingAlgorithm();
 
  protected:
@@ -46,13 +45,25 @@ class ValiantsRoutingAlgorithm : public RoutingAlgorithm {
                       RoutingAlgorithm::Response* _response) override;
 
  private:
-  u32 maxOutputs_;
-  OutputAlg outputAlg_;
-  std::unordered_set<std::tuple<u32, u32, f64>> vcPool_;
-  std::unordered_set<std::tuple<u32, u32, f64>> outputPorts_;
-  IntNodeAlg intNodeAlg_;
-  BaseRoutingAlg routingAlg_;
-  bool shortCut_;
+  struct Settings {
+    explicit Settings(const nlohmann::json& _settings);
+    u32 maxOutputs;
+    OutputAlg outputAlg;
+    IntNodeAlg intNodeAlg;
+    BaseRoutingAlg routingAlg;
+    bool shortCut;
+  };
+
+  // parsed once for all instances with the same settings
+  const SharedSettings<Settings> settings_;
+  const u32 maxOutputs_;
+  const OutputAlg outputAlg_;
+  const IntNodeAlg intNodeAlg_;
+  const BaseRoutingAlg routingAlg_;
+  const bool shortCut_;
+  CandidateVector& vcPool_;
+  CandidateVector& outputPorts_;
+  std::vector<u32> intNodeCandidates_;
 };
 
 }  // namespace HyperX
@@ -17,9 +17,7 @@
 #include <algorithm>
 #include <cassert>
 #include <iostream>
-#include <set>
 
-#include "colhash/tuplehash.h"
 #include "network/cube/util.h"
 
 const f64 TOLERANCE = 1e-6;
@@ -106,15 +104,138 @@ u32 computeInputPortDim(const std::vector<u32>& _dimensionWidths,
   assert(false);
 }
 
+namespace {
+
+// this holds the vectors of released routing extensions for reuse
+class RoutingExtensionPool {
+ public:
+  RoutingExtensionPool() {}
+
+  ~RoutingExtensionPool() {
+    for (std::vector<u32>* extension : free_) {
+      delete extension;
+    }
+  }
+
+  std::vector<u32>* get() {
+    if (free_.empty()) {
+      return new std::vector<u32>();
+    }
+    std::vector<u32>* extension = free_.back();
+    free_.pop_back();
+    return extension;
+  }
+
+  void put(std::vector<u32>* _extension) {
+    free_.push_back(_extension);
+  }
+
+ private:
+  std::vector<std::vector<u32>*> free_;
+};
+
+RoutingExtensionPool routingExtensions;
+
+}  // namespace
+
+std::vector<u32>* createRoutingExtension(u32 _size, u32 _value) {
+  std::vector<u32>* extension = routingExtensions.get();
+  extension->assign(_size, _value);
+  return extension;
+}
+
+void releaseRoutingExtension(Packet* _packet) {
+  std::vector<u32>* extension =
+      reinterpret_cast<std::vector<u32>*>(_packet->getRoutingExtension());
+  if (extension != nullptr) {
+    routingExtensions.put(extension);
+    _packet->setRoutingExtension(nullptr);
+  }
+}
+
 /*******************INTERMEDIATE DESTINATION FOR VALIANTS**********************/
 
+namespace {
+
+// this returns the id of the router at '_address' (starting at '_offset') with
+//  the coordinate of dimension '_dim' replaced by '_coord'
+u32 alignedRouterId(const std::vector<u32>& _address, u32 _offset,
+                    const std::vector<u32>& _dimensionWidths, u32 _dim,
+                    u32 _coord) {
+  // addresses are in little endian format
+  u32 id = 0;
+  u32 scale = 1;
+  for (u32 dim = 0; dim < _dimensionWidths.size(); dim++) {
+    u32 coord = (dim == _dim) ? _coord : _address.at(_offset + dim);
+    id += coord * scale;
+    scale *= _dimensionWidths.at(dim);
+  }
+  return id;
+}
+
+// this sets the intermediate address to the address of router '_routerId'
+void setIntermediateRouter(u32 _routerId,
+                           const std::vector<u32>& _dimensionWidths,
+                           std::vector<u32>* _address) {
+  _address->at(0) = 0;
+  for (u32 dim = 0; dim < _dimensionWidths.size(); dim++) {
+    _address->at(dim + 1) = _routerId % _dimensionWidths.at(dim);
+    _routerId /= _dimensionWidths.at(dim);
+  }
+}
+
+// this picks a router uniformly at random from the '_candidates' router ids,
+//  the candidates may contain duplicates and are reordered in place
+u32 randCandidateRouter(std::vector<u32>* _candidates) {
+  assert(!_candidates->empty());
+  std::sort(_candidates->begin(), _candidates->end());
+  _candidates->erase(std::unique(_candidates->begin(), _candidates->end()),
+                     _candidates->end());
+  u64 randInd = gSim->rnd.nextU64(0, _candidates->size() - 1);
+  return _candidates->at(randInd);
+}
+
+// this picks a router uniformly at random from the routers that differ from
+//  '_address' (starting at '_offset') in at most one dimension
+void randAlignedRouter(const std::vector<u32>& _address, u32 _offset,
+                       const std::vector<u32>& _dimensionWidths,
+                       std::vector<u32>* _intAddress) {
+  // the router itself is followed by the other routers of each dimension
+  u32 numRouters = 1;
+  for (u32 dim = 0; dim < _dimensionWidths.size(); dim++) {
+    numRouters += _dimensionWidths.at(dim) - 1;
+  }
+  u64 randInd = gSim->rnd.nextU64(0, numRouters - 1);
+
+  _intAddress->at(0) = 0;
+  for (u32 dim = 0; dim < _dimensionWidths.size(); dim++) {
+    _intAddress->at(dim + 1) = _address.at(_offset + dim);
+  }
+  if (randInd == 0) {
+    return;
+  }
+  randInd--;
+  for (u32 dim = 0; dim < _dimensionWidths.size(); dim++) {
+    u32 others = _dimensionWidths.at(dim) - 1;
+    if (randInd < others) {
+      u32 coord = _address.at(_offset + dim);
+      _intAddress->at(dim + 1) = randInd < coord ? randInd : randInd + 1;
+      return;
+    }
+    randInd -= others;
+  }
+  assert(false);
+}
+
+}  // namespace
+
 void intNodeReg(Router* _router, u32 _inputPort, u32 _inputVc,
                 const std::vector<u32>& _sourceRouter,
                 const std::vector<u32>* _destinationTerminal,
                 const std::vector<u32>& _dimensionWidths,
                 const std::vector<u32>& _dimensionWeights, u32 _concentration,
                 u32 _interfacePorts, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
-                std::vector<u32>* _address) {
+                std::vector<u32>* _candidates, std::vector<u32>* _address) {
   u32 dimensions = _dimensionWidths.size();
   _address->resize(1 + dimensions);
 
@@ -133,36 +254,28 @@ void intNodeMoveUnaligned(Router* _router, u32 _inputPort, u32 _inputVc,
                           const std::vector<u32>& _dimensionWeights,
                           u32 _concentration, u32 _interfacePorts, u32 _vcSet,
                           u32 _numVcSets, u32 _numVcs,
+                          std::vector<u32>* _candidates,
                           std::vector<u32>* _address) {
   u32 dimensions = _dimensionWidths.size();
   _address->resize(1 + dimensions);
 
-  std::unordered_set<u32> nodesUnAligned;
-
-  u32 numRouters = Cube::computeNumRouters(_dimensionWidths);
-
-  for (u32 routerId = 0; routerId < numRouters; ++routerId) {
-    std::vector<u32> routerAddr;
-    Cube::translateRouterIdToAddress(routerId, _dimensionWidths, &routerAddr);
-    bool aligned = true;
-    for (u32 dim = 0; dim < _dimensionWidths.size(); dim++) {
-      if ((_sourceRouter.at(dim) == _destinationTerminal->at(dim + 1)) &&
-          (_sourceRouter.at(dim) != routerAddr.at(dim))) {
-        aligned = false;
-      }
-    }
-    if (aligned) {  // not done twice
-      bool res = nodesUnAligned.emplace(routerId).second;
-      assert(res);
+  // the routers keeping the aligned dimensions of the source and destination
+  //  form a sub-hyperx over the unaligned dimensions, pick one of them
+  u64 numRouters = 1;
+  for (u32 dim = 0; dim < dimensions; dim++) {
+    if (_sourceRouter.at(dim) != _destinationTerminal->at(dim + 1)) {
+      numRouters *= _dimensionWidths.at(dim);
     }
   }
+  u64 randInd = gSim->rnd.nextU64(0, numRouters - 1);
 
-  const u32* it = uSetRandElement(nodesUnAligned);
-  std::vector<u32> ancestor;
-  Cube::translateRouterIdToAddress(*it, _dimensionWidths, &ancestor);
-
-  for (u32 ind = 0; ind < _sourceRouter.size(); ind++) {
-    _address->at(ind + 1) = ancestor.at(ind);
+  for (u32 dim = 0; dim < dimensions; dim++) {
+    if (_sourceRouter.at(dim) == _destinationTerminal->at(dim + 1)) {
+      _address->at(dim + 1) = _sourceRouter.at(dim);
+    } else {
+      _address->at(dim + 1) = randInd % _dimensionWidths.at(dim);
+      randInd /= _dimensionWidths.at(dim);
+    }
   }
   _address->at(0) = 0;
 }
@@ -173,29 +286,11 @@ void intNodeSrc(Router* _router, u32 _inputPort, u32 _inputVc,
                 const std::vector<u32>& _dimensionWidths,
                 const std::vector<u32>& _dimensionWeights, u32 _concentration,
                 u32 _interfacePorts, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
-                std::vector<u32>* _address) {
-  std::unordered_set<u32> ancestors;
+                std::vector<u32>* _candidates, std::vector<u32>* _address) {
   u32 dimensions = _dimensionWidths.size();
   _address->resize(1 + dimensions);
 
-  for (u32 dim = 0; dim < dimensions; dim++) {
-    for (u32 idx = 0; idx < _dimensionWidths.at(dim); idx++) {
-      std::vector<u32> tmpVec(_sourceRouter);
-      tmpVec.at(dim) = idx;
-      u32 ancestorId =
-          Cube::translateRouterAddressToId(&tmpVec, _dimensionWidths);
-      ancestors.emplace(ancestorId);
-    }
-  }
-
-  const u32* it = uSetRandElement(ancestors);
-  std::vector<u32> ancestor;
-  Cube::translateRouterIdToAddress(*it, _dimensionWidths, &ancestor);
-
-  for (u32 ind = 0; ind < _sourceRouter.size(); ind++) {
-    _address->at(ind + 1) = ancestor.at(ind);
-  }
-  _address->at(0) = 0;
+  randAlignedRouter(_sourceRouter, 0, _dimensionWidths, _address);
 }
 
 void intNodeDst(Router* _router, u32 _inputPort, u32 _inputVc,
@@ -204,32 +299,11 @@ void intNodeDst(Router* _router, u32 _inputPort, u32 _inputVc,
                 const std::vector<u32>& _dimensionWidths,
                 const std::vector<u32>& _dimensionWeights, u32 _concentration,
                 u32 _interfacePorts, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
-                std::vector<u32>* _address) {
-  std::unordered_set<u32> ancestors;
+                std::vector<u32>* _candidates, std::vector<u32>* _address) {
   u32 dimensions = _dimensionWidths.size();
   _address->resize(1 + dimensions);
 
-  for (u32 dim = 0; dim < dimensions; dim++) {
-    for (u32 idx = 0; idx < _dimensionWidths.at(dim); idx++) {
-      std::vector<u32> tmpVec(dimensions);
-      for (u32 ind = 0; ind < dimensions; ind++) {
-        tmpVec.at(ind) = _destinationTerminal->at(ind + 1);
-      }
-      tmpVec.at(dim) = idx;
-      u32 ancestorId =
-          Cube::translateRouterAddressToId(&tmpVec, _dimensionWidths);
-      ancestors.emplace(ancestorId);
-    }
-  }
-
-  const u32* it = uSetRandElement(ancestors);
-  std::vector<u32> ancestor;
-  Cube::translateRouterIdToAddress(*it, _dimensionWidths, &ancestor);
-
-  for (u32 ind = 0; ind < _sourceRouter.size(); ind++) {
-    _address->at(ind + 1) = ancestor.at(ind);
-  }
-  _address->at(0) = 0;
+  randAlignedRouter(*_destinationTerminal, 1, _dimensionWidths, _address);
 }
 
 void intNodeSrcDst(Router* _router, u32 _inputPort, u32 _inputVc,
@@ -238,42 +312,28 @@ void intNodeSrcDst(Router* _router, u32 _inputPort, u32 _inputVc,
                    const std::vector<u32>& _dimensionWidths,
                    const std::vector<u32>& _dimensionWeights,
                    u32 _concentration, u32 _interfacePorts, u32 _vcSet,
-                   u32 _numVcSets, u32 _numVcs, std::vector<u32>* _address) {
-  std::unordered_set<u32> ancestors;
+                   u32 _numVcSets, u32 _numVcs, std::vector<u32>* _candidates,
+                   std::vector<u32>* _address) {
+  _candidates->clear();
   u32 dimensions = _dimensionWidths.size();
   _address->resize(1 + dimensions);
 
   for (u32 dim = 0; dim < dimensions; dim++) {
     for (u32 idx = 0; idx < _dimensionWidths.at(dim); idx++) {
-      std::vector<u32> tmpVec(_sourceRouter);
-      tmpVec.at(dim) = idx;
-      u32 ancestorId =
-          Cube::translateRouterAddressToId(&tmpVec, _dimensionWidths);
-      ancestors.emplace(ancestorId);
+      _candidates->push_back(
+          alignedRouterId(_sourceRouter, 0, _dimensionWidths, dim, idx));
     }
   }
 
   for (u32 dim = 0; dim < dimensions; dim++) {
     for (u32 idx = 0; idx < _dimensionWidths.at(dim); idx++) {
-      std::vector<u32> tmpVec(dimensions);
-      for (u32 ind = 0; ind < dimensions; ind++) {
-        tmpVec.at(ind) = _destinationTerminal->at(ind + 1);
-      }
-      tmpVec.at(dim) = idx;
-      u32 ancestorId =
-          Cube::translateRouterAddressToId(&tmpVec, _dimensionWidths);
-      ancestors.emplace(ancestorId);
+      _candidates->push_back(alignedRouterId(*_destinationTerminal, 1,
+                                             _dimensionWidths, dim, idx));
     }
   }
 
-  const u32* it = uSetRandElement(ancestors);
-  std::vector<u32> ancestor;
-  Cube::translateRouterIdToAddress(*it, _dimensionWidths, &ancestor);
-
-  for (u32 ind = 0; ind < _sourceRouter.size(); ind++) {
-    _address->at(ind + 1) = ancestor.at(ind);
-  }
-  _address->at(0) = 0;
+  setIntermediateRouter(randCandidateRouter(_candidates), _dimensionWidths,
+                        _address);
 }
 
 void intNodeMinV(Router* _router, u32 _inputPort, u32 _inputVc,
@@ -282,12 +342,12 @@ void intNodeMinV(Router* _router, u32 _inputPort, u32 _inputVc,
                  const std::vector<u32>& _dimensionWidths,
                  const std::vector<u32>& _dimensionWeights, u32 _concentration,
                  u32 _interfacePorts, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
-                 std::vector<u32>* _address) {
+                 std::vector<u32>* _candidates, std::vector<u32>* _address) {
   u32 dim;
   u32 portBase = _concentration;
   f64 minCongestion = F64_POS_INF;
 
-  std::unordered_set<u32> ancestors;
+  _candidates->clear();
   u32 dimensions = _dimensionWidths.size();
   _address->resize(1 + dimensions);
   const f64 tolerance = 1e-6;
@@ -303,35 +363,23 @@ void intNodeMinV(Router* _router, u32 _inputPort, u32 _inputVc,
             continue;
           } else if (congestion < (minCongestion - tolerance)) {
             minCongestion = congestion;
-            ancestors.clear();
-          }
-          std::vector<u32> tmpVec(_sourceRouter);
-          if (idx < _sourceRouter.at(dim)) {
-            tmpVec.at(dim) = idx;
-          } else {
-            tmpVec.at(dim) = idx + 1;
+            _candidates->clear();
           }
-          u32 ancestorId =
-              Cube::translateRouterAddressToId(&tmpVec, _dimensionWidths);
+          u32 coord = idx < _sourceRouter.at(dim) ? idx : idx + 1;
           // we don't need to perform check here, because congestion is
           // for port,vc pair, and we're interested only in Router ID (port),
           // so we can have many port,vc pair with the same congestion
           // for the same port
-          ancestors.emplace(ancestorId);
+          _candidates->push_back(
+              alignedRouterId(_sourceRouter, 0, _dimensionWidths, dim, coord));
         }
       }
     }
     portBase += ((_dimensionWidths.at(dim) - 1) * _dimensionWeights.at(dim));
   }
 
-  const u32* it = uSetRandElement(ancestors);
-  std::vector<u32> ancestor;
-  Cube::translateRouterIdToAddress(*it, _dimensionWidths, &ancestor);
-
-  for (u32 ind = 0; ind < _sourceRouter.size(); ind++) {
-    _address->at(ind + 1) = ancestor.at(ind);
-  }
-  _address->at(0) = 0;
+  setIntermediateRouter(randCandidateRouter(_candidates), _dimensionWidths,
+                        _address);
 }
 
 void intNodeMinP(Router* _router, u32 _inputPort, u32 _inputVc,
@@ -340,12 +388,12 @@ void intNodeMinP(Router* _router, u32 _inputPort, u32 _inputVc,
                  const std::vector<u32>& _dimensionWidths,
                  const std::vector<u32>& _dimensionWeights, u32 _concentration,
                  u32 _interfacePorts, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
-                 std::vector<u32>* _address) {
+                 std::vector<u32>* _candidates, std::vector<u32>* _address) {
   u32 dim;
   u32 portBase = _concentration;
   f64 minCongestion = F64_POS_INF;
 
-  std::unordered_set<u32> ancestors;
+  _candidates->clear();
   u32 dimensions = _dimensionWidths.size();
   _address->resize(1 + dimensions);
   const f64 tolerance = 1e-6;
@@ -355,56 +403,48 @@ void intNodeMinP(Router* _router, u32 _inputPort, u32 _inputVc,
     for (u32 idx = 0; idx < _dimensionWidths.at(dim) - 1; idx++) {
       for (u32 weight = 0; weight < _dimensionWeights.at(dim); weight++) {
         u32 port = portBase + idx + weight;
-        f64 congestion = getAveragePortCongestion(
-            _router, _inputPort, _inputVc, port, {_vcSet}, _numVcSets, _numVcs);
+        f64 congestion =
+            getAveragePortCongestion(_router, _inputPort, _inputVc, port,
+                                     &_vcSet, 1, _numVcSets, _numVcs);
         if (congestion > (minCongestion + tolerance)) {
           continue;
         } else if (congestion < (minCongestion - tolerance)) {
           minCongestion = congestion;
-          ancestors.clear();
-        }
-        for (u32 vc = _vcSet; vc < _numVcs; vc += _numVcSets) {
-          std::vector<u32> tmpVec(_sourceRouter);
-          if (idx < _sourceRouter.at(dim)) {
-            tmpVec.at(dim) = idx;
-          } else {
-            tmpVec.at(dim) = idx + 1;
-          }
-          u32 ancestorId =
-              Cube::translateRouterAddressToId(&tmpVec, _dimensionWidths);
-          // we don't need to perform check here, because congestion is
-          // for port,vc pair, and we're interested only in Router ID (port),
-          // so we can have many port,vc pair with the same congestion
-          // for the same port
-          ancestors.emplace(ancestorId);
+          _candidates->clear();
         }
+        // the router is the same for all VCs of the port
+        u32 coord = idx < _sourceRouter.at(dim) ? idx : idx + 1;
+        _candidates->push_back(
+            alignedRouterId(_sourceRouter, 0, _dimensionWidths, dim, coord));
       }
     }
     portBase += ((_dimensionWidths.at(dim) - 1) * _dimensionWeights.at(dim));
   }
 
-  const u32* it = uSetRandElement(ancestors);
-  std::vector<u32> ancestor;
-  Cube::translateRouterIdToAddress(*it, _dimensionWidths, &ancestor);
-
-  for (u32 ind = 0; ind < _sourceRouter.size(); ind++) {
-    _address->at(ind + 1) = ancestor.at(ind);
-  }
-  _address->at(0) = 0;
+  setIntermediateRouter(randCandidateRouter(_candidates), _dimensionWidths,
+                        _address);
 }
 
 /*******************MAX_OUTPUTS HANDLING FOR ROUTING ALGORITHMS***************/
-void makeOutputVcSet(
-    std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool, u32 _maxOutputs,
-    OutputAlg _outputAlg,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputPorts) {
+const CandidateVector::Candidate* randCandidate(const CandidateVector& _pool) {
+  u64 randInd = gSim->rnd.nextU64(0, _pool.size() - 1);
+  return _pool.begin() + randInd;
+}
+
+const CandidateVector::Candidate* minCongCandidate(
+    const CandidateVector& _pool) {
+  return std::min_element(_pool.begin(), _pool.end(),
+                          tupleComp2<u32, u32, f64>);
+}
+
+void makeOutputVcSet(CandidateVector* _vcPool, u32 _maxOutputs,
+                     OutputAlg _outputAlg, CandidateVector* _outputPorts) {
   _outputPorts->clear();
 
   if (_vcPool->size() != 0) {
     if (_maxOutputs == 0 /*infinite*/) {
       for (auto& it : *_vcPool) {
-        bool res = _outputPorts->emplace(it).second;
-        assert(res);
+        _outputPorts->add(it);
       }
     } else {
       for (u32 i = 0; i < _maxOutputs; ++i) {
@@ -413,27 +453,25 @@ void makeOutputVcSet(
         } else {
           const std::tuple<u32, u32, f64>* it;
           if (_outputAlg == OutputAlg::Rand) {
-            it = uSetRandElement(*_vcPool);
+            it = randCandidate(*_vcPool);
           } else if (_outputAlg == OutputAlg::Min) {
-            it = uSetMinCong(*_vcPool);
+            it = minCongCandidate(*_vcPool);
           } else {
             fprintf(stderr, "Unknown output algorithm\n");
             assert(false);
           }
-          bool res = _outputPorts->emplace(*it).second;
-          assert(res);
-          _vcPool->erase(*it);
+          _outputPorts->add(*it);
+          _vcPool->erase(it);
         }
       }
     }
   }
 }
 
-void makeOutputPortSet(
-    std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool,
-    const std::vector<u32>& _vcSets, u32 _numVcSets, u32 _numVcs,
-    u32 _maxOutputs, OutputAlg _outputAlg,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputPorts) {
+void makeOutputPortSet(CandidateVector* _vcPool,
+                       const u32* _vcSets, u32 _vcSetsCount, u32 _numVcSets,
+                       u32 _numVcs, u32 _maxOutputs, OutputAlg _outputAlg,
+                       CandidateVector* _outputPorts) {
   _outputPorts->clear();
 
   if (_vcPool->size() != 0) {
@@ -441,11 +479,12 @@ void makeOutputPortSet(
       for (auto& it : *_vcPool) {
         u32 port = std::get<0>(it);
         f64 congestion = std::get<2>(it);
-        for (u32 vcSet : _vcSets) {  // loop through all vcSets
+        // loop through all vcSets
+        for (u32 set = 0; set < _vcSetsCount; set++) {
+          u32 vcSet = _vcSets[set];
           for (u32 vc = vcSet; vc < _numVcs; vc += _numVcSets) {
             std::tuple<u32, u32, f64> t(port, vc, congestion);
-            bool res = _outputPorts->emplace(t).second;
-            assert(res);
+            _outputPorts->add(t);
           }
         }
       }
@@ -456,23 +495,24 @@ void makeOutputPortSet(
         } else {
           const std::tuple<u32, u32, f64>* it;
           if (_outputAlg == OutputAlg::Rand) {
-            it = uSetRandElement(*_vcPool);
+            it = randCandidate(*_vcPool);
           } else if (_outputAlg == OutputAlg::Min) {
-            it = uSetMinCong(*_vcPool);
+            it = minCongCandidate(*_vcPool);
           } else {
             fprintf(stderr, "Unknown output algorithm\n");
             assert(false);
           }
           u32 port = std::get<0>(*it);
           f64 congestion = std::get<2>(*it);
-          for (u32 vcSet : _vcSets) {  // loop through all vcSets
+          // loop through all vcSets
+          for (u32 set = 0; set < _vcSetsCount; set++) {
+            u32 vcSet = _vcSets[set];
             for (u32 vc = vcSet; vc < _numVcs; vc += _numVcSets) {
               std::tuple<u32, u32, f64> t(port, vc, congestion);
-              bool res = _outputPorts->emplace(t).second;
-              assert(res);
+              _outputPorts->add(t);
             }
           }
-          _vcPool->erase(*it);
+          _vcPool->erase(it);
         }
       }
     }
@@ -480,11 +520,13 @@ void makeOutputPortSet(
 }
 
 f64 getAveragePortCongestion(Router* _router, u32 _inputPort, u32 _inputVc,
-                             u32 _outputPort, const std::vector<u32>& _vcSets,
-                             u32 _numVcSets, u32 _numVcs) {
+                             u32 _outputPort, const u32* _vcSets,
+                             u32 _vcSetsCount, u32 _numVcSets, u32 _numVcs) {
   u32 _numVcsInSet = 0;
   f64 congestion = 0;
-  for (u32 vcSet : _vcSets) {  // loop through vcSets (vector at 1st hop)
+  // loop through vcSets (vector at 1st hop)
+  for (u32 set = 0; set < _vcSetsCount; set++) {
+    u32 vcSet = _vcSets[set];
     for (u32 outputVc = vcSet; outputVc < _numVcs; outputVc += _numVcSets) {
       congestion += _router->congestionStatus(_inputPort, _inputVc, _outputPort,
                                               outputVc);
@@ -496,14 +538,15 @@ f64 getAveragePortCongestion(Router* _router, u32 _inputPort, u32 _inputVc,
 
 /*******************DIMENSION ORDERED ROUTING ALGORITHM***********************/
 
-void dimOrderVcRoutingOutput(
-    Router* _router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
-    const std::vector<u32>& _vcSets, u32 _numVcSets, u32 _numVcs,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool) {
-  assert(_vcSets.size() > 0);
+void dimOrderVcRoutingOutput(Router* _router, u32 _inputPort, u32 _inputVc,
+                             const std::vector<u32>& _dimensionWidths,
+                             const std::vector<u32>& _dimensionWeights,
+                             u32 _concentration, u32 _interfacePorts,
+                             const std::vector<u32>* _destinationAddress,
+                             const u32* _vcSets, u32 _vcSetsCount,
+                             u32 _numVcSets, u32 _numVcs,
+                             CandidateVector* _vcPool) {
+  assert(_vcSetsCount > 0);
   _vcPool->clear();
 
   // ex: [x,y,z] for router, [c,x,y,z] for destination
@@ -531,7 +574,9 @@ void dimOrderVcRoutingOutput(
     for (u32 weight = 0; weight < _dimensionWeights.at(dim); weight++) {
       u32 port = computeOutputPort(portBase, offset, _dimensionWeights.at(dim),
                                    weight);
-      for (u32 vcSet : _vcSets) {  // loop through vcSets (vector at 1st hop)
+      // loop through vcSets (vector at 1st hop)
+      for (u32 set = 0; set < _vcSetsCount; set++) {
+        u32 vcSet = _vcSets[set];
         for (u32 vc = vcSet; vc < _numVcs; vc += _numVcSets) {
           // The code below returns congestion status
           // This information is not needed for DOR routing, which is completely
@@ -540,8 +585,7 @@ void dimOrderVcRoutingOutput(
           f64 congestion =
               _router->congestionStatus(_inputPort, _inputVc, port, vc);
           std::tuple<u32, u32, f64> t(port, vc, congestion);
-          bool res = _vcPool->emplace(t).second;
-          assert(res);
+          _vcPool->add(t);
         }
       }
     }
@@ -550,13 +594,14 @@ void dimOrderVcRoutingOutput(
   }
 }
 
-void dimOrderPortRoutingOutput(
-    Router* _router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
-    const std::vector<u32>& _vcSets, u32 _numVcSets, u32 _numVcs,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool) {
+void dimOrderPortRoutingOutput(Router* _router, u32 _inputPort, u32 _inputVc,
+                               const std::vector<u32>& _dimensionWidths,
+                               const std::vector<u32>& _dimensionWeights,
+                               u32 _concentration, u32 _interfacePorts,
+                               const std::vector<u32>* _destinationAddress,
+                               const u32* _vcSets, u32 _vcSetsCount,
+                               u32 _numVcSets, u32 _numVcs,
+                               CandidateVector* _vcPool) {
   _vcPool->clear();
 
   // ex: [x,y,z] for router, [c,x,y,z] for destination
@@ -588,11 +633,11 @@ void dimOrderPortRoutingOutput(
       // oblivious, it might be helpful for another routing algorithms that
       // use DOR as base routing in adaptive phases
       f64 congestion = getAveragePortCongestion(
-          _router, _inputPort, _inputVc, port, _vcSets, _numVcSets, _numVcs);
+          _router, _inputPort, _inputVc, port, _vcSets, _vcSetsCount,
+          _numVcSets, _numVcs);
 
       std::tuple<u32, u32, f64> t(port, 0, congestion);
-      bool res = _vcPool->emplace(t).second;
-      assert(res);
+      _vcPool->add(t);
     }
     // must have at least one route if not at destination
     assert(_vcPool->size() > 0);
@@ -601,13 +646,14 @@ void dimOrderPortRoutingOutput(
 
 /*******************RANDOM MINIMAL ROUTING ALGORITHMS ************************/
 
-void randMinVcRoutingOutput(
-    Router* _router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
-    const std::vector<u32>& _vcSets, u32 _numVcSets, u32 _numVcs,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool) {
+void randMinVcRoutingOutput(Router* _router, u32 _inputPort, u32 _inputVc,
+                            const std::vector<u32>& _dimensionWidths,
+                            const std::vector<u32>& _dimensionWeights,
+                            u32 _concentration, u32 _interfacePorts,
+                            const std::vector<u32>* _destinationAddress,
+                            const u32* _vcSets, u32 _vcSetsCount,
+                            u32 _numVcSets, u32 _numVcs,
+                            CandidateVector* _vcPool) {
   _vcPool->clear();
 
   // ex: [x,y,z] for router, [c,x,y,z] for destination
@@ -627,13 +673,13 @@ void randMinVcRoutingOutput(
       for (u32 weight = 0; weight < _dimensionWeights.at(dim); weight++) {
         u32 port = computeOutputPort(portBase, offset,
                                      _dimensionWeights.at(dim), weight);
-        for (u32 vcSet : _vcSets) {
+        for (u32 set = 0; set < _vcSetsCount; set++) {
+          u32 vcSet = _vcSets[set];
           for (u32 vc = vcSet; vc < _numVcs; vc += _numVcSets) {
             f64 congestion =
                 _router->congestionStatus(_inputPort, _inputVc, port, vc);
             std::tuple<u32, u32, f64> t(port, vc, congestion);
-            bool res = _vcPool->emplace(t).second;
-            assert(res);
+            _vcPool->add(t);
           }
         }
       }
@@ -642,13 +688,14 @@ void randMinVcRoutingOutput(
   }
 }
 
-void randMinPortRoutingOutput(
-    Router* _router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
-    const std::vector<u32>& _vcSets, u32 _numVcSets, u32 _numVcs,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool) {
+void randMinPortRoutingOutput(Router* _router, u32 _inputPort, u32 _inputVc,
+                              const std::vector<u32>& _dimensionWidths,
+                              const std::vector<u32>& _dimensionWeights,
+                              u32 _concentration, u32 _interfacePorts,
+                              const std::vector<u32>* _destinationAddress,
+                              const u32* _vcSets, u32 _vcSetsCount,
+                              u32 _numVcSets, u32 _numVcs,
+                              CandidateVector* _vcPool) {
   _vcPool->clear();
 
   // ex: [x,y,z] for router, [c,x,y,z] for destination
@@ -670,10 +717,10 @@ void randMinPortRoutingOutput(
         u32 port = computeOutputPort(portBase, offset,
                                      _dimensionWeights.at(dim), weight);
         f64 congestion = getAveragePortCongestion(
-            _router, _inputPort, _inputVc, port, _vcSets, _numVcSets, _numVcs);
+            _router, _inputPort, _inputVc, port, _vcSets, _vcSetsCount,
+            _numVcSets, _numVcs);
         std::tuple<u32, u32, f64> t(port, 0, congestion);
-        bool res = _vcPool->emplace(t).second;
-        assert(res);
+        _vcPool->add(t);
       }
     }
     portBase += ((_dimensionWidths.at(dim) - 1) * _dimensionWeights.at(dim));
@@ -682,13 +729,14 @@ void randMinPortRoutingOutput(
 
 /*******************ADAPTIVE MINIMAL ROUTING ALGORITHMS **********************/
 
-void adaptiveMinVcRoutingOutput(
-    Router* _router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
-    const std::vector<u32>& _vcSets, u32 _numVcSets, u32 _numVcs,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool) {
+void adaptiveMinVcRoutingOutput(Router* _router, u32 _inputPort, u32 _inputVc,
+                                const std::vector<u32>& _dimensionWidths,
+                                const std::vector<u32>& _dimensionWeights,
+                                u32 _concentration, u32 _interfacePorts,
+                                const std::vector<u32>* _destinationAddress,
+                                const u32* _vcSets, u32 _vcSetsCount,
+                                u32 _numVcSets, u32 _numVcs,
+                                CandidateVector* _vcPool) {
   _vcPool->clear();
 
   // ex: [x,y,z] for router, [c,x,y,z] for destination
@@ -711,7 +759,8 @@ void adaptiveMinVcRoutingOutput(
       for (u32 weight = 0; weight < _dimensionWeights.at(dim); weight++) {
         u32 port = computeOutputPort(portBase, offset,
                                      _dimensionWeights.at(dim), weight);
-        for (u32 vcSet : _vcSets) {
+        for (u32 set = 0; set < _vcSetsCount; set++) {
+          u32 vcSet = _vcSets[set];
           for (u32 vc = vcSet; vc < _numVcs; vc += _numVcSets) {
             f64 congestion =
                 _router->congestionStatus(_inputPort, _inputVc, port, vc);
@@ -722,8 +771,7 @@ void adaptiveMinVcRoutingOutput(
               _vcPool->clear();
             }
             std::tuple<u32, u32, f64> t(port, vc, congestion);
-            bool res = _vcPool->emplace(t).second;
-            assert(res);
+            _vcPool->add(t);
           }
         }
       }
@@ -732,13 +780,14 @@ void adaptiveMinVcRoutingOutput(
   }
 }
 
-void adaptiveMinPortRoutingOutput(
-    Router* _router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
-    const std::vector<u32>& _vcSets, u32 _numVcSets, u32 _numVcs,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool) {
+void adaptiveMinPortRoutingOutput(Router* _router, u32 _inputPort, u32 _inputVc,
+                                  const std::vector<u32>& _dimensionWidths,
+                                  const std::vector<u32>& _dimensionWeights,
+                                  u32 _concentration, u32 _interfacePorts,
+                                  const std::vector<u32>* _destinationAddress,
+                                  const u32* _vcSets, u32 _vcSetsCount,
+                                  u32 _numVcSets, u32 _numVcs,
+                                  CandidateVector* _vcPool) {
   _vcPool->clear();
 
   // ex: [x,y,z] for router, [c,x,y,z] for destination
@@ -762,7 +811,8 @@ void adaptiveMinPortRoutingOutput(
         u32 port = computeOutputPort(portBase, offset,
                                      _dimensionWeights.at(dim), weight);
         f64 congestion = getAveragePortCongestion(
-            _router, _inputPort, _inputVc, port, _vcSets, _numVcSets, _numVcs);
+            _router, _inputPort, _inputVc, port, _vcSets, _vcSetsCount,
+            _numVcSets, _numVcs);
         if (congestion > minCongestion) {
           continue;
         } else if (congestion < minCongestion) {
@@ -770,8 +820,7 @@ void adaptiveMinPortRoutingOutput(
           _vcPool->clear();
         }
         std::tuple<u32, u32, f64> t(port, 0, congestion);
-        bool res = _vcPool->emplace(t).second;
-        assert(res);
+        _vcPool->add(t);
       }
     }
     portBase += ((_dimensionWidths.at(dim) - 1) * _dimensionWeights.at(dim));
@@ -780,14 +829,16 @@ void adaptiveMinPortRoutingOutput(
 
 /*******************VALIANTS ROUTING ALGORITHMS *******************************/
 
-void valiantsRoutingOutput(
-    Router* _router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
-    u32 _vcSet, u32 _numVcSets, u32 _numVcs, bool _shortCut,
-    IntNodeAlg _intNodeAlg, BaseRoutingAlg _routingAlg, Flit* _flit,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool) {
+void valiantsRoutingOutput(Router* _router, u32 _inputPort, u32 _inputVc,
+                           const std::vector<u32>& _dimensionWidths,
+                           const std::vector<u32>& _dimensionWeights,
+                           u32 _concentration, u32 _interfacePorts,
+                           const std::vector<u32>* _destinationAddress,
+                           u32 _vcSet, u32 _numVcSets, u32 _numVcs,
+                           bool _shortCut, IntNodeAlg _intNodeAlg,
+                           BaseRoutingAlg _routingAlg, Flit* _flit,
+                           std::vector<u32>* _intNodeCandidates,
+                           CandidateVector* _vcPool) {
   _vcPool->clear();
 
   Packet* packet = _flit->packet();
@@ -799,9 +850,7 @@ void valiantsRoutingOutput(
   if (_shortCut) {
     // If source == destination, don't pick intermediate address
     if (isDestinationRouter(_router, _destinationAddress)) {
-      delete reinterpret_cast<const std::vector<u32>*>(
-          packet->getRoutingExtension());
-      packet->setRoutingExtension(nullptr);
+      releaseRoutingExtension(packet);
       return;
     }
   }
@@ -814,7 +863,8 @@ void valiantsRoutingOutput(
     // create routing extension header
     //  the extension is a vector with one dummy element then the address of the
     //  intermediate router
-    std::vector<u32>* intAddr = new std::vector<u32>(1 + routerAddress.size());
+    std::vector<u32>* intAddr =
+        createRoutingExtension(1 + routerAddress.size(), 0);
 
     IntNodeAlgFunc intNodeAlgFunc;
     switch (_intNodeAlg) {
@@ -846,7 +896,7 @@ void valiantsRoutingOutput(
     intNodeAlgFunc(_router, _inputPort, _inputVc, routerAddress,
                    _destinationAddress, _dimensionWidths, _dimensionWeights,
                    _concentration, _interfacePorts, _vcSet, _numVcSets, _numVcs,
-                   intAddr);
+                   _intNodeCandidates, intAddr);
 
     intAddr->at(0) = U32_MAX;  // dummy
 
@@ -899,13 +949,12 @@ void valiantsRoutingOutput(
     u32 vcSet = _vcSet;
     routingAlgFunc(_router, _inputPort, _inputVc, _dimensionWidths,
                    _dimensionWeights, _concentration, _interfacePorts,
-                   intermediateAddress, {_vcSet}, _numVcSets, _numVcs, _vcPool);
+                   intermediateAddress, &_vcSet, 1, _numVcSets, _numVcs,
+                   _vcPool);
 
     // at destination (Int)
     if (_vcPool->empty()) {
-      delete reinterpret_cast<const std::vector<u32>*>(
-          packet->getRoutingExtension());
-      packet->setRoutingExtension(nullptr);
+      releaseRoutingExtension(packet);
       stage = 1;
       if ((_routingAlg == BaseRoutingAlg::DORP) ||
           (_routingAlg == BaseRoutingAlg::DORV)) {
@@ -916,7 +965,7 @@ void valiantsRoutingOutput(
       }
       routingAlgFunc(_router, _inputPort, _inputVc, _dimensionWidths,
                      _dimensionWeights, _concentration, _interfacePorts,
-                     _destinationAddress, {vcSet}, _numVcSets, _numVcs,
+                     _destinationAddress, &vcSet, 1, _numVcSets, _numVcs,
                      _vcPool);
       return;
     }
@@ -929,20 +978,23 @@ void valiantsRoutingOutput(
     }
     routingAlgFunc(_router, _inputPort, _inputVc, _dimensionWidths,
                    _dimensionWeights, _concentration, _interfacePorts,
-                   _destinationAddress, {_vcSet}, _numVcSets, _numVcs, _vcPool);
+                   _destinationAddress, &_vcSet, 1, _numVcSets, _numVcs,
+                   _vcPool);
   }
 }
 
-void ugalRoutingOutput(
-    Router* _router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
-    bool _shortCut, bool _minAllVcSets, IntNodeAlg _intNodeAlg,
-    BaseRoutingAlg _routingAlg, NonMinRoutingAlg _nonMinimalAlg, Flit* _flit,
-    f64* _weightReg, f64* _weightVal,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _vcPoolReg,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _vcPoolVal) {
+void ugalRoutingOutput(Router* _router, u32 _inputPort, u32 _inputVc,
+                       const std::vector<u32>& _dimensionWidths,
+                       const std::vector<u32>& _dimensionWeights,
+                       u32 _concentration, u32 _interfacePorts, u32 _vcSet,
+                       u32 _numVcSets, u32 _numVcs, bool _shortCut,
+                       bool _minAllVcSets, IntNodeAlg _intNodeAlg,
+                       BaseRoutingAlg _routingAlg,
+                       NonMinRoutingAlg _nonMinimalAlg, Flit* _flit,
+                       std::vector<u32>* _intNodeCandidates, f64* _weightReg,
+                       f64* _weightVal,
+                       CandidateVector* _vcPoolReg,
+                       CandidateVector* _vcPoolVal) {
   _vcPoolReg->clear();
   _vcPoolVal->clear();
 
@@ -1007,46 +1059,51 @@ void ugalRoutingOutput(
     valiantsRoutingOutput(_router, _inputPort, _inputVc, _dimensionWidths,
                           _dimensionWeights, _concentration, _interfacePorts,
                           destAddress, vcSet, _numVcSets, _numVcs, _shortCut,
-                          _intNodeAlg, _routingAlg, _flit, _vcPoolVal);
+                          _intNodeAlg, _routingAlg, _flit, _intNodeCandidates,
+                          _vcPoolVal);
   }
 
   if (packet->getHopCount() == 0) {
     // minimal routes only
     // note: vcSet is baseVc on hop count 1
-    std::vector<u32> vcSets;
+    u32 vcSets[2];
+    u32 vcSetsCount;
     if (!_minAllVcSets) {  // dont use all VCsets
-      vcSets.push_back(_vcSet);
+      vcSets[0] = _vcSet;
+      vcSetsCount = 1;
     } else {  // enable all vc sets for initial hop
       if ((_routingAlg == BaseRoutingAlg::DORV) ||
           (_routingAlg == BaseRoutingAlg::DORP)) {
         // DOR 2 vcSets (0 and 1)
-        vcSets.push_back(_vcSet + 0);
-        vcSets.push_back(_vcSet + 1);
+        vcSets[0] = _vcSet + 0;
+        vcSets[1] = _vcSet + 1;
       } else if ((_intNodeAlg == IntNodeAlg::REG) ||
                  (_intNodeAlg == IntNodeAlg::UNALIGNED)) {
         // distance class vcSets 0 and Dim
-        vcSets.push_back(_vcSet + 0);
-        vcSets.push_back(_vcSet + _dimensionWidths.size());
+        vcSets[0] = _vcSet + 0;
+        vcSets[1] = _vcSet + _dimensionWidths.size();
       } else {
         // 2 VcSets (0 and 1)
-        vcSets.push_back(_vcSet + 0);
-        vcSets.push_back(_vcSet + 1);
+        vcSets[0] = _vcSet + 0;
+        vcSets[1] = _vcSet + 1;
       }
+      vcSetsCount = 2;
     }
     routingAlgFunc(_router, _inputPort, _inputVc, _dimensionWidths,
                    _dimensionWeights, _concentration, _interfacePorts,
-                   destAddress, vcSets, _numVcSets, _numVcs, _vcPoolReg);
+                   destAddress, vcSets, vcSetsCount, _numVcSets, _numVcs,
+                   _vcPoolReg);
   }
 }
 
 /*******************LEAST CONGESTED QUEUE ROUTING ALGORITHMS *****************/
-void lcqVcRoutingOutput(
-    Router* _router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
-    u32 _vcSet, u32 _numVcSets, u32 _numVcs, bool _shortCut,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool) {
+void lcqVcRoutingOutput(Router* _router, u32 _inputPort, u32 _inputVc,
+                        const std::vector<u32>& _dimensionWidths,
+                        const std::vector<u32>& _dimensionWeights,
+                        u32 _concentration, u32 _interfacePorts,
+                        const std::vector<u32>* _destinationAddress, u32 _vcSet,
+                        u32 _numVcSets, u32 _numVcs, bool _shortCut,
+                        CandidateVector* _vcPool) {
   _vcPool->clear();
 
   u32 dim;
@@ -1075,8 +1132,7 @@ void lcqVcRoutingOutput(
             _vcPool->clear();
           }
           std::tuple<u32, u32, f64> t(port, vc, congestion);
-          bool res = _vcPool->emplace(t).second;
-          assert(res);
+          _vcPool->add(t);
         }
       }
     }
@@ -1084,13 +1140,13 @@ void lcqVcRoutingOutput(
   }
 }
 
-void lcqPortRoutingOutput(
-    Router* _router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
-    u32 _vcSet, u32 _numVcSets, u32 _numVcs, bool _shortCut,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool) {
+void lcqPortRoutingOutput(Router* _router, u32 _inputPort, u32 _inputVc,
+                          const std::vector<u32>& _dimensionWidths,
+                          const std::vector<u32>& _dimensionWeights,
+                          u32 _concentration, u32 _interfacePorts,
+                          const std::vector<u32>* _destinationAddress,
+                          u32 _vcSet, u32 _numVcSets, u32 _numVcs,
+                          bool _shortCut, CandidateVector* _vcPool) {
   _vcPool->clear();
 
   u32 dim;
@@ -1109,8 +1165,9 @@ void lcqPortRoutingOutput(
     for (u32 idx = 0; idx < _dimensionWidths.at(dim) - 1; idx++) {
       for (u32 weight = 0; weight < _dimensionWeights.at(dim); weight++) {
         u32 port = portBase + (idx * _dimensionWeights.at(dim)) + weight;
-        f64 congestion = getAveragePortCongestion(
-            _router, _inputPort, _inputVc, port, {_vcSet}, _numVcSets, _numVcs);
+        f64 congestion =
+            getAveragePortCongestion(_router, _inputPort, _inputVc, port,
+                                     &_vcSet, 1, _numVcSets, _numVcs);
         if (congestion > minCongestion) {
           continue;
         } else if (congestion < minCongestion) {
@@ -1118,8 +1175,7 @@ void lcqPortRoutingOutput(
           _vcPool->clear();
         }
         std::tuple<u32, u32, f64> t(port, 0, congestion);
-        bool res = _vcPool->emplace(t).second;
-        assert(res);
+        _vcPool->add(t);
       }
     }
     portBase += ((_dimensionWidths.at(dim) - 1) * _dimensionWeights.at(dim));
@@ -1127,14 +1183,14 @@ void lcqPortRoutingOutput(
 }
 
 /********************DAL ROUTING ALGORITHMS **********************************/
-void doalPortRoutingOutput(
-    Router* _router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
-    u32 _baseVc, u32 _vcSet, u32 _numVcSets, u32 _numVcs, Flit* _flit,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsMin,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsNonMin) {
+void doalPortRoutingOutput(Router* _router, u32 _inputPort, u32 _inputVc,
+                           const std::vector<u32>& _dimensionWidths,
+                           const std::vector<u32>& _dimensionWeights,
+                           u32 _concentration, u32 _interfacePorts,
+                           const std::vector<u32>* _destinationAddress,
+                           u32 _baseVc, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
+                           Flit* _flit, CandidateVector* _outputVcsMin,
+                           CandidateVector* _outputVcsNonMin) {
   _outputVcsMin->clear();
   _outputVcsNonMin->clear();
 
@@ -1172,33 +1228,31 @@ void doalPortRoutingOutput(
             // we can do that if we didn't deroute previously
             f64 congestion =
                 getAveragePortCongestion(_router, _inputPort, _inputVc, outPort,
-                                         {_vcSet}, _numVcSets, _numVcs);
+                                         &_vcSet, 1, _numVcSets, _numVcs);
             std::tuple<u32, u32, f64> t(outPort, 0, congestion);
-            bool res = _outputVcsNonMin->emplace(t).second;
-            assert(res);
+            _outputVcsNonMin->add(t);
           }
         } else {
           // minimal routes with VCset == 0
           f64 congestion =
               getAveragePortCongestion(_router, _inputPort, _inputVc, outPort,
-                                       {_vcSet}, _numVcSets, _numVcs);
+                                       &_vcSet, 1, _numVcSets, _numVcs);
           std::tuple<u32, u32, f64> t(outPort, 0, congestion);
-          bool res = _outputVcsMin->emplace(t).second;
-          assert(res);
+          _outputVcsMin->add(t);
         }
       }
     }
   }
 }
 
-void doalVcRoutingOutput(
-    Router* _router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
-    u32 _baseVc, u32 _vcSet, u32 _numVcSets, u32 _numVcs, Flit* _flit,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsMin,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsNonMin) {
+void doalVcRoutingOutput(Router* _router, u32 _inputPort, u32 _inputVc,
+                         const std::vector<u32>& _dimensionWidths,
+                         const std::vector<u32>& _dimensionWeights,
+                         u32 _concentration, u32 _interfacePorts,
+                         const std::vector<u32>* _destinationAddress,
+                         u32 _baseVc, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
+                         Flit* _flit, CandidateVector* _outputVcsMin,
+                         CandidateVector* _outputVcsNonMin) {
   _outputVcsMin->clear();
   _outputVcsNonMin->clear();
 
@@ -1238,16 +1292,14 @@ void doalVcRoutingOutput(
               f64 congestion =
                   _router->congestionStatus(_inputPort, _inputVc, outPort, vc);
               std::tuple<u32, u32, f64> t(outPort, vc, congestion);
-              bool res = _outputVcsNonMin->emplace(t).second;
-              assert(res);
+              _outputVcsNonMin->add(t);
             }
           } else {
             // minimal routes with VCset == 0
             f64 congestion =
                 _router->congestionStatus(_inputPort, _inputVc, outPort, vc);
             std::tuple<u32, u32, f64> t(outPort, vc, congestion);
-            bool res = _outputVcsMin->emplace(t).second;
-            assert(res);
+            _outputVcsMin->add(t);
           }
         }
       }
@@ -1255,14 +1307,14 @@ void doalVcRoutingOutput(
   }
 }
 
-void ddalPortRoutingOutput(
-    Router* _router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
-    u32 _vcSet, u32 _numVcSets, u32 _numVcs, Flit* _flit,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsMin,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsNonMin) {
+void ddalPortRoutingOutput(Router* _router, u32 _inputPort, u32 _inputVc,
+                           const std::vector<u32>& _dimensionWidths,
+                           const std::vector<u32>& _dimensionWeights,
+                           u32 _concentration, u32 _interfacePorts,
+                           const std::vector<u32>* _destinationAddress,
+                           u32 _vcSet, u32 _numVcSets, u32 _numVcs, Flit* _flit,
+                           CandidateVector* _outputVcsMin,
+                           CandidateVector* _outputVcsNonMin) {
   _outputVcsMin->clear();
   _outputVcsNonMin->clear();
   Packet* packet = _flit->packet();
@@ -1273,29 +1325,20 @@ void ddalPortRoutingOutput(
 
   if (packet->getHopCount() == 0) {
     assert(packet->getRoutingExtension() == nullptr);
-    std::vector<u32>* re = new std::vector<u32>(_dimensionWidths.size(), 0);
+    std::vector<u32>* re = createRoutingExtension(_dimensionWidths.size(), 0);
     packet->setRoutingExtension(re);
   }
 
-  std::set<u32> dimensions;
-  // determine the next dimension to work on
-  u32 dim;
-  u32 portBase = _concentration;
-  for (dim = 0; dim < routerAddress.size(); dim++) {
-    if (routerAddress.at(dim) != _destinationAddress->at(dim + 1)) {
-      dimensions.emplace(dim);
-    }
-    portBase += ((_dimensionWidths.at(dim) - 1) * _dimensionWeights.at(dim));
-  }
-
   // test if already at destination router
-  if (dimensions.empty()) {
+  if (isDestinationRouter(_router, _destinationAddress)) {
     return;
   }
 
-  portBase = _concentration;
+  // work on all unaligned dimensions
+  u32 dim;
+  u32 portBase = _concentration;
   for (dim = 0; dim < routerAddress.size(); dim++) {
-    if (dimensions.find(dim) != dimensions.end()) {
+    if (routerAddress.at(dim) != _destinationAddress->at(dim + 1)) {
       // more router-to-router hops needed
       u32 src = routerAddress.at(dim);
       u32 dst = _destinationAddress->at(dim + 1);
@@ -1315,27 +1358,24 @@ void ddalPortRoutingOutput(
           if ((offset != srcDstOffset) && (derouted == 0)) {
             f64 congestion =
                 getAveragePortCongestion(_router, _inputPort, _inputVc, outPort,
-                                         {_vcSet}, _numVcSets, _numVcs);
+                                         &_vcSet, 1, _numVcSets, _numVcs);
             std::tuple<u32, u32, f64> t(outPort, 0, congestion);
-            bool res = _outputVcsNonMin->emplace(t).second;
-            assert(res);
+            _outputVcsNonMin->add(t);
           }
           if ((offset == srcDstOffset) && (derouted > 0)) {
             f64 congestion =
                 getAveragePortCongestion(_router, _inputPort, _inputVc, outPort,
-                                         {_vcSet}, _numVcSets, _numVcs);
+                                         &_vcSet, 1, _numVcSets, _numVcs);
             assert(derouted == 1);
             std::tuple<u32, u32, f64> t(outPort, 0, congestion);
-            bool res = _outputVcsMin->emplace(t).second;
-            assert(res);
+            _outputVcsMin->add(t);
           }
           if ((offset == srcDstOffset) && (derouted == 0)) {
             f64 congestion =
                 getAveragePortCongestion(_router, _inputPort, _inputVc, outPort,
-                                         {_vcSet}, _numVcSets, _numVcs);
+                                         &_vcSet, 1, _numVcSets, _numVcs);
             std::tuple<u32, u32, f64> t(outPort, 0, congestion);
-            bool res = _outputVcsMin->emplace(t).second;
-            assert(res);
+            _outputVcsMin->add(t);
           }
         }
       }
@@ -1344,14 +1384,14 @@ void ddalPortRoutingOutput(
   }
 }
 
-void ddalVcRoutingOutput(
-    Router* _router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
-    u32 _vcSet, u32 _numVcSets, u32 _numVcs, Flit* _flit,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsMin,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsNonMin) {
+void ddalVcRoutingOutput(Router* _router, u32 _inputPort, u32 _inputVc,
+                         const std::vector<u32>& _dimensionWidths,
+                         const std::vector<u32>& _dimensionWeights,
+                         u32 _concentration, u32 _interfacePorts,
+                         const std::vector<u32>* _destinationAddress,
+                         u32 _vcSet, u32 _numVcSets, u32 _numVcs, Flit* _flit,
+                         CandidateVector* _outputVcsMin,
+                         CandidateVector* _outputVcsNonMin) {
   _outputVcsMin->clear();
   _outputVcsNonMin->clear();
   Packet* packet = _flit->packet();
@@ -1362,29 +1402,20 @@ void ddalVcRoutingOutput(
 
   if (packet->getHopCount() == 0) {
     assert(packet->getRoutingExtension() == nullptr);
-    std::vector<u32>* re = new std::vector<u32>(_dimensionWidths.size(), 0);
+    std::vector<u32>* re = createRoutingExtension(_dimensionWidths.size(), 0);
     packet->setRoutingExtension(re);
   }
 
-  std::set<u32> dimensions;
-  // determine the next dimension to work on
-  u32 dim;
-  u32 portBase = _concentration;
-  for (dim = 0; dim < routerAddress.size(); dim++) {
-    if (routerAddress.at(dim) != _destinationAddress->at(dim + 1)) {
-      dimensions.emplace(dim);
-    }
-    portBase += ((_dimensionWidths.at(dim) - 1) * _dimensionWeights.at(dim));
-  }
-
   // test if already at destination router
-  if (dimensions.empty()) {
+  if (isDestinationRouter(_router, _destinationAddress)) {
     return;
   }
 
-  portBase = _concentration;
+  // work on all unaligned dimensions
+  u32 dim;
+  u32 portBase = _concentration;
   for (dim = 0; dim < routerAddress.size(); dim++) {
-    if (dimensions.find(dim) != dimensions.end()) {
+    if (routerAddress.at(dim) != _destinationAddress->at(dim + 1)) {
       // more router-to-router hops needed
       u32 src = routerAddress.at(dim);
       u32 dst = _destinationAddress->at(dim + 1);
@@ -1407,16 +1438,14 @@ void ddalVcRoutingOutput(
               f64 congestion =
                   _router->congestionStatus(_inputPort, _inputVc, outPort, vc);
               std::tuple<u32, u32, f64> t(outPort, vc, congestion);
-              bool res = _outputVcsNonMin->emplace(t).second;
-              assert(res);
+              _outputVcsNonMin->add(t);
             }
             if ((offset == srcDstOffset) && (derouted > 0)) {
               assert(derouted == 1);
               f64 congestion =
                   _router->congestionStatus(_inputPort, _inputVc, outPort, vc);
               std::tuple<u32, u32, f64> t(outPort, vc, congestion);
-              bool res = _outputVcsMin->emplace(t).second;
-              assert(res);
+              _outputVcsMin->add(t);
             }
           }
           for (u32 vc = _vcSet + 1; vc < _numVcs; vc += _numVcSets) {
@@ -1424,8 +1453,7 @@ void ddalVcRoutingOutput(
               f64 congestion =
                   _router->congestionStatus(_inputPort, _inputVc, outPort, vc);
               std::tuple<u32, u32, f64> t(outPort, vc, congestion);
-              bool res = _outputVcsMin->emplace(t).second;
-              assert(res);
+              _outputVcsMin->add(t);
             }
           }
         }
@@ -1435,15 +1463,15 @@ void ddalVcRoutingOutput(
   }
 }
 
-void vdalPortRoutingOutput(
-    Router* _router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
-    u32 _baseVc, u32 _vcSet, u32 _numVcSets, u32 _numVcs, Flit* _flit,
-    bool _multiDeroute,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsMin,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsNonMin) {
+void vdalPortRoutingOutput(Router* _router, u32 _inputPort, u32 _inputVc,
+                           const std::vector<u32>& _dimensionWidths,
+                           const std::vector<u32>& _dimensionWeights,
+                           u32 _concentration, u32 _interfacePorts,
+                           const std::vector<u32>* _destinationAddress,
+                           u32 _baseVc, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
+                           Flit* _flit, bool _multiDeroute,
+                           CandidateVector* _outputVcsMin,
+                           CandidateVector* _outputVcsNonMin) {
   _outputVcsMin->clear();
   _outputVcsNonMin->clear();
   Packet* packet = _flit->packet();
@@ -1464,25 +1492,16 @@ void vdalPortRoutingOutput(
 
   bool allowDeroutes = hopsleft < vcSetsLeft;
 
-  std::set<u32> dimensions;
-  // determine the next dimension to work on
-  u32 dim;
-  u32 portBase = _concentration;
-  for (dim = 0; dim < routerAddress.size(); dim++) {
-    if (routerAddress.at(dim) != _destinationAddress->at(dim + 1)) {
-      dimensions.emplace(dim);
-    }
-    portBase += ((_dimensionWidths.at(dim) - 1) * _dimensionWeights.at(dim));
-  }
-
   // test if already at destination router
-  if (dimensions.empty()) {
+  if (isDestinationRouter(_router, _destinationAddress)) {
     return;
   }
 
-  portBase = _concentration;
+  // work on all unaligned dimensions
+  u32 dim;
+  u32 portBase = _concentration;
   for (dim = 0; dim < routerAddress.size(); dim++) {
-    if (dimensions.find(dim) != dimensions.end()) {
+    if (routerAddress.at(dim) != _destinationAddress->at(dim + 1)) {
       // more router-to-router hops needed
       u32 src = routerAddress.at(dim);
       u32 dst = _destinationAddress->at(dim + 1);
@@ -1505,20 +1524,18 @@ void vdalPortRoutingOutput(
             // deroute offset
             if (allowDeroutes) {
               f64 congestion = getAveragePortCongestion(
-                  _router, _inputPort, _inputVc, outPort, {_vcSet}, _numVcSets,
-                  _numVcs);
+                  _router, _inputPort, _inputVc, outPort, &_vcSet, 1,
+                  _numVcSets, _numVcs);
               std::tuple<u32, u32, f64> t(outPort, 0, congestion);
-              bool res = _outputVcsNonMin->emplace(t).second;
-              assert(res);
+              _outputVcsNonMin->add(t);
             }
           } else {
             // minimal offset
             f64 congestion =
                 getAveragePortCongestion(_router, _inputPort, _inputVc, outPort,
-                                         {_vcSet}, _numVcSets, _numVcs);
+                                         &_vcSet, 1, _numVcSets, _numVcs);
             std::tuple<u32, u32, f64> t(outPort, 0, congestion);
-            bool res = _outputVcsMin->emplace(t).second;
-            assert(res);
+            _outputVcsMin->add(t);
           }
         }
       }
@@ -1527,15 +1544,15 @@ void vdalPortRoutingOutput(
   }
 }
 
-void vdalVcRoutingOutput(
-    Router* _router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
-    u32 _baseVc, u32 _vcSet, u32 _numVcSets, u32 _numVcs, Flit* _flit,
-    bool _multiDeroute,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsMin,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsNonMin) {
+void vdalVcRoutingOutput(Router* _router, u32 _inputPort, u32 _inputVc,
+                         const std::vector<u32>& _dimensionWidths,
+                         const std::vector<u32>& _dimensionWeights,
+                         u32 _concentration, u32 _interfacePorts,
+                         const std::vector<u32>* _destinationAddress,
+                         u32 _baseVc, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
+                         Flit* _flit, bool _multiDeroute,
+                         CandidateVector* _outputVcsMin,
+                         CandidateVector* _outputVcsNonMin) {
   _outputVcsMin->clear();
   _outputVcsNonMin->clear();
   Packet* packet = _flit->packet();
@@ -1556,25 +1573,16 @@ void vdalVcRoutingOutput(
 
   bool allowDeroutes = hopsleft < vcSetsLeft;
 
-  std::set<u32> dimensions;
-  // determine the next dimension to work on
-  u32 dim;
-  u32 portBase = _concentration;
-  for (dim = 0; dim < routerAddress.size(); dim++) {
-    if (routerAddress.at(dim) != _destinationAddress->at(dim + 1)) {
-      dimensions.emplace(dim);
-    }
-    portBase += ((_dimensionWidths.at(dim) - 1) * _dimensionWeights.at(dim));
-  }
-
   // test if already at destination router
-  if (dimensions.empty()) {
+  if (isDestinationRouter(_router, _destinationAddress)) {
     return;
   }
 
-  portBase = _concentration;
+  // work on all unaligned dimensions
+  u32 dim;
+  u32 portBase = _concentration;
   for (dim = 0; dim < routerAddress.size(); dim++) {
-    if (dimensions.find(dim) != dimensions.end()) {
+    if (routerAddress.at(dim) != _destinationAddress->at(dim + 1)) {
       // more router-to-router hops needed
       u32 src = routerAddress.at(dim);
       u32 dst = _destinationAddress->at(dim + 1);
@@ -1599,16 +1607,14 @@ void vdalVcRoutingOutput(
                 f64 congestion = _router->congestionStatus(_inputPort, _inputVc,
                                                            outPort, vc);
                 std::tuple<u32, u32, f64> t(outPort, vc, congestion);
-                bool res = _outputVcsNonMin->emplace(t).second;
-                assert(res);
+                _outputVcsNonMin->add(t);
               }
             } else {
               // minimal offset
               f64 congestion =
                   _router->congestionStatus(_inputPort, _inputVc, outPort, vc);
               std::tuple<u32, u32, f64> t(outPort, vc, congestion);
-              bool res = _outputVcsMin->emplace(t).second;
-              assert(res);
+              _outputVcsMin->add(t);
             }
           }
         }
@@ -1620,19 +1626,25 @@ void vdalVcRoutingOutput(
 
 /********************SKIPPING DIMENSIONALLY ORDERED ROUTING ALGORITHMS********/
 
-void skippingDimOrderRoutingOutput(
-    Router* _router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
-    u32 _startingDim, u32 _baseVc, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
-    Flit* _flit, f64 _iBias, f64 _cBias, f64 _step, f64 _threshold,
-    f64 _thresholdMin, f64 _thresholdNonMin, SkippingRoutingAlg _routingAlg,
-    DecisionScheme _decisionScheme, HopCountMode _hopCountMode,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcs1,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcs2,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcs3,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool) {
+void skippingDimOrderRoutingOutput(Router* _router, u32 _inputPort,
+                                   u32 _inputVc,
+                                   const std::vector<u32>& _dimensionWidths,
+                                   const std::vector<u32>& _dimensionWeights,
+                                   u32 _concentration, u32 _interfacePorts,
+                                   const std::vector<u32>* _destinationAddress,
+                                   u32 _startingDim, u32 _baseVc, u32 _vcSet,
+                                   u32 _numVcSets, u32 _numVcs, Flit* _flit,
+                                   f64 _iBias, f64 _cBias, f64 _step,
+                                   f64 _threshold, f64 _thresholdMin,
+                                   f64 _thresholdNonMin,
+                                   SkippingRoutingAlg _routingAlg,
+                                   DecisionScheme _decisionScheme,
+                                   HopCountMode _hopCountMode,
+                                   std::vector<u32>* _fakeDestinationAddress,
+                                   CandidateVector* _outputVcs1,
+                                   CandidateVector* _outputVcs2,
+                                   CandidateVector* _outputVcs3,
+                                   CandidateVector* _vcPool) {
   _outputVcs1->clear();
   _outputVcs2->clear();
   _outputVcs3->clear();
@@ -1643,7 +1655,9 @@ void skippingDimOrderRoutingOutput(
   const std::vector<u32>& routerAddress = _router->address();
   assert(routerAddress.size() == (_destinationAddress->size() - 1));
 
-  std::vector<u32> fakeDestinationAddress(*_destinationAddress);
+  std::vector<u32>& fakeDestinationAddress = *_fakeDestinationAddress;
+  fakeDestinationAddress.assign(_destinationAddress->begin(),
+                                _destinationAddress->end());
   if (_startingDim > 0) {
     for (u32 dim = 1; dim < _startingDim; dim++) {
       fakeDestinationAddress.at(dim) = routerAddress.at(dim - 1);
@@ -1662,13 +1676,13 @@ void skippingDimOrderRoutingOutput(
   if (_routingAlg == SkippingRoutingAlg::DORV) {
     dimOrderVcRoutingOutput(_router, _inputPort, _inputVc, _dimensionWidths,
                             _dimensionWeights, _concentration, _interfacePorts,
-                            &fakeDestinationAddress, {_vcSet}, _numVcSets,
+                            &fakeDestinationAddress, &_vcSet, 1, _numVcSets,
                             _numVcs, _outputVcs1);
   } else if (_routingAlg == SkippingRoutingAlg::DORP) {
     dimOrderPortRoutingOutput(_router, _inputPort, _inputVc, _dimensionWidths,
                               _dimensionWeights, _concentration,
                               _interfacePorts, &fakeDestinationAddress,
-                              {_vcSet}, _numVcSets, _numVcs, _outputVcs1);
+                              &_vcSet, 1, _numVcSets, _numVcs, _outputVcs1);
   } else {
     if (_routingAlg == SkippingRoutingAlg::DOALV) {
       doalVcRoutingOutput(_router, _inputPort, _inputVc, _dimensionWidths,
@@ -1688,17 +1702,17 @@ void skippingDimOrderRoutingOutput(
     if (_decisionScheme == DecisionScheme::MW) {
       monolithicWeighted(*_outputVcs1, *_outputVcs2, hops, hopIncr, _iBias,
                          _cBias, BiasScheme::REGULAR, _vcPool, &nonMin);
-      _vcPool->swap(*_outputVcs1);
+      _vcPool->swap(_outputVcs1);
       _vcPool->clear();
     } else if (_decisionScheme == DecisionScheme::ST) {
       stagedThreshold(*_outputVcs1, *_outputVcs2, _thresholdMin,
                       _thresholdNonMin, _vcPool, &nonMin);
-      _vcPool->swap(*_outputVcs1);
+      _vcPool->swap(_outputVcs1);
       _vcPool->clear();
     } else if (_decisionScheme == DecisionScheme::TW) {
       thresholdWeighted(*_outputVcs1, *_outputVcs2, hops, hopIncr, _threshold,
                         _vcPool, &nonMin);
-      _vcPool->swap(*_outputVcs1);
+      _vcPool->swap(_outputVcs1);
       _vcPool->clear();
     } else {
       fprintf(stderr, "Invalid decision scheme\n");
@@ -1715,12 +1729,12 @@ void skippingDimOrderRoutingOutput(
       dimOrderVcRoutingOutput(_router, _inputPort, _inputVc, _dimensionWidths,
                               _dimensionWeights, _concentration,
                               _interfacePorts, &fakeDestinationAddress,
-                              {_vcSet}, _numVcSets, _numVcs, _outputVcs2);
+                              &_vcSet, 1, _numVcSets, _numVcs, _outputVcs2);
     } else if (_routingAlg == SkippingRoutingAlg::DORP) {
       dimOrderPortRoutingOutput(_router, _inputPort, _inputVc, _dimensionWidths,
                                 _dimensionWeights, _concentration,
                                 _interfacePorts, &fakeDestinationAddress,
-                                {_vcSet}, _numVcSets, _numVcs, _outputVcs2);
+                                &_vcSet, 1, _numVcSets, _numVcs, _outputVcs2);
     } else {
       if (_routingAlg == SkippingRoutingAlg::DOALV) {
         doalVcRoutingOutput(
@@ -1741,16 +1755,16 @@ void skippingDimOrderRoutingOutput(
         monolithicWeighted(*_outputVcs2, *_outputVcs3, hops, hopIncr, _iBias,
                            _cBias, BiasScheme::REGULAR, _vcPool, &nonMin);
         _outputVcs2->clear();
-        _vcPool->swap(*_outputVcs2);
+        _vcPool->swap(_outputVcs2);
       } else if (_decisionScheme == DecisionScheme::ST) {
         stagedThreshold(*_outputVcs2, *_outputVcs3, _thresholdMin,
                         _thresholdNonMin, _vcPool, &nonMin);
         _outputVcs2->clear();
-        _vcPool->swap(*_outputVcs2);
+        _vcPool->swap(_outputVcs2);
       } else if (_decisionScheme == DecisionScheme::TW) {
         thresholdWeighted(*_outputVcs1, *_outputVcs2, hops, hopIncr, _threshold,
                           _vcPool, &nonMin);
-        _vcPool->swap(*_outputVcs1);
+        _vcPool->swap(_outputVcs1);
         _vcPool->clear();
       } else {
         fprintf(stderr, "Invalid decision scheme\n");
@@ -1777,23 +1791,27 @@ void skippingDimOrderRoutingOutput(
       fprintf(stderr, "Invalid decision scheme\n");
       assert(false);
     }
-    _outputVcs1->swap(*_vcPool);
+    _outputVcs1->swap(_vcPool);
   }
-  _vcPool->swap(*_outputVcs1);
+  _vcPool->swap(_outputVcs1);
 }
 
-void finishingDimOrderRoutingOutput(
-    Router* _router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
-    u32 _baseVc, u32 _vcSet, u32 _numVcSets, u32 _numVcs, Flit* _flit,
-    f64 _iBias, f64 _cBias, f64 _threshold, f64 _thresholdMin,
-    f64 _thresholdNonMin, SkippingRoutingAlg _routingAlg,
-    DecisionScheme _decisionScheme, HopCountMode _hopCountMode,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcs1,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcs2,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool) {
+void finishingDimOrderRoutingOutput(Router* _router, u32 _inputPort,
+                                    u32 _inputVc,
+                                    const std::vector<u32>& _dimensionWidths,
+                                    const std::vector<u32>& _dimensionWeights,
+                                    u32 _concentration, u32 _interfacePorts,
+                                    const std::vector<u32>* _destinationAddress,
+                                    u32 _baseVc, u32 _vcSet, u32 _numVcSets,
+                                    u32 _numVcs, Flit* _flit, f64 _iBias,
+                                    f64 _cBias, f64 _threshold,
+                                    f64 _thresholdMin, f64 _thresholdNonMin,
+                                    SkippingRoutingAlg _routingAlg,
+                                    DecisionScheme _decisionScheme,
+                                    HopCountMode _hopCountMode,
+                                    CandidateVector* _outputVcs1,
+                                    CandidateVector* _outputVcs2,
+                                    CandidateVector* _vcPool) {
   _outputVcs1->clear();
   _outputVcs2->clear();
   _vcPool->clear();
@@ -1810,12 +1828,12 @@ void finishingDimOrderRoutingOutput(
   if (_routingAlg == SkippingRoutingAlg::DORV) {
     dimOrderVcRoutingOutput(_router, _inputPort, _inputVc, _dimensionWidths,
                             _dimensionWeights, _concentration, _interfacePorts,
-                            _destinationAddress, {_vcSet}, _numVcSets, _numVcs,
-                            _vcPool);
+                            _destinationAddress, &_vcSet, 1, _numVcSets,
+                            _numVcs, _vcPool);
   } else if (_routingAlg == SkippingRoutingAlg::DORP) {
     dimOrderPortRoutingOutput(_router, _inputPort, _inputVc, _dimensionWidths,
                               _dimensionWeights, _concentration,
-                              _interfacePorts, _destinationAddress, {_vcSet},
+                              _interfacePorts, _destinationAddress, &_vcSet, 1,
                               _numVcSets, _numVcs, _vcPool);
   } else {
     if (_routingAlg == SkippingRoutingAlg::DOALV) {
@@ -1851,11 +1869,11 @@ void finishingDimOrderRoutingOutput(
 
 /********************DECISION SCHEMES ****************************************/
 
-void monolithicWeighted(
-    const std::unordered_set<std::tuple<u32, u32, f64>>& _outputVcsMin,
-    const std::unordered_set<std::tuple<u32, u32, f64>>& _outputVcsNonMin,
-    f64 _hopsLeft, f64 _hopsIncr, f64 _iBias, f64 _cBias, BiasScheme _biasMode,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool, bool* _nonMin) {
+void monolithicWeighted(const CandidateVector& _outputVcsMin,
+                        const CandidateVector& _outputVcsNonMin, f64 _hopsLeft,
+                        f64 _hopsIncr, f64 _iBias, f64 _cBias,
+                        BiasScheme _biasMode, CandidateVector* _vcPool,
+                        bool* _nonMin) {
   _vcPool->clear();
 
   f64 weightMin = F64_MAX;
@@ -1870,10 +1888,10 @@ void monolithicWeighted(
     if (delta > TOLERANCE) {  // replace
       weightMin = weight;
       _vcPool->clear();
-      _vcPool->emplace(it);
+      _vcPool->add(it);
 
     } else if (absDelta < TOLERANCE) {  // same (add)
-      _vcPool->emplace(it);
+      _vcPool->add(it);
     }
   }
 
@@ -1911,19 +1929,18 @@ void monolithicWeighted(
       *_nonMin = true;
       weightMin = weight;
       _vcPool->clear();
-      _vcPool->emplace(it);
+      _vcPool->add(it);
     } else if ((absDelta < TOLERANCE) && (*_nonMin)) {  // same (add)
-      _vcPool->emplace(it);
+      _vcPool->add(it);
       *_nonMin = true;
     }
   }
 }
 
-void stagedThreshold(
-    const std::unordered_set<std::tuple<u32, u32, f64>>& _outputVcsMin,
-    const std::unordered_set<std::tuple<u32, u32, f64>>& _outputVcsNonMin,
-    f64 _thresholdMin, f64 _thresholdNonMin,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool, bool* _nonMin) {
+void stagedThreshold(const CandidateVector& _outputVcsMin,
+                     const CandidateVector& _outputVcsNonMin, f64 _thresholdMin,
+                     f64 _thresholdNonMin, CandidateVector* _vcPool,
+                     bool* _nonMin) {
   _vcPool->clear();
   *_nonMin = false;
 
@@ -1932,7 +1949,7 @@ void stagedThreshold(
     f64 congestion = std::get<2>(it);
     if (congestion < (_thresholdMin + 1e-6)) {
       // min < TH
-      _vcPool->emplace(it);
+      _vcPool->add(it);
     }
   }
   if (_vcPool->empty() && !_outputVcsNonMin.empty()) {
@@ -1940,7 +1957,7 @@ void stagedThreshold(
       f64 congestion = std::get<2>(it);
       if (congestion < (_thresholdNonMin + 1e-6)) {
         // non-minimal < TH
-        _vcPool->emplace(it);
+        _vcPool->add(it);
         *_nonMin = true;
       }
     }
@@ -1950,20 +1967,19 @@ void stagedThreshold(
   if (_vcPool->empty()) {
     if (!_outputVcsNonMin.empty()) {
       // no minimal > TH
-      *_vcPool = _outputVcsNonMin;
+      _vcPool->assign(_outputVcsNonMin);
       *_nonMin = true;
     } else {
       // min > TH
-      *_vcPool = _outputVcsMin;
+      _vcPool->assign(_outputVcsMin);
     }
   }
 }
 
-void thresholdWeighted(
-    const std::unordered_set<std::tuple<u32, u32, f64>>& _outputVcsMin,
-    const std::unordered_set<std::tuple<u32, u32, f64>>& _outputVcsNonMin,
-    f64 _hopsLeft, f64 _hopsIncr, f64 _threshold,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool, bool* _nonMin) {
+void thresholdWeighted(const CandidateVector& _outputVcsMin,
+                       const CandidateVector& _outputVcsNonMin, f64 _hopsLeft,
+                       f64 _hopsIncr, f64 _threshold, CandidateVector* _vcPool,
+                       bool* _nonMin) {
   _vcPool->clear();
   f64 leastCong = F64_MAX;
   *_nonMin = false;
@@ -1977,9 +1993,9 @@ void thresholdWeighted(
     if (delta > TOLERANCE) {  // replace
       leastCong = congMin;
       _vcPool->clear();
-      _vcPool->emplace(it);
+      _vcPool->add(it);
     } else if (absDelta < TOLERANCE) {  // same (add)
-      _vcPool->emplace(it);
+      _vcPool->add(it);
     }
   }
 
@@ -1997,9 +2013,9 @@ void thresholdWeighted(
       if (delta > TOLERANCE) {  // replace
         leastCong = congNM;
         _vcPool->clear();
-        _vcPool->emplace(it);
+        _vcPool->add(it);
       } else if (absDelta < TOLERANCE) {  // same (add)
-        _vcPool->emplace(it);
+        _vcPool->add(it);
       }
     }
   }
@@ -16,9 +16,9 @@
 #define NETWORK_HYPERX_UTIL_H_
 
 #include <tuple>
-#include <unordered_set>
 #include <vector>
 
+#include "network/hyperx/CandidateVector.h"
 #include "prim/prim.h"
 #include "router/Router.h"
 #include "types/Message.h"
@@ -61,17 +61,17 @@ enum class OutputAlg : u8 { Rand, Min };
 typedef void (*IntNodeAlgFunc)(Router*, u32, u32, const std::vector<u32>&,
                                const std::vector<u32>*, const std::vector<u32>&,
                                const std::vector<u32>&, u32, u32, u32, u32, u32,
-                               std::vector<u32>*);
+                               std::vector<u32>*, std::vector<u32>*);
 
 typedef void (*MinRoutingAlgFunc)(
     Router*, u32, u32, const std::vector<u32>&, const std::vector<u32>&, u32,
-    u32, const std::vector<u32>*, const std::vector<u32>&, u32, u32,
-    std::unordered_set<std::tuple<u32, u32, f64>>*);
+    u32, const std::vector<u32>*, const u32*, u32, u32, u32,
+    CandidateVector*);
 
 typedef void (*FirstHopRoutingAlgFunc)(
     Router*, u32, u32, const std::vector<u32>&, const std::vector<u32>&, u32,
     u32, const std::vector<u32>*, u32, u32, u32, bool,
-    std::unordered_set<std::tuple<u32, u32, f64>>*);
+    CandidateVector*);
 
 bool isDestinationRouter(Router* _router,
                          const std::vector<u32>* _destinationAddress);
@@ -81,13 +81,21 @@ u32 hopsLeft(Router* _router, const std::vector<u32>* _destinationAddress);
 u32 computeInputPortDim(const std::vector<u32>& _dimensionWidths,
                         const std::vector<u32>& _dimensionWeights,
                         u32 _concentration, u32 _inputPort);
+
+// routing extensions are the address vectors packets carry between routers,
+//  they are recycled instead of being allocated for every packet
+std::vector<u32>* createRoutingExtension(u32 _size, u32 _value);
+void releaseRoutingExtension(Packet* _packet);
+
+// these pick the intermediate router of valiants routing into '_address',
+//  '_candidates' is scratch space of the caller that keeps the heap out of it
 void intNodeReg(Router* _router, u32 _inputPort, u32 _inputVc,
                 const std::vector<u32>& _sourceRouter,
                 const std::vector<u32>* _destinationTerminal,
                 const std::vector<u32>& _dimensionWidths,
                 const std::vector<u32>& _dimensionWeights, u32 _concentration,
                 u32 _interfacePorts, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
-                std::vector<u32>* _address);
+                std::vector<u32>* _candidates, std::vector<u32>* _address);
 
 void intNodeMoveUnaligned(Router* _router, u32 _inputPort, u32 _inputVc,
                           const std::vector<u32>& _sourceRouter,
@@ -96,6 +104,7 @@ void intNodeMoveUnaligned(Router* _router, u32 _inputPort, u32 _inputVc,
                           const std::vector<u32>& _dimensionWeights,
                           u32 _concentration, u32 _interfacePorts, u32 _vcSet,
                           u32 _numVcSets, u32 _numVcs,
+                          std::vector<u32>* _candidates,
                           std::vector<u32>* _address);
 
 void intNodeSrc(Router* _router, u32 _inputPort, u32 _inputVc,
@@ -104,7 +113,7 @@ void intNodeSrc(Router* _router, u32 _inputPort, u32 _inputVc,
                 const std::vector<u32>& _dimensionWidths,
                 const std::vector<u32>& _dimensionWeights, u32 _concentration,
                 u32 _interfacePorts, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
-                std::vector<u32>* _address);
+                std::vector<u32>* _candidates, std::vector<u32>* _address);
 
 void intNodeDst(Router* _router, u32 _inputPort, u32 _inputVc,
                 const std::vector<u32>& _sourceRouter,
@@ -112,7 +121,7 @@ void intNodeDst(Router* _router, u32 _inputPort, u32 _inputVc,
                 const std::vector<u32>& _dimensionWidths,
                 const std::vector<u32>& _dimensionWeights, u32 _concentration,
                 u32 _interfacePorts, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
-                std::vector<u32>* _address);
+                std::vector<u32>* _candidates, std::vector<u32>* _address);
 
 void intNodeSrcDst(Router* _router, u32 _inputPort, u32 _inputVc,
                    const std::vector<u32>& _sourceRouter,
@@ -120,7 +129,8 @@ void intNodeSrcDst(Router* _router, u32 _inputPort, u32 _inputVc,
                    const std::vector<u32>& _dimensionWidths,
                    const std::vector<u32>& _dimensionWeights,
                    u32 _concentration, u32 _interfacePorts, u32 _vcSet,
-                   u32 _numVcSets, u32 _numVcs, std::vector<u32>* _address);
+                   u32 _numVcSets, u32 _numVcs, std::vector<u32>* _candidates,
+                   std::vector<u32>* _address);
 
 void intNodeMinV(Router* _router, u32 _inputPort, u32 _inputVc,
                  const std::vector<u32>& _sourceRouter,
@@ -128,7 +138,7 @@ void intNodeMinV(Router* _router, u32 _inputPort, u32 _inputVc,
                  const std::vector<u32>& _dimensionWidths,
                  const std::vector<u32>& _dimensionWeights, u32 _concentration,
                  u32 _interfacePorts, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
-                 std::vector<u32>* _address);
+                 std::vector<u32>* _candidates, std::vector<u32>* _address);
 
 void intNodeMinP(Router* _router, u32 _inputPort, u32 _inputVc,
                  const std::vector<u32>& _sourceRouter,
@@ -136,90 +146,102 @@ void intNodeMinP(Router* _router, u32 _inputPort, u32 _inputVc,
                  const std::vector<u32>& _dimensionWidths,
                  const std::vector<u32>& _dimensionWeights, u32 _concentration,
                  u32 _interfacePorts, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
-                 std::vector<u32>* _address);
+                 std::vector<u32>* _candidates, std::vector<u32>* _address);
+
+const CandidateVector::Candidate* randCandidate(const CandidateVector& _pool);
 
-void makeOutputVcSet(
-    std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool, u32 _maxOutputs,
-    OutputAlg _outputAlg,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputPorts);
+const CandidateVector::Candidate* minCongCandidate(
+    const CandidateVector& _pool);
 
-void makeOutputPortSet(
-    std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool,
-    const std::vector<u32>& _vcSets, u32 _numVcSets, u32 _numVcs,
-    u32 _maxOutputs, OutputAlg _outputAlg,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputPorts);
+void makeOutputVcSet(CandidateVector* _vcPool, u32 _maxOutputs,
+                     OutputAlg _outputAlg, CandidateVector* _outputPorts);
+
+void makeOutputPortSet(CandidateVector* _vcPool,
+                       const u32* _vcSets, u32 _vcSetsCount, u32 _numVcSets,
+                       u32 _numVcs, u32 _maxOutputs, OutputAlg _outputAlg,
+                       CandidateVector* _outputPorts);
 
 f64 getAveragePortCongestion(Router* _router, u32 _inputPort, u32 _inputVc,
-                             u32 _outputPort, const std::vector<u32>& _vcSets,
-                             u32 _numVcSets, u32 _numVcs);
-
-void dimOrderVcRoutingOutput(
-    Router* router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
-    const std::vector<u32>& _vcSets, u32 _numVcSets, u32 _numVcs,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool);
-
-void dimOrderPortRoutingOutput(
-    Router* router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
-    const std::vector<u32>& _vcSets, u32 _numVcSets, u32 _numVcs,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool);
-
-void randMinVcRoutingOutput(
-    Router* router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
-    const std::vector<u32>& _vcSets, u32 _numVcSets, u32 _numVcs,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool);
-
-void randMinPortRoutingOutput(
-    Router* router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
-    const std::vector<u32>& _vcSets, u32 _numVcSets, u32 _numVcs,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool);
-
-void adaptiveMinVcRoutingOutput(
-    Router* router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
-    const std::vector<u32>& _vcSet, u32 _numVcSets, u32 _numVcs,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool);
-
-void adaptiveMinPortRoutingOutput(
-    Router* router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
-    const std::vector<u32>& _vcSets, u32 _numVcSets, u32 _numVcs,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool);
-
-void valiantsRoutingOutput(
-    Router* _router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
-    u32 _vcSet, u32 _numVcSets, u32 _numVcs, bool _shortCut,
-    IntNodeAlg _intNodeAlg, BaseRoutingAlg _routingAlg, Flit* _flit,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool);
-
-void ugalRoutingOutput(
-    Router* _router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
-    bool _shortCut, bool _minAllVcSets, IntNodeAlg _intNodeAlg,
-    BaseRoutingAlg _routingAlg, NonMinRoutingAlg _nonMinimalAlg, Flit* _flit,
-    f64* _weightReg, f64* _weightVal,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputPortsReg,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputPortsVal);
+                             u32 _outputPort, const u32* _vcSets,
+                             u32 _vcSetsCount, u32 _numVcSets, u32 _numVcs);
+
+void dimOrderVcRoutingOutput(Router* router, u32 _inputPort, u32 _inputVc,
+                             const std::vector<u32>& _dimensionWidths,
+                             const std::vector<u32>& _dimensionWeights,
+                             u32 _concentration, u32 _interfacePorts,
+                             const std::vector<u32>* _destinationAddress,
+                             const u32* _vcSets, u32 _vcSetsCount,
+                             u32 _numVcSets, u32 _numVcs,
+                             CandidateVector* _vcPool);
+
+void dimOrderPortRoutingOutput(Router* router, u32 _inputPort, u32 _inputVc,
+                               const std::vector<u32>& _dimensionWidths,
+                               const std::vector<u32>& _dimensionWeights,
+                               u32 _concentration, u32 _interfacePorts,
+                               const std::vector<u32>* _destinationAddress,
+                               const u32* _vcSets, u32 _vcSetsCount,
+                               u32 _numVcSets, u32 _numVcs,
+                               CandidateVector* _vcPool);
+
+void randMinVcRoutingOutput(Router* router, u32 _inputPort, u32 _inputVc,
+                            const std::vector<u32>& _dimensionWidths,
+                            const std::vector<u32>& _dimensionWeights,
+                            u32 _concentration, u32 _interfacePorts,
+                            const std::vector<u32>* _destinationAddress,
+                            const u32* _vcSets, u32 _vcSetsCount,
+                            u32 _numVcSets, u32 _numVcs,
+                            CandidateVector* _vcPool);
+
+void randMinPortRoutingOutput(Router* router, u32 _inputPort, u32 _inputVc,
+                              const std::vector<u32>& _dimensionWidths,
+                              const std::vector<u32>& _dimensionWeights,
+                              u32 _concentration, u32 _interfacePorts,
+                              const std::vector<u32>* _destinationAddress,
+                              const u32* _vcSets, u32 _vcSetsCount,
+                              u32 _numVcSets, u32 _numVcs,
+                              CandidateVector* _vcPool);
+
+void adaptiveMinVcRoutingOutput(Router* router, u32 _inputPort, u32 _inputVc,
+                                const std::vector<u32>& _dimensionWidths,
+                                const std::vector<u32>& _dimensionWeights,
+                                u32 _concentration, u32 _interfacePorts,
+                                const std::vector<u32>* _destinationAddress,
+                                const u32* _vcSets, u32 _vcSetsCount,
+                                u32 _numVcSets, u32 _numVcs,
+                                CandidateVector* _vcPool);
+
+void adaptiveMinPortRoutingOutput(Router* router, u32 _inputPort, u32 _inputVc,
+                                  const std::vector<u32>& _dimensionWidths,
+                                  const std::vector<u32>& _dimensionWeights,
+                                  u32 _concentration, u32 _interfacePorts,
+                                  const std::vector<u32>* _destinationAddress,
+                                  const u32* _vcSets, u32 _vcSetsCount,
+                                  u32 _numVcSets, u32 _numVcs,
+                                  CandidateVector* _vcPool);
+
+void valiantsRoutingOutput(Router* _router, u32 _inputPort, u32 _inputVc,
+                           const std::vector<u32>& _dimensionWidths,
+                           const std::vector<u32>& _dimensionWeights,
+                           u32 _concentration, u32 _interfacePorts,
+                           const std::vector<u32>* _destinationAddress,
+                           u32 _vcSet, u32 _numVcSets, u32 _numVcs,
+                           bool _shortCut, IntNodeAlg _intNodeAlg,
+                           BaseRoutingAlg _routingAlg, Flit* _flit,
+                           std::vector<u32>* _intNodeCandidates,
+                           CandidateVector* _vcPool);
+
+void ugalRoutingOutput(Router* _router, u32 _inputPort, u32 _inputVc,
+                       const std::vector<u32>& _dimensionWidths,
+                       const std::vector<u32>& _dimensionWeights,
+                       u32 _concentration, u32 _interfacePorts, u32 _vcSet,
+                       u32 _numVcSets, u32 _numVcs, bool _shortCut,
+                       bool _minAllVcSets, IntNodeAlg _intNodeAlg,
+                       BaseRoutingAlg _routingAlg,
+                       NonMinRoutingAlg _nonMinimalAlg, Flit* _flit,
+                       std::vector<u32>* _intNodeCandidates, f64* _weightReg,
+                       f64* _weightVal,
+                       CandidateVector* _outputPortsReg,
+                       CandidateVector* _outputPortsVal);
 
 void lcqVcRoutingOutput(Router* _router, u32 _inputPort, u32 _inputVc,
                         const std::vector<u32>& _dimensionWidths,
@@ -227,124 +249,126 @@ void lcqVcRoutingOutput(Router* _router, u32 _inputPort, u32 _inputVc,
                         u32 _concentration, u32 _interfacePorts,
                         const std::vector<u32>* _destinationAddress, u32 _vcSet,
                         u32 _numVcSets, u32 _numVcs, bool _shortCut,
-                        std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool);
-
-void lcqPortRoutingOutput(
-    Router* _router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
-    u32 _vcSet, u32 _numVcSets, u32 _numVcs, bool _shortCut,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool);
-
-void doalPortRoutingOutput(
-    Router* _router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
-    u32 _baseVc, u32 _vcSet, u32 _numVcSets, u32 _numVcs, Flit* _flit,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsMin,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsNonMin);
-
-void doalVcRoutingOutput(
-    Router* _router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
-    u32 _baseVc, u32 _vcSet, u32 _numVcSets, u32 _numVcs, Flit* _flit,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsMin,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsNonMin);
-
-void ddalPortRoutingOutput(
-    Router* _router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
-    u32 _vcSet, u32 _numVcSets, u32 _numVcs, Flit* _flit,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsMin,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsNonMin);
-
-void ddalVcRoutingOutput(
-    Router* _router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
-    u32 _vcSet, u32 _numVcSets, u32 _numVcs, Flit* _flit,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsMin,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsNonMin);
-
-void vdalPortRoutingOutput(
-    Router* _router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
-    u32 _baseVc, u32 _vcSet, u32 _numVcSets, u32 _numVcs, Flit* _flit,
-    bool _multiDeroute,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsMin,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsNonMin);
-
-void vdalVcRoutingOutput(
-    Router* _router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
-    u32 _baseVc, u32 _vcSet, u32 _numVcSets, u32 _numVcs, Flit* _flit,
-    bool _multiDeroute,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsMin,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsNonMin);
-
-void skippingDimOrderRoutingOutput(
-    Router* _router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
-    u32 _startingDim, u32 _baseVc, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
-    Flit* _flit, f64 _iBias, f64 _cBias, f64 _step, f64 _threshold,
-    f64 _thresholdMin, f64 _thresholdNonMin, SkippingRoutingAlg _routingAlg,
-    DecisionScheme _decisionScheme, HopCountMode _hopCountMode,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcs1,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcs2,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcs3,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool);
-
-void finishingDimOrderRoutingOutput(
-    Router* _router, u32 _inputPort, u32 _inputVc,
-    const std::vector<u32>& _dimensionWidths,
-    const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
-    u32 _baseVc, u32 _vcSet, u32 _numVcSets, u32 _numVcs, Flit* _flit,
-    f64 _iBias, f64 _cBias, f64 _threshold, f64 _thresholdMin,
-    f64 _thresholdNonMin, SkippingRoutingAlg _routingAlg,
-    DecisionScheme _decisionScheme, HopCountMode _hopCountMode,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcs1,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcs2,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool);
-
-void monolithicWeighted(
-    const std::unordered_set<std::tuple<u32, u32, f64>>& _outputVcsMin,
-    const std::unordered_set<std::tuple<u32, u32, f64>>& _outputVcsNonMin,
-    f64 _hopsLeft, f64 _hopsIncr, f64 _iBias, f64 _cBias, BiasScheme _biasMode,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool, bool* _nonMin);
-
-void stagedThreshold(
-    const std::unordered_set<std::tuple<u32, u32, f64>>& _outputVcsMin,
-    const std::unordered_set<std::tuple<u32, u32, f64>>& _outputVcsNonMin,
-    f64 _thresholdMin, f64 _thresholdNonMin,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool, bool* _nonMin);
-
-void thresholdWeighted(
-    const std::unordered_set<std::tuple<u32, u32, f64>>& _outputVcsMin,
-    const std::unordered_set<std::tuple<u32, u32, f64>>& _outputVcsNonMin,
-    f64 _hopsLeft, f64 _hopsIncr, f64 _threshold,
-    std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool, bool* _nonMin);
+                        CandidateVector* _vcPool);
 
-}  // namespace HyperX
-
-template <typename T>
-const T* uSetRandElement(const std::unordered_set<T>& uSet);
+void lcqPortRoutingOutput(Router* _router, u32 _inputPort, u32 _inputVc,
+                          const std::vector<u32>& _dimensionWidths,
+                          const std::vector<u32>& _dimensionWeights,
+                          u32 _concentration, u32 _interfacePorts,
+                          const std::vector<u32>* _destinationAddress,
+                          u32 _vcSet, u32 _numVcSets, u32 _numVcs,
+                          bool _shortCut, CandidateVector* _vcPool);
+
+void doalPortRoutingOutput(Router* _router, u32 _inputPort, u32 _inputVc,
+                           const std::vector<u32>& _dimensionWidths,
+                           const std::vector<u32>& _dimensionWeights,
+                           u32 _concentration, u32 _interfacePorts,
+                           const std::vector<u32>* _destinationAddress,
+                           u32 _baseVc, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
+                           Flit* _flit, CandidateVector* _outputVcsMin,
+                           CandidateVector* _outputVcsNonMin);
+
+void doalVcRoutingOutput(Router* _router, u32 _inputPort, u32 _inputVc,
+                         const std::vector<u32>& _dimensionWidths,
+                         const std::vector<u32>& _dimensionWeights,
+                         u32 _concentration, u32 _interfacePorts,
+                         const std::vector<u32>* _destinationAddress,
+                         u32 _baseVc, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
+                         Flit* _flit, CandidateVector* _outputVcsMin,
+                         CandidateVector* _outputVcsNonMin);
+
+void ddalPortRoutingOutput(Router* _router, u32 _inputPort, u32 _inputVc,
+                           const std::vector<u32>& _dimensionWidths,
+                           const std::vector<u32>& _dimensionWeights,
+                           u32 _concentration, u32 _interfacePorts,
+                           const std::vector<u32>* _destinationAddress,
+                           u32 _vcSet, u32 _numVcSets, u32 _numVcs, Flit* _flit,
+                           CandidateVector* _outputVcsMin,
+                           CandidateVector* _outputVcsNonMin);
+
+void ddalVcRoutingOutput(Router* _router, u32 _inputPort, u32 _inputVc,
+                         const std::vector<u32>& _dimensionWidths,
+                         const std::vector<u32>& _dimensionWeights,
+                         u32 _concentration, u32 _interfacePorts,
+                         const std::vector<u32>* _destinationAddress,
+                         u32 _vcSet, u32 _numVcSets, u32 _numVcs, Flit* _flit,
+                         CandidateVector* _outputVcsMin,
+                         CandidateVector* _outputVcsNonMin);
+
+void vdalPortRoutingOutput(Router* _router, u32 _inputPort, u32 _inputVc,
+                           const std::vector<u32>& _dimensionWidths,
+                           const std::vector<u32>& _dimensionWeights,
+                           u32 _concentration, u32 _interfacePorts,
+                           const std::vector<u32>* _destinationAddress,
+                           u32 _baseVc, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
+                           Flit* _flit, bool _multiDeroute,
+                           CandidateVector* _outputVcsMin,
+                           CandidateVector* _outputVcsNonMin);
+
+void vdalVcRoutingOutput(Router* _router, u32 _inputPort, u32 _inputVc,
+                         const std::vector<u32>& _dimensionWidths,
+                         const std::vector<u32>& _dimensionWeights,
+                         u32 _concentration, u32 _interfacePorts,
+                         const std::vector<u32>* _destinationAddress,
+                         u32 _baseVc, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
+                         Flit* _flit, bool _multiDeroute,
+                         CandidateVector* _outputVcsMin,
+                         CandidateVector* _outputVcsNonMin);
+
+void skippingDimOrderRoutingOutput(Router* _router, u32 _inputPort,
+                                   u32 _inputVc,
+                                   const std::vector<u32>& _dimensionWidths,
+                                   const std::vector<u32>& _dimensionWeights,
+                                   u32 _concentration, u32 _interfacePorts,
+                                   const std::vector<u32>* _destinationAddress,
+                                   u32 _startingDim, u32 _baseVc, u32 _vcSet,
+                                   u32 _numVcSets, u32 _numVcs, Flit* _flit,
+                                   f64 _iBias, f64 _cBias, f64 _step,
+                                   f64 _threshold, f64 _thresholdMin,
+                                   f64 _thresholdNonMin,
+                                   SkippingRoutingAlg _routingAlg,
+                                   DecisionScheme _decisionScheme,
+                                   HopCountMode _hopCountMode,
+                                   std::vector<u32>* _fakeDestinationAddress,
+                                   CandidateVector* _outputVcs1,
+                                   CandidateVector* _outputVcs2,
+                                   CandidateVector* _outputVcs3,
+                                   CandidateVector* _vcPool);
+
+void finishingDimOrderRoutingOutput(Router* _router, u32 _inputPort,
+                                    u32 _inputVc,
+                                    const std::vector<u32>& _dimensionWidths,
+                                    const std::vector<u32>& _dimensionWeights,
+                                    u32 _concentration, u32 _interfacePorts,
+                                    const std::vector<u32>* _destinationAddress,
+                                    u32 _baseVc, u32 _vcSet, u32 _numVcSets,
+                                    u32 _numVcs, Flit* _flit, f64 _iBias,
+                                    f64 _cBias, f64 _threshold,
+                                    f64 _thresholdMin, f64 _thresholdNonMin,
+                                    SkippingRoutingAlg _routingAlg,
+                                    DecisionScheme _decisionScheme,
+                                    HopCountMode _hopCountMode,
+                                    CandidateVector* _outputVcs1,
+                                    CandidateVector* _outputVcs2,
+                                    CandidateVector* _vcPool);
+
+void monolithicWeighted(const CandidateVector& _outputVcsMin,
+                        const CandidateVector& _outputVcsNonMin, f64 _hopsLeft,
+                        f64 _hopsIncr, f64 _iBias, f64 _cBias,
+                        BiasScheme _biasMode, CandidateVector* _vcPool,
+                        bool* _nonMin);
+
+void stagedThreshold(const CandidateVector& _outputVcsMin,
+                     const CandidateVector& _outputVcsNonMin, f64 _thresholdMin,
+                     f64 _thresholdNonMin, CandidateVector* _vcPool,
+                     bool* _nonMin);
+
+void thresholdWeighted(const CandidateVector& _outputVcsMin,
+                       const CandidateVector& _outputVcsNonMin, f64 _hopsLeft,
+                       f64 _hopsIncr, f64 _threshold, CandidateVector* _vcPool,
+                       bool* _nonMin);
 
-template <typename T>
-const T* uSetMinCong(const std::unordered_set<T>& uSet);
+}  // namespace HyperX
 
 #include "network/hyperx/util.tcc"
 
@@ -19,20 +19,10 @@
 #error "don't include this file directly. use the .h file instead"
 #else  // NETWORK_HYPERX_UTIL_H_
 
-#include <algorithm>
 #include <tuple>
-#include <unordered_set>
 
 namespace HyperX {
 
-template <typename T>
-const T* uSetRandElement(const std::unordered_set<T>& uSet) {
-  u64 randInd = gSim->rnd.nextU64(0, uSet.size() - 1);
-  typename std::unordered_set<T>::const_iterator it = uSet.begin();
-  std::advance(it, randInd);
-  return &(*it);
-}
-
 template <typename T1, typename T2, typename T3>
 bool tupleComp2(const std::tuple<T1, T2, T3>& tL,
                 const std::tuple<T1, T2, T3>& tR) {
@@ -43,14 +33,6 @@ bool tupleComp2(const std::tuple<T1, T2, T3>& tL,
   }
 }
 
-template <typename T1, typename T2, typename T3>
-const std::tuple<T1, T2, T3>* uSetMinCong(
-    const std::unordered_set<std::tuple<T1, T2, T3> >& uSet) {
-  typename std::unordered_set<std::tuple<T1, T2, T3> >::const_iterator it =
-      min_element(uSet.begin(), uSet.end(), tupleComp2<T1, T2, T3>);
-  return &(*it);
-}
-
 }  // namespace HyperX
 
 #endif  // NETWORK_HYPERX_UTIL_H_
@@ -22,6 +22,7 @@
 #include "event/Component.h"
 #include "gtest/gtest.h"
 #include "network/cube/util.h"
+#include "network/hyperx/CandidateVector.h"
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
 #include "router/Router.h"
@@ -109,6 +110,7 @@ void intNodeTestCongestion(const std::vector<u32>& _sourceRouter,
                            const std::unordered_map<u32, f64> _congStatus,
                            HyperX::IntNodeAlgFunc _intNodeAlgFunc) {
   std::vector<u32> addr;
+  std::vector<u32> candidates;
   u32 numBuckets;
   u32 nonZeroBuckets = 0;
   const u64 kRounds = 10000;
@@ -132,7 +134,7 @@ void intNodeTestCongestion(const std::vector<u32>& _sourceRouter,
     router = new TestRouter(_sourceRouter, numPorts, _numVcs, _congStatus);
     _intNodeAlgFunc(router, 0, 0, _sourceRouter, _destinationTerminal,
                     _dimWidths, _dimWeights, _conc, _interfacePorts, _vcSet,
-                    _numVcSets, _numVcs, &addr);
+                    _numVcSets, _numVcs, &candidates, &addr);
     u32 id = Cube::translateInterfaceAddressToId(&addr, _dimWidths, _conc,
                                                  _interfacePorts);
     if (_idSet.find(id) == _idSet.end()) {
@@ -191,14 +193,14 @@ void distRoutingTest(
     const std::unordered_map<u32, f64>& _congStatus,
     HyperX::MinRoutingAlgFunc _routingAlgFunc,
     HyperX::FirstHopRoutingAlgFunc _firstHopAlgFunc) {
-  std::unordered_set<std::tuple<u32, u32, f64>> vcPool;
-  std::unordered_set<std::tuple<u32, u32, f64>> outputPorts;
   TestRouter* router;
   u32 numPorts;
   numPorts = _conc;
   for (u32 dim = 0; dim < _widths.size(); dim++) {
     numPorts += _widths.at(dim) * _weights.at(dim);
   }
+  HyperX::CandidateVector vcPool(numPorts * _numVcs);
+  HyperX::CandidateVector outputPorts(numPorts * _numVcs);
   router = new TestRouter(_sourceRouter, numPorts, _numVcs, _congStatus);
 
   u32 numBuckets;
@@ -215,7 +217,7 @@ void distRoutingTest(
   for (u64 idx = 0; idx < kRounds; idx++) {
     if (_routingAlgFunc) {
       _routingAlgFunc(router, 0, 0, _widths, _weights, _conc, _interfacePorts,
-                      _destinationTerminal, {_vcSet}, _numVcSets, _numVcs,
+                      _destinationTerminal, &_vcSet, 1, _numVcSets, _numVcs,
                       &vcPool);
     } else {
       _firstHopAlgFunc(router, 0, 0, _widths, _weights, _conc, _interfacePorts,
@@ -227,7 +229,7 @@ void distRoutingTest(
       HyperX::makeOutputVcSet(&vcPool, _maxOutputs, HyperX::OutputAlg::Rand,
                               &outputPorts);
     } else {
-      HyperX::makeOutputPortSet(&vcPool, {_vcSet}, _numVcSets, _numVcs,
+      HyperX::makeOutputPortSet(&vcPool, &_vcSet, 1, _numVcSets, _numVcs,
                                 _maxOutputs, HyperX::OutputAlg::Rand,
                                 &outputPorts);
     }
@@ -1872,15 +1874,13 @@ TEST(HyperXUtil, valiantsRoutingAlgorithm) {
   TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
   std::vector<u32> src, dst, widths, weights;
   u32 conc, interfacePorts, vcSet, numVcSets, numVcs;
-  std::unordered_set<std::tuple<u32, u32, f64>> outputPorts;
   std::unordered_set<std::tuple<u32, u32>> refOutputPorts;
   std::unordered_map<u32, f64> congStatus;
 
   Message* m = new Message(1, nullptr);
-  Packet* p = new Packet(0, 1, m);
+  Packet* p = Packet::create(0, 1, m);
   m->setPacket(0, p);
-  Flit* f = new Flit(0, true, false, p);
-  p->setFlit(0, f);
+  Flit* f = p->getFlit(0);
   HyperX::IntNodeAlg intNodeAlg = HyperX::IntNodeAlg::DST;
   HyperX::BaseRoutingAlg routingAlg = HyperX::BaseRoutingAlg::DORP;
 
@@ -1904,50 +1904,60 @@ TEST(HyperXUtil, valiantsRoutingAlgorithm) {
     numPorts += widths.at(dim) * weights.at(dim);
   }
   router = new TestRouter(src, numPorts, numVcs, congStatus);
+  HyperX::CandidateVector outputPorts(numPorts * numVcs);
+  std::vector<u32> candidates;
 
   HyperX::valiantsRoutingOutput(router, 0, 0, widths, weights, conc,
                                 interfacePorts, &dst, vcSet, numVcSets, numVcs,
-                                false, intNodeAlg, routingAlg, f, &outputPorts);
+                                false, intNodeAlg, routingAlg, f, &candidates,
+                                &outputPorts);
   ASSERT_NE(p->getRoutingExtension(), nullptr);
 
-  delete reinterpret_cast<const std::vector<u32>*>(p->getRoutingExtension());
-  p->setRoutingExtension(nullptr);
+  HyperX::releaseRoutingExtension(p);
   HyperX::valiantsRoutingOutput(router, 0, 0, widths, weights, conc,
                                 interfacePorts, &dst, vcSet, numVcSets, numVcs,
-                                true, intNodeAlg, routingAlg, f, &outputPorts);
+                                true, intNodeAlg, routingAlg, f, &candidates,
+                                &outputPorts);
   ASSERT_NE(p->getRoutingExtension(), nullptr);
 
   dst = {0, 0, 0};
   HyperX::valiantsRoutingOutput(router, 0, 0, widths, weights, conc,
                                 interfacePorts, &dst, vcSet, numVcSets, numVcs,
-                                true, intNodeAlg, routingAlg, f, &outputPorts);
+                                true, intNodeAlg, routingAlg, f, &candidates,
+                                &outputPorts);
   ASSERT_EQ(p->getRoutingExtension(), nullptr);
   for (auto& it : outputPorts) {
     ASSERT_EQ(std::get<0>(it), 0u);
   }
 
-  false_src = new std::vector<u32>({U32_MAX, 0, 0});
+  false_src = HyperX::createRoutingExtension(3, 0);
+  false_src->at(0) = U32_MAX;
   dst = {0, 1, 1};
   p->incrementHopCount();
   p->setRoutingExtension(false_src);
   HyperX::valiantsRoutingOutput(router, 0, 0, widths, weights, conc,
                                 interfacePorts, &dst, vcSet, numVcSets, numVcs,
-                                false, intNodeAlg, routingAlg, f, &outputPorts);
+                                false, intNodeAlg, routingAlg, f, &candidates,
+                                &outputPorts);
   ASSERT_EQ(p->getRoutingExtension(), nullptr);
 
-  false_src = new std::vector<u32>({U32_MAX, 0, 0});
+  false_src = HyperX::createRoutingExtension(3, 0);
+  false_src->at(0) = U32_MAX;
   p->setRoutingExtension(false_src);
   HyperX::valiantsRoutingOutput(router, 0, 0, widths, weights, conc,
                                 interfacePorts, &dst, vcSet, numVcSets, numVcs,
-                                true, intNodeAlg, routingAlg, f, &outputPorts);
+                                true, intNodeAlg, routingAlg, f, &candidates,
+                                &outputPorts);
   ASSERT_EQ(p->getRoutingExtension(), nullptr);
 
-  false_src = new std::vector<u32>({U32_MAX, 0, 0});
+  false_src = HyperX::createRoutingExtension(3, 0);
+  false_src->at(0) = U32_MAX;
   p->setRoutingExtension(false_src);
   dst = {0, 0, 0};
   HyperX::valiantsRoutingOutput(router, 0, 0, widths, weights, conc,
                                 interfacePorts, &dst, vcSet, numVcSets, numVcs,
-                                true, intNodeAlg, routingAlg, f, &outputPorts);
+                                true, intNodeAlg, routingAlg, f, &candidates,
+                                &outputPorts);
   ASSERT_EQ(p->getRoutingExtension(), nullptr);
   for (auto& it : outputPorts) {
     ASSERT_EQ(std::get<0>(it), 0u);
@@ -1957,18 +1967,21 @@ TEST(HyperXUtil, valiantsRoutingAlgorithm) {
   dst = {0, 1, 1};
   HyperX::valiantsRoutingOutput(router, 0, 0, widths, weights, conc,
                                 interfacePorts, &dst, vcSet, numVcSets, numVcs,
-                                false, intNodeAlg, routingAlg, f, &outputPorts);
+                                false, intNodeAlg, routingAlg, f, &candidates,
+                                &outputPorts);
   ASSERT_EQ(p->getRoutingExtension(), nullptr);
 
   HyperX::valiantsRoutingOutput(router, 0, 0, widths, weights, conc,
                                 interfacePorts, &dst, vcSet, numVcSets, numVcs,
-                                true, intNodeAlg, routingAlg, f, &outputPorts);
+                                true, intNodeAlg, routingAlg, f, &candidates,
+                                &outputPorts);
   ASSERT_EQ(p->getRoutingExtension(), nullptr);
 
   dst = {0, 0, 0};
   HyperX::valiantsRoutingOutput(router, 0, 0, widths, weights, conc,
                                 interfacePorts, &dst, vcSet, numVcSets, numVcs,
-                                true, intNodeAlg, routingAlg, f, &outputPorts);
+                                true, intNodeAlg, routingAlg, f, &candidates,
+                                &outputPorts);
   ASSERT_EQ(p->getRoutingExtension(), nullptr);
   for (auto& it : outputPorts) {
     ASSERT_EQ(std::get<0>(it), 0u);
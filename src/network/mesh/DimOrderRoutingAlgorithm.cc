@@ -14,11 +14,13 @@
  */
 #include "network/mesh/DimOrderRoutingAlgorithm.h"
 
+#include <algorithm>
 #include <cassert>
 #include <tuple>
-#include <unordered_set>
+#include <vector>
 
 #include "factory/ObjectFactory.h"
+#include "network/cube/util.h"
 #include "network/mesh/util.h"
 #include "strop/strop.h"
 #include "types/Message.h"
@@ -31,11 +33,17 @@ DimOrderRoutingAlgorithm::DimOrderRoutingAlgorithm(
     u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, nlohmann::json _settings)
+    u32 _interfacePorts, const nlohmann::json& _settings)
     : RoutingAlgorithm(_name, _parent, _router, _baseVc, _numVcs, _inputPort,
                        _inputVc, _dimensionWidths, _dimensionWeights,
                        _concentration, _interfacePorts, _settings),
-      mode_(parseRoutingMode(_settings["mode"].get<std::string>())) {
+      mode_(parseRoutingMode(_settings["mode"].get<std::string>())),
+      useTable_(RoutingTable::enabled(
+          _settings, Cube::computeNumRouters(_dimensionWidths),
+          Cube::computeNumRouters(_dimensionWidths),
+          *std::max_element(_dimensionWeights.begin(),
+                            _dimensionWeights.end()))),
+      table_(nullptr) {
   // VC set mapping:
   //  0 = all routing
   assert(numVcs_ >= 1);
@@ -47,18 +55,100 @@ DimOrderRoutingAlgorithm::DimOrderRoutingAlgorithm(
 
 DimOrderRoutingAlgorithm::~DimOrderRoutingAlgorithm() {
   delete reduction_;
+  if (table_ != nullptr) {
+    RoutingTable::release(table_);
+  }
+}
+
+void DimOrderRoutingAlgorithm::initialize() {
+  if (!useTable_) {
+    return;
+  }
+
+  // use the table of another instance on this router if it exists
+  const std::string key = "Mesh::DimOrderRoutingAlgorithm";
+  table_ = RoutingTable::acquire(router_, key);
+  if (table_ != nullptr) {
+    return;
+  }
+
+  // build the table for all destination routers, the ejection ports of this
+  //  router depend on the destination interface and are not stored
+  u32 numRouters = Cube::computeNumRouters(dimensionWidths_);
+  table_ = new RoutingTable(numRouters);
+  std::vector<u32> routerAddress;
+  std::vector<u32> destinationAddress(1 + dimensionWidths_.size(), 0);
+  for (u32 id = 0; id < numRouters; id++) {
+    Cube::translateRouterIdToAddress(id, dimensionWidths_, &routerAddress);
+    std::copy(routerAddress.begin(), routerAddress.end(),
+              destinationAddress.begin() + 1);
+    u32 hops = computeRoute(&destinationAddress, &ports_);
+    table_->addDestination(hops);
+    if (id != router_->id()) {
+      for (u32 port : ports_) {
+        table_->addPort(port);
+      }
+    }
+  }
+  RoutingTable::share(router_, key, table_);
 }
 
 void DimOrderRoutingAlgorithm::processRequest(
     Flit* _flit, RoutingAlgorithm::Response* _response) {
+  // retrieve the candidate ports
+  const u32* ports;
+  u32 numPorts;
+  u32 hops;
+  if (table_ != nullptr) {
+    const Message* message = _flit->packet()->message();
+    u32 destinationRouter = Cube::translateInterfaceIdToRouterId(
+        message->getDestinationId(), concentration_, interfacePorts_);
+    hops = table_->info(destinationRouter);
+    if (destinationRouter == router_->id()) {
+      computeEjectionPorts(message->getDestinationAddress(), &ports_);
+      ports = ports_.data();
+      numPorts = ports_.size();
+    } else {
+      ports = table_->ports(destinationRouter);
+      numPorts = table_->numPorts(destinationRouter);
+    }
+  } else {
+    hops = computeRoute(_flit->packet()->message()->getDestinationAddress(),
+                        &ports_);
+    ports = ports_.data();
+    numPorts = ports_.size();
+  }
+
+  // add all candidate ports
+  for (u32 idx = 0; idx < numPorts; idx++) {
+    addPort(ports[idx], hops, 0);
+  }
+
+  // reduction phase
+  const std::vector<std::tuple<u32, u32>>* outputs =
+      reduction_->reduce(nullptr);
+  for (const auto& t : *outputs) {
+    u32 port = std::get<0>(t);
+    u32 vc = std::get<1>(t);
+    if (vc == U32_MAX) {
+      for (u32 vc = baseVc_; vc < baseVc_ + numVcs_; vc += 1) {
+        _response->add(port, vc);
+      }
+    } else {
+      _response->add(port, vc);
+    }
+  }
+}
+
+u32 DimOrderRoutingAlgorithm::computeRoute(
+    const std::vector<u32>* _destinationAddress,
+    std::vector<u32>* _ports) const {
+  _ports->clear();
   u32 outputPort;
 
-  // ex: [x,y,z]
+  // ex: [x,y,z] for router, [c,x,y,z] for destination
   const std::vector<u32>& routerAddress = router_->address();
-  // ex: [c,x,y,z]
-  const std::vector<u32>* destinationAddress =
-      _flit->packet()->message()->getDestinationAddress();
-  assert(routerAddress.size() == (destinationAddress->size() - 1));
+  assert(routerAddress.size() == (_destinationAddress->size() - 1));
 
   // determine the next dimension to work on
   u32 dim;
@@ -67,7 +157,7 @@ void DimOrderRoutingAlgorithm::processRequest(
   u32 dimWeight = U32_MAX;
   for (dim = 0; dim < numDimensions; dim++) {
     dimWeight = dimensionWeights_.at(dim);
-    if (routerAddress.at(dim) != destinationAddress->at(dim + 1)) {
+    if (routerAddress.at(dim) != _destinationAddress->at(dim + 1)) {
       break;
     }
     portBase += 2 * dimWeight;
@@ -82,19 +172,16 @@ void DimOrderRoutingAlgorithm::processRequest(
   }
 
   // determine minimum number of hops to destination for reduction algorithm
-  u32 hops = computeMinimalHops(&tempRA, destinationAddress, numDimensions,
+  u32 hops = computeMinimalHops(&tempRA, _destinationAddress, numDimensions,
                                 dimensionWidths_);
 
   // test if already at destination router
   if (dim == routerAddress.size()) {
-    u32 basePort = destinationAddress->at(0) * interfacePorts_;
-    for (u32 offset = 0; offset < interfacePorts_; offset++) {
-      addPort(basePort + offset, hops, 0);
-    }
+    computeEjectionPorts(_destinationAddress, _ports);
   } else {
     // more router-to-router hops needed
     u32 src = routerAddress.at(dim);
-    u32 dst = destinationAddress->at(dim + 1);
+    u32 dst = _destinationAddress->at(dim + 1);
     assert(src != dst);
 
     // determine direction
@@ -115,23 +202,20 @@ void DimOrderRoutingAlgorithm::processRequest(
 
     // add all ports connecting to the destination (based on weight)
     for (u32 wInd = 0; wInd < dimWeight; wInd++) {
-      addPort(outputPort + wInd, hops, 0);
+      _ports->push_back(outputPort + wInd);
     }
   }
 
-  // reduction phase
-  const std::unordered_set<std::tuple<u32, u32>>* outputs =
-      reduction_->reduce(nullptr);
-  for (const auto& t : *outputs) {
-    u32 port = std::get<0>(t);
-    u32 vc = std::get<1>(t);
-    if (vc == U32_MAX) {
-      for (u32 vc = baseVc_; vc < baseVc_ + numVcs_; vc += 1) {
-        _response->add(port, vc);
-      }
-    } else {
-      _response->add(port, vc);
-    }
+  return hops;
+}
+
+void DimOrderRoutingAlgorithm::computeEjectionPorts(
+    const std::vector<u32>* _destinationAddress,
+    std::vector<u32>* _ports) const {
+  _ports->clear();
+  u32 basePort = _destinationAddress->at(0) * interfacePorts_;
+  for (u32 offset = 0; offset < interfacePorts_; offset++) {
+    _ports->push_back(basePort + offset);
   }
 }
 
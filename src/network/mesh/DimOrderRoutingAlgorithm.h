@@ -24,6 +24,7 @@
 #include "prim/prim.h"
 #include "router/Router.h"
 #include "routing/Reduction.h"
+#include "routing/RoutingTable.h"
 #include "routing/mode.h"
 
 namespace Mesh {
@@ -36,17 +37,29 @@ class DimOrderRoutingAlgorithm : public RoutingAlgorithm {
                            const std::vector<u32>& _dimensionWidths,
                            const std::vector<u32>& _dimensionWeights,
                            u32 _concentration, u32 _interfacePorts,
-                           nlohmann::json _settings);
+                           const nlohmann::json& _settings);
   ~DimOrderRoutingAlgorithm();
 
+  void initialize() override;
+
  protected:
   void processRequest(Flit* _flit,
                       RoutingAlgorithm::Response* _response) override;
 
  private:
+  // this computes the minimal hops and the candidate output ports
+  u32 computeRoute(const std::vector<u32>* _destinationAddress,
+                   std::vector<u32>* _ports) const;
+  // this computes the ports of the destination interface at its router
+  void computeEjectionPorts(const std::vector<u32>* _destinationAddress,
+                            std::vector<u32>* _ports) const;
   void addPort(u32 _port, u32 _hops, u32 vcSet);
   const RoutingMode mode_;
   Reduction* reduction_;
+
+  const bool useTable_;
+  RoutingTable* table_;
+  std::vector<u32> ports_;
 };
 
 }  // namespace Mesh
@@ -26,7 +26,7 @@ RoutingAlgorithm::RoutingAlgorithm(const std::string& _name,
                                    const std::vector<u32>& _dimensionWidths,
                                    const std::vector<u32>& _dimensionWeights,
                                    u32 _concentration, u32 _interfacePorts,
-                                   nlohmann::json _settings)
+                                   const nlohmann::json& _settings)
     : ::RoutingAlgorithm(_name, _parent, _router, _baseVc, _numVcs, _inputPort,
                          _inputVc, _settings),
       dimensionWidths_(_dimensionWidths),
@@ -43,7 +43,7 @@ RoutingAlgorithm* RoutingAlgorithm::create(
     u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, nlohmann::json _settings) {
+    u32 _interfacePorts, const nlohmann::json& _settings) {
   // retrieve the algorithm
   const std::string& algorithm = _settings["algorithm"].get<std::string>();
 
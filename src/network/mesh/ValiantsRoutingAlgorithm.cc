@@ -16,7 +16,7 @@
 
 #include <cassert>
 #include <tuple>
-#include <unordered_set>
+#include <vector>
 
 #include "factory/ObjectFactory.h"
 #include "network/mesh/util.h"
@@ -30,7 +30,7 @@ ValiantsRoutingAlgorithm::ValiantsRoutingAlgorithm(
     u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, nlohmann::json _settings)
+    u32 _interfacePorts, const nlohmann::json& _settings)
     : RoutingAlgorithm(_name, _parent, _router, _baseVc, _numVcs, _inputPort,
                        _inputVc, _dimensionWidths, _dimensionWeights,
                        _concentration, _interfacePorts, _settings),
@@ -225,7 +225,7 @@ void ValiantsRoutingAlgorithm::processRequest(
   }
 
   // reduction phase
-  const std::unordered_set<std::tuple<u32, u32>>* outputs =
+  const std::vector<std::tuple<u32, u32>>* outputs =
       reduction_->reduce(nullptr);
   for (const auto& t : *outputs) {
     u32 port = std::get<0>(t);
@@ -23,12 +23,10 @@
 
 namespace ParkingLot {
 
-ExitLotRoutingAlgorithm::ExitLotRoutingAlgorithm(const std::string& _name,
-                                                 const Component* _parent,
-                                                 Router* _router, u32 _baseVc,
-                                                 u32 _numVcs, u32 _inputPort,
-                                                 u32 _inputVc, u32 _outputPort,
-                                                 nlohmann::json _settings)
+ExitLotRoutingAlgorithm::ExitLotRoutingAlgorithm(
+    const std::string& _name, const Component* _parent, Router* _router,
+    u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc, u32 _outputPort,
+    const nlohmann::json& _settings)
     : RoutingAlgorithm(_name, _parent, _router, _baseVc, _numVcs, _inputPort,
                        _inputVc, _outputPort, _settings),
       adaptive_(_settings["adaptive"].get<bool>()) {
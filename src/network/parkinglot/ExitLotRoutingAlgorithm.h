@@ -30,7 +30,7 @@ class ExitLotRoutingAlgorithm : public ParkingLot::RoutingAlgorithm {
   ExitLotRoutingAlgorithm(const std::string& _name, const Component* _parent,
                           Router* _router, u32 _baseVc, u32 _numVcs,
                           u32 _inputPort, u32 _inputVc, u32 _outputPort,
-                          nlohmann::json _settings);
+                          const nlohmann::json& _settings);
   ~ExitLotRoutingAlgorithm();
 
  protected:
@@ -25,7 +25,7 @@
 
 #define PARKINGLOT_ROUTINGALGORITHM_ARGS                                  \
   const std::string&, const Component*, Router*, u32, u32, u32, u32, u32, \
-      nlohmann::json
+      const nlohmann::json&
 
 namespace ParkingLot {
 
@@ -33,7 +33,8 @@ class RoutingAlgorithm : public ::RoutingAlgorithm {
  public:
   RoutingAlgorithm(const std::string& _name, const Component* _parent,
                    Router* _router, u32 _baseVc, u32 _numVcs, u32 _inputPort,
-                   u32 _inputVc, u32 _outputPort, nlohmann::json _settings);
+                   u32 _inputVc, u32 _outputPort,
+                   const nlohmann::json& _settings);
   virtual ~RoutingAlgorithm();
 
   // this is a routing algorithm factory for the parking lot topology
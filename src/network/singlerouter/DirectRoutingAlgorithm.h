@@ -30,7 +30,7 @@ class DirectRoutingAlgorithm : public SingleRouter::RoutingAlgorithm {
   DirectRoutingAlgorithm(const std::string& _name, const Component* _parent,
                          Router* _router, u32 _baseVc, u32 _numVcs,
                          u32 _inputPort, u32 _inputVc, u32 _concentration,
-                         u32 _interfacePorts, nlohmann::json _settings);
+                         u32 _interfacePorts, const nlohmann::json& _settings);
   ~DirectRoutingAlgorithm();
 
  protected:
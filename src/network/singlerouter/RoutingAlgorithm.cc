@@ -23,7 +23,7 @@ RoutingAlgorithm::RoutingAlgorithm(const std::string& _name,
                                    u32 _baseVc, u32 _numVcs, u32 _inputPort,
                                    u32 _inputVc, u32 _concentration,
                                    u32 _interfacePorts,
-                                   nlohmann::json _settings)
+                                   const nlohmann::json& _settings)
     : ::RoutingAlgorithm(_name, _parent, _router, _baseVc, _numVcs, _inputPort,
                          _inputVc, _settings),
       concentration_(_concentration),
@@ -34,7 +34,7 @@ RoutingAlgorithm::~RoutingAlgorithm() {}
 RoutingAlgorithm* RoutingAlgorithm::create(
     const std::string& _name, const Component* _parent, Router* _router,
     u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc, u32 _concentration,
-    u32 _interfacePorts, nlohmann::json _settings) {
+    u32 _interfacePorts, const nlohmann::json& _settings) {
   // retrieve the algorithm
   const std::string& algorithm = _settings["algorithm"].get<std::string>();
 
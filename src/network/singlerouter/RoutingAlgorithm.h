@@ -25,7 +25,7 @@
 
 #define SINGLEROUTER_ROUTINGALGORITHM_ARGS                                     \
   const std::string&, const Component*, Router*, u32, u32, u32, u32, u32, u32, \
-      nlohmann::json
+      const nlohmann::json&
 
 namespace SingleRouter {
 
@@ -34,7 +34,7 @@ class RoutingAlgorithm : public ::RoutingAlgorithm {
   RoutingAlgorithm(const std::string& _name, const Component* _parent,
                    Router* _router, u32 _baseVc, u32 _numVcs, u32 _inputPort,
                    u32 _inputVc, u32 _concentration, u32 _interfacePorts,
-                   nlohmann::json _settings);
+                   const nlohmann::json& _settings);
   virtual ~RoutingAlgorithm();
 
   // this is a routing algorithm factory for the SingleRouter topology
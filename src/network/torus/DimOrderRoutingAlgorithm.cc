@@ -14,11 +14,13 @@
  */
 #include "network/torus/DimOrderRoutingAlgorithm.h"
 
+#include <algorithm>
 #include <cassert>
 #include <tuple>
-#include <unordered_set>
+#include <vector>
 
 #include "factory/ObjectFactory.h"
+#include "network/cube/util.h"
 #include "network/torus/util.h"
 #include "strop/strop.h"
 #include "types/Message.h"
@@ -26,16 +28,35 @@
 
 namespace Torus {
 
+namespace {
+
+// route info word layout
+const u32 kHopsMask = 0xFFFF;
+const u32 kEject = 1u << 16;
+const u32 kTie = 1u << 17;  // both directions listed, right ports first
+const u32 kRight = 1u << 18;
+const u32 kRightDateline = 1u << 19;
+const u32 kLeftDateline = 1u << 20;
+const u32 kDimShift = 24;
+
+}  // namespace
+
 DimOrderRoutingAlgorithm::DimOrderRoutingAlgorithm(
     const std::string& _name, const Component* _parent, Router* _router,
     u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, nlohmann::json _settings)
+    u32 _interfacePorts, const nlohmann::json& _settings)
     : RoutingAlgorithm(_name, _parent, _router, _baseVc, _numVcs, _inputPort,
                        _inputVc, _dimensionWidths, _dimensionWeights,
                        _concentration, _interfacePorts, _settings),
-      mode_(parseRoutingMode(_settings["mode"].get<std::string>())) {
+      mode_(parseRoutingMode(_settings["mode"].get<std::string>())),
+      useTable_(RoutingTable::enabled(
+          _settings, Cube::computeNumRouters(_dimensionWidths),
+          Cube::computeNumRouters(_dimensionWidths),
+          2 * *std::max_element(_dimensionWeights.begin(),
+                                _dimensionWeights.end()))),
+      table_(nullptr) {
   // VC set mapping:
   //  0 = no dateline
   //  1 = dateline
@@ -48,105 +69,107 @@ DimOrderRoutingAlgorithm::DimOrderRoutingAlgorithm(
 
 DimOrderRoutingAlgorithm::~DimOrderRoutingAlgorithm() {
   delete reduction_;
+  if (table_ != nullptr) {
+    RoutingTable::release(table_);
+  }
 }
 
-void DimOrderRoutingAlgorithm::processRequest(
-    Flit* _flit, RoutingAlgorithm::Response* _response) {
-  u32 outputPort;
+void DimOrderRoutingAlgorithm::initialize() {
+  if (!useTable_) {
+    return;
+  }
 
-  // ex: [x,y,z]
-  const std::vector<u32>& routerAddress = router_->address();
-  // ex: [c,x,y,z]
-  const std::vector<u32>* destinationAddress =
-      _flit->packet()->message()->getDestinationAddress();
-  assert(routerAddress.size() == (destinationAddress->size() - 1));
+  // use the table of another instance on this router if it exists
+  const std::string key = "Torus::DimOrderRoutingAlgorithm";
+  table_ = RoutingTable::acquire(router_, key);
+  if (table_ != nullptr) {
+    return;
+  }
 
-  // determine the next dimension to work on
-  u32 dim;
-  u32 numDimensions = dimensionWidths_.size();
-  u32 portBase = concentration_;
-  u32 dimWeight = U32_MAX;
-  for (dim = 0; dim < numDimensions; dim++) {
-    dimWeight = dimensionWeights_.at(dim);
-    if (routerAddress.at(dim) != destinationAddress->at(dim + 1)) {
-      break;
+  // build the table for all destination routers, the ejection ports of this
+  //  router depend on the destination interface and are not stored
+  u32 numRouters = Cube::computeNumRouters(dimensionWidths_);
+  table_ = new RoutingTable(numRouters);
+  std::vector<u32> routerAddress;
+  std::vector<u32> destinationAddress(1 + dimensionWidths_.size(), 0);
+  for (u32 id = 0; id < numRouters; id++) {
+    Cube::translateRouterIdToAddress(id, dimensionWidths_, &routerAddress);
+    std::copy(routerAddress.begin(), routerAddress.end(),
+              destinationAddress.begin() + 1);
+    u32 info = computeRoute(&destinationAddress, &ports_);
+    table_->addDestination(info);
+    if (id != router_->id()) {
+      for (u32 port : ports_) {
+        table_->addPort(port);
+      }
     }
-    portBase += 2 * dimWeight;
   }
+  RoutingTable::share(router_, key, table_);
+}
 
-  // create a temporary router address with a dummy concentration for use with
-  //  'util.h' 'computeMinimalHops() frunction'
-  std::vector<u32> tempRA = std::vector<u32>(1 + routerAddress.size());
-  tempRA.at(0) = U32_MAX;  // dummy
-  for (u32 ind = 1; ind < tempRA.size(); ind++) {
-    tempRA.at(ind) = routerAddress.at(ind - 1);
+void DimOrderRoutingAlgorithm::processRequest(
+    Flit* _flit, RoutingAlgorithm::Response* _response) {
+  // retrieve the route info and candidate ports
+  const u32* ports;
+  u32 numPorts;
+  u32 info;
+  if (table_ != nullptr) {
+    const Message* message = _flit->packet()->message();
+    u32 destinationRouter = Cube::translateInterfaceIdToRouterId(
+        message->getDestinationId(), concentration_, interfacePorts_);
+    info = table_->info(destinationRouter);
+    if (destinationRouter == router_->id()) {
+      computeEjectionPorts(message->getDestinationAddress(), &ports_);
+      ports = ports_.data();
+      numPorts = ports_.size();
+    } else {
+      ports = table_->ports(destinationRouter);
+      numPorts = table_->numPorts(destinationRouter);
+    }
+  } else {
+    info = computeRoute(_flit->packet()->message()->getDestinationAddress(),
+                        &ports_);
+    ports = ports_.data();
+    numPorts = ports_.size();
   }
-
-  // determine minimum number of hops to destination for reduction algorithm
-  u32 hops = computeMinimalHops(&tempRA, destinationAddress, numDimensions,
-                                dimensionWidths_);
+  u32 hops = info & kHopsMask;
 
   // figure out which VC set to use
   u32 vcSet = (_flit->getVc() - baseVc_) % 2;
 
   // test if already at destination router
-  if (dim == routerAddress.size()) {
-    u32 basePort = destinationAddress->at(0) * interfacePorts_;
-
+  if (info & kEject) {
     // on ejection, any dateline VcSet is ok
     if (routingModeIsPort(mode_)) {
       // if routing mode is port then all vcs in the port are already added
-      for (u32 offset = 0; offset < interfacePorts_; offset++) {
-        addPort(basePort + offset, hops, U32_MAX);
+      for (u32 idx = 0; idx < numPorts; idx++) {
+        addPort(ports[idx], hops, U32_MAX);
       }
     } else {
       // adding each vcSet (2 for DOR) will allow for all vcs to be used
-      for (u32 offset = 0; offset < interfacePorts_; offset++) {
+      for (u32 idx = 0; idx < numPorts; idx++) {
         for (u32 vcSetInd = 0; vcSetInd < 2; vcSetInd++) {
-          addPort(basePort + offset, hops, vcSetInd);
+          addPort(ports[idx], hops, vcSetInd);
         }
       }
     }
   } else {
-    // more router-to-router hops needed
-    u32 src = routerAddress.at(dim);
-    u32 dst = destinationAddress->at(dim + 1);
-    assert(src != dst);
-
-    // in torus topology, we can get to a destination in two directions,
-    //  this algorithm takes the shortest path, randomized tie breaker
-    u32 rightDelta =
-        ((dst > src) ? (dst - src) : (dst + dimensionWidths_.at(dim) - src));
-    u32 leftDelta =
-        ((src > dst) ? (src - dst) : (src + dimensionWidths_.at(dim) - dst));
-
-    // determine direction
+    // determine direction, randomized tie breaker
     bool right;
-    if (rightDelta == leftDelta) {
+    if (info & kTie) {
       right = gSim->rnd.nextBool();
-    } else if (rightDelta < leftDelta) {
-      right = true;
-    } else {
-      right = false;
-    }
-
-    // choose output port, figure out next router in this dimension
-    u32 next;
-    bool crossDateline;
-    if (right) {
-      outputPort = portBase;
-      next = (src + 1) % dimensionWidths_.at(dim);
-      crossDateline = next < src;
+      numPorts /= 2;
+      if (!right) {
+        ports += numPorts;
+      }
     } else {
-      outputPort = portBase + dimWeight;
-      next = src == 0 ? dimensionWidths_.at(dim) - 1 : src - 1;
-      crossDateline = next > src;
+      right = (info & kRight) != 0;
     }
-    assert(next != src);
+    bool crossDateline = (info & (right ? kRightDateline : kLeftDateline)) != 0;
 
     // reset to VC set 0 when switching dimensions
     //  this also occurs on an injection port
-    if (dim != inputPortDim_) {
+    if ((info >> kDimShift) != inputPortDim_) {
       vcSet = 0;
     }
 
@@ -157,13 +180,13 @@ void DimOrderRoutingAlgorithm::processRequest(
     }
 
     // add all ports connecting to the destination (based on weight)
-    for (u32 wInd = 0; wInd < dimWeight; wInd++) {
-      addPort(outputPort + wInd, hops, vcSet);
+    for (u32 idx = 0; idx < numPorts; idx++) {
+      addPort(ports[idx], hops, vcSet);
     }
   }
 
   // reduction phase
-  const std::unordered_set<std::tuple<u32, u32>>* outputs =
+  const std::vector<std::tuple<u32, u32>>* outputs =
       reduction_->reduce(nullptr);
   for (const auto& t : *outputs) {
     u32 port = std::get<0>(t);
@@ -178,6 +201,101 @@ void DimOrderRoutingAlgorithm::processRequest(
   }
 }
 
+u32 DimOrderRoutingAlgorithm::computeRoute(
+    const std::vector<u32>* _destinationAddress,
+    std::vector<u32>* _ports) const {
+  _ports->clear();
+
+  // ex: [x,y,z] for router, [c,x,y,z] for destination
+  const std::vector<u32>& routerAddress = router_->address();
+  assert(routerAddress.size() == (_destinationAddress->size() - 1));
+
+  // determine the next dimension to work on
+  u32 dim;
+  u32 numDimensions = dimensionWidths_.size();
+  u32 portBase = concentration_;
+  u32 dimWeight = U32_MAX;
+  for (dim = 0; dim < numDimensions; dim++) {
+    dimWeight = dimensionWeights_.at(dim);
+    if (routerAddress.at(dim) != _destinationAddress->at(dim + 1)) {
+      break;
+    }
+    portBase += 2 * dimWeight;
+  }
+
+  // create a temporary router address with a dummy concentration for use with
+  //  'util.h' 'computeMinimalHops() frunction'
+  std::vector<u32> tempRA = std::vector<u32>(1 + routerAddress.size());
+  tempRA.at(0) = U32_MAX;  // dummy
+  for (u32 ind = 1; ind < tempRA.size(); ind++) {
+    tempRA.at(ind) = routerAddress.at(ind - 1);
+  }
+
+  // determine minimum number of hops to destination for reduction algorithm
+  u32 hops = computeMinimalHops(&tempRA, _destinationAddress, numDimensions,
+                                dimensionWidths_);
+  assert(hops <= kHopsMask);
+  assert(dim < (1u << (32 - kDimShift)));
+  u32 info = hops | (dim << kDimShift);
+
+  // test if already at destination router
+  if (dim == routerAddress.size()) {
+    computeEjectionPorts(_destinationAddress, _ports);
+    return info | kEject;
+  }
+
+  // more router-to-router hops needed
+  u32 src = routerAddress.at(dim);
+  u32 dst = _destinationAddress->at(dim + 1);
+  assert(src != dst);
+
+  // in torus topology, we can get to a destination in two directions,
+  //  this algorithm takes the shortest path, randomized tie breaker
+  u32 rightDelta =
+      ((dst > src) ? (dst - src) : (dst + dimensionWidths_.at(dim) - src));
+  u32 leftDelta =
+      ((src > dst) ? (src - dst) : (src + dimensionWidths_.at(dim) - dst));
+
+  // figure out next router in each direction and the dateline crossings
+  u32 rightNext = (src + 1) % dimensionWidths_.at(dim);
+  u32 leftNext = src == 0 ? dimensionWidths_.at(dim) - 1 : src - 1;
+  assert(rightNext != src && leftNext != src);
+  if (rightNext < src) {
+    info |= kRightDateline;
+  }
+  if (leftNext > src) {
+    info |= kLeftDateline;
+  }
+
+  // add all ports connecting to the destination (based on weight)
+  if (rightDelta <= leftDelta) {
+    for (u32 wInd = 0; wInd < dimWeight; wInd++) {
+      _ports->push_back(portBase + wInd);
+    }
+  }
+  if (leftDelta <= rightDelta) {
+    for (u32 wInd = 0; wInd < dimWeight; wInd++) {
+      _ports->push_back(portBase + dimWeight + wInd);
+    }
+  }
+  if (rightDelta == leftDelta) {
+    info |= kTie;
+  } else if (rightDelta < leftDelta) {
+    info |= kRight;
+  }
+  return info;
+}
+
+void DimOrderRoutingAlgorithm::computeEjectionPorts(
+    const std::vector<u32>* _destinationAddress,
+    std::vector<u32>* _ports) const {
+  _ports->clear();
+  u32 basePort = _destinationAddress->at(0) * interfacePorts_;
+  for (u32 offset = 0; offset < interfacePorts_; offset++) {
+    _ports->push_back(basePort + offset);
+  }
+}
+
 void DimOrderRoutingAlgorithm::addPort(u32 _port, u32 _hops, u32 vcSet) {
   if (routingModeIsPort(mode_)) {
     // add the port as a whole
@@ -27,7 +27,7 @@
 #define TORUS_ROUTINGALGORITHM_ARGS                                  \
   const std::string&, const Component*, Router*, u32, u32, u32, u32, \
       const std::vector<u32>&, const std::vector<u32>&, u32, u32,    \
-      nlohmann::json
+      const nlohmann::json&
 
 namespace Torus {
 
@@ -38,7 +38,7 @@ class RoutingAlgorithm : public ::RoutingAlgorithm {
                    u32 _inputVc, const std::vector<u32>& _dimensionWidths,
                    const std::vector<u32>& _dimensionWeights,
                    u32 _concentration, u32 _interface,
-                   nlohmann::json _settings);
+                   const nlohmann::json& _settings);
   virtual ~RoutingAlgorithm();
 
   // this is a routing algorithm factory for the torus topology
@@ -35,7 +35,7 @@ class ValiantsRoutingAlgorithm : public RoutingAlgorithm {
                            const std::vector<u32>& _dimensionWidths,
                            const std::vector<u32>& _dimensionWeights,
                            u32 _concentration, u32 _interfacePorts,
-                           nlohmann::json _settings);
+                           const nlohmann::json& _settings);
   ~ValiantsRoutingAlgorithm();
 
  protected:
@@ -17,6 +17,7 @@
 #include <cassert>
 
 #include "factory/ObjectFactory.h"
+#include "routing/mode.h"
 #include "strop/strop.h"
 #include "types/Packet.h"
 #include "workload/Workload.h"
@@ -24,7 +25,7 @@
 Router::Router(const std::string& _name, const Component* _parent,
                Network* _network, u32 _id, const std::vector<u32>& _address,
                u32 _numPorts, u32 _numVcs, MetadataHandler* _metadataHandler,
-               nlohmann::json _settings)
+               const nlohmann::json& _settings)
     : Component(_name, _parent),
       PortedDevice(_id, _address, _numPorts, _numVcs),
       network_(_network),
@@ -36,7 +37,7 @@ Router* Router::create(const std::string& _name, const Component* _parent,
                        Network* _network, u32 _id,
                        const std::vector<u32>& _address, u32 _numPorts,
                        u32 _numVcs, MetadataHandler* _metadataHandler,
-                       nlohmann::json _settings) {
+                       const nlohmann::json& _settings) {
   // retrieve the architecture
   const std::string& architecture =
       _settings["architecture"].get<std::string>();
@@ -58,6 +59,21 @@ Network* Router::network() const {
   return network_;
 }
 
+f64 Router::portCongestionStatus(u32 _inputPort, u32 _inputVc,
+                                 u32 _outputPort,
+                                 CongestionSensor::Aggregate _aggregate) const {
+  switch (_aggregate) {
+    case CongestionSensor::Aggregate::kAverage:
+      return averagePortCongestion(this, _inputPort, _inputVc, _outputPort);
+    case CongestionSensor::Aggregate::kMinimum:
+      return minimumPortCongestion(this, _inputPort, _inputVc, _outputPort);
+    case CongestionSensor::Aggregate::kMaximum:
+      return maximumPortCongestion(this, _inputPort, _inputVc, _outputPort);
+    default:
+      assert(false);
+  }
+}
+
 void Router::packetArrival(u32 _port, Packet* _packet) const {
   metadataHandler_->packetRouterArrival(this, _port, _packet);
 }
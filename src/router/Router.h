@@ -20,6 +20,7 @@
 #include <vector>
 
 #include "architecture/PortedDevice.h"
+#include "congestion/CongestionSensor.h"
 #include "event/Component.h"
 #include "metadata/MetadataHandler.h"
 #include "nlohmann/json.hpp"
@@ -33,7 +34,7 @@ class Network;
 
 #define ROUTER_ARGS                                    \
   const std::string&, const Component*, Network*, u32, \
-      const std::vector<u32>&, u32, u32, MetadataHandler*, nlohmann::json
+      const std::vector<u32>&, u32, u32, MetadataHandler*, const nlohmann::json&
 
 class Router : public Component,
                public PortedDevice,
@@ -44,7 +45,7 @@ class Router : public Component,
  public:
   Router(const std::string& _name, const Component* _parent, Network* _network,
          u32 _id, const std::vector<u32>& _address, u32 _numPorts, u32 _numVcs,
-         MetadataHandler* _metadataHandler, nlohmann::json _settings);
+         MetadataHandler* _metadataHandler, const nlohmann::json& _settings);
   virtual ~Router();
 
   // this is a router factory
@@ -64,6 +65,12 @@ class Router : public Component,
   virtual f64 congestionStatus(u32 _inputPort, u32 _inputVc, u32 _outputPort,
                                u32 _outputVc) const = 0;
 
+  // this combines congestionStatus() of all VCs of an output port
+  //  the default implementation visits every VC
+  virtual f64 portCongestionStatus(
+      u32 _inputPort, u32 _inputVc, u32 _outputPort,
+      CongestionSensor::Aggregate _aggregate) const;
+
  protected:
   Network* network_;
 
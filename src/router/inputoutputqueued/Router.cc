@@ -15,7 +15,6 @@
 #include "router/inputoutputqueued/Router.h"
 
 #include <cassert>
-#include <cmath>
 
 #include "architecture/util.h"
 #include "congestion/CongestionSensor.h"
@@ -30,16 +29,11 @@ namespace InputOutputQueued {
 Router::Router(const std::string& _name, const Component* _parent,
                Network* _network, u32 _id, const std::vector<u32>& _address,
                u32 _numPorts, u32 _numVcs, MetadataHandler* _metadataHandler,
-               nlohmann::json _settings)
+               const nlohmann::json& _settings)
     : ::Router(_name, _parent, _network, _id, _address, _numPorts, _numVcs,
                _metadataHandler, _settings),
       congestionMode_(parseCongestionMode(
           _settings["congestion_mode"].get<std::string>())) {
-  // determine the size of credits
-  creditSize_ =
-      numVcs_ * (u32)std::ceil((f64)gSim->cycleTime(Simulator::Clock::CHANNEL) /
-                               (f64)gSim->cycleTime(Simulator::Clock::ROUTER));
-
   // queue depths
   outputQueueDepth_ = _settings["output_queue_depth"].get<u32>();
   assert(outputQueueDepth_ > 0);
@@ -324,7 +318,6 @@ void Router::receiveCredit(u32 _port, Credit* _credit) {
       congestionSensor_->incrementCredit(vcIdx);
     }
   }
-  delete _credit;
 }
 
 void Router::sendCredit(u32 _port, u32 _vc) {
@@ -332,8 +325,7 @@ void Router::sendCredit(u32 _port, u32 _vc) {
   assert(_vc < numVcs_);
   Credit* credit = inputChannels_.at(_port)->getNextCredit();
   if (credit == nullptr) {
-    credit = new Credit(creditSize_);
-    inputChannels_.at(_port)->setNextCredit(credit);
+    credit = inputChannels_.at(_port)->setNextCredit();
   }
 
   // mark the credit with the specified VC
@@ -356,6 +348,13 @@ f64 Router::congestionStatus(u32 _inputPort, u32 _inputVc, u32 _outputPort,
                                    _outputVc);
 }
 
+f64 Router::portCongestionStatus(u32 _inputPort, u32 _inputVc,
+                                 u32 _outputPort,
+                                 CongestionSensor::Aggregate _aggregate) const {
+  return congestionSensor_->portStatus(_inputPort, _inputVc, _outputPort,
+                                       _aggregate);
+}
+
 Router::CongestionMode Router::parseCongestionMode(const std::string& _mode) {
   if (_mode == "output") {
     return Router::CongestionMode::kOutput;
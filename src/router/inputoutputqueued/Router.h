@@ -44,7 +44,7 @@ class Router : public ::Router {
  public:
   Router(const std::string& _name, const Component* _parent, Network* _network,
          u32 _id, const std::vector<u32>& _address, u32 _numPorts, u32 _numVcs,
-         MetadataHandler* _metadataHandler, nlohmann::json _settings);
+         MetadataHandler* _metadataHandler, const nlohmann::json& _settings);
   ~Router();
 
   // Network
@@ -64,6 +64,9 @@ class Router : public ::Router {
 
   f64 congestionStatus(u32 _inputPort, u32 _inputVc, u32 _outputPort,
                        u32 _outputVc) const override;
+  f64 portCongestionStatus(
+      u32 _inputPort, u32 _inputVc, u32 _outputPort,
+      CongestionSensor::Aggregate _aggregate) const override;
 
  private:
   enum class CongestionMode { kOutput, kDownstream, kOutputAndDownstream };
@@ -72,7 +75,6 @@ class Router : public ::Router {
 
   const CongestionMode congestionMode_;
 
-  u32 creditSize_;
   u32 inputQueueDepth_;
   u32 outputQueueDepth_;
   // input queue tailoring
@@ -21,10 +21,6 @@
 #include "router/inputqueued/Router.h"
 #include "types/Packet.h"
 
-// event types
-#define INJECTED_FLIT (0x33)
-#define PROCESS_PIPELINE (0xB7)
-
 namespace InputQueued {
 
 InputQueue::InputQueue(const std::string& _name, const Component* _parent,
@@ -34,7 +30,8 @@ InputQueue::InputQueue(const std::string& _name, const Component* _parent,
                        VcScheduler* _vcScheduler, u32 _vcSchedulerIndex,
                        CrossbarScheduler* _crossbarScheduler,
                        u32 _crossbarSchedulerIndex, Crossbar* _crossbar,
-                       u32 _crossbarIndex, CreditWatcher* _creditWatcher)
+                       u32 _crossbarIndex, CreditWatcher* _creditWatcher,
+                       bool _routerTick)
     : Component(_name, _parent),
       depth_(0),
       port_(_port),
@@ -42,6 +39,7 @@ InputQueue::InputQueue(const std::string& _name, const Component* _parent,
       vc_(_vc),
       vcaSwaWait_(_vcaSwaWait),
       storeAndForward_(_storeAndForward),
+      routerTick_(_routerTick),
       router_(_router),
       routingAlgorithm_(_routingAlgorithm),
       vcScheduler_(_vcScheduler),
@@ -106,25 +104,8 @@ void InputQueue::receiveFlit(u32 _port, Flit* _flit) {
   if (gSim->isCycle(Simulator::Clock::ROUTER)) {
     setPipelineEvent();
   } else {
-    addEvent(gSim->futureCycle(Simulator::Clock::ROUTER, 1), 1, nullptr,
-             INJECTED_FLIT);
-  }
-}
-
-void InputQueue::processEvent(void* _event, s32 _type) {
-  switch (_type) {
-    case (INJECTED_FLIT):
-      assert(gSim->epsilon() == 1);
-      setPipelineEvent();
-      break;
-
-    case (PROCESS_PIPELINE):
-      assert(gSim->epsilon() == 2);
-      processPipeline();
-      break;
-
-    default:
-      assert(false);
+    addEvent<&InputQueue::setPipelineEvent>(
+        gSim->futureCycle(Simulator::Clock::ROUTER, 1), 1, nullptr);
   }
 }
 
@@ -180,11 +161,21 @@ void InputQueue::crossbarSchedulerResponse(u32 _port, u32 _vcIdx) {
 void InputQueue::setPipelineEvent() {
   if (eventTime_ == U64_MAX) {
     eventTime_ = gSim->time();
-    addEvent(gSim->time(), 2, nullptr, PROCESS_PIPELINE);
+    schedulePipeline(eventTime_);
+  }
+}
+
+void InputQueue::schedulePipeline(u64 _time) {
+  if (routerTick_) {
+    router_->tickInputQueue(port_, vc_, _time);
+  } else {
+    addEvent<&InputQueue::processPipeline>(_time, 2, nullptr);
   }
 }
 
 void InputQueue::processPipeline() {
+  assert(gSim->epsilon() == 2);
+
   // make sure the pipeline is being processed on clock cycle boundaries
   assert(gSim->time() % gSim->cycleTime(Simulator::Clock::ROUTER) == 0);
 
@@ -399,7 +390,7 @@ void InputQueue::processPipeline() {
       (buffer_.size() > 0)) {                         // more flits in buffer
     // set a pipeline event for the next cycle
     eventTime_ = gSim->futureCycle(Simulator::Clock::ROUTER, 1);
-    addEvent(eventTime_, 2, nullptr, PROCESS_PIPELINE);
+    schedulePipeline(eventTime_);
   }
 }
 
@@ -15,7 +15,6 @@
 #ifndef ROUTER_INPUTQUEUED_INPUTQUEUE_H_
 #define ROUTER_INPUTQUEUED_INPUTQUEUE_H_
 
-#include <queue>
 #include <string>
 #include <vector>
 
@@ -28,6 +27,7 @@
 #include "routing/RoutingAlgorithm.h"
 #include "types/Flit.h"
 #include "types/FlitReceiver.h"
+#include "util/CircularQueue.h"
 
 namespace InputQueued {
 
@@ -45,7 +45,8 @@ class InputQueue : public Component,
              RoutingAlgorithm* _routingAlgorithm, VcScheduler* _vcScheduler,
              u32 _vcSchedulerIndex, CrossbarScheduler* _crossbarScheduler,
              u32 _crossbarSchedulerIndex, Crossbar* _crossbar,
-             u32 _crossbarIndex, CreditWatcher* _creditWatcher);
+             u32 _crossbarIndex, CreditWatcher* _creditWatcher,
+             bool _routerTick);
   ~InputQueue();
 
   // set input queue depth (tailor mode)
@@ -54,9 +55,6 @@ class InputQueue : public Component,
   // called by next higher router (FlitReceiver)
   void receiveFlit(u32 _port, Flit* _flit) override;
 
-  // event system (Component)
-  void processEvent(void* _event, s32 _type) override;
-
   // response from routing algorithm
   void routingAlgorithmResponse(RoutingAlgorithm::Response* _response) override;
 
@@ -66,9 +64,12 @@ class InputQueue : public Component,
   // response from CrossbarScheduler
   void crossbarSchedulerResponse(u32 _port, u32 _vcIdx) override;
 
+  // advances the pipeline one cycle, called by the router when it ticks
+  void processPipeline();
+
  private:
   void setPipelineEvent();
-  void processPipeline();
+  void schedulePipeline(u64 _time);
 
   // attributes
   u32 depth_;
@@ -79,6 +80,7 @@ class InputQueue : public Component,
   // settings
   const bool vcaSwaWait_;  // stall VCA until SWA is empty
   const bool storeAndForward_;
+  const bool routerTick_;  // the router processes the pipeline, not events
 
   // external devices
   Router* router_;
@@ -108,7 +110,7 @@ class InputQueue : public Component,
   // The following variables represent the pipeline registers
 
   // buffer
-  std::queue<Flit*> buffer_;
+  CircularQueue<Flit*> buffer_;
 
   // routing algorithm execution [rfe_] pipeline stage
   struct {
@@ -15,7 +15,6 @@
 #ifndef ROUTER_INPUTQUEUED_OUTPUTQUEUE_H_
 #define ROUTER_INPUTQUEUED_OUTPUTQUEUE_H_
 
-#include <queue>
 #include <string>
 #include <vector>
 
@@ -24,6 +23,7 @@
 #include "prim/prim.h"
 #include "types/Flit.h"
 #include "types/FlitReceiver.h"
+#include "util/CircularQueue.h"
 
 namespace InputQueued {
 
@@ -69,7 +69,7 @@ class OutputQueue : public Component, public FlitReceiver {
   u64 eventTime_;
 
   // buffer
-  std::queue<Flit*> buffer_;  // insertion time & inserted flit
+  CircularQueue<Flit*> buffer_;  // insertion time & inserted flit
 };
 
 }  // namespace InputQueued
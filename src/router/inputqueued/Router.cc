@@ -14,7 +14,9 @@
  */
 #include "router/inputqueued/Router.h"
 
+#include <algorithm>
 #include <cassert>
+#include <utility>
 
 #include "architecture/util.h"
 #include "congestion/CongestionSensor.h"
@@ -28,16 +30,11 @@ namespace InputQueued {
 Router::Router(const std::string& _name, const Component* _parent,
                Network* _network, u32 _id, const std::vector<u32>& _address,
                u32 _numPorts, u32 _numVcs, MetadataHandler* _metadataHandler,
-               nlohmann::json _settings)
+               const nlohmann::json& _settings)
     : ::Router(_name, _parent, _network, _id, _address, _numPorts, _numVcs,
                _metadataHandler, _settings),
       congestionMode_(parseCongestionMode(
           _settings["congestion_mode"].get<std::string>())) {
-  // determine the size of credits
-  creditSize_ =
-      numVcs_ * (u32)std::ceil((f64)gSim->cycleTime(Simulator::Clock::CHANNEL) /
-                               (f64)gSim->cycleTime(Simulator::Clock::ROUTER));
-
   // queue depths
   inputQueueDepth_ = 0;
   inputQueueTailored_ = false;
@@ -72,6 +69,19 @@ Router::Router(const std::string& _name, const Component* _parent,
   u32 outputQueueDepth = _settings["output_queue_depth"].get<u32>();
   assert(outputQueueDepth > 0);
 
+  // when enabled, the router processes all active input queue pipelines in
+  //  a single tick per cycle instead of one event per input queue
+  routerTick_ = false;
+  if (_settings.contains("router_tick") &&
+      !_settings["router_tick"].is_null()) {
+    routerTick_ = _settings["router_tick"].get<bool>();
+  }
+  tickTime_ = U64_MAX;
+  if (routerTick_) {
+    tickQueues_.reserve(numPorts_ * numVcs_);
+    tickWork_.reserve(numPorts_ * numVcs_);
+  }
+
   // create a congestion status device
   congestionSensor_ = CongestionSensor::create("CongestionSensor", this, this,
                                                _settings["congestion_sensor"]);
@@ -125,7 +135,7 @@ Router::Router(const std::string& _name, const Component* _parent,
       InputQueue* iq = new InputQueue(
           iqName, this, this, inputQueueDepth_, port, numVcs_, vc, vcaSwaWait,
           storeAndForward, rf, vcScheduler_, clientIndex, crossbarScheduler_,
-          clientIndex, crossbar_, clientIndex, congestionSensor_);
+          clientIndex, crossbar_, clientIndex, congestionSensor_, routerTick_);
       inputQueues_.at(vcIdx) = iq;
 
       // register the input queue with VC and crossbar schedulers
@@ -261,7 +271,6 @@ void Router::receiveCredit(u32 _port, Credit* _credit) {
       congestionSensor_->incrementCredit(vcIdx);
     }
   }
-  delete _credit;
 }
 
 void Router::sendCredit(u32 _port, u32 _vc) {
@@ -269,8 +278,7 @@ void Router::sendCredit(u32 _port, u32 _vc) {
   assert(_vc < numVcs_);
   Credit* credit = inputChannels_.at(_port)->getNextCredit();
   if (credit == nullptr) {
-    credit = new Credit(creditSize_);
-    inputChannels_.at(_port)->setNextCredit(credit);
+    credit = inputChannels_.at(_port)->setNextCredit();
   }
 
   // mark the credit with the specified VC
@@ -293,6 +301,41 @@ f64 Router::congestionStatus(u32 _inputPort, u32 _inputVc, u32 _outputPort,
                                    _outputVc);
 }
 
+f64 Router::portCongestionStatus(u32 _inputPort, u32 _inputVc,
+                                 u32 _outputPort,
+                                 CongestionSensor::Aggregate _aggregate) const {
+  return congestionSensor_->portStatus(_inputPort, _inputVc, _outputPort,
+                                       _aggregate);
+}
+
+void Router::tickInputQueue(u32 _port, u32 _vc, u64 _time) {
+  assert(routerTick_);
+  if (tickTime_ == U64_MAX) {
+    tickTime_ = _time;
+    addEvent<&Router::tick>(tickTime_, 2, nullptr);
+  }
+  // input queues only schedule their pipeline for the pending tick
+  assert(_time == tickTime_);
+  tickQueues_.push_back(vcIndex(_port, _vc));
+}
+
+void Router::tick() {
+  assert(gSim->epsilon() == 2);
+  assert(tickTime_ == gSim->time());
+
+  // input queues scheduling themselves during this tick are for the next
+  //  cycle, so start a new list
+  tickTime_ = U64_MAX;
+  std::swap(tickQueues_, tickWork_);
+
+  // process the pipelines in a fixed order
+  std::sort(tickWork_.begin(), tickWork_.end());
+  for (u32 vcIdx : tickWork_) {
+    inputQueues_.at(vcIdx)->processPipeline();
+  }
+  tickWork_.clear();
+}
+
 Router::CongestionMode Router::parseCongestionMode(const std::string& _mode) {
   if (_mode == "output") {
     return Router::CongestionMode::kOutput;
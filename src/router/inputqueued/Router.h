@@ -43,7 +43,7 @@ class Router : public ::Router {
  public:
   Router(const std::string& _name, const Component* _parent, Network* _network,
          u32 _id, const std::vector<u32>& _address, u32 _numPorts, u32 _numVcs,
-         MetadataHandler* _metadataHandler, nlohmann::json _settings);
+         MetadataHandler* _metadataHandler, const nlohmann::json& _settings);
   ~Router();
 
   // Network
@@ -63,14 +63,23 @@ class Router : public ::Router {
 
   f64 congestionStatus(u32 _inputPort, u32 _inputVc, u32 _outputPort,
                        u32 _outputVc) const override;
+  f64 portCongestionStatus(
+      u32 _inputPort, u32 _inputVc, u32 _outputPort,
+      CongestionSensor::Aggregate _aggregate) const override;
+
+  // in router tick mode, this marks an input queue to be processed in the
+  //  router's tick at time '_time'
+  void tickInputQueue(u32 _port, u32 _vc, u64 _time);
 
  private:
   enum class CongestionMode { kOutput, kDownstream };
 
   static CongestionMode parseCongestionMode(const std::string& _mode);
 
+  // processes all active input queues in router tick mode
+  void tick();
+
   const CongestionMode congestionMode_;
-  u32 creditSize_;
   u32 inputQueueDepth_;
   // input queue tailoring
   bool inputQueueTailored_;
@@ -88,6 +97,12 @@ class Router : public ::Router {
 
   std::vector<Channel*> inputChannels_;
   std::vector<Channel*> outputChannels_;
+
+  // router tick mode
+  bool routerTick_;
+  u64 tickTime_;  // U64_MAX when no tick is scheduled
+  std::vector<u32> tickQueues_;  // input queues to process in the next tick
+  std::vector<u32> tickWork_;    // input queues being processed in this tick
 };
 
 }  // namespace InputQueued
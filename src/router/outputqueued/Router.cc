@@ -15,7 +15,6 @@
 #include "router/outputqueued/Router.h"
 
 #include <cassert>
-#include <cmath>
 
 #include "architecture/util.h"
 #include "congestion/CongestionSensor.h"
@@ -34,7 +33,7 @@ namespace OutputQueued {
 Router::Router(const std::string& _name, const Component* _parent,
                Network* _network, u32 _id, const std::vector<u32>& _address,
                u32 _numPorts, u32 _numVcs, MetadataHandler* _metadataHandler,
-               nlohmann::json _settings)
+               const nlohmann::json& _settings)
     : ::Router(_name, _parent, _network, _id, _address, _numPorts, _numVcs,
                _metadataHandler, _settings),
       transferLatency_(_settings["transfer_latency"].get<u32>()),
@@ -43,11 +42,6 @@ Router::Router(const std::string& _name, const Component* _parent,
   assert(!_settings["transfer_latency"].is_null());
   assert(transferLatency_ > 0);
 
-  // determine the size of credits
-  creditSize_ =
-      numVcs_ * (u32)std::ceil((f64)gSim->cycleTime(Simulator::Clock::CHANNEL) /
-                               (f64)gSim->cycleTime(Simulator::Clock::ROUTER));
-
   // initialize the port VCs trackers
   portVcs_.resize(numPorts_, U32_MAX);
 
@@ -347,7 +341,6 @@ void Router::receiveCredit(u32 _port, Credit* _credit) {
       congestionSensor_->incrementCredit(vcIdx);
     }
   }
-  delete _credit;
 }
 
 void Router::sendCredit(u32 _port, u32 _vc) {
@@ -355,8 +348,7 @@ void Router::sendCredit(u32 _port, u32 _vc) {
   assert(_vc < numVcs_);
   Credit* credit = inputChannels_.at(_port)->getNextCredit();
   if (credit == nullptr) {
-    credit = new Credit(creditSize_);
-    inputChannels_.at(_port)->setNextCredit(credit);
+    credit = inputChannels_.at(_port)->setNextCredit();
   }
 
   // mark the credit with the specified VC
@@ -379,6 +371,13 @@ f64 Router::congestionStatus(u32 _inputPort, u32 _inputVc, u32 _outputPort,
                                    _outputVc);
 }
 
+f64 Router::portCongestionStatus(u32 _inputPort, u32 _inputVc,
+                                 u32 _outputPort,
+                                 CongestionSensor::Aggregate _aggregate) const {
+  return congestionSensor_->portStatus(_inputPort, _inputVc, _outputPort,
+                                       _aggregate);
+}
+
 void Router::registerPacket(u32 _inputPort, u32 _inputVc, Flit* _headFlit,
                             u32 _outputPort, u32 _outputVc) {
   assert(gSim->epsilon() == 0);
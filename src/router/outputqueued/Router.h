@@ -45,7 +45,7 @@ class Router : public ::Router {
  public:
   Router(const std::string& _name, const Component* _parent, Network* _network,
          u32 _id, const std::vector<u32>& _address, u32 _numPorts, u32 _numVcs,
-         MetadataHandler* _metadataHandler, nlohmann::json _settings);
+         MetadataHandler* _metadataHandler, const nlohmann::json& _settings);
   ~Router();
 
   // Network
@@ -65,6 +65,9 @@ class Router : public ::Router {
 
   f64 congestionStatus(u32 _inputPort, u32 _inputVc, u32 _outputPort,
                        u32 _outputVc) const override;
+  f64 portCongestionStatus(
+      u32 _inputPort, u32 _inputVc, u32 _outputPort,
+      CongestionSensor::Aggregate _aggregate) const override;
 
   // only called on epsilon 0 from IQ
   void registerPacket(u32 _inputPort, u32 _inputVc, Flit* _headFlit,
@@ -88,7 +91,6 @@ class Router : public ::Router {
 
   const u32 transferLatency_;
   const CongestionMode congestionMode_;
-  u32 creditSize_;
 
   u32 inputQueueDepth_;
   u32 outputQueueDepth_;  // U32_MAX for infinite
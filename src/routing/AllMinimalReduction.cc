@@ -21,18 +21,18 @@ AllMinimalReduction::AllMinimalReduction(const std::string& _name,
                                          const PortedDevice* _device,
                                          RoutingMode _mode,
                                          bool _ignoreDuplicates,
-                                         nlohmann::json _settings)
+                                         const nlohmann::json& _settings)
     : Reduction(_name, _parent, _device, _mode, _ignoreDuplicates, _settings) {}
 
 AllMinimalReduction::~AllMinimalReduction() {}
 
 void AllMinimalReduction::process(
     u32 _minHops,
-    const std::unordered_set<std::tuple<u32, u32, u32, f64>>& _minimal,
-    const std::unordered_set<std::tuple<u32, u32, u32, f64>>& _nonMinimal,
-    std::unordered_set<std::tuple<u32, u32>>* _outputs, bool* _allMinimal) {
+    const std::vector<std::tuple<u32, u32, u32, f64>>& _minimal,
+    const std::vector<std::tuple<u32, u32, u32, f64>>& _nonMinimal,
+    std::vector<std::tuple<u32, u32>>* _outputs, bool* _allMinimal) {
   for (const auto& t : _minimal) {
-    _outputs->insert(std::make_tuple(std::get<0>(t), std::get<1>(t)));
+    _outputs->emplace_back(std::get<0>(t), std::get<1>(t));
   }
   *_allMinimal = true;
 }
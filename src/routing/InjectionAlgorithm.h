@@ -29,7 +29,7 @@ class Interface;
 
 #define INJECTIONALGORITHM_ARGS                                    \
   const std::string&, const Component*, Interface*, u32, u32, u32, \
-      nlohmann::json
+      const nlohmann::json&
 
 class InjectionAlgorithm : public Component {
  public:
@@ -39,7 +39,7 @@ class InjectionAlgorithm : public Component {
    */
   InjectionAlgorithm(const std::string& _name, const Component* _parent,
                      Interface* _interface, u32 _baseVc, u32 _numVcs,
-                     u32 _inputPc, nlohmann::json _settings);
+                     u32 _inputPc, const nlohmann::json& _settings);
   virtual ~InjectionAlgorithm();
   u32 baseVc() const;
   u32 numVcs() const;
@@ -17,7 +17,7 @@
 
 #include <string>
 #include <tuple>
-#include <unordered_set>
+#include <vector>
 
 #include "event/Component.h"
 #include "nlohmann/json.hpp"
@@ -30,15 +30,14 @@ class LeastCongestedMinimalReduction : public Reduction {
                                  const Component* _parent,
                                  const PortedDevice* _device, RoutingMode _mode,
                                  bool _ignoreDuplicates,
-                                 nlohmann::json _settings);
+                                 const nlohmann::json& _settings);
   ~LeastCongestedMinimalReduction();
 
   void process(
       u32 _minHops,
-      const std::unordered_set<std::tuple<u32, u32, u32, f64>>& _minimal,
-      const std::unordered_set<std::tuple<u32, u32, u32, f64>>& _nonMinimal,
-      std::unordered_set<std::tuple<u32, u32>>* _outputs,
-      bool* _allMinimal) override;
+      const std::vector<std::tuple<u32, u32, u32, f64>>& _minimal,
+      const std::vector<std::tuple<u32, u32, u32, f64>>& _nonMinimal,
+      std::vector<std::tuple<u32, u32>>* _outputs, bool* _allMinimal) override;
 };
 
 #endif  // ROUTING_LEASTCONGESTEDMINIMALREDUCTION_H_
@@ -14,6 +14,7 @@
  */
 #include "routing/Reduction.h"
 
+#include <algorithm>
 #include <cassert>
 
 #include "event/Simulator.h"
@@ -21,22 +22,38 @@
 
 Reduction::Reduction(const std::string& _name, const Component* _parent,
                      const PortedDevice* _device, RoutingMode _mode,
-                     bool _ignoreDuplicates, nlohmann::json _settings)
+                     bool _ignoreDuplicates, const nlohmann::json& _settings)
     : Component(_name, _parent),
       device_(_device),
       mode_(_mode),
       maxOutputs_(_settings["max_outputs"].get<u32>()),
       ignoreDuplicates_(_ignoreDuplicates),
+      stamps_(_ignoreDuplicates ? nullptr : acquireStamps(_device)),
       start_(true) {
   // check inputs
   assert(!_settings["max_outputs"].is_null());
+
+  // the number of options is bounded by the number of distinct inputs
+  u32 maxOptions = device_->numPorts();
+  if (!routingModeIsPort(mode_)) {
+    maxOptions *= device_->numVcs();
+  }
+  minimal_.reserve(maxOptions);
+  nonMinimal_.reserve(maxOptions);
+  intermediate_.reserve(maxOptions);
+  outputs_.reserve(maxOptions);
 }
 
-Reduction::~Reduction() {}
+Reduction::~Reduction() {
+  if (stamps_) {
+    releaseStamps(device_);
+  }
+}
 
 Reduction* Reduction::create(const std::string& _name, const Component* _parent,
                              const PortedDevice* _device, RoutingMode _mode,
-                             bool _ignoreDuplicates, nlohmann::json _settings) {
+                             bool _ignoreDuplicates,
+                             const nlohmann::json& _settings) {
   // retrieve algorithm
   const std::string& algorithm = _settings["algorithm"].get<std::string>();
 
@@ -57,53 +74,62 @@ Reduction* Reduction::create(const std::string& _name, const Component* _parent,
 void Reduction::add(u32 _port, u32 _vcRc, u32 _hops, f64 _congestion) {
   // detect restart of state machine
   if (start_) {
-    check_.clear();
     minimal_.clear();
     nonMinimal_.clear();
     minHops_ = U32_MAX;
     intermediate_.clear();
     outputs_.clear();
     start_ = false;
+
+    // invalidate all stamps by advancing the generation
+    if (stamps_) {
+      stamps_->generation++;
+      if (stamps_->generation == 0) {
+        std::fill(stamps_->stamp.begin(), stamps_->stamp.end(), 0);
+        stamps_->generation = 1;
+      }
+    }
   }
 
   // check that this input hasn't already been specified
-  std::tuple<u32, u32> input;
   assert(_port < device_->numPorts());
-  if (routingModeIsPort(mode_)) {
-    input = std::make_tuple(_port, _hops);
-  } else {
-    assert(_vcRc < device_->numVcs());
-    input = std::make_tuple(device_->vcIndex(_port, _vcRc), _hops);
-  }
-  if (!ignoreDuplicates_) {
-    assert(check_.count(input) == 0);
+  if (stamps_) {
+    u32 index;
+    if (routingModeIsPort(mode_)) {
+      index = _port;
+    } else {
+      assert(_vcRc < device_->numVcs());
+      index = device_->vcIndex(_port, _vcRc);
+    }
+    if (stamps_->stamp[index] == stamps_->generation) {
+      // the same input with a different hop count is legal
+      assert(!isDuplicate(_port, _vcRc, _hops));
+    } else {
+      stamps_->stamp[index] = stamps_->generation;
+    }
   }
-  check_.insert(input);
 
   // keep track of the minimum hop entry
   if (_hops < minHops_) {
     // move old minimal to non-minimal
-    for (const auto& t : minimal_) {
-      nonMinimal_.insert(t);
-    }
+    nonMinimal_.insert(nonMinimal_.end(), minimal_.begin(), minimal_.end());
     minimal_.clear();
 
     // update new minimal value
     minHops_ = _hops;
 
     // insert the new minimal
-    minimal_.insert(std::make_tuple(_port, _vcRc, _hops, _congestion));
+    minimal_.emplace_back(_port, _vcRc, _hops, _congestion);
   } else if (_hops == minHops_) {
     // minimal route
-    minimal_.insert(std::make_tuple(_port, _vcRc, _hops, _congestion));
+    minimal_.emplace_back(_port, _vcRc, _hops, _congestion);
   } else {
     // non-minimal route
-    nonMinimal_.insert(std::make_tuple(_port, _vcRc, _hops, _congestion));
+    nonMinimal_.emplace_back(_port, _vcRc, _hops, _congestion);
   }
 }
 
-const std::unordered_set<std::tuple<u32, u32>>* Reduction::reduce(
-    bool* _allMinimal) {
+const std::vector<std::tuple<u32, u32>>* Reduction::reduce(bool* _allMinimal) {
   // handle state machine
   assert(!start_);
   start_ = true;
@@ -113,11 +139,22 @@ const std::unordered_set<std::tuple<u32, u32>>* Reduction::reduce(
   process(minHops_, minimal_, nonMinimal_, &intermediate_, &allMinimal_);
   assert(intermediate_.size() > 0);
 
-  // reduce the subclass' set to a maximum of 'maxOutputs_'
-  while ((intermediate_.size() > 0) &&
-         (maxOutputs_ == 0 || outputs_.size() < maxOutputs_)) {
-    // randomly pull element out
-    outputs_.insert(gSim->rnd.remove(&intermediate_));
+  // sort the subclass' outputs and remove duplicates
+  std::sort(intermediate_.begin(), intermediate_.end());
+  intermediate_.erase(std::unique(intermediate_.begin(), intermediate_.end()),
+                      intermediate_.end());
+
+  // reduce the subclass' outputs to a maximum of 'maxOutputs_'
+  if (maxOutputs_ == 0 || intermediate_.size() <= maxOutputs_) {
+    // all are used
+    outputs_.swap(intermediate_);
+  } else {
+    while (outputs_.size() < maxOutputs_) {
+      // randomly pull element out
+      u64 index = gSim->rnd.nextU64(0, intermediate_.size() - 1);
+      outputs_.push_back(intermediate_[index]);
+      intermediate_.erase(intermediate_.begin() + index);
+    }
   }
 
   // set the minimal flag
@@ -127,3 +164,46 @@ const std::unordered_set<std::tuple<u32, u32>>* Reduction::reduce(
 
   return &outputs_;
 }
+
+std::map<const PortedDevice*, Reduction::Stamps*>& Reduction::stampRegistry() {
+  static std::map<const PortedDevice*, Stamps*> stamps;
+  return stamps;
+}
+
+Reduction::Stamps* Reduction::acquireStamps(const PortedDevice* _device) {
+  Stamps*& stamps = stampRegistry()[_device];
+  if (stamps == nullptr) {
+    // one stamp per port or VC, covers both routing modes
+    stamps = new Stamps();
+    stamps->stamp.resize(_device->numPorts() * _device->numVcs(), 0);
+    stamps->generation = 0;
+    stamps->references = 0;
+  }
+  stamps->references++;
+  return stamps;
+}
+
+void Reduction::releaseStamps(const PortedDevice* _device) {
+  std::map<const PortedDevice*, Stamps*>::iterator it =
+      stampRegistry().find(_device);
+  assert(it != stampRegistry().end());
+  assert(it->second->references > 0);
+  it->second->references--;
+  if (it->second->references == 0) {
+    delete it->second;
+    stampRegistry().erase(it);
+  }
+}
+
+bool Reduction::isDuplicate(u32 _port, u32 _vcRc, u32 _hops) const {
+  bool isPort = routingModeIsPort(mode_);
+  for (const auto* options : {&minimal_, &nonMinimal_}) {
+    for (const auto& t : *options) {
+      if (std::get<0>(t) == _port && std::get<2>(t) == _hops &&
+          (isPort || std::get<1>(t) == _vcRc)) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
@@ -15,12 +15,12 @@
 #ifndef ROUTING_REDUCTION_H_
 #define ROUTING_REDUCTION_H_
 
+#include <map>
 #include <string>
 #include <tuple>
-#include <unordered_set>
+#include <vector>
 
 #include "architecture/PortedDevice.h"
-#include "colhash/tuplehash.h"
 #include "event/Component.h"
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
@@ -28,13 +28,13 @@
 
 #define REDUCTION_ARGS                                                    \
   const std::string&, const Component*, const PortedDevice*, RoutingMode, \
-      bool, nlohmann::json
+      bool, const nlohmann::json&
 
 class Reduction : public Component {
  public:
   Reduction(const std::string& _name, const Component* _parent,
             const PortedDevice* _device, RoutingMode _mode,
-            bool _ignoreDuplicates, nlohmann::json _settings);
+            bool _ignoreDuplicates, const nlohmann::json& _settings);
   virtual ~Reduction();
 
   // this is a reduction factory
@@ -48,18 +48,19 @@ class Reduction : public Component {
   // compute the results
   //  'allMinimal' can be nullptr if the user doesn't care. The flag indicates
   //  if any routes are non-minimal
-  const std::unordered_set<std::tuple<u32, u32>>* reduce(bool* _allMinimal);
+  //  the returned outputs are unique
+  const std::vector<std::tuple<u32, u32>>* reduce(bool* _allMinimal);
 
  protected:
   // subclasses must implement this function
   //  _inputs  = {port, vcRc, hops, congestion}
   //  _outputs = {port, vcRc}
+  //  _outputs may contain duplicates, they are removed by reduce()
   virtual void process(
       u32 _minHops,
-      const std::unordered_set<std::tuple<u32, u32, u32, f64>>& _minimal,
-      const std::unordered_set<std::tuple<u32, u32, u32, f64>>& _nonMinimal,
-      std::unordered_set<std::tuple<u32, u32>>* _outputs,
-      bool* _allMinimal) = 0;
+      const std::vector<std::tuple<u32, u32, u32, f64>>& _minimal,
+      const std::vector<std::tuple<u32, u32, u32, f64>>& _nonMinimal,
+      std::vector<std::tuple<u32, u32>>* _outputs, bool* _allMinimal) = 0;
 
  private:
   const PortedDevice* device_;
@@ -67,13 +68,25 @@ class Reduction : public Component {
   const u32 maxOutputs_;
   const bool ignoreDuplicates_;
 
+  // duplicate detection stamps, shared by all reductions of a device
+  struct Stamps {
+    std::vector<u32> stamp;
+    u32 generation;
+    u32 references;
+  };
+  static std::map<const PortedDevice*, Stamps*>& stampRegistry();
+  static Stamps* acquireStamps(const PortedDevice* _device);
+  static void releaseStamps(const PortedDevice* _device);
+  bool isDuplicate(u32 _port, u32 _vcRc, u32 _hops) const;
+
+  Stamps* stamps_;
+
   bool start_;
-  std::unordered_set<std::tuple<u32, u32>> check_;
-  std::unordered_set<std::tuple<u32, u32, u32, f64>> minimal_;
-  std::unordered_set<std::tuple<u32, u32, u32, f64>> nonMinimal_;
+  std::vector<std::tuple<u32, u32, u32, f64>> minimal_;
+  std::vector<std::tuple<u32, u32, u32, f64>> nonMinimal_;
   u32 minHops_;
-  std::unordered_set<std::tuple<u32, u32>> intermediate_;
-  std::unordered_set<std::tuple<u32, u32>> outputs_;
+  std::vector<std::tuple<u32, u32>> intermediate_;
+  std::vector<std::tuple<u32, u32>> outputs_;
   bool allMinimal_;
 };
 
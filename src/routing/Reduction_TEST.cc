@@ -0,0 +1,263 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "routing/Reduction.h"
+
+#include <cassert>
+#include <chrono>
+#include <set>
+#include <tuple>
+#include <unordered_set>
+#include <vector>
+
+#include "architecture/PortedDevice_TESTLIB.h"
+#include "colhash/tuplehash.h"
+#include "event/Simulator.h"
+#include "gtest/gtest.h"
+#include "nlohmann/json.hpp"
+#include "routing/AllMinimalReduction.h"
+#include "test/TestSetup_TESTLIB.h"
+
+static std::set<std::tuple<u32, u32>> toSet(
+    const std::vector<std::tuple<u32, u32>>& _outputs) {
+  return std::set<std::tuple<u32, u32>>(_outputs.begin(), _outputs.end());
+}
+
+TEST(Reduction, unique) {
+  TestSetup ts(1, 1, 1, 1, 12345);
+  TestPortedDevice dev(4, 6);
+  nlohmann::json settings;
+  settings["max_outputs"] = 0;
+
+  {
+    // the same port with different hops is not a duplicate
+    AllMinimalReduction red("Reduction", nullptr, &dev, RoutingMode::kPortAve,
+                            false, settings);
+    for (u32 round = 0; round < 3; round++) {
+      red.add(2, 0, 3, 0.5);
+      red.add(1, 0, 4, 0.1);
+      red.add(2, 0, 5, 0.2);
+      red.add(1, 1, 3, 0.3);
+
+      bool allMin;
+      const auto* o = red.reduce(&allMin);
+      ASSERT_TRUE(allMin);
+      std::vector<std::tuple<u32, u32>> exp = {std::make_tuple(1u, 1u),
+                                               std::make_tuple(2u, 0u)};
+      ASSERT_EQ(*o, exp);
+    }
+  }
+
+  {
+    // exact duplicates are allowed when ignored
+    AllMinimalReduction red("Reduction", nullptr, &dev, RoutingMode::kVc, true,
+                            settings);
+    red.add(3, 5, 2, 0.5);
+    red.add(3, 5, 2, 0.5);
+    red.add(0, 2, 2, 0.5);
+    red.add(3, 5, 2, 0.5);
+
+    const auto* o = red.reduce(nullptr);
+    std::vector<std::tuple<u32, u32>> exp = {std::make_tuple(0u, 2u),
+                                             std::make_tuple(3u, 5u)};
+    ASSERT_EQ(*o, exp);
+  }
+}
+
+TEST(Reduction, maxOutputs) {
+  TestSetup ts(1, 1, 1, 1, 12345);
+  TestPortedDevice dev(8, 2);
+  nlohmann::json settings;
+  settings["max_outputs"] = 3;
+  AllMinimalReduction red("Reduction", nullptr, &dev, RoutingMode::kVc, false,
+                          settings);
+
+  std::vector<u32> counts(dev.numPorts() * dev.numVcs(), 0);
+  for (u32 round = 0; round < 10000; round++) {
+    for (u32 port = 0; port < dev.numPorts(); port++) {
+      for (u32 vc = 0; vc < dev.numVcs(); vc++) {
+        red.add(port, vc, 1, 0.0);
+      }
+    }
+    const auto* o = red.reduce(nullptr);
+    ASSERT_EQ(o->size(), 3u);
+    ASSERT_EQ(toSet(*o).size(), 3u);
+    for (const auto& t : *o) {
+      counts.at(dev.vcIndex(std::get<0>(t), std::get<1>(t)))++;
+    }
+  }
+
+  // all options are chosen uniformly
+  for (u32 count : counts) {
+    ASSERT_NEAR(count, 10000 * 3 / counts.size(), 200);
+  }
+}
+
+/* Reduction benchmark */
+
+// this is the former hash set based all minimal reduction, kept as a reference
+class HashedAllMinimalReduction {
+ public:
+  HashedAllMinimalReduction(const PortedDevice* _device, u32 _maxOutputs)
+      : device_(_device), maxOutputs_(_maxOutputs), start_(true) {}
+
+  void add(u32 _port, u32 _vc, u32 _hops, f64 _congestion) {
+    if (start_) {
+      check_.clear();
+      minimal_.clear();
+      nonMinimal_.clear();
+      minHops_ = U32_MAX;
+      intermediate_.clear();
+      outputs_.clear();
+      start_ = false;
+    }
+
+    std::tuple<u32, u32> input =
+        std::make_tuple(device_->vcIndex(_port, _vc), _hops);
+    assert(check_.count(input) == 0);
+    check_.insert(input);
+
+    if (_hops < minHops_) {
+      for (const auto& t : minimal_) {
+        nonMinimal_.insert(t);
+      }
+      minimal_.clear();
+      minHops_ = _hops;
+      minimal_.insert(std::make_tuple(_port, _vc, _hops, _congestion));
+    } else if (_hops == minHops_) {
+      minimal_.insert(std::make_tuple(_port, _vc, _hops, _congestion));
+    } else {
+      nonMinimal_.insert(std::make_tuple(_port, _vc, _hops, _congestion));
+    }
+  }
+
+  const std::unordered_set<std::tuple<u32, u32>>* reduce() {
+    start_ = true;
+    for (const auto& t : minimal_) {
+      intermediate_.insert(std::make_tuple(std::get<0>(t), std::get<1>(t)));
+    }
+    while ((intermediate_.size() > 0) &&
+           (maxOutputs_ == 0 || outputs_.size() < maxOutputs_)) {
+      outputs_.insert(gSim->rnd.remove(&intermediate_));
+    }
+    return &outputs_;
+  }
+
+ private:
+  const PortedDevice* device_;
+  const u32 maxOutputs_;
+  bool start_;
+  std::unordered_set<std::tuple<u32, u32>> check_;
+  std::unordered_set<std::tuple<u32, u32, u32, f64>> minimal_;
+  std::unordered_set<std::tuple<u32, u32, u32, f64>> nonMinimal_;
+  u32 minHops_;
+  std::unordered_set<std::tuple<u32, u32>> intermediate_;
+  std::unordered_set<std::tuple<u32, u32>> outputs_;
+};
+
+// a radix 32 router with 4 VCs, each decision sees every VC of 8 ports
+static const u32 kBenchPorts = 32;
+static const u32 kBenchVcs = 4;
+static const u32 kBenchOptions = 8;
+static const u32 kBenchPerRound = kBenchOptions * kBenchVcs;
+
+// this precomputes the options of each decision, half of them are minimal
+static std::vector<std::tuple<u32, u32, u32, f64>> benchOptions(u32 _rounds) {
+  std::vector<std::tuple<u32, u32, u32, f64>> options;
+  for (u32 round = 0; round < _rounds; round++) {
+    for (u32 option = 0; option < kBenchOptions; option++) {
+      u32 port = (round + option * 5) % kBenchPorts;
+      for (u32 vc = 0; vc < kBenchVcs; vc++) {
+        options.push_back(std::make_tuple(port, vc, 2 + option % 2,
+                                          gSim->rnd.nextF64()));
+      }
+    }
+  }
+  return options;
+}
+
+TEST(Reduction, hashedEquivalence) {
+  const u32 rounds = 1000;
+
+  TestSetup ts(1, 1, 1, 1, 12345);
+  TestPortedDevice dev(kBenchPorts, kBenchVcs);
+  nlohmann::json settings;
+  settings["max_outputs"] = 0;
+  AllMinimalReduction flat("Reduction", nullptr, &dev, RoutingMode::kVc, false,
+                           settings);
+  HashedAllMinimalReduction hashed(&dev, 0);
+  std::vector<std::tuple<u32, u32, u32, f64>> options = benchOptions(rounds);
+
+  // both implementations produce the same outputs
+  for (u32 round = 0; round < rounds; round++) {
+    for (u32 i = round * kBenchPerRound; i < (round + 1) * kBenchPerRound;
+         i++) {
+      const auto& t = options.at(i);
+      flat.add(std::get<0>(t), std::get<1>(t), std::get<2>(t), std::get<3>(t));
+      hashed.add(std::get<0>(t), std::get<1>(t), std::get<2>(t),
+                 std::get<3>(t));
+    }
+    const auto* fo = flat.reduce(nullptr);
+    const auto* ho = hashed.reduce();
+    std::set<std::tuple<u32, u32>> hs(ho->begin(), ho->end());
+    ASSERT_EQ(toSet(*fo), hs);
+  }
+}
+
+// run with --gtest_also_run_disabled_tests to compare the implementations
+TEST(Reduction, DISABLED_benchmark) {
+  const u32 rounds = 20000;
+
+  TestSetup ts(1, 1, 1, 1, 12345);
+  TestPortedDevice dev(kBenchPorts, kBenchVcs);
+  nlohmann::json settings;
+  settings["max_outputs"] = 0;
+  AllMinimalReduction flat("Reduction", nullptr, &dev, RoutingMode::kVc, false,
+                           settings);
+  HashedAllMinimalReduction hashed(&dev, 0);
+  std::vector<std::tuple<u32, u32, u32, f64>> options = benchOptions(rounds);
+
+  u64 flatTotal = 0;
+  auto flatStart = std::chrono::steady_clock::now();
+  for (u32 round = 0; round < rounds; round++) {
+    for (u32 i = round * kBenchPerRound; i < (round + 1) * kBenchPerRound;
+         i++) {
+      const auto& t = options[i];
+      flat.add(std::get<0>(t), std::get<1>(t), std::get<2>(t), std::get<3>(t));
+    }
+    flatTotal += flat.reduce(nullptr)->size();
+  }
+  auto flatEnd = std::chrono::steady_clock::now();
+
+  u64 hashedTotal = 0;
+  auto hashedStart = std::chrono::steady_clock::now();
+  for (u32 round = 0; round < rounds; round++) {
+    for (u32 i = round * kBenchPerRound; i < (round + 1) * kBenchPerRound;
+         i++) {
+      const auto& t = options[i];
+      hashed.add(std::get<0>(t), std::get<1>(t), std::get<2>(t),
+                 std::get<3>(t));
+    }
+    hashedTotal += hashed.reduce()->size();
+  }
+  auto hashedEnd = std::chrono::steady_clock::now();
+  ASSERT_EQ(flatTotal, hashedTotal);
+
+  f64 flatNs = std::chrono::duration<f64, std::nano>(
+      flatEnd - flatStart).count() / rounds;
+  f64 hashedNs = std::chrono::duration<f64, std::nano>(
+      hashedEnd - hashedStart).count() / rounds;
+  printf("ns per reduction: flat %.1f, hashed %.1f, speedup %.2fx\n", flatNs,
+         hashedNs, hashedNs / flatNs);
+}
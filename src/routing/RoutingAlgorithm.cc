@@ -15,6 +15,7 @@
 #include "routing/RoutingAlgorithm.h"
 
 #include <cassert>
+#include <utility>
 
 #include "event/Simulator.h"
 #include "router/Router.h"
@@ -56,26 +57,89 @@ RoutingAlgorithm::Client::Client() {}
 
 RoutingAlgorithm::Client::~Client() {}
 
+/* RoutingAlgorithm::Batch class */
+
+class RoutingAlgorithm::Batch : public Component {
+ public:
+  Batch(const std::string& _name, const Component* _parent)
+      : Component(_name, _parent), time_(U64_MAX) {}
+
+  ~Batch() {}
+
+  // adds a request of '_algorithm' to be responded to at '_time'
+  void add(RoutingAlgorithm* _algorithm, u64 _time) {
+    if (time_ == U64_MAX) {
+      time_ = _time;
+      addEvent<&Batch::respond>(time_, 0, nullptr);
+    }
+    // all requests of a cycle are responded to in the next cycle
+    assert(_time == time_);
+    pending_.push_back(_algorithm);
+  }
+
+ private:
+  void respond() {
+    assert(time_ == gSim->time());
+
+    // requests made during the responses are for the next cycle
+    time_ = U64_MAX;
+    std::swap(pending_, work_);
+
+    // respond in request order
+    for (RoutingAlgorithm* algorithm : work_) {
+      algorithm->respond();
+    }
+    work_.clear();
+  }
+
+  u64 time_;  // U64_MAX when no response event is scheduled
+  std::vector<RoutingAlgorithm*> pending_;
+  std::vector<RoutingAlgorithm*> work_;
+};
+
 /* RoutingAlgorithm class */
 
+SharedRegistry<const Router*, RoutingAlgorithm::Batch>
+    RoutingAlgorithm::batches_;
+
 RoutingAlgorithm::RoutingAlgorithm(const std::string& _name,
                                    const Component* _parent, Router* _router,
                                    u32 _baseVc, u32 _numVcs, u32 _inputPort,
-                                   u32 _inputVc, nlohmann::json _settings)
+                                   u32 _inputVc,
+                                   const nlohmann::json& _settings)
     : Component(_name, _parent),
       router_(_router),
       baseVc_(_baseVc),
       numVcs_(_numVcs),
       inputPort_(_inputPort),
       inputVc_(_inputVc),
-      latency_(_settings["latency"].get<u32>()) {
+      latency_(_settings["latency"].get<u32>()),
+      head_(0),
+      count_(0),
+      batch_(nullptr) {
   assert(router_ != nullptr);
   assert(latency_ > 0);
   assert(numVcs_ <= router_->numVcs());
   assert(baseVc_ <= router_->numVcs() - numVcs_);
+
+  // a client makes at most one request per cycle
+  requests_.resize(latency_);
+
+  // latency 1 requests share one response event per router cycle
+  if (latency_ == 1) {
+    batch_ = batches_.acquire(router_);
+    if (batch_ == nullptr) {
+      batch_ = new Batch("RoutingAlgorithmBatch", router_);
+      batches_.share(router_, batch_);
+    }
+  }
 }
 
-RoutingAlgorithm::~RoutingAlgorithm() {}
+RoutingAlgorithm::~RoutingAlgorithm() {
+  if (batch_ && batches_.release(router_)) {
+    delete batch_;
+  }
+}
 
 u32 RoutingAlgorithm::latency() const {
   return latency_;
@@ -99,19 +163,39 @@ u32 RoutingAlgorithm::inputVc() const {
 
 void RoutingAlgorithm::request(Client* _client, Flit* _flit,
                                Response* _response) {
+  // push the request into the ring
+  assert(count_ < requests_.size());
+  u32 tail = head_ + count_;
+  if (tail >= requests_.size()) {
+    tail -= requests_.size();
+  }
+  Request& req = requests_[tail];
+  req.client = _client;
+  req.flit = _flit;
+  req.response = _response;
+  count_++;
+
+  // schedule the response
   u64 respTime = gSim->futureCycle(Simulator::Clock::ROUTER, latency_);
-  EventPackage* evt = new EventPackage();
-  evt->client = _client;
-  evt->flit = _flit;
-  evt->response = _response;
-  addEvent(respTime, 0, evt, 0);
+  if (batch_) {
+    batch_->add(this, respTime);
+  } else {
+    addEvent<&RoutingAlgorithm::respond>(respTime, 0, nullptr);
+  }
 }
 
 void RoutingAlgorithm::vcScheduled(Flit* _flit, u32 _port, u32 _vc) {}
 
-void RoutingAlgorithm::processEvent(void* _event, s32 _type) {
-  EventPackage* evt = reinterpret_cast<EventPackage*>(_event);
-  processRequest(evt->flit, evt->response);
-  evt->client->routingAlgorithmResponse(evt->response);
-  delete evt;
+void RoutingAlgorithm::respond() {
+  // pop the oldest request, responses are in request order
+  assert(count_ > 0);
+  Request req = requests_[head_];
+  head_++;
+  if (head_ == requests_.size()) {
+    head_ = 0;
+  }
+  count_--;
+
+  processRequest(req.flit, req.response);
+  req.client->routingAlgorithmResponse(req.response);
 }
@@ -23,12 +23,13 @@
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
 #include "types/Flit.h"
+#include "util/SharedRegistry.h"
 
 class Router;
 
 #define ROUTINGALGORITHM_ARGS                                        \
   const std::string&, const Component*, Router*, u32, u32, u32, u32, \
-      nlohmann::json
+      const nlohmann::json&
 
 class RoutingAlgorithm : public Component {
  public:
@@ -74,7 +75,7 @@ class RoutingAlgorithm : public Component {
    */
   RoutingAlgorithm(const std::string& _name, const Component* _parent,
                    Router* _router, u32 _baseVc, u32 _numVcs, u32 _inputPort,
-                   u32 _inputVc, nlohmann::json _settings);
+                   u32 _inputVc, const nlohmann::json& _settings);
   virtual ~RoutingAlgorithm();
   u32 latency() const;
   u32 baseVc() const;
@@ -83,7 +84,6 @@ class RoutingAlgorithm : public Component {
   u32 inputVc() const;
   void request(Client* _client, Flit* _flit, Response* _response);
   virtual void vcScheduled(Flit* _flit, u32 _port, u32 _vc);
-  void processEvent(void* _event, s32 _type) override;
 
  protected:
   virtual void processRequest(Flit* _flit, Response* _response) = 0;
@@ -95,14 +95,27 @@ class RoutingAlgorithm : public Component {
   const u32 inputVc_;
 
  private:
-  class EventPackage {
-   public:
+  struct Request {
     Client* client;
     Flit* flit;
     Response* response;
   };
 
+  // this responds to the latency 1 requests of all algorithms of a router
+  class Batch;
+  static SharedRegistry<const Router*, Batch> batches_;
+
+  // this processes the oldest pending request and responds to its client
+  void respond();
+
   const u32 latency_;
+
+  // pending requests in order of response time, at most one per cycle
+  std::vector<Request> requests_;
+  u32 head_;
+  u32 count_;
+
+  Batch* batch_;  // used instead of events when latency is 1
 };
 
 #endif  // ROUTING_ROUTINGALGORITHM_H_
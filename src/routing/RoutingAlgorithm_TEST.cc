@@ -0,0 +1,134 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "routing/RoutingAlgorithm.h"
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "event/Simulator.h"
+#include "gtest/gtest.h"
+#include "nlohmann/json.hpp"
+#include "routing/RoutingAlgorithm_TESTLIB.h"
+#include "test/TestSetup_TESTLIB.h"
+
+namespace {
+
+// {time, algorithm id}
+typedef std::tuple<u64, u32> RequestRecord;
+
+class TestRoutingAlgorithm : public RoutingAlgorithm {
+ public:
+  TestRoutingAlgorithm(const std::string& _name, Router* _router, u32 _id,
+                       nlohmann::json _settings,
+                       std::vector<RequestRecord>* _log)
+      : RoutingAlgorithm(_name, nullptr, _router, 0, 1, 0, 0, _settings),
+        id_(_id),
+        log_(_log) {}
+
+ protected:
+  void processRequest(Flit* _flit, Response* _response) override {
+    log_->push_back(std::make_tuple(gSim->time(), id_));
+  }
+
+ private:
+  const u32 id_;
+  std::vector<RequestRecord>* log_;
+};
+
+class TestClient : public Component, public RoutingAlgorithm::Client {
+ public:
+  TestClient(const std::vector<TestRoutingAlgorithm*>& _algorithms,
+             u32 _requests)
+      : Component("TestClient", nullptr),
+        algorithms_(_algorithms),
+        requests_(_requests),
+        cycle_(0),
+        responses_(0) {
+    addEvent(0, 1, nullptr, 0);
+  }
+
+  void processEvent(void* _event, s32 _type) override {
+    // request after the responses of this cycle, in reverse order of the
+    //  algorithms
+    for (u32 a = algorithms_.size(); a > 0; a--) {
+      algorithms_.at(a - 1)->request(this, nullptr, &response_);
+    }
+    cycle_++;
+    if (cycle_ < requests_) {
+      addEvent(gSim->futureCycle(Simulator::Clock::ROUTER, 1), 1, nullptr, 0);
+    }
+  }
+
+  void routingAlgorithmResponse(
+      RoutingAlgorithm::Response* _response) override {
+    ASSERT_EQ(_response, &response_);
+    responses_++;
+  }
+
+  u32 responses() const {
+    return responses_;
+  }
+
+ private:
+  const std::vector<TestRoutingAlgorithm*> algorithms_;
+  const u32 requests_;
+  u32 cycle_;
+  u32 responses_;
+  RoutingAlgorithm::Response response_;
+};
+
+}  // namespace
+
+TEST(RoutingAlgorithm, latency) {
+  for (u32 latency : {1u, 2u, 5u}) {
+    TestSetup ts(1, 1, 1, 1, 12345);
+    RoutingAlgorithmTestRouter router("Router", 4, 1);
+    nlohmann::json settings;
+    settings["latency"] = latency;
+
+    std::vector<RequestRecord> log;
+    std::vector<TestRoutingAlgorithm*> algorithms;
+    for (u32 a = 0; a < 3; a++) {
+      algorithms.push_back(
+          new TestRoutingAlgorithm("RoutingAlgorithm_" + std::to_string(a),
+                                   &router, a, settings, &log));
+    }
+
+    // one request per cycle to each algorithm
+    const u32 requests = 10;
+    TestClient client(algorithms, requests);
+    gSim->initialize();
+    gSim->simulate();
+    ASSERT_EQ(client.responses(), requests * algorithms.size());
+
+    // every request is processed after exactly 'latency' cycles, batched
+    //  latency 1 requests are processed in the order they were made
+    ASSERT_EQ(log.size(), requests * algorithms.size());
+    for (u32 r = 0; r < requests; r++) {
+      for (u32 a = 0; a < algorithms.size(); a++) {
+        const RequestRecord& rec = log.at(r * algorithms.size() + a);
+        ASSERT_EQ(std::get<0>(rec), r + latency);
+        if (latency == 1) {
+          ASSERT_EQ(std::get<1>(rec), algorithms.size() - 1 - a);
+        }
+      }
+    }
+
+    for (TestRoutingAlgorithm* algorithm : algorithms) {
+      delete algorithm;
+    }
+  }
+}
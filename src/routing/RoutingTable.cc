@@ -0,0 +1,106 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "routing/RoutingTable.h"
+
+#include <cassert>
+
+namespace {
+
+// the default bound on the total size of all tables of an algorithm
+const u64 kDefaultBudget = 1llu << 30;
+
+}  // namespace
+
+SharedRegistry<RoutingTable::Key, RoutingTable> RoutingTable::tables_;
+
+RoutingTable::RoutingTable(u32 _numDestinations)
+    : numDestinations_(_numDestinations), key_(nullptr, "") {
+  info_.reserve(numDestinations_);
+  offsets_.reserve(numDestinations_ + 1);
+  offsets_.push_back(0);
+}
+
+RoutingTable::~RoutingTable() {}
+
+bool RoutingTable::enabled(const nlohmann::json& _settings, u32 _numRouters,
+                           u32 _numDestinations, u32 _maxPorts) {
+  if (!_settings.contains("table") || !_settings["table"].get<bool>()) {
+    return false;
+  }
+  u64 budget = kDefaultBudget;
+  if (_settings.contains("table_budget")) {
+    budget = _settings["table_budget"].get<u64>();
+  }
+
+  // info and offset words plus the worst case port lists
+  u64 perRouter = sizeof(u32) * ((u64)_numDestinations * (2 + _maxPorts) + 1);
+  return perRouter * _numRouters <= budget;
+}
+
+RoutingTable* RoutingTable::acquire(const Router* _router,
+                                    const std::string& _key) {
+  return tables_.acquire(Key(_router, _key));
+}
+
+void RoutingTable::share(const Router* _router, const std::string& _key,
+                         RoutingTable* _table) {
+  assert(_table->complete());
+  assert(std::get<0>(_table->key_) == nullptr);
+  _table->key_ = Key(_router, _key);
+  tables_.share(_table->key_, _table);
+}
+
+void RoutingTable::release(RoutingTable* _table) {
+  if (tables_.release(_table->key_)) {
+    delete _table;
+  }
+}
+
+void RoutingTable::addDestination(u32 _info) {
+  assert(info_.size() < numDestinations_);
+  info_.push_back(_info);
+  offsets_.push_back(ports_.size());
+}
+
+void RoutingTable::addPort(u32 _port) {
+  assert(!info_.empty());
+  ports_.push_back(_port);
+  offsets_.back()++;
+}
+
+bool RoutingTable::complete() const {
+  return info_.size() == numDestinations_;
+}
+
+u32 RoutingTable::numDestinations() const {
+  return numDestinations_;
+}
+
+u32 RoutingTable::info(u32 _destination) const {
+  return info_[_destination];
+}
+
+u32 RoutingTable::numPorts(u32 _destination) const {
+  return offsets_[_destination + 1] - offsets_[_destination];
+}
+
+const u32* RoutingTable::ports(u32 _destination) const {
+  return ports_.data() + offsets_[_destination];
+}
+
+u64 RoutingTable::bytes() const {
+  return sizeof(u32) * (info_.capacity() + offsets_.capacity() +
+                        ports_.capacity());
+}
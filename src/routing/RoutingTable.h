@@ -0,0 +1,76 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef ROUTING_ROUTINGTABLE_H_
+#define ROUTING_ROUTINGTABLE_H_
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "colhash/tuplehash.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+#include "util/SharedRegistry.h"
+
+class Router;
+
+/*
+ * This is a compact destination lookup table for deterministic routing
+ *  algorithms. Each destination router maps to an algorithm defined info word
+ *  and a contiguous list of candidate output ports. One table is built per
+ *  router and shared by all routing algorithm instances on that router.
+ */
+class RoutingTable {
+ public:
+  explicit RoutingTable(u32 _numDestinations);
+  ~RoutingTable();
+
+  // this determines if the settings enable a table with the given shape
+  //  "table" enables the table, "table_budget" bounds (in bytes) the total
+  //  size of all tables across '_numRouters' routers
+  static bool enabled(const nlohmann::json& _settings, u32 _numRouters,
+                      u32 _numDestinations, u32 _maxPorts);
+
+  // these share tables between the algorithm instances of a router
+  //  acquire() returns nullptr if no table has been shared under the key
+  static RoutingTable* acquire(const Router* _router, const std::string& _key);
+  static void share(const Router* _router, const std::string& _key,
+                    RoutingTable* _table);
+  static void release(RoutingTable* _table);
+
+  // destinations must be added in order, each followed by its ports
+  void addDestination(u32 _info);
+  void addPort(u32 _port);
+  bool complete() const;
+
+  u32 numDestinations() const;
+  u32 info(u32 _destination) const;
+  u32 numPorts(u32 _destination) const;
+  const u32* ports(u32 _destination) const;
+  u64 bytes() const;
+
+ private:
+  const u32 numDestinations_;
+  std::vector<u32> info_;
+  std::vector<u32> offsets_;
+  std::vector<u32> ports_;
+
+  // tables shared by router and algorithm key
+  typedef std::tuple<const Router*, std::string> Key;
+  static SharedRegistry<Key, RoutingTable> tables_;
+  Key key_;
+};
+
+#endif  // ROUTING_ROUTINGTABLE_H_
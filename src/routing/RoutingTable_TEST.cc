@@ -0,0 +1,81 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "routing/RoutingTable.h"
+
+#include "gtest/gtest.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+#include "routing/RoutingAlgorithm_TESTLIB.h"
+#include "test/TestSetup_TESTLIB.h"
+
+TEST(RoutingTable, build) {
+  RoutingTable table(4);
+  ASSERT_EQ(table.numDestinations(), 4u);
+  for (u32 dst = 0; dst < 4; dst++) {
+    ASSERT_FALSE(table.complete());
+    table.addDestination(dst * 10);
+    for (u32 port = 0; port < dst; port++) {
+      table.addPort(100 * dst + port);
+    }
+  }
+  ASSERT_TRUE(table.complete());
+
+  for (u32 dst = 0; dst < 4; dst++) {
+    ASSERT_EQ(table.info(dst), dst * 10);
+    ASSERT_EQ(table.numPorts(dst), dst);
+    const u32* ports = table.ports(dst);
+    for (u32 port = 0; port < dst; port++) {
+      ASSERT_EQ(ports[port], 100 * dst + port);
+    }
+  }
+  ASSERT_GE(table.bytes(), sizeof(u32) * (4 + 5 + 6));
+}
+
+TEST(RoutingTable, enabled) {
+  nlohmann::json settings;
+  ASSERT_FALSE(RoutingTable::enabled(settings, 16, 64, 2));
+  settings["table"] = false;
+  ASSERT_FALSE(RoutingTable::enabled(settings, 16, 64, 2));
+  settings["table"] = true;
+  ASSERT_TRUE(RoutingTable::enabled(settings, 16, 64, 2));
+
+  // 16 routers * 4 bytes * (64 * (2 + 2) + 1) = 16448 bytes
+  settings["table_budget"] = 16448;
+  ASSERT_TRUE(RoutingTable::enabled(settings, 16, 64, 2));
+  settings["table_budget"] = 16447;
+  ASSERT_FALSE(RoutingTable::enabled(settings, 16, 64, 2));
+}
+
+TEST(RoutingTable, share) {
+  TestSetup test(1, 1, 1, 1, 123);
+  RoutingAlgorithmTestRouter router0("Router0", 4, 2);
+  RoutingAlgorithmTestRouter router1("Router1", 4, 2);
+
+  ASSERT_EQ(RoutingTable::acquire(&router0, "a"), nullptr);
+  RoutingTable* table = new RoutingTable(1);
+  table->addDestination(0);
+  RoutingTable::share(&router0, "a", table);
+
+  ASSERT_EQ(RoutingTable::acquire(&router0, "a"), table);
+  ASSERT_EQ(RoutingTable::acquire(&router0, "b"), nullptr);
+  ASSERT_EQ(RoutingTable::acquire(&router1, "a"), nullptr);
+
+  // the table is removed with its last reference
+  RoutingTable::release(table);
+  ASSERT_EQ(RoutingTable::acquire(&router0, "a"), table);
+  RoutingTable::release(table);
+  RoutingTable::release(table);
+  ASSERT_EQ(RoutingTable::acquire(&router0, "a"), nullptr);
+}
@@ -24,7 +24,7 @@ WeightedReduction::WeightedReduction(const std::string& _name,
                                      const Component* _parent,
                                      const PortedDevice* _device,
                                      RoutingMode _mode, bool _ignoreDuplicates,
-                                     nlohmann::json _settings)
+                                     const nlohmann::json& _settings)
     : Reduction(_name, _parent, _device, _mode, _ignoreDuplicates, _settings),
       congestionBias_(_settings["congestion_bias"].get<f64>()),
       independentBias_(_settings["independent_bias"].get<f64>()),
@@ -40,9 +40,9 @@ WeightedReduction::~WeightedReduction() {}
 
 void WeightedReduction::process(
     u32 _minHops,
-    const std::unordered_set<std::tuple<u32, u32, u32, f64>>& _minimal,
-    const std::unordered_set<std::tuple<u32, u32, u32, f64>>& _nonMinimal,
-    std::unordered_set<std::tuple<u32, u32>>* _outputs, bool* _allMinimal) {
+    const std::vector<std::tuple<u32, u32, u32, f64>>& _minimal,
+    const std::vector<std::tuple<u32, u32, u32, f64>>& _nonMinimal,
+    std::vector<std::tuple<u32, u32>>* _outputs, bool* _allMinimal) {
   // find the minimally weighted options
   f64 minWeight = F64_MAX;
 
@@ -56,10 +56,10 @@ void WeightedReduction::process(
       minCongestion = std::get<3>(t);
       minWeight = weight;
       _outputs->clear();
-      _outputs->insert(std::make_tuple(std::get<0>(t), std::get<1>(t)));
+      _outputs->emplace_back(std::get<0>(t), std::get<1>(t));
     } else if (congestionEqualTo(weight, minWeight)) {
       // equal lowest weight
-      _outputs->insert(std::make_tuple(std::get<0>(t), std::get<1>(t)));
+      _outputs->emplace_back(std::get<0>(t), std::get<1>(t));
     }
   }
 
@@ -75,10 +75,10 @@ void WeightedReduction::process(
       nonMin = true;
       minWeight = weight;
       _outputs->clear();
-      _outputs->insert(std::make_tuple(std::get<0>(t), std::get<1>(t)));
+      _outputs->emplace_back(std::get<0>(t), std::get<1>(t));
     } else if (congestionEqualTo(weight, minWeight) && nonMin) {
       // equal lowest weight
-      _outputs->insert(std::make_tuple(std::get<0>(t), std::get<1>(t)));
+      _outputs->emplace_back(std::get<0>(t), std::get<1>(t));
     }
   }
 
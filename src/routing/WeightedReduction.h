@@ -17,7 +17,7 @@
 
 #include <string>
 #include <tuple>
-#include <unordered_set>
+#include <vector>
 
 #include "event/Component.h"
 #include "nlohmann/json.hpp"
@@ -29,15 +29,14 @@ class WeightedReduction : public Reduction {
  public:
   WeightedReduction(const std::string& _name, const Component* _parent,
                     const PortedDevice* _device, RoutingMode _mode,
-                    bool _ignoreDuplicates, nlohmann::json _settings);
+                    bool _ignoreDuplicates, const nlohmann::json& _settings);
   ~WeightedReduction();
 
   void process(
       u32 _minHops,
-      const std::unordered_set<std::tuple<u32, u32, u32, f64>>& _minimal,
-      const std::unordered_set<std::tuple<u32, u32, u32, f64>>& _nonMinimal,
-      std::unordered_set<std::tuple<u32, u32>>* _outputs,
-      bool* _allMinimal) override;
+      const std::vector<std::tuple<u32, u32, u32, f64>>& _minimal,
+      const std::vector<std::tuple<u32, u32, u32, f64>>& _nonMinimal,
+      std::vector<std::tuple<u32, u32>>* _outputs, bool* _allMinimal) override;
 
  private:
   f64 congestionBias_;
@@ -55,11 +55,17 @@ f64 portCongestion(RoutingMode _mode, const Router* _router, u32 _inputPort,
                    u32 _inputVc, u32 _outputPort) {
   switch (_mode) {
     case RoutingMode::kPortAve:
-      return averagePortCongestion(_router, _inputPort, _inputVc, _outputPort);
+      return _router->portCongestionStatus(
+          _inputPort, _inputVc, _outputPort,
+          CongestionSensor::Aggregate::kAverage);
     case RoutingMode::kPortMin:
-      return minimumPortCongestion(_router, _inputPort, _inputVc, _outputPort);
+      return _router->portCongestionStatus(
+          _inputPort, _inputVc, _outputPort,
+          CongestionSensor::Aggregate::kMinimum);
     case RoutingMode::kPortMax:
-      return maximumPortCongestion(_router, _inputPort, _inputVc, _outputPort);
+      return _router->portCongestionStatus(
+          _inputPort, _inputVc, _outputPort,
+          CongestionSensor::Aggregate::kMaximum);
     default:
       assert(false);
   }
@@ -0,0 +1,171 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "stats/AsyncOutFile.h"
+
+#include <cassert>
+#include <cinttypes>
+#include <cstdio>
+#include <utility>
+
+/* AsyncOutFile::Writer class */
+
+class AsyncOutFile::Writer {
+ public:
+  Writer() : references(0), done_(false) {
+    thread_ = std::thread(&Writer::run, this);
+  }
+
+  ~Writer() {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      done_ = true;
+    }
+    condition_.notify_all();
+    thread_.join();
+    assert(jobs_.empty());
+  }
+
+  // hands '_buffer' of '_file' to the writer thread, waits when the previous
+  //  buffer of '_file' is still being written
+  bool push(AsyncOutFile* _file, std::string* _buffer) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    bool stalled = _file->inFlight_;
+    condition_.wait(lock, [_file] { return !_file->inFlight_; });
+    _file->inFlight_ = true;
+    jobs_.push_back(std::make_pair(_file, _buffer));
+    lock.unlock();
+    condition_.notify_all();
+    return stalled;
+  }
+
+  // waits until no buffer of '_file' is being written
+  void wait(AsyncOutFile* _file) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    condition_.wait(lock, [_file] { return !_file->inFlight_; });
+  }
+
+  u32 references;
+
+ private:
+  void run() {
+    while (true) {
+      std::pair<AsyncOutFile*, std::string*> job;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        condition_.wait(lock, [this] { return !jobs_.empty() || done_; });
+        if (jobs_.empty()) {
+          break;
+        }
+        job = jobs_.front();
+        jobs_.pop_front();
+      }
+
+      job.first->outFile_->write(*job.second);
+      job.second->clear();
+
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        job.first->inFlight_ = false;
+      }
+      condition_.notify_all();
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::deque<std::pair<AsyncOutFile*, std::string*>> jobs_;
+  bool done_;
+  std::thread thread_;
+};
+
+/* AsyncOutFile class */
+
+std::mutex AsyncOutFile::writerMutex_;
+AsyncOutFile::Writer* AsyncOutFile::sharedWriter_ = nullptr;
+std::atomic<u64> AsyncOutFile::totalStalls_(0);
+
+AsyncOutFile::AsyncOutFile(const std::string& _filename, u64 _bufferSize)
+    : filename_(_filename),
+      outFile_(new fio::OutFile(_filename)),
+      bufferSize_(_bufferSize),
+      current_(0),
+      inFlight_(false),
+      stalls_(0) {
+  assert(bufferSize_ > 0);
+  buffers_[0].reserve(bufferSize_);
+  buffers_[1].reserve(bufferSize_);
+  writer_ = acquireWriter();
+}
+
+AsyncOutFile::~AsyncOutFile() {
+  if (!buffers_[current_].empty()) {
+    flush();
+  }
+  writer_->wait(this);
+  delete outFile_;
+  releaseWriter();
+
+  // stalls mean the simulator outpaced the writer thread
+  if (stalls_ > 0) {
+    fprintf(stderr, "%s: %" PRIu64 " writes stalled on the writer thread\n",
+            filename_.c_str(), stalls_);
+  }
+}
+
+void AsyncOutFile::write(const std::string& _text) {
+  write(_text.data(), _text.size());
+}
+
+void AsyncOutFile::write(const char* _data, u64 _size) {
+  buffers_[current_].append(_data, _size);
+  if (buffers_[current_].size() >= bufferSize_) {
+    flush();
+  }
+}
+
+u64 AsyncOutFile::stalls() const {
+  return stalls_;
+}
+
+u64 AsyncOutFile::totalStalls() {
+  return totalStalls_;
+}
+
+AsyncOutFile::Writer* AsyncOutFile::acquireWriter() {
+  std::unique_lock<std::mutex> lock(writerMutex_);
+  if (sharedWriter_ == nullptr) {
+    sharedWriter_ = new Writer();
+  }
+  sharedWriter_->references++;
+  return sharedWriter_;
+}
+
+void AsyncOutFile::releaseWriter() {
+  std::unique_lock<std::mutex> lock(writerMutex_);
+  assert(sharedWriter_ != nullptr && sharedWriter_->references > 0);
+  sharedWriter_->references--;
+  if (sharedWriter_->references == 0) {
+    delete sharedWriter_;
+    sharedWriter_ = nullptr;
+  }
+}
+
+void AsyncOutFile::flush() {
+  if (writer_->push(this, &buffers_[current_])) {
+    stalls_++;
+    totalStalls_++;
+  }
+  current_ ^= 1;
+}
@@ -0,0 +1,78 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef STATS_ASYNCOUTFILE_H_
+#define STATS_ASYNCOUTFILE_H_
+
+#include <atomic>
+#include <condition_variable>  // NOLINT
+#include <deque>
+#include <mutex>  // NOLINT
+#include <string>
+#include <thread>  // NOLINT
+
+#include "fio/OutFile.h"
+#include "prim/prim.h"
+
+// This is an output file whose compression and disk I/O are performed by a
+//  writer thread that is shared by all AsyncOutFiles. Writes are appended to
+//  one of two buffers. When a buffer fills it is handed to the writer thread
+//  and the other buffer is used. Memory use is bounded by the two buffers: if
+//  the writer hasn't finished with the other buffer, the write waits for it.
+//  Destruction waits until all data has been written and reports the number
+//  of stalled writes to stderr, if there were any. The stalls of all files
+//  are also totaled for the info log.
+class AsyncOutFile {
+ public:
+  explicit AsyncOutFile(const std::string& _filename,
+                        u64 _bufferSize = 1 << 20);
+  ~AsyncOutFile();
+
+  // a write that fills the current buffer blocks while the other buffer is
+  //  still being written, this is counted as a stall
+  void write(const std::string& _text);
+  void write(const char* _data, u64 _size);
+
+  // returns the number of writes that waited for the writer thread
+  u64 stalls() const;
+
+  // returns the number of stalled writes of all files so far
+  static u64 totalStalls();
+
+ private:
+  class Writer;
+
+  static Writer* acquireWriter();
+  static void releaseWriter();
+
+  // the writer is created by the first and deleted by the last AsyncOutFile
+  static std::mutex writerMutex_;
+  static Writer* sharedWriter_;
+
+  // files may be written from other threads than the simulator's
+  static std::atomic<u64> totalStalls_;
+
+  void flush();
+
+  const std::string filename_;
+  fio::OutFile* outFile_;
+  const u64 bufferSize_;
+  std::string buffers_[2];
+  u32 current_;
+  bool inFlight_;  // guarded by the writer's mutex
+  u64 stalls_;
+  Writer* writer_;
+};
+
+#endif  // STATS_ASYNCOUTFILE_H_
@@ -0,0 +1,165 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "stats/AsyncOutFile.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>  // NOLINT
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>  // NOLINT
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "prim/prim.h"
+
+namespace {
+
+std::string tempFile(const std::string& _name) {
+  return testing::TempDir() + "AsyncOutFile_" + _name;
+}
+
+// this returns the contents of a file and removes it
+std::string readFile(const std::string& _filename) {
+  std::ifstream file(_filename, std::ios::binary);
+  std::stringstream ss;
+  ss << file.rdbuf();
+  std::remove(_filename.c_str());
+  return ss.str();
+}
+
+// text of varying length such that writes straddle buffer boundaries
+std::string text(u32 _file, u32 _index) {
+  return std::to_string(_file) + ':' + std::string(_index % 13, 'a' + _file) +
+         std::to_string(_index) + '\n';
+}
+
+}  // namespace
+
+TEST(AsyncOutFile, byteOrder) {
+  std::string filename = tempFile("byteOrder.txt");
+  AsyncOutFile* file = new AsyncOutFile(filename, 7);
+  std::string exp;
+  for (u32 index = 0; index < 10000; index++) {
+    std::string t = text(0, index);
+    file->write(t);
+    exp += t;
+  }
+  delete file;
+  ASSERT_EQ(readFile(filename), exp);
+}
+
+TEST(AsyncOutFile, sharedWriter) {
+  const u32 kFiles = 3;
+  std::vector<u32> order({0, 1, 2});
+  do {
+    // the files share the writer thread and are destroyed in every order
+    std::vector<std::string> filenames;
+    std::vector<AsyncOutFile*> files;
+    std::vector<std::string> exp(kFiles);
+    for (u32 f = 0; f < kFiles; f++) {
+      filenames.push_back(tempFile("sharedWriter_" + std::to_string(f)));
+      files.push_back(new AsyncOutFile(filenames.at(f), 5 + f));
+    }
+    for (u32 index = 0; index < 2000; index++) {
+      for (u32 f = 0; f < kFiles; f++) {
+        std::string t = text(f, index);
+        files.at(f)->write(t.data(), t.size());
+        exp.at(f) += t;
+      }
+    }
+
+    // a file destroyed early doesn't end the others
+    for (u32 d = 0; d < kFiles; d++) {
+      u32 f = order.at(d);
+      delete files.at(f);
+      for (u32 o = d + 1; o < kFiles; o++) {
+        std::string t = text(order.at(o), 2000 + d);
+        files.at(order.at(o))->write(t);
+        exp.at(order.at(o)) += t;
+      }
+    }
+
+    for (u32 f = 0; f < kFiles; f++) {
+      ASSERT_EQ(readFile(filenames.at(f)), exp.at(f));
+    }
+  } while (std::next_permutation(order.begin(), order.end()));
+}
+
+TEST(AsyncOutFile, flushOnDestruction) {
+  // nothing fills the buffer, destruction writes it
+  std::string filename = tempFile("flushOnDestruction.txt");
+  AsyncOutFile* file = new AsyncOutFile(filename);
+  file->write("hello\n");
+  file->write("world\n");
+  ASSERT_EQ(file->stalls(), 0u);
+  delete file;
+  ASSERT_EQ(readFile(filename), "hello\nworld\n");
+}
+
+TEST(AsyncOutFile, stalls) {
+  // a pipe holds less than a buffer, thus the first buffer is written only
+  //  as fast as the pipe is read
+  const u64 kBufferSize = 1 << 18;
+  std::string filename = tempFile("stalls.fifo");
+  std::remove(filename.c_str());
+  ASSERT_EQ(mkfifo(filename.c_str(), 0600), 0);
+
+  std::atomic<bool> drain(false);
+  std::string received;
+  std::thread reader([&]() {
+    int fd = open(filename.c_str(), O_RDONLY);
+    ASSERT_GE(fd, 0);
+    while (!drain) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    char chunk[4096];
+    ssize_t size;
+    while ((size = read(fd, chunk, sizeof(chunk))) > 0) {
+      received.append(chunk, size);
+    }
+    close(fd);
+  });
+
+  u64 totalStalls = AsyncOutFile::totalStalls();
+  AsyncOutFile* file = new AsyncOutFile(filename, kBufferSize);
+  std::string first(kBufferSize, 'a');
+  std::string second(kBufferSize, 'b');
+
+  // the first buffer never waits
+  file->write(first);
+  ASSERT_EQ(file->stalls(), 0u);
+
+  // the second buffer waits for the first, the pipe is drained meanwhile
+  std::thread releaser([&]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    drain = true;
+  });
+  file->write(second);
+  ASSERT_EQ(file->stalls(), 1u);
+  ASSERT_EQ(AsyncOutFile::totalStalls(), totalStalls + 1);
+
+  delete file;
+  releaser.join();
+  reader.join();
+  std::remove(filename.c_str());
+  ASSERT_EQ(received, first + second);
+}
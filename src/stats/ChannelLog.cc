@@ -17,27 +17,34 @@
 #include <cassert>
 #include <string>
 
+#include "event/Simulator.h"
+
 ChannelLog::ChannelLog(u32 _numVcs, nlohmann::json _settings)
-    : numVcs_(_numVcs), outFile_(nullptr) {
+    : numVcs_(_numVcs),
+      outFile_(nullptr),
+      windowLength_(0),
+      windowFile_(nullptr) {
+  // set up the stream
+  ss_.precision(6);
+  ss_.setf(std::ios::fixed, std::ios::floatfield);
+
   if (!_settings["file"].is_null()) {
     // create file
-    outFile_ = new fio::OutFile(_settings["file"].get<std::string>());
-
-    // set up the stream
-    ss_.precision(6);
-    ss_.setf(std::ios::fixed, std::ios::floatfield);
+    outFile_ = new AsyncOutFile(_settings["file"].get<std::string>());
+    writeHeader(outFile_);
+  }
 
-    // write the header
-    ss_ << "name,";
-    for (u32 vc = 0; vc < numVcs_; vc++) {
-      ss_ << vc << ',';
-    }
-    ss_ << "total" << std::endl;
+  if (!_settings["window_file"].is_null()) {
+    // each row is the utilization of one channel within one window
+    assert(_settings["window"].is_number_integer());
+    windowLength_ = _settings["window"].get<u64>();
+    assert(windowLength_ > 0);
 
-    // write to the outfile and reset the stream
-    outFile_->write(ss_.str());
-    ss_.str("");
-    ss_.clear();
+    // create file
+    windowFile_ =
+        new AsyncOutFile(_settings["window_file"].get<std::string>());
+    ss_ << "time,";
+    writeHeader(windowFile_);
   }
 }
 
@@ -45,6 +52,9 @@ ChannelLog::~ChannelLog() {
   if (outFile_) {
     delete outFile_;
   }
+  if (windowFile_) {
+    delete windowFile_;
+  }
 }
 
 void ChannelLog::logChannel(const Channel* _channel) {
@@ -62,3 +72,45 @@ void ChannelLog::logChannel(const Channel* _channel) {
     ss_.clear();
   }
 }
+
+u64 ChannelLog::windowLength() const {
+  return windowLength_;
+}
+
+void ChannelLog::logWindow(const Channel* _channel, u64 _windowStart,
+                           u64 _windowEnd, const std::vector<u64>& _counts) {
+  assert(windowFile_);
+  assert(_windowStart < _windowEnd);
+  assert(_counts.size() == numVcs_);
+
+  // log the channel utilization within the window to the stream, windows
+  //  are clipped to the monitoring period by the channel
+  f64 cycles = (f64)(_windowEnd - _windowStart) /
+               gSim->cycleTime(Simulator::Clock::CHANNEL);
+  u64 total = 0;
+  ss_ << _windowStart << ',' << _channel->fullName() << ',';
+  for (u32 vc = 0; vc < numVcs_; vc++) {
+    ss_ << (_counts[vc] / cycles) << ',';
+    total += _counts[vc];
+  }
+  ss_ << (total / cycles) << std::endl;
+
+  // write to the outfile and reset the stream
+  windowFile_->write(ss_.str());
+  ss_.str("");
+  ss_.clear();
+}
+
+void ChannelLog::writeHeader(AsyncOutFile* _outFile) {
+  // write the header
+  ss_ << "name,";
+  for (u32 vc = 0; vc < numVcs_; vc++) {
+    ss_ << vc << ',';
+  }
+  ss_ << "total" << std::endl;
+
+  // write to the outfile and reset the stream
+  _outFile->write(ss_.str());
+  ss_.str("");
+  ss_.clear();
+}
@@ -16,11 +16,12 @@
 #define STATS_CHANNELLOG_H_
 
 #include <sstream>
+#include <vector>
 
-#include "fio/OutFile.h"
 #include "network/Channel.h"
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
+#include "stats/AsyncOutFile.h"
 
 class ChannelLog {
  public:
@@ -28,10 +29,20 @@ class ChannelLog {
   ~ChannelLog();
   void logChannel(const Channel* _channel);
 
+  // windowed utilization, a window length of 0 means it is disabled
+  u64 windowLength() const;
+  void logWindow(const Channel* _channel, u64 _windowStart, u64 _windowEnd,
+                 const std::vector<u64>& _counts);
+
  private:
+  void writeHeader(AsyncOutFile* _outFile);
+
   const u32 numVcs_;
-  fio::OutFile* outFile_;
+  AsyncOutFile* outFile_;
   std::stringstream ss_;
+
+  u64 windowLength_;
+  AsyncOutFile* windowFile_;
 };
 
 #endif  // STATS_CHANNELLOG_H_
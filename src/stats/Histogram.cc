@@ -0,0 +1,130 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "stats/Histogram.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include "bits/bits.h"
+
+Histogram::Histogram(u32 _precision)
+    : precision_(_precision),
+      count_(0),
+      minimum_(U64_MAX),
+      maximum_(0),
+      sum_(0.0) {
+  assert(precision_ > 0 && precision_ < 32);
+}
+
+Histogram::~Histogram() {}
+
+void Histogram::add(u64 _value) {
+  u32 index = bucketIndex(_value);
+  if (index >= buckets_.size()) {
+    buckets_.resize(index + 1, 0);
+  }
+  buckets_[index]++;
+  count_++;
+  minimum_ = std::min(minimum_, _value);
+  maximum_ = std::max(maximum_, _value);
+  sum_ += _value;
+}
+
+u64 Histogram::count() const {
+  return count_;
+}
+
+u64 Histogram::minimum() const {
+  return minimum_;
+}
+
+u64 Histogram::maximum() const {
+  return maximum_;
+}
+
+f64 Histogram::mean() const {
+  return count_ == 0 ? 0.0 : sum_ / count_;
+}
+
+u64 Histogram::quantile(f64 _quantile) const {
+  assert(_quantile >= 0.0 && _quantile <= 1.0);
+  if (count_ == 0) {
+    return 0;
+  }
+  u64 rank = std::max(static_cast<u64>(1), static_cast<u64>(std::ceil(
+      _quantile * count_)));
+  u64 seen = 0;
+  for (u32 index = 0; index < buckets_.size(); index++) {
+    seen += buckets_[index];
+    if (seen >= rank) {
+      return std::min(bucketHighest(index), maximum_);
+    }
+  }
+  assert(false);
+  return maximum_;
+}
+
+nlohmann::json Histogram::summary() const {
+  nlohmann::json summary;
+  summary["count"] = count_;
+  summary["minimum"] = count_ == 0 ? 0 : minimum_;
+  summary["maximum"] = maximum_;
+  summary["mean"] = mean();
+  summary["p50"] = quantile(0.5);
+  summary["p90"] = quantile(0.9);
+  summary["p99"] = quantile(0.99);
+  summary["p999"] = quantile(0.999);
+  summary["p9999"] = quantile(0.9999);
+  summary["precision"] = precision_;
+
+  // buckets are [lowest value, count] pairs
+  nlohmann::json buckets = nlohmann::json::array();
+  for (u32 index = 0; index < buckets_.size(); index++) {
+    if (buckets_[index] > 0) {
+      buckets.push_back({bucketLowest(index), buckets_[index]});
+    }
+  }
+  summary["buckets"] = buckets;
+  return summary;
+}
+
+u32 Histogram::bucketIndex(u64 _value) const {
+  // values below 2^(precision+1) have exact buckets
+  u64 subBuckets = static_cast<u64>(1) << precision_;
+  if (_value < (subBuckets << 1)) {
+    return static_cast<u32>(_value);
+  }
+  u32 shift = static_cast<u32>(bits::floorLog2(_value)) - precision_;
+  return static_cast<u32>(shift * subBuckets + (_value >> shift));
+}
+
+u64 Histogram::bucketLowest(u32 _index) const {
+  u64 subBuckets = static_cast<u64>(1) << precision_;
+  if (_index < (subBuckets << 1)) {
+    return _index;
+  }
+  u32 shift = static_cast<u32>(_index / subBuckets) - 1;
+  return (_index - shift * subBuckets) << shift;
+}
+
+u64 Histogram::bucketHighest(u32 _index) const {
+  u64 subBuckets = static_cast<u64>(1) << precision_;
+  if (_index < (subBuckets << 1)) {
+    return _index;
+  }
+  u32 shift = static_cast<u32>(_index / subBuckets) - 1;
+  return bucketLowest(_index) + (static_cast<u64>(1) << shift) - 1;
+}
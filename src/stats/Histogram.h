@@ -0,0 +1,58 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef STATS_HISTOGRAM_H_
+#define STATS_HISTOGRAM_H_
+
+#include <vector>
+
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+
+// This is a log-linear histogram (as in HDR histograms). Values less than
+//  2^(precision+1) have their own bucket, larger values share buckets that are
+//  2^(precision) per power of 2 wide. The relative error of any bucket is at
+//  most 2^(-precision).
+class Histogram {
+ public:
+  explicit Histogram(u32 _precision);
+  ~Histogram();
+
+  void add(u64 _value);
+
+  u64 count() const;
+  u64 minimum() const;
+  u64 maximum() const;
+  f64 mean() const;
+
+  // returns the highest value equivalent to the value at quantile '_quantile'
+  u64 quantile(f64 _quantile) const;
+
+  // returns a summary with quantiles and all non-empty buckets
+  nlohmann::json summary() const;
+
+ private:
+  u32 bucketIndex(u64 _value) const;
+  u64 bucketLowest(u32 _index) const;
+  u64 bucketHighest(u32 _index) const;
+
+  const u32 precision_;
+  std::vector<u64> buckets_;
+  u64 count_;
+  u64 minimum_;
+  u64 maximum_;
+  f64 sum_;
+};
+
+#endif  // STATS_HISTOGRAM_H_
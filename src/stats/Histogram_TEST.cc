@@ -0,0 +1,142 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "stats/Histogram.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "gtest/gtest.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+
+namespace {
+
+// returns the highest value of the bucket holding '_value', a larger value
+//  is added such that the maximum doesn't clip the result
+u64 bucketHighest(u32 _precision, u64 _value) {
+  Histogram hist(_precision);
+  hist.add(_value);
+  hist.add(U64_MAX >> 1);
+  return hist.quantile(0.5);
+}
+
+// returns the lowest value of the bucket holding '_value'
+u64 bucketLowest(u32 _precision, u64 _value) {
+  Histogram hist(_precision);
+  hist.add(_value);
+  nlohmann::json buckets = hist.summary()["buckets"];
+  assert(buckets.size() == 1);
+  return buckets[0][0].get<u64>();
+}
+
+}  // namespace
+
+TEST(Histogram, percentiles) {
+  // all values are below 2^(precision+1), thus are exact
+  Histogram hist(7);
+  for (u64 value = 100; value >= 1; value--) {
+    hist.add(value);
+  }
+  ASSERT_EQ(hist.count(), 100u);
+  ASSERT_EQ(hist.minimum(), 1u);
+  ASSERT_EQ(hist.maximum(), 100u);
+  ASSERT_DOUBLE_EQ(hist.mean(), 50.5);
+  ASSERT_EQ(hist.quantile(0.0), 1u);
+  ASSERT_EQ(hist.quantile(0.5), 50u);
+  ASSERT_EQ(hist.quantile(0.9), 90u);
+  ASSERT_EQ(hist.quantile(0.99), 99u);
+  ASSERT_EQ(hist.quantile(1.0), 100u);
+
+  nlohmann::json summary = hist.summary();
+  ASSERT_EQ(summary["p50"].get<u64>(), 50u);
+  ASSERT_EQ(summary["p90"].get<u64>(), 90u);
+  ASSERT_EQ(summary["p99"].get<u64>(), 99u);
+  ASSERT_EQ(summary["p999"].get<u64>(), 100u);
+  ASSERT_EQ(summary["buckets"].size(), 100u);
+
+  // the maximum clips the highest value of its bucket
+  Histogram wide(1);
+  wide.add(1000);
+  ASSERT_EQ(wide.quantile(1.0), 1000u);
+  ASSERT_EQ(wide.quantile(0.5), 1000u);
+
+  Histogram empty(3);
+  ASSERT_EQ(empty.quantile(0.5), 0u);
+  ASSERT_EQ(empty.summary()["minimum"].get<u64>(), 0u);
+}
+
+TEST(Histogram, powersOfTwo) {
+  for (u32 precision = 1; precision <= 8; precision++) {
+    for (u32 power = precision + 1; power < 48; power++) {
+      u64 value = static_cast<u64>(1) << power;
+      u64 width = static_cast<u64>(1) << (power - precision);
+
+      // a power of two starts a bucket and the value below it ends one
+      ASSERT_EQ(bucketLowest(precision, value), value);
+      ASSERT_EQ(bucketHighest(precision, value), value + width - 1);
+      ASSERT_EQ(bucketHighest(precision, value - 1), value - 1);
+      ASSERT_EQ(bucketLowest(precision, value - 1), value - (width >> 1));
+    }
+  }
+}
+
+TEST(Histogram, relativeError) {
+  for (u32 precision = 1; precision <= 10; precision++) {
+    f64 maxError = 1.0 / (static_cast<u64>(1) << precision);
+    f64 worst = 0.0;
+    for (u64 value = 1; value < (static_cast<u64>(1) << 40);
+         value = value * 9 / 8 + 1) {
+      u64 lowest = bucketLowest(precision, value);
+      u64 highest = bucketHighest(precision, value);
+      ASSERT_LE(lowest, value);
+      ASSERT_GE(highest, value);
+      f64 error = static_cast<f64>(highest - lowest) / lowest;
+      ASSERT_LT(error, maxError);
+      worst = std::max(worst, error);
+    }
+    // the bound is tight
+    ASSERT_GT(worst, maxError / 2);
+  }
+}
+
+TEST(Histogram, precision) {
+  // values below 2^(precision+1) have their own bucket
+  for (u32 precision = 1; precision <= 8; precision++) {
+    u64 exact = static_cast<u64>(2) << precision;
+    Histogram hist(precision);
+    for (u64 value = 0; value < exact; value++) {
+      hist.add(value);
+    }
+    nlohmann::json summary = hist.summary();
+    ASSERT_EQ(summary["precision"].get<u32>(), precision);
+    ASSERT_EQ(summary["buckets"].size(), exact);
+
+    // the next two values share the first bucket that is 2 wide
+    hist.add(exact);
+    hist.add(exact + 1);
+    summary = hist.summary();
+    ASSERT_EQ(summary["buckets"].size(), exact + 1);
+    ASSERT_EQ(summary["buckets"][exact][0].get<u64>(), exact);
+    ASSERT_EQ(summary["buckets"][exact][1].get<u64>(), 2u);
+  }
+
+  // a higher precision gives narrower buckets
+  ASSERT_EQ(bucketLowest(2, 1000), 896u);
+  ASSERT_EQ(bucketHighest(2, 1000), 1023u);
+  ASSERT_EQ(bucketLowest(4, 1000), 992u);
+  ASSERT_EQ(bucketHighest(4, 1000), 1023u);
+  ASSERT_EQ(bucketLowest(8, 1000), 1000u);
+  ASSERT_EQ(bucketHighest(8, 1000), 1001u);
+}
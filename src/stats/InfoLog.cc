@@ -19,7 +19,7 @@
 InfoLog::InfoLog(nlohmann::json _settings) : outFile_(nullptr) {
   if (!_settings["file"].is_null()) {
     // create file
-    outFile_ = new fio::OutFile(_settings["file"].get<std::string>());
+    outFile_ = new AsyncOutFile(_settings["file"].get<std::string>());
   }
 }
 
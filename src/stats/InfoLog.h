@@ -17,9 +17,9 @@
 
 #include <string>
 
-#include "fio/OutFile.h"
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
+#include "stats/AsyncOutFile.h"
 
 class InfoLog {
  public:
@@ -28,7 +28,7 @@ class InfoLog {
   void logInfo(const std::string& _name, const std::string& _value);
 
  private:
-  fio::OutFile* outFile_;
+  AsyncOutFile* outFile_;
 };
 
 #endif  // STATS_INFOLOG_H_
@@ -0,0 +1,119 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "stats/LatencyStats.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "event/Simulator.h"
+#include "stats/AsyncOutFile.h"
+#include "types/Flit.h"
+#include "types/Packet.h"
+#include "workload/util.h"
+
+LatencyStats::ClassStats::ClassStats(u32 _precision)
+    : messageLatency(_precision),
+      packetLatency(_precision),
+      hopCount(_precision) {}
+
+LatencyStats::ApplicationStats::ApplicationStats(u32 _precision)
+    : transactionLatency(_precision) {}
+
+LatencyStats::LatencyStats(nlohmann::json _settings) {
+  assert(_settings.contains("file") && _settings["file"].is_string());
+  filename_ = _settings["file"].get<std::string>();
+
+  // the precision is an optional setting
+  precision_ = 5;
+  if (_settings.contains("precision")) {
+    precision_ = _settings["precision"].get<u32>();
+  }
+}
+
+LatencyStats::~LatencyStats() {
+  nlohmann::json summary;
+  summary["applications"] = nlohmann::json::array();
+  for (u32 app = 0; app < applications_.size(); app++) {
+    const ApplicationStats& appStats = applications_.at(app);
+    nlohmann::json appSummary;
+    appSummary["id"] = app;
+    appSummary["transaction_latency"] = appStats.transactionLatency.summary();
+    appSummary["protocol_classes"] = nlohmann::json::array();
+    for (u32 pc = 0; pc < appStats.classes.size(); pc++) {
+      const ClassStats& classStats = appStats.classes.at(pc);
+      nlohmann::json classSummary;
+      classSummary["id"] = pc;
+      classSummary["message_latency"] = classStats.messageLatency.summary();
+      classSummary["packet_latency"] = classStats.packetLatency.summary();
+      classSummary["hop_count"] = classStats.hopCount.summary();
+      appSummary["protocol_classes"].push_back(classSummary);
+    }
+    summary["applications"].push_back(appSummary);
+  }
+
+  AsyncOutFile outFile(filename_);
+  outFile.write(summary.dump() + '\n');
+}
+
+void LatencyStats::logMessage(const Message* _message) {
+  ApplicationStats& appStats =
+      applicationStats(appId(_message->getTransaction()));
+  u32 pc = _message->getProtocolClass();
+  while (appStats.classes.size() <= pc) {
+    appStats.classes.emplace_back(precision_);
+  }
+  ClassStats& classStats = appStats.classes.at(pc);
+
+  // latencies are measured from the first send to the last receive
+  u64 msgSend = U64_MAX;
+  u64 msgReceive = 0;
+  for (u32 p = 0; p < _message->numPackets(); p++) {
+    Packet* packet = _message->packet(p);
+    u64 pktSend = U64_MAX;
+    u64 pktReceive = 0;
+    for (u32 f = 0; f < packet->numFlits(); f++) {
+      Flit* flit = packet->getFlit(f);
+      pktSend = std::min(pktSend, flit->getSendTime());
+      pktReceive = std::max(pktReceive, flit->getReceiveTime());
+    }
+    classStats.packetLatency.add(pktReceive - pktSend);
+    classStats.hopCount.add(packet->getHopCount());
+    msgSend = std::min(msgSend, pktSend);
+    msgReceive = std::max(msgReceive, pktReceive);
+  }
+  classStats.messageLatency.add(msgReceive - msgSend);
+}
+
+void LatencyStats::startTransaction(u64 _trans) {
+  bool res = transactionStarts_.insert(std::make_pair(_trans, gSim->time()))
+                 .second;
+  (void)res;  // UNUSED
+  assert(res);
+}
+
+void LatencyStats::endTransaction(u64 _trans) {
+  auto it = transactionStarts_.find(_trans);
+  assert(it != transactionStarts_.end());
+  applicationStats(appId(_trans))
+      .transactionLatency.add(gSim->time() - it->second);
+  transactionStarts_.erase(it);
+}
+
+LatencyStats::ApplicationStats& LatencyStats::applicationStats(u32 _app) {
+  while (applications_.size() <= _app) {
+    applications_.emplace_back(precision_);
+  }
+  return applications_.at(_app);
+}
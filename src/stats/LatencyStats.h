@@ -0,0 +1,62 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef STATS_LATENCYSTATS_H_
+#define STATS_LATENCYSTATS_H_
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+#include "stats/Histogram.h"
+#include "types/Message.h"
+
+// This keeps streaming histograms of the latencies and hop counts of the
+//  messages and transactions given to the MessageLog. The histograms are kept
+//  per application and per protocol class and are written as a JSON summary
+//  when destroyed.
+class LatencyStats {
+ public:
+  explicit LatencyStats(nlohmann::json _settings);
+  ~LatencyStats();
+
+  void logMessage(const Message* _message);
+  void startTransaction(u64 _trans);
+  void endTransaction(u64 _trans);
+
+ private:
+  struct ClassStats {
+    explicit ClassStats(u32 _precision);
+    Histogram messageLatency;
+    Histogram packetLatency;
+    Histogram hopCount;
+  };
+
+  struct ApplicationStats {
+    explicit ApplicationStats(u32 _precision);
+    Histogram transactionLatency;
+    std::vector<ClassStats> classes;
+  };
+
+  ApplicationStats& applicationStats(u32 _app);
+
+  std::string filename_;
+  u32 precision_;
+  std::vector<ApplicationStats> applications_;
+  std::unordered_map<u64, u64> transactionStarts_;
+};
+
+#endif  // STATS_LATENCYSTATS_H_
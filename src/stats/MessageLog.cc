@@ -14,6 +14,8 @@
  */
 #include "stats/MessageLog.h"
 
+#include <zlib.h>
+
 #include <cassert>
 #include <sstream>
 #include <string>
@@ -22,21 +24,147 @@
 #include "types/Flit.h"
 #include "types/Packet.h"
 
-MessageLog::MessageLog(nlohmann::json _settings) : outFile_(nullptr) {
+namespace {
+
+// the binary file starts with this and the format version, then a sequence
+//  of blocks
+const char kBinaryMagic[] = "SSMPFBIN";
+const u32 kBinaryVersion = 1;
+
+template <typename T>
+void appendColumn(const std::vector<T>& _column, std::string* _out) {
+  _out->append(reinterpret_cast<const char*>(_column.data()),
+               _column.size() * sizeof(T));
+}
+
+void appendU64(u64 _value, std::string* _out) {
+  _out->append(reinterpret_cast<const char*>(&_value), sizeof(u64));
+}
+
+// the version is little endian regardless of the host
+std::string versionWord() {
+  std::string word;
+  for (u32 byte = 0; byte < sizeof(kBinaryVersion); byte++) {
+    word.push_back(static_cast<char>((kBinaryVersion >> (8 * byte)) & 0xFF));
+  }
+  return word;
+}
+
+}  // namespace
+
+MessageLog::MessageLog(nlohmann::json _settings, LatencyStats* _latencyStats)
+    : outFile_(nullptr),
+      binary_(false),
+      latencyStats_(_latencyStats),
+      block_(nullptr),
+      numBlocks_(0),
+      done_(false) {
   if (!_settings["file"].is_null()) {
     // create file
-    outFile_ = new fio::OutFile(_settings["file"].get<std::string>());
+    outFile_ = new AsyncOutFile(_settings["file"].get<std::string>());
+
+    // the text format is the default
+    std::string format = "text";
+    if (!_settings["format"].is_null()) {
+      format = _settings["format"].get<std::string>();
+    }
+    if (format == "binary") {
+      // the blocks are already compressed, gzip would compress them twice
+      binary_ = true;
+      const std::string& filename = _settings["file"].get<std::string>();
+      if (filename.size() >= 3 &&
+          filename.compare(filename.size() - 3, 3, ".gz") == 0) {
+        fprintf(stderr, "binary message logs can't be gzipped: %s\n",
+                filename.c_str());
+        assert(false);
+      }
+    } else if (format != "text") {
+      fprintf(stderr, "invalid message log format: %s\n", format.c_str());
+      assert(false);
+    }
+  }
+
+  if (binary_) {
+    blockFlits_ = 65536;
+    if (!_settings["block_flits"].is_null()) {
+      blockFlits_ = _settings["block_flits"].get<u32>();
+    }
+    assert(blockFlits_ > 0);
+    compressionLevel_ = 1;
+    if (!_settings["compression_level"].is_null()) {
+      compressionLevel_ = _settings["compression_level"].get<s32>();
+    }
+    assert(compressionLevel_ >= 0 && compressionLevel_ <= 9);
+    maxBlocks_ = 4;
+    if (!_settings["max_blocks"].is_null()) {
+      maxBlocks_ = _settings["max_blocks"].get<u32>();
+    }
+    assert(maxBlocks_ >= 2);
+
+    outFile_->write(std::string(kBinaryMagic, sizeof(kBinaryMagic) - 1));
+    outFile_->write(versionWord());
+    writer_ = std::thread(&MessageLog::writeBlocks, this);
+    acquireBlock();
   }
 }
 
 MessageLog::~MessageLog() {
+  if (binary_) {
+    // hand over the last block then wait for the writer to finish
+    if (block_->records.empty()) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      freeBlocks_.push_back(block_);
+    } else {
+      pushBlock();
+    }
+    block_ = nullptr;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      done_ = true;
+    }
+    condition_.notify_all();
+    writer_.join();
+    assert(freeBlocks_.size() == numBlocks_);
+    for (Block* block : freeBlocks_) {
+      delete block;
+    }
+  }
   if (outFile_) {
     delete outFile_;
   }
 }
 
 void MessageLog::logMessage(const Message* _message) {
-  if (outFile_) {
+  if (latencyStats_) {
+    latencyStats_->logMessage(_message);
+  }
+  if (binary_) {
+    block_->records.push_back(static_cast<u8>(Record::kMessage));
+    block_->msgIds.push_back(_message->id());
+    block_->msgSources.push_back(_message->getSourceId());
+    block_->msgDestinations.push_back(_message->getDestinationId());
+    block_->msgTransactions.push_back(_message->getTransaction());
+    block_->msgProtocolClasses.push_back(_message->getProtocolClass());
+    block_->msgMinimalHopCounts.push_back(_message->getMinimalHopCount());
+    block_->msgOpCodes.push_back(_message->getOpCode());
+    block_->msgNumPackets.push_back(_message->numPackets());
+    for (u32 p = 0; p < _message->numPackets(); p++) {
+      Packet* packet = _message->packet(p);
+      block_->pktIds.push_back(packet->id());
+      block_->pktHopCounts.push_back(packet->getHopCount());
+      block_->pktNumFlits.push_back(packet->numFlits());
+      for (u32 f = 0; f < packet->numFlits(); f++) {
+        Flit* flit = packet->getFlit(f);
+        block_->flitIds.push_back(flit->id());
+        block_->flitSendTimes.push_back(flit->getSendTime());
+        block_->flitReceiveTimes.push_back(flit->getReceiveTime());
+      }
+    }
+    if (block_->flitIds.size() >= blockFlits_) {
+      pushBlock();
+      acquireBlock();
+    }
+  } else if (outFile_) {
     std::stringstream ss;
     ss << "+M" << ',';
     ss << _message->id() << ',';
@@ -66,7 +194,12 @@ void MessageLog::logMessage(const Message* _message) {
 }
 
 void MessageLog::startTransaction(u64 _trans) {
-  if (outFile_) {
+  if (latencyStats_) {
+    latencyStats_->startTransaction(_trans);
+  }
+  if (binary_) {
+    logTransaction(Record::kStartTransaction, _trans);
+  } else if (outFile_) {
     std::stringstream ss;
     ss << "+T" << ',' << _trans << ',' << gSim->time() << '\n';
     outFile_->write(ss.str());
@@ -74,9 +207,141 @@ void MessageLog::startTransaction(u64 _trans) {
 }
 
 void MessageLog::endTransaction(u64 _trans) {
-  if (outFile_) {
+  if (latencyStats_) {
+    latencyStats_->endTransaction(_trans);
+  }
+  if (binary_) {
+    logTransaction(Record::kEndTransaction, _trans);
+  } else if (outFile_) {
     std::stringstream ss;
     ss << "-T" << ',' << _trans << ',' << gSim->time() << '\n';
     outFile_->write(ss.str());
   }
 }
+
+void MessageLog::logTransaction(Record _record, u64 _trans) {
+  block_->records.push_back(static_cast<u8>(_record));
+  block_->transIds.push_back(_trans);
+  block_->transTimes.push_back(gSim->time());
+  if (block_->records.size() >= blockFlits_) {
+    pushBlock();
+    acquireBlock();
+  }
+}
+
+void MessageLog::acquireBlock() {
+  assert(block_ == nullptr);
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (freeBlocks_.empty() && numBlocks_ < maxBlocks_) {
+    // the largest columns are preallocated, all keep their capacity when
+    //  blocks are reused
+    Block* block = new Block();
+    block->records.reserve(blockFlits_);
+    block->flitIds.reserve(blockFlits_);
+    block->flitSendTimes.reserve(blockFlits_);
+    block->flitReceiveTimes.reserve(blockFlits_);
+    freeBlocks_.push_back(block);
+    numBlocks_++;
+  }
+
+  // backpressure: wait for the writer when all blocks are in use
+  condition_.wait(lock, [this] { return !freeBlocks_.empty(); });
+  block_ = freeBlocks_.back();
+  freeBlocks_.pop_back();
+}
+
+void MessageLog::clearBlock(Block* _block) {
+  _block->records.clear();
+  _block->transIds.clear();
+  _block->transTimes.clear();
+  _block->msgIds.clear();
+  _block->msgSources.clear();
+  _block->msgDestinations.clear();
+  _block->msgTransactions.clear();
+  _block->msgProtocolClasses.clear();
+  _block->msgMinimalHopCounts.clear();
+  _block->msgOpCodes.clear();
+  _block->msgNumPackets.clear();
+  _block->pktIds.clear();
+  _block->pktHopCounts.clear();
+  _block->pktNumFlits.clear();
+  _block->flitIds.clear();
+  _block->flitSendTimes.clear();
+  _block->flitReceiveTimes.clear();
+}
+
+void MessageLog::pushBlock() {
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    fullBlocks_.push_back(block_);
+  }
+  block_ = nullptr;
+  condition_.notify_all();
+}
+
+void MessageLog::writeBlocks() {
+  std::string raw;
+  std::string compressed;
+  while (true) {
+    Block* block;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(lock, [this] { return !fullBlocks_.empty() || done_; });
+      if (fullBlocks_.empty()) {
+        break;
+      }
+      block = fullBlocks_.front();
+      fullBlocks_.pop_front();
+    }
+
+    // each block is its own zlib stream preceded by its sizes
+    serializeBlock(block, &raw);
+    uLongf size = compressBound(raw.size());
+    compressed.resize(2 * sizeof(u64) + size);
+    s32 res = compress2(
+        reinterpret_cast<Bytef*>(&compressed[2 * sizeof(u64)]), &size,
+        reinterpret_cast<const Bytef*>(raw.data()), raw.size(),
+        compressionLevel_);
+    (void)res;  // UNUSED
+    assert(res == Z_OK);
+    u64 sizes[2] = {raw.size(), size};
+    compressed.replace(0, sizeof(sizes), reinterpret_cast<const char*>(sizes),
+                       sizeof(sizes));
+    compressed.resize(2 * sizeof(u64) + size);
+    outFile_->write(compressed);
+
+    clearBlock(block);
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      freeBlocks_.push_back(block);
+    }
+    condition_.notify_all();
+  }
+}
+
+void MessageLog::serializeBlock(const Block* _block,
+                                std::string* _out) const {
+  _out->clear();
+  appendU64(_block->records.size(), _out);
+  appendU64(_block->transIds.size(), _out);
+  appendU64(_block->msgIds.size(), _out);
+  appendU64(_block->pktIds.size(), _out);
+  appendU64(_block->flitIds.size(), _out);
+  appendColumn(_block->records, _out);
+  appendColumn(_block->transIds, _out);
+  appendColumn(_block->transTimes, _out);
+  appendColumn(_block->msgIds, _out);
+  appendColumn(_block->msgSources, _out);
+  appendColumn(_block->msgDestinations, _out);
+  appendColumn(_block->msgTransactions, _out);
+  appendColumn(_block->msgProtocolClasses, _out);
+  appendColumn(_block->msgMinimalHopCounts, _out);
+  appendColumn(_block->msgOpCodes, _out);
+  appendColumn(_block->msgNumPackets, _out);
+  appendColumn(_block->pktIds, _out);
+  appendColumn(_block->pktHopCounts, _out);
+  appendColumn(_block->pktNumFlits, _out);
+  appendColumn(_block->flitIds, _out);
+  appendColumn(_block->flitSendTimes, _out);
+  appendColumn(_block->flitReceiveTimes, _out);
+}
@@ -15,21 +15,82 @@
 #ifndef STATS_MESSAGELOG_H_
 #define STATS_MESSAGELOG_H_
 
-#include "fio/OutFile.h"
+#include <condition_variable>  // NOLINT
+#include <deque>
+#include <mutex>  // NOLINT
+#include <string>
+#include <thread>  // NOLINT
+#include <vector>
+
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
+#include "stats/AsyncOutFile.h"
+#include "stats/LatencyStats.h"
 #include "types/Message.h"
 
 class MessageLog {
  public:
-  explicit MessageLog(nlohmann::json _settings);
+  // all logged messages and transactions are also given to '_latencyStats'
+  //  when it isn't nullptr, even without a file being logged to
+  MessageLog(nlohmann::json _settings, LatencyStats* _latencyStats);
   ~MessageLog();
   void logMessage(const Message* _message);
   void startTransaction(u64 _trans);
   void endTransaction(u64 _trans);
 
  private:
-  fio::OutFile* outFile_;
+  // the binary format holds records in columns, see scripts/binary_mpf.py
+  enum class Record : u8 { kStartTransaction, kEndTransaction, kMessage };
+
+  struct Block {
+    std::vector<u8> records;
+
+    std::vector<u64> transIds;
+    std::vector<u64> transTimes;
+
+    std::vector<u32> msgIds;
+    std::vector<u32> msgSources;
+    std::vector<u32> msgDestinations;
+    std::vector<u64> msgTransactions;
+    std::vector<u32> msgProtocolClasses;
+    std::vector<u32> msgMinimalHopCounts;
+    std::vector<u32> msgOpCodes;
+    std::vector<u32> msgNumPackets;
+
+    std::vector<u32> pktIds;
+    std::vector<u32> pktHopCounts;
+    std::vector<u32> pktNumFlits;
+
+    std::vector<u32> flitIds;
+    std::vector<u64> flitSendTimes;
+    std::vector<u64> flitReceiveTimes;
+  };
+
+  void logTransaction(Record _record, u64 _trans);
+  void acquireBlock();
+  void clearBlock(Block* _block);
+  void pushBlock();
+  void writeBlocks();
+  void serializeBlock(const Block* _block, std::string* _out) const;
+
+  AsyncOutFile* outFile_;
+  bool binary_;
+  LatencyStats* latencyStats_;
+
+  // binary format
+  u32 blockFlits_;
+  s32 compressionLevel_;
+  Block* block_;
+
+  // blocks are handed to a writer thread, at most 'maxBlocks_' exist
+  u32 maxBlocks_;
+  u32 numBlocks_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::deque<Block*> fullBlocks_;
+  std::vector<Block*> freeBlocks_;
+  bool done_;
+  std::thread writer_;
 };
 
 #endif  // STATS_MESSAGELOG_H_
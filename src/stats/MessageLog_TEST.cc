@@ -0,0 +1,305 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "stats/MessageLog.h"
+
+#include <zlib.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "event/Component.h"
+#include "event/Simulator.h"
+#include "gtest/gtest.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+#include "test/TestSetup_TESTLIB.h"
+#include "types/Flit.h"
+#include "types/Message.h"
+#include "types/Packet.h"
+
+namespace {
+
+// record types of the binary format
+const u8 kStartTransaction = 0;
+const u8 kEndTransaction = 1;
+const u8 kMessage = 2;
+
+// the columns of one block of the binary format
+struct Columns {
+  std::vector<u8> records;
+  std::vector<u64> transIds;
+  std::vector<u64> transTimes;
+  std::vector<u32> msgIds;
+  std::vector<u32> msgSources;
+  std::vector<u32> msgDestinations;
+  std::vector<u64> msgTransactions;
+  std::vector<u32> msgProtocolClasses;
+  std::vector<u32> msgMinimalHopCounts;
+  std::vector<u32> msgOpCodes;
+  std::vector<u32> msgNumPackets;
+  std::vector<u32> pktIds;
+  std::vector<u32> pktHopCounts;
+  std::vector<u32> pktNumFlits;
+  std::vector<u32> flitIds;
+  std::vector<u64> flitSendTimes;
+  std::vector<u64> flitReceiveTimes;
+};
+
+void addTransaction(u8 _record, u64 _trans, u64 _time, Columns* _columns) {
+  _columns->records.push_back(_record);
+  _columns->transIds.push_back(_trans);
+  _columns->transTimes.push_back(_time);
+}
+
+void addMessage(const Message* _message, Columns* _columns) {
+  _columns->records.push_back(kMessage);
+  _columns->msgIds.push_back(_message->id());
+  _columns->msgSources.push_back(_message->getSourceId());
+  _columns->msgDestinations.push_back(_message->getDestinationId());
+  _columns->msgTransactions.push_back(_message->getTransaction());
+  _columns->msgProtocolClasses.push_back(_message->getProtocolClass());
+  _columns->msgMinimalHopCounts.push_back(_message->getMinimalHopCount());
+  _columns->msgOpCodes.push_back(_message->getOpCode());
+  _columns->msgNumPackets.push_back(_message->numPackets());
+  for (u32 p = 0; p < _message->numPackets(); p++) {
+    const Packet* packet = _message->packet(p);
+    _columns->pktIds.push_back(packet->id());
+    _columns->pktHopCounts.push_back(packet->getHopCount());
+    _columns->pktNumFlits.push_back(packet->numFlits());
+    for (u32 f = 0; f < packet->numFlits(); f++) {
+      const Flit* flit = packet->getFlit(f);
+      _columns->flitIds.push_back(flit->id());
+      _columns->flitSendTimes.push_back(flit->getSendTime());
+      _columns->flitReceiveTimes.push_back(flit->getReceiveTime());
+    }
+  }
+}
+
+// this makes a message whose fields are all derived from '_id'
+Message* makeMessage(u32 _id, u32 _numFlits, u32 _maxPacketSize,
+                     u64 _trans) {
+  Message* message = Message::create(_numFlits, _maxPacketSize, nullptr);
+  message->setId(_id);
+  message->setSourceId(_id + 1);
+  message->setDestinationId(_id + 2);
+  message->setTransaction(_trans);
+  message->setProtocolClass(_id % 3);
+  message->setMinimalHopCount(_id + 3);
+  message->setOpCode(_id + 4);
+  for (u32 p = 0; p < message->numPackets(); p++) {
+    Packet* packet = message->packet(p);
+    for (u32 hop = 0; hop <= p; hop++) {
+      packet->incrementHopCount();
+    }
+    for (u32 f = 0; f < packet->numFlits(); f++) {
+      Flit* flit = packet->getFlit(f);
+      flit->setSendTime(1000 * _id + 10 * p + f);
+      flit->setReceiveTime(1000 * _id + 10 * p + f + 500);
+    }
+  }
+  return message;
+}
+
+// this runs each step at its time
+class StepRunner : public Component {
+ public:
+  explicit StepRunner(
+      const std::vector<std::pair<u64, std::function<void()>>>& _steps)
+      : Component("StepRunner", nullptr), steps_(_steps) {
+    for (u32 step = 0; step < steps_.size(); step++) {
+      addEvent(steps_.at(step).first, 0, &steps_.at(step).second, 0);
+    }
+  }
+
+  void processEvent(void* _event, s32 _type) override {
+    (*reinterpret_cast<std::function<void()>*>(_event))();
+  }
+
+ private:
+  std::vector<std::pair<u64, std::function<void()>>> steps_;
+};
+
+template <typename T>
+void readColumn(const std::string& _raw, u64 _count, u64* _offset,
+                std::vector<T>* _column) {
+  ASSERT_LE(*_offset + _count * sizeof(T), _raw.size());
+  _column->resize(_count);
+  std::memcpy(_column->data(), _raw.data() + *_offset, _count * sizeof(T));
+  *_offset += _count * sizeof(T);
+}
+
+// this reads the blocks of a binary message log
+void readBinaryLog(const std::string& _filename,
+                   std::vector<Columns>* _blocks) {
+  std::ifstream file(_filename, std::ios::binary);
+  std::stringstream ss;
+  ss << file.rdbuf();
+  std::string data = ss.str();
+
+  // the magic is followed by a little endian version
+  ASSERT_GE(data.size(), 12u);
+  ASSERT_EQ(data.substr(0, 8), "SSMPFBIN");
+  ASSERT_EQ(data.substr(8, 4), std::string("\x01\x00\x00\x00", 4));
+  u64 offset = 12;
+
+  while (offset < data.size()) {
+    // each block is a zlib stream preceded by its raw and compressed sizes
+    ASSERT_LE(offset + 2 * sizeof(u64), data.size());
+    u64 sizes[2];
+    std::memcpy(sizes, data.data() + offset, sizeof(sizes));
+    offset += sizeof(sizes);
+    ASSERT_LE(offset + sizes[1], data.size());
+    std::string raw(sizes[0], '\0');
+    uLongf rawSize = sizes[0];
+    ASSERT_EQ(uncompress(reinterpret_cast<Bytef*>(&raw[0]), &rawSize,
+                         reinterpret_cast<const Bytef*>(data.data() + offset),
+                         sizes[1]),
+              Z_OK);
+    ASSERT_EQ(rawSize, sizes[0]);
+    offset += sizes[1];
+
+    // the counts are followed by the columns
+    u64 counts[5];
+    ASSERT_GE(raw.size(), sizeof(counts));
+    std::memcpy(counts, raw.data(), sizeof(counts));
+    u64 numRecords = counts[0];
+    u64 numTrans = counts[1];
+    u64 numMsgs = counts[2];
+    u64 numPkts = counts[3];
+    u64 numFlits = counts[4];
+    u64 rawOffset = sizeof(counts);
+    _blocks->emplace_back();
+    Columns& block = _blocks->back();
+    readColumn(raw, numRecords, &rawOffset, &block.records);
+    readColumn(raw, numTrans, &rawOffset, &block.transIds);
+    readColumn(raw, numTrans, &rawOffset, &block.transTimes);
+    readColumn(raw, numMsgs, &rawOffset, &block.msgIds);
+    readColumn(raw, numMsgs, &rawOffset, &block.msgSources);
+    readColumn(raw, numMsgs, &rawOffset, &block.msgDestinations);
+    readColumn(raw, numMsgs, &rawOffset, &block.msgTransactions);
+    readColumn(raw, numMsgs, &rawOffset, &block.msgProtocolClasses);
+    readColumn(raw, numMsgs, &rawOffset, &block.msgMinimalHopCounts);
+    readColumn(raw, numMsgs, &rawOffset, &block.msgOpCodes);
+    readColumn(raw, numMsgs, &rawOffset, &block.msgNumPackets);
+    readColumn(raw, numPkts, &rawOffset, &block.pktIds);
+    readColumn(raw, numPkts, &rawOffset, &block.pktHopCounts);
+    readColumn(raw, numPkts, &rawOffset, &block.pktNumFlits);
+    readColumn(raw, numFlits, &rawOffset, &block.flitIds);
+    readColumn(raw, numFlits, &rawOffset, &block.flitSendTimes);
+    readColumn(raw, numFlits, &rawOffset, &block.flitReceiveTimes);
+    ASSERT_EQ(rawOffset, raw.size());
+  }
+}
+
+}  // namespace
+
+TEST(MessageLog, binary) {
+  TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
+  std::string filename = testing::TempDir() + "MessageLog_binary.bin";
+  nlohmann::json settings;
+  settings["file"] = filename;
+  settings["format"] = "binary";
+  settings["block_flits"] = 5;
+  settings["max_blocks"] = 2;
+  MessageLog* log = new MessageLog(settings, nullptr);
+
+  // a block ends when a message makes it hold 'block_flits' flits or a
+  //  transaction makes it hold 'block_flits' records
+  std::vector<Columns> exp(4);
+  std::vector<std::pair<u64, std::function<void()>>> steps;
+  auto transactionStep = [&](u64 _time, bool _start, u64 _trans, u32 _block) {
+    steps.push_back({_time, [=, &exp]() {
+      if (_start) {
+        log->startTransaction(_trans);
+      } else {
+        log->endTransaction(_trans);
+      }
+      addTransaction(_start ? kStartTransaction : kEndTransaction, _trans,
+                     gSim->time(), &exp.at(_block));
+    }});
+  };
+  auto messageStep = [&](u64 _time, u32 _id, u32 _numFlits, u32 _maxPacketSize,
+                     u64 _trans, u32 _block) {
+    steps.push_back({_time, [=, &exp]() {
+      Message* msg = makeMessage(_id, _numFlits, _maxPacketSize, _trans);
+      log->logMessage(msg);
+      addMessage(msg, &exp.at(_block));
+      delete msg;
+    }});
+  };
+
+  // block 0 ends on the flits of message 1
+  transactionStep(10, true, 100, 0);
+  messageStep(20, 0, 3, 2, 100, 0);
+  transactionStep(30, true, 101, 0);
+  messageStep(40, 1, 2, 2, 101, 0);
+  // block 1 ends on the records of transaction 103
+  transactionStep(50, false, 100, 1);
+  transactionStep(60, false, 101, 1);
+  transactionStep(70, true, 102, 1);
+  transactionStep(80, false, 102, 1);
+  messageStep(90, 2, 1, 4, 103, 1);
+  transactionStep(100, true, 103, 1);
+  // block 2 is a single message larger than a block
+  messageStep(110, 3, 6, 4, 103, 2);
+  // block 3 is written on destruction
+  transactionStep(120, false, 103, 3);
+
+  StepRunner runner(steps);
+  gSim->initialize();
+  gSim->simulate();
+  delete log;
+
+  std::vector<Columns> blocks;
+  readBinaryLog(filename, &blocks);
+  std::remove(filename.c_str());
+
+  ASSERT_EQ(blocks.size(), exp.size());
+  for (u32 b = 0; b < blocks.size(); b++) {
+    SCOPED_TRACE("block " + std::to_string(b));
+    ASSERT_EQ(blocks.at(b).records, exp.at(b).records);
+    ASSERT_EQ(blocks.at(b).transIds, exp.at(b).transIds);
+    ASSERT_EQ(blocks.at(b).transTimes, exp.at(b).transTimes);
+    ASSERT_EQ(blocks.at(b).msgIds, exp.at(b).msgIds);
+    ASSERT_EQ(blocks.at(b).msgSources, exp.at(b).msgSources);
+    ASSERT_EQ(blocks.at(b).msgDestinations, exp.at(b).msgDestinations);
+    ASSERT_EQ(blocks.at(b).msgTransactions, exp.at(b).msgTransactions);
+    ASSERT_EQ(blocks.at(b).msgProtocolClasses, exp.at(b).msgProtocolClasses);
+    ASSERT_EQ(blocks.at(b).msgMinimalHopCounts,
+              exp.at(b).msgMinimalHopCounts);
+    ASSERT_EQ(blocks.at(b).msgOpCodes, exp.at(b).msgOpCodes);
+    ASSERT_EQ(blocks.at(b).msgNumPackets, exp.at(b).msgNumPackets);
+    ASSERT_EQ(blocks.at(b).pktIds, exp.at(b).pktIds);
+    ASSERT_EQ(blocks.at(b).pktHopCounts, exp.at(b).pktHopCounts);
+    ASSERT_EQ(blocks.at(b).pktNumFlits, exp.at(b).pktNumFlits);
+    ASSERT_EQ(blocks.at(b).flitIds, exp.at(b).flitIds);
+    ASSERT_EQ(blocks.at(b).flitSendTimes, exp.at(b).flitSendTimes);
+    ASSERT_EQ(blocks.at(b).flitReceiveTimes, exp.at(b).flitReceiveTimes);
+  }
+
+  // the blocks hold what was expected of them
+  ASSERT_EQ(blocks.at(0).records,
+            std::vector<u8>({kStartTransaction, kMessage, kStartTransaction,
+                             kMessage}));
+  ASSERT_EQ(blocks.at(0).flitIds.size(), 5u);
+  ASSERT_EQ(blocks.at(1).records.size(), 6u);
+  ASSERT_EQ(blocks.at(2).flitIds.size(), 6u);
+  ASSERT_EQ(blocks.at(3).transTimes, std::vector<u64>({120}));
+}
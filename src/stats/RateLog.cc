@@ -19,7 +19,7 @@
 RateLog::RateLog(nlohmann::json _settings) : outFile_(nullptr) {
   if (!_settings["file"].is_null()) {
     // create file
-    outFile_ = new fio::OutFile(_settings["file"].get<std::string>());
+    outFile_ = new AsyncOutFile(_settings["file"].get<std::string>());
 
     // write header
     outFile_->write("id,name,injection,delivered,ejection\n");
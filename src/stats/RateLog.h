@@ -18,9 +18,9 @@
 #include <sstream>
 #include <string>
 
-#include "fio/OutFile.h"
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
+#include "stats/AsyncOutFile.h"
 
 class RateLog {
  public:
@@ -30,7 +30,7 @@ class RateLog {
                 f64 _injectionRate, f64 _deliveredRate, f64 _ejectionRate);
 
  private:
-  fio::OutFile* outFile_;
+  AsyncOutFile* outFile_;
   std::stringstream ss_;
 };
 
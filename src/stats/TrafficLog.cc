@@ -14,28 +14,51 @@
  */
 #include "stats/TrafficLog.h"
 
+#include <algorithm>
 #include <cassert>
 #include <sstream>
 #include <string>
 
+#include "architecture/PortedDevice.h"
 #include "event/Simulator.h"
 #include "types/Flit.h"
 #include "types/Packet.h"
 
-TrafficLog::TrafficLog(nlohmann::json _settings) : outFile_(nullptr) {
+TrafficLog::TrafficLog(nlohmann::json _settings)
+    : outFile_(nullptr), aggregate_(false), window_(0), windowStart_(U64_MAX) {
   if (!_settings["file"].is_null()) {
     // create file
-    outFile_ = new fio::OutFile(_settings["file"].get<std::string>());
+    outFile_ = new AsyncOutFile(_settings["file"].get<std::string>());
 
     // write header
     outFile_->write(
         "time,device,inputPort,inputVc,outputPort,outputVc,"
         "flits\n");
+
+    // determine the mode, logging every event is the default
+    if (!_settings["mode"].is_null()) {
+      std::string mode = _settings["mode"].get<std::string>();
+      if (mode == "aggregate") {
+        aggregate_ = true;
+      } else if (mode != "event") {
+        fprintf(stderr, "invalid traffic log mode: %s\n", mode.c_str());
+        assert(false);
+      }
+    }
+
+    // the window is optional, 0 means a single window
+    if (!_settings["window"].is_null()) {
+      assert(aggregate_);
+      window_ = _settings["window"].get<u64>();
+    }
   }
 }
 
 TrafficLog::~TrafficLog() {
   if (outFile_) {
+    if (aggregate_) {
+      flushWindow();
+    }
     delete outFile_;
   }
 }
@@ -44,14 +67,82 @@ void TrafficLog::logTraffic(const Component* _device, u32 _inputPort,
                             u32 _inputVc, u32 _outputPort, u32 _outputVc,
                             u32 _flits) {
   if (outFile_) {
-    std::stringstream ss;
-    ss << gSim->time() << ',';
-    ss << _device->name() << ',';
-    ss << _inputPort << ',';
-    ss << _inputVc << ',';
-    ss << _outputPort << ',';
-    ss << _outputVc << ',';
-    ss << _flits << '\n';
-    outFile_->write(ss.str());
+    if (aggregate_) {
+      // start a new window when needed
+      u64 now = gSim->time();
+      if (windowStart_ == U64_MAX) {
+        windowStart_ = window_ == 0 ? now : now - (now % window_);
+      } else if (window_ > 0 && now >= windowStart_ + window_) {
+        flushWindow();
+        windowStart_ = now - (now % window_);
+      }
+
+      // count the flits
+      Device& dev = device(_device);
+      assert(_inputPort < dev.numPorts && _outputPort < dev.numPorts);
+      assert(_inputVc < dev.numVcs && _outputVc < dev.numVcs);
+      u32 index = ((_inputPort * dev.numVcs + _inputVc) * dev.numPorts +
+                   _outputPort) * dev.numVcs + _outputVc;
+      if (_flits > 0 && dev.flits[index] == 0) {
+        dev.dirty.push_back(index);
+      }
+      dev.flits[index] += _flits;
+    } else {
+      std::stringstream ss;
+      ss << gSim->time() << ',';
+      ss << _device->name() << ',';
+      ss << _inputPort << ',';
+      ss << _inputVc << ',';
+      ss << _outputPort << ',';
+      ss << _outputVc << ',';
+      ss << _flits << '\n';
+      outFile_->write(ss.str());
+    }
+  }
+}
+
+TrafficLog::Device& TrafficLog::device(const Component* _device) {
+  auto it = deviceIndices_.find(_device);
+  if (it != deviceIndices_.end()) {
+    return devices_[it->second];
+  }
+
+  // the counters of a device are created when it first logs traffic
+  const PortedDevice* ported = dynamic_cast<const PortedDevice*>(_device);
+  assert(ported != nullptr);
+  deviceIndices_[_device] = devices_.size();
+  devices_.emplace_back();
+  Device& dev = devices_.back();
+  dev.name = _device->name();
+  dev.numPorts = ported->numPorts();
+  dev.numVcs = ported->numVcs();
+  u64 size = static_cast<u64>(dev.numPorts) * dev.numVcs * dev.numPorts *
+             dev.numVcs;
+  assert(size <= U32_MAX);
+  dev.flits.resize(size, 0);
+  return dev;
+}
+
+void TrafficLog::flushWindow() {
+  // devices are written in the order they first logged traffic
+  std::stringstream ss;
+  for (Device& dev : devices_) {
+    std::sort(dev.dirty.begin(), dev.dirty.end());
+    for (u32 index : dev.dirty) {
+      u32 outputVc = index % dev.numVcs;
+      u32 outputPort = (index / dev.numVcs) % dev.numPorts;
+      u32 inputVc = (index / (dev.numVcs * dev.numPorts)) % dev.numVcs;
+      u32 inputPort = index / (dev.numVcs * dev.numPorts * dev.numVcs);
+      ss << windowStart_ << ',';
+      ss << dev.name << ',';
+      ss << inputPort << ',';
+      ss << inputVc << ',';
+      ss << outputPort << ',';
+      ss << outputVc << ',';
+      ss << dev.flits[index] << '\n';
+      dev.flits[index] = 0;
+    }
+    dev.dirty.clear();
   }
+  outFile_->write(ss.str());
 }
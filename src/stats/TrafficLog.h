@@ -15,10 +15,14 @@
 #ifndef STATS_TRAFFICLOG_H_
 #define STATS_TRAFFICLOG_H_
 
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include "event/Component.h"
-#include "fio/OutFile.h"
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
+#include "stats/AsyncOutFile.h"
 
 class TrafficLog {
  public:
@@ -28,7 +32,26 @@ class TrafficLog {
                   u32 _outputPort, u32 _outputVc, u32 _flits);
 
  private:
-  fio::OutFile* outFile_;
+  // in aggregate mode, flits are counted per device and written once per
+  //  window (or once at the end) using the same CSV format. the time column
+  //  holds the start of the window.
+  struct Device {
+    std::string name;
+    u32 numPorts;
+    u32 numVcs;
+    std::vector<u64> flits;  // [inputPort][inputVc][outputPort][outputVc]
+    std::vector<u32> dirty;  // indices of non-zero counts
+  };
+
+  Device& device(const Component* _device);
+  void flushWindow();
+
+  AsyncOutFile* outFile_;
+  bool aggregate_;
+  u64 window_;
+  u64 windowStart_;
+  std::unordered_map<const Component*, u32> deviceIndices_;
+  std::vector<Device> devices_;
 };
 
 #endif  // STATS_TRAFFICLOG_H_
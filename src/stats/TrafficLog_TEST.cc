@@ -0,0 +1,146 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "stats/TrafficLog.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "architecture/PortedDevice_TESTLIB.h"
+#include "event/Component.h"
+#include "event/Simulator.h"
+#include "gtest/gtest.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+#include "test/TestSetup_TESTLIB.h"
+
+namespace {
+
+class TestDevice : public Component, public TestPortedDevice {
+ public:
+  TestDevice(const std::string& _name, u32 _numPorts, u32 _numVcs)
+      : Component(_name, nullptr), TestPortedDevice(_numPorts, _numVcs) {}
+};
+
+struct Traffic {
+  u64 time;
+  const TestDevice* device;
+  u32 inputPort;
+  u32 inputVc;
+  u32 outputPort;
+  u32 outputVc;
+  u32 flits;
+};
+
+// this logs each traffic record at its time
+class TrafficSource : public Component {
+ public:
+  TrafficSource(TrafficLog* _log, const std::vector<Traffic>& _traffic)
+      : Component("TrafficSource", nullptr), log_(_log), traffic_(_traffic) {
+    for (Traffic& traffic : traffic_) {
+      addEvent(traffic.time, 0, &traffic, 0);
+    }
+  }
+
+  void processEvent(void* _event, s32 _type) override {
+    const Traffic* traffic = reinterpret_cast<const Traffic*>(_event);
+    log_->logTraffic(traffic->device, traffic->inputPort, traffic->inputVc,
+                     traffic->outputPort, traffic->outputVc, traffic->flits);
+  }
+
+ private:
+  TrafficLog* log_;
+  std::vector<Traffic> traffic_;
+};
+
+// this runs the traffic through a traffic log and returns the file contents
+std::string logTraffic(const nlohmann::json& _settings,
+                       const std::vector<Traffic>& _traffic) {
+  TrafficLog* log = new TrafficLog(_settings);
+  TrafficSource source(log, _traffic);
+  gSim->initialize();
+  gSim->simulate();
+  delete log;
+
+  std::string filename = _settings["file"].get<std::string>();
+  std::ifstream file(filename);
+  std::stringstream ss;
+  ss << file.rdbuf();
+  std::remove(filename.c_str());
+  return ss.str();
+}
+
+const char* kHeader =
+    "time,device,inputPort,inputVc,outputPort,outputVc,flits\n";
+
+}  // namespace
+
+TEST(TrafficLog, aggregateWindows) {
+  TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
+  TestDevice a("A", 2, 2);
+  TestDevice b("B", 3, 1);
+
+  nlohmann::json settings;
+  settings["file"] = testing::TempDir() + "TrafficLog_aggregateWindows.csv";
+  settings["mode"] = "aggregate";
+  settings["window"] = 10;
+
+  std::vector<Traffic> traffic({
+      // window 0, flits of the same path are summed, zero flits are no row
+      {3, &a, 0, 0, 1, 1, 2},
+      {3, &b, 2, 0, 0, 0, 1},
+      {3, &a, 0, 0, 1, 1, 3},
+      {7, &a, 1, 1, 0, 0, 0},
+      {7, &a, 1, 0, 0, 1, 4},
+      // window 10
+      {12, &b, 1, 0, 2, 0, 6},
+      // window 20 has no traffic, window 30 starts with zero flits
+      {35, &a, 1, 1, 0, 0, 0},
+      {35, &a, 1, 1, 0, 0, 2},
+      {39, &a, 0, 0, 1, 1, 1}});
+
+  // devices are in the order they first logged traffic, paths are sorted
+  std::string exp = std::string(kHeader) +
+                    "0,A,0,0,1,1,5\n"
+                    "0,A,1,0,0,1,4\n"
+                    "0,B,2,0,0,0,1\n"
+                    "10,B,1,0,2,0,6\n"
+                    "30,A,0,0,1,1,1\n"
+                    "30,A,1,1,0,0,2\n";
+  ASSERT_EQ(logTraffic(settings, traffic), exp);
+}
+
+TEST(TrafficLog, aggregateSingleWindow) {
+  TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
+  TestDevice a("A", 2, 1);
+  TestDevice b("B", 2, 1);
+
+  nlohmann::json settings;
+  settings["file"] =
+      testing::TempDir() + "TrafficLog_aggregateSingleWindow.csv";
+  settings["mode"] = "aggregate";
+
+  std::vector<Traffic> traffic({{5, &b, 0, 0, 1, 0, 1},
+                                {17, &a, 1, 0, 0, 0, 2},
+                                {250, &b, 0, 0, 1, 0, 3}});
+
+  // the window starts at the first traffic
+  std::string exp = std::string(kHeader) +
+                    "5,B,0,0,1,0,4\n"
+                    "5,A,1,0,0,0,2\n";
+  ASSERT_EQ(logTraffic(settings, traffic), exp);
+}
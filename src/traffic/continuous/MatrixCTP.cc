@@ -14,88 +14,295 @@
  */
 #include "traffic/continuous/MatrixCTP.h"
 
+#include <sys/resource.h>
+
+#include <algorithm>
 #include <cassert>
+#include <cctype>
+#include <chrono>  // NOLINT
+#include <condition_variable>  // NOLINT
+#include <cstdlib>
+#include <mutex>  // NOLINT
+#include <thread>  // NOLINT
 #include <unordered_map>
+#include <utility>
 
 #include "factory/ObjectFactory.h"
 #include "fio/InFile.h"
 #include "mut/mut.h"
-#include "strop/strop.h"
 
 namespace {
 
 // this holds cummulative distributions
 std::unordered_map<std::string, std::vector<std::vector<f64>>> cdistMap;
+// this holds alias tables
+std::unordered_map<std::string, std::vector<MatrixCTP::AliasTable>> aliasMap;
 bool cleared = false;
 
-// this retrieves cummulative distributions, loads them only when needed
-const std::vector<f64>& retrieveCummulativeDistribution(
-    const std::string& _filename, u32 _terminal, u32 _numTerminals) {
-  cleared = false;
+// the number of lines each parsing thread handles per block
+const u32 kLinesPerThread = 64;
 
-  // determine if file has already been processed
-  if (cdistMap.count(_filename) == 0) {
-    // create a new entry
-    cdistMap[_filename];
-    std::vector<std::vector<f64>>& cdists = cdistMap.at(_filename);
+// this parses a row of comma separated probabilities, calling '_func' with
+//  the column and value of each non-zero probability
+template <typename F>
+void parseProbabilities(const std::string& _line, u32 _numTerminals, F _func) {
+  const char* str = _line.c_str();
+  u32 column = 0;
+  while (*str != '\0') {
+    char* end;
+    f64 prob = std::strtod(str, &end);
+    assert(end != str);
+    assert(column < _numTerminals);
+    if (prob != 0.0) {
+      _func(column, prob);
+    }
+    column++;
+    str = end;
+    while (std::isspace(static_cast<unsigned char>(*str))) {
+      str++;
+    }
+    if (*str == ',') {
+      str++;
+    } else {
+      assert(*str == '\0');
+    }
+  }
+  assert(column == _numTerminals);
+}
+
+// this creates the cumulative distribution of a row
+void parseCummulativeDistribution(const std::string& _line, u32 _numTerminals,
+                                  std::vector<f64>* _cdist) {
+  std::vector<f64> pdist(_numTerminals, 0.0);
+  bool allZeros = true;
+  parseProbabilities(_line, _numTerminals, [&](u32 _column, f64 _prob) {
+    pdist.at(_column) = _prob;
+    allZeros = false;
+  });
+  if (!allZeros) {
+    mut::generateCumulativeDistribution(pdist, _cdist);
+  }
+}
+
+// this creates the alias table of a row (Vose's method)
+void parseAliasTable(const std::string& _line, u32 _numTerminals,
+                     MatrixCTP::AliasTable* _table) {
+  std::vector<f64> probs;
+  f64 sum = 0.0;
+  parseProbabilities(_line, _numTerminals, [&](u32 _column, f64 _prob) {
+    _table->destinations.push_back(_column);
+    probs.push_back(_prob);
+    sum += _prob;
+  });
 
-    // parse the file
-    fio::InFile inf(_filename);
+  // scale the probabilities such that their average is 1.0
+  u32 size = probs.size();
+  std::vector<u32> small;
+  std::vector<u32> large;
+  for (u32 idx = 0; idx < size; idx++) {
+    probs.at(idx) = probs.at(idx) * size / sum;
+    if (probs.at(idx) < 1.0) {
+      small.push_back(idx);
+    } else {
+      large.push_back(idx);
+    }
+  }
+
+  // pair each small entry with a large entry that fills the remainder
+  _table->thresholds.resize(size, 1.0);
+  _table->aliases = _table->destinations;
+  while (!small.empty() && !large.empty()) {
+    u32 less = small.back();
+    small.pop_back();
+    u32 more = large.back();
+    _table->thresholds.at(less) = probs.at(less);
+    _table->aliases.at(less) = _table->destinations.at(more);
+    probs.at(more) = (probs.at(more) + probs.at(less)) - 1.0;
+    if (probs.at(more) < 1.0) {
+      large.pop_back();
+      small.push_back(more);
+    }
+  }
+  // the remaining entries are (within rounding error) exactly 1.0 and keep
+  //  their default threshold and alias
+}
+
+// this loads all rows of a matrix file, the next block of lines is read
+//  from the file while the current block is parsed in parallel
+template <typename T>
+void loadMatrix(const std::string& _filename, u32 _numTerminals,
+                u32 _numThreads, void (*_parse)(const std::string&, u32, T*),
+                std::vector<T>* _rows) {
+  std::chrono::steady_clock::time_point startTime =
+      std::chrono::steady_clock::now();
+
+  _rows->resize(_numTerminals);
+  fio::InFile inf(_filename);
+  fio::InFile::Status sts = fio::InFile::Status::OK;
+  u32 blockSize = _numThreads * kLinesPerThread;
+
+  // this reads the next block of non-empty lines
+  u32 lineNum = 0;
+  auto readBlock = [&](std::vector<std::string>* _block) {
+    _block->clear();
     std::string line;
-    u32 lineNum = 0;
-    fio::InFile::Status sts = fio::InFile::Status::OK;
-    for (lineNum = 0; sts == fio::InFile::Status::OK;) {
+    while (sts == fio::InFile::Status::OK && _block->size() < blockSize) {
       sts = inf.getLine(&line);
       assert(sts != fio::InFile::Status::ERROR);
-      if (sts == fio::InFile::Status::OK) {
-        if (line.size() > 0) {
-          // make space to hold a probability distribution
-          std::vector<f64> pdist(_numTerminals, F64_POS_INF);
-
-          // insert prob dist data
-          std::vector<std::string> strs = strop::split(line, ',');
-          assert(strs.size() == _numTerminals);
-          for (u32 idx = 0; idx < strs.size(); idx++) {
-            pdist.at(idx) = std::stod(strs.at(idx));
-          }
-
-          // create the cumulative distribution
-          cdists.push_back({});
-
-          // fill in the cumulative distribution
-          bool allZeros = true;
-          for (f64 p : pdist) {
-            if (p != 0.0) {
-              allZeros = false;
-              break;
-            }
-          }
-          if (!allZeros) {
-            std::vector<f64>& cdist = cdists.at(lineNum);
-            mut::generateCumulativeDistribution(pdist, &cdist);
-          }
-
-          // advance line counter
-          lineNum++;
+      if (sts == fio::InFile::Status::OK && line.size() > 0) {
+        if (lineNum >= _numTerminals) {
+          fprintf(stderr, "expected %u lines, found more\n", _numTerminals);
+          assert(false);
         }
+        _block->push_back(std::move(line));
+        lineNum++;
       }
     }
-    if (lineNum != _numTerminals) {
-      fprintf(stderr, "expected %u lines, processed %u lines\n", _numTerminals,
-              lineNum);
-      assert(false);
+  };
+
+  // this parses every '_numThreads' line of a block starting at '_offset'
+  auto parseBlock = [&](const std::vector<std::string>* _block, u32 _first,
+                        u32 _offset) {
+    for (u32 idx = _offset; idx < _block->size(); idx += _numThreads) {
+      _parse(_block->at(idx), _numTerminals, &_rows->at(_first + idx));
+    }
+  };
+
+  // the workers live for the whole load, each block is handed to them by
+  //  bumping the generation and they count down 'busy' when done with it
+  std::mutex mutex;
+  std::condition_variable condition;
+  u64 generation = 0;
+  u32 busy = 0;
+  bool done = false;
+  const std::vector<std::string>* current = nullptr;
+  u32 currentFirst = 0;
+  auto work = [&](u32 _offset) {
+    u64 seen = 0;
+    while (true) {
+      const std::vector<std::string>* block;
+      u32 first;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [&] { return generation != seen || done; });
+        if (generation == seen) {
+          break;
+        }
+        seen = generation;
+        block = current;
+        first = currentFirst;
+      }
+      parseBlock(block, first, _offset);
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        busy--;
+      }
+      condition.notify_all();
+    }
+  };
+  std::vector<std::thread> workers;
+  for (u32 thread = 0; thread < _numThreads; thread++) {
+    workers.emplace_back(work, thread);
+  }
+
+  std::vector<std::string> block;
+  std::vector<std::string> nextBlock;
+  readBlock(&block);
+  u32 first = 0;
+  while (!block.empty()) {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      current = &block;
+      currentFirst = first;
+      busy = _numThreads;
+      generation++;
+    }
+    condition.notify_all();
+    u32 next = lineNum;
+    readBlock(&nextBlock);
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      condition.wait(lock, [&] { return busy == 0; });
     }
+    std::swap(block, nextBlock);
+    first = next;
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    done = true;
+  }
+  condition.notify_all();
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+
+  if (lineNum != _numTerminals) {
+    fprintf(stderr, "expected %u lines, processed %u lines\n", _numTerminals,
+            lineNum);
+    assert(false);
+  }
+
+  // report the load time and the peak memory usage thus far
+  std::chrono::duration<f64> loadTime =
+      std::chrono::duration_cast<std::chrono::duration<f64>>(
+          std::chrono::steady_clock::now() - startTime);
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  gSim->infoLog.logInfo("Traffic matrix " + _filename + " load seconds",
+                        std::to_string(loadTime.count()));
+  gSim->infoLog.logInfo("Traffic matrix " + _filename + " peak RSS KiB",
+                        std::to_string(usage.ru_maxrss));
+}
+
+// this determines how many threads parse matrix files
+u32 parseThreads(const nlohmann::json& _settings) {
+  if (_settings.contains("parse_threads")) {
+    u32 threads = _settings["parse_threads"].get<u32>();
+    assert(threads > 0);
+    return threads;
+  }
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// this retrieves cummulative distributions, loads them only when needed
+const std::vector<f64>& retrieveCummulativeDistribution(
+    const std::string& _filename, u32 _terminal, u32 _numTerminals,
+    u32 _numThreads) {
+  cleared = false;
+
+  // determine if file has already been processed
+  if (cdistMap.count(_filename) == 0) {
+    loadMatrix(_filename, _numTerminals, _numThreads,
+               &parseCummulativeDistribution, &cdistMap[_filename]);
   }
 
   // retrieve the cummulative distribution
   return cdistMap.at(_filename).at(_terminal);
 }
 
-// this clears the cummulative distributions
+// this retrieves alias tables, loads them only when needed
+const MatrixCTP::AliasTable& retrieveAliasTable(
+    const std::string& _filename, u32 _terminal, u32 _numTerminals,
+    u32 _numThreads) {
+  cleared = false;
+
+  // determine if file has already been processed
+  if (aliasMap.count(_filename) == 0) {
+    loadMatrix(_filename, _numTerminals, _numThreads, &parseAliasTable,
+               &aliasMap[_filename]);
+  }
+
+  // retrieve the alias table
+  return aliasMap.at(_filename).at(_terminal);
+}
+
+// this clears the cummulative distributions and alias tables
 void clearCummulativeDistributions() {
   if (!cleared) {
     cleared = true;
     cdistMap.clear();
+    aliasMap.clear();
   }
 }
 
@@ -104,18 +311,54 @@ void clearCummulativeDistributions() {
 MatrixCTP::MatrixCTP(const std::string& _name, const Component* _parent,
                      u32 _numTerminals, u32 _self, nlohmann::json _settings)
     : ContinuousTrafficPattern(_name, _parent, _numTerminals, _self,
-                               _settings) {
+                               _settings),
+      storage_(parseStorage(_settings.contains("storage")
+                                ? _settings["storage"].get<std::string>()
+                                : "dense")) {
   assert(_settings.contains("file") && _settings["file"].is_string());
-  cumulativeDistribution_ = retrieveCummulativeDistribution(
-      _settings["file"].get<std::string>(), self_, numTerminals_);
+  const std::string filename = _settings["file"].get<std::string>();
+  u32 numThreads = parseThreads(_settings);
+  switch (storage_) {
+    case MatrixCTP::Storage::kDense:
+      cumulativeDistribution_ = retrieveCummulativeDistribution(
+          filename, self_, numTerminals_, numThreads);
+      break;
+    case MatrixCTP::Storage::kSparse:
+      aliasTable_ =
+          retrieveAliasTable(filename, self_, numTerminals_, numThreads);
+      break;
+    default:
+      assert(false);
+  }
 }
 
 MatrixCTP::~MatrixCTP() {}
 
 u32 MatrixCTP::nextDestination() {
   clearCummulativeDistributions();
-  f64 rnd = gSim->rnd.nextF64();
-  return mut::searchCumulativeDistribution(cumulativeDistribution_, rnd);
+  if (storage_ == MatrixCTP::Storage::kDense) {
+    f64 rnd = gSim->rnd.nextF64();
+    return mut::searchCumulativeDistribution(cumulativeDistribution_, rnd);
+  } else {
+    u32 size = aliasTable_.destinations.size();
+    assert(size > 0);
+    u32 idx = gSim->rnd.nextU64(0, size - 1);
+    f64 rnd = gSim->rnd.nextF64();
+    return rnd < aliasTable_.thresholds[idx]
+               ? aliasTable_.destinations[idx]
+               : aliasTable_.aliases[idx];
+  }
+}
+
+MatrixCTP::Storage MatrixCTP::parseStorage(const std::string& _storage) {
+  if (_storage == "dense") {
+    return MatrixCTP::Storage::kDense;
+  } else if (_storage == "sparse") {
+    return MatrixCTP::Storage::kSparse;
+  } else {
+    fprintf(stderr, "invalid storage: %s\n", _storage.c_str());
+    assert(false);
+  }
 }
 
 registerWithObjectFactory("matrix", ContinuousTrafficPattern, MatrixCTP,
@@ -29,8 +29,24 @@ class MatrixCTP : public ContinuousTrafficPattern {
   ~MatrixCTP();
   u32 nextDestination() override;
 
+  // Walker alias table over the non-zero destinations of a row
+  struct AliasTable {
+    std::vector<u32> destinations;
+    std::vector<f64> thresholds;
+    std::vector<u32> aliases;
+  };
+
  private:
+  enum class Storage {
+    kDense,  // a cumulative distribution over all terminals
+    kSparse  // an alias table over the non-zero destinations
+  };
+
+  static Storage parseStorage(const std::string& _storage);
+
+  const Storage storage_;
   std::vector<f64> cumulativeDistribution_;
+  AliasTable aliasTable_;
 };
 
 #endif  // TRAFFIC_CONTINUOUS_MATRIXCTP_H_
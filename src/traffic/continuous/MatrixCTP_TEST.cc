@@ -106,66 +106,116 @@ void cleanCSV(const char* _file) {
 
 TEST(MatrixCTP, full) {
   const bool DEBUG = false;
-  for (const std::tuple<u32, const f64*>& test : allTests()) {
-    u32 testSize = std::get<0>(test);
-    const f64* testDist = std::get<1>(test);
-
-    // set up
-    TestSetup testSetup(1234, 1234, 1234, 1234, 456789);
-    writeCSV(makeCSV(testDist, testSize).c_str(), TMPFILE);
-    nlohmann::json settings;
-    settings["file"] = TMPFILE;
-    std::vector<ContinuousTrafficPattern*> tps(testSize, nullptr);
-    for (u32 tp = 0; tp < testSize; tp++) {
-      tps.at(tp) = new MatrixCTP("TP_" + std::to_string(tp), nullptr, testSize,
-                                 tp, settings);
-    }
+  for (const char* storage : {"dense", "sparse"}) {
+    for (const std::tuple<u32, const f64*>& test : allTests()) {
+      u32 testSize = std::get<0>(test);
+      const f64* testDist = std::get<1>(test);
+
+      // set up
+      TestSetup testSetup(1234, 1234, 1234, 1234, 456789);
+      writeCSV(makeCSV(testDist, testSize).c_str(), TMPFILE);
+      nlohmann::json settings;
+      settings["file"] = TMPFILE;
+      settings["storage"] = storage;
+      settings["parse_threads"] = 3;
+      std::vector<ContinuousTrafficPattern*> tps(testSize, nullptr);
+      for (u32 tp = 0; tp < testSize; tp++) {
+        tps.at(tp) = new MatrixCTP("TP_" + std::to_string(tp), nullptr,
+                                   testSize, tp, settings);
+      }
 
-    // testing
-    f64* counts = new f64[testSize * testSize]();
-    u32* srcCounts = new u32[testSize]();
-    for (u32 r = 0; r < 20000000; r++) {
-      u32 src = gSim->rnd.nextU64(0, testSize - 1);
-      u32 dst = tps.at(src)->nextDestination();
-      srcCounts[src]++;
-      counts[makeIdx(src, dst, testSize)]++;
-    }
+      // testing
+      f64* counts = new f64[testSize * testSize]();
+      u32* srcCounts = new u32[testSize]();
+      for (u32 r = 0; r < 20000000; r++) {
+        u32 src = gSim->rnd.nextU64(0, testSize - 1);
+        u32 dst = tps.at(src)->nextDestination();
+        srcCounts[src]++;
+        counts[makeIdx(src, dst, testSize)]++;
+      }
 
-    // turn counts into dist
-    for (u32 src = 0; src < testSize; src++) {
-      for (u32 dst = 0; dst < testSize; dst++) {
-        counts[makeIdx(src, dst, testSize)] /= (f64)srcCounts[src];
+      // turn counts into dist
+      for (u32 src = 0; src < testSize; src++) {
+        for (u32 dst = 0; dst < testSize; dst++) {
+          counts[makeIdx(src, dst, testSize)] /= (f64)srcCounts[src];
+        }
       }
-    }
 
-    // print results
-    if (DEBUG) {
-      printf("Expected:\n%s\n", makeCSV(testDist, testSize).c_str());
-      printf("Actual:\n%s\n", makeCSV(counts, testSize).c_str());
-    }
+      // print results
+      if (DEBUG) {
+        printf("Expected:\n%s\n", makeCSV(testDist, testSize).c_str());
+        printf("Actual:\n%s\n", makeCSV(counts, testSize).c_str());
+      }
 
-    // verification
-    f64 worst = 0.0;
-    for (u32 src = 0; src < testSize; src++) {
-      for (u32 dst = 0; dst < testSize; dst++) {
-        f64 act = counts[makeIdx(src, dst, testSize)];
-        f64 exp = testDist[makeIdx(src, dst, testSize)];
-        ASSERT_NEAR(act, exp, 0.001);
-        if (fabs(act - exp) > worst) {
-          worst = fabs(act - exp);
+      // verification
+      f64 worst = 0.0;
+      for (u32 src = 0; src < testSize; src++) {
+        for (u32 dst = 0; dst < testSize; dst++) {
+          f64 act = counts[makeIdx(src, dst, testSize)];
+          f64 exp = testDist[makeIdx(src, dst, testSize)];
+          ASSERT_NEAR(act, exp, 0.001);
+          if (fabs(act - exp) > worst) {
+            worst = fabs(act - exp);
+          }
         }
       }
+      if (DEBUG) {
+        printf("worst variance=%f\n", worst);
+      }
+
+      // clean up
+      delete[] counts;
+      delete[] srcCounts;
+      for (u32 tp = 0; tp < testSize; tp++) {
+        delete tps.at(tp);
+      }
+      cleanCSV(TMPFILE);
     }
-    if (DEBUG) {
-      printf("worst variance=%f\n", worst);
+  }
+}
+
+TEST(MatrixCTP, sparse) {
+  // each source sends to a few destinations of a large matrix
+  const u32 size = 1000;
+  const u32 fanout = 3;
+  const f64 probs[] = {0.5, 0.3, 0.2};
+  std::stringstream ss;
+  for (u32 row = 0; row < size; row++) {
+    for (u32 col = 0; col < size; col++) {
+      u32 offset = (col + size - row) % size;
+      ss << (offset < fanout ? probs[offset] : 0.0) << ',';
     }
+    ss << '\n';
+  }
+  writeCSV(ss.str().c_str(), TMPFILE);
+
+  TestSetup testSetup(1234, 1234, 1234, 1234, 456789);
+  nlohmann::json settings;
+  settings["file"] = TMPFILE;
+  settings["storage"] = "sparse";
+  settings["parse_threads"] = 4;
+  std::vector<ContinuousTrafficPattern*> tps(size, nullptr);
+  for (u32 tp = 0; tp < size; tp++) {
+    tps.at(tp) = new MatrixCTP("TP_" + std::to_string(tp), nullptr, size, tp,
+                               settings);
+  }
 
-    // clean up
-    delete[] counts;
-    delete[] srcCounts;
-    for (u32 tp = 0; tp < testSize; tp++) {
-      delete tps.at(tp);
+  const u32 samples = 20000;
+  for (u32 src = 0; src < size; src += 97) {
+    u32 counts[fanout] = {0};
+    for (u32 s = 0; s < samples; s++) {
+      u32 dst = tps.at(src)->nextDestination();
+      u32 offset = (dst + size - src) % size;
+      ASSERT_LT(offset, fanout);
+      counts[offset]++;
+    }
+    for (u32 offset = 0; offset < fanout; offset++) {
+      ASSERT_NEAR((f64)counts[offset] / samples, probs[offset], 0.02);
     }
-    cleanCSV(TMPFILE);
   }
+
+  for (u32 tp = 0; tp < size; tp++) {
+    delete tps.at(tp);
+  }
+  cleanCSV(TMPFILE);
 }
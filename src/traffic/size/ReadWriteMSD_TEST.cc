@@ -45,8 +45,8 @@ TEST(ReadWriteMSD, simple) {
   std::unordered_map<u32, u32> sizes;
   const u32 ROUNDS = 10000000;
   Message* fakeRequest = new Message(1, nullptr);
-  Packet* fakeRQ = new Packet(0, RQ, fakeRequest);
-  Packet* fakeWQ = new Packet(0, WQ, fakeRequest);
+  Packet* fakeRQ = Packet::create(0, RQ, fakeRequest);
+  Packet* fakeWQ = Packet::create(0, WQ, fakeRequest);
   for (u32 round = 0; round < ROUNDS; round++) {
     // request
     u32 req = msd->nextMessageSize();
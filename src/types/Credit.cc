@@ -16,28 +16,36 @@
 
 #include <cassert>
 
-Credit::Credit(u32 _nums) {
-  assert(_nums > 0);
-  numNums_ = _nums;
-  putPos_ = 0;
-  getPos_ = 0;
-  nums_ = new u32[_nums];
+Credit::Credit() {
+  clear();
 }
 
-Credit::~Credit() {
-  delete[] nums_;
+Credit::~Credit() {}
+
+void Credit::clear() {
+  mask_ = 0;
+  for (u32 vc = 0; vc < kMaxVcs; vc++) {
+    counts_[vc] = 0;
+  }
 }
 
 bool Credit::more() const {
-  return getPos_ < putPos_;
+  return mask_ != 0;
 }
 
 void Credit::putNum(u32 _num) {
-  assert(putPos_ < numNums_);
-  nums_[putPos_++] = _num;
+  assert(_num < kMaxVcs);
+  assert(counts_[_num] < U8_MAX);
+  counts_[_num]++;
+  mask_ |= (u64)1 << _num;
 }
 
 u32 Credit::getNum() {
-  assert(getPos_ < numNums_);
-  return nums_[getPos_++];
+  assert(mask_ != 0);
+  u32 num = __builtin_ctzll(mask_);
+  counts_[num]--;
+  if (counts_[num] == 0) {
+    mask_ &= ~((u64)1 << num);
+  }
+  return num;
 }
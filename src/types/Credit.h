@@ -17,19 +17,25 @@
 
 #include "prim/prim.h"
 
+/*
+ * A credit is a value type that holds a count per VC. It never touches the
+ * heap and is carried inside of the channel (see Channel::setNextCredit()).
+ * VCs are retrieved in ascending order, each as many times as it was put.
+ */
 class Credit {
  public:
-  explicit Credit(u32 _nums);
+  static const u32 kMaxVcs = 64;
+
+  Credit();
   ~Credit();
+  void clear();
   bool more() const;
   void putNum(u32 _num);
   u32 getNum();
 
  private:
-  u32 numNums_;
-  u32 putPos_;
-  u32 getPos_;
-  u32* nums_;
+  u64 mask_;  // VCs with a non-zero count
+  u8 counts_[kMaxVcs];
 };
 
 #endif  // TYPES_CREDIT_H_
@@ -18,14 +18,13 @@
 
 #include "types/Packet.h"
 
-Flit::Flit(u32 _id, bool _isHead, bool _isTail, Packet* _packet)
-    : id_(_id),
-      head_(_isHead),
-      tail_(_isTail),
-      packet_(_packet),
+Flit::Flit(u32 _id, bool _isHead, bool _isTail)
+    : sendTime_(U64_MAX),
+      receiveTime_(U64_MAX),
+      id_(_id),
       vc_(U32_MAX),
-      sendTime_(U64_MAX),
-      receiveTime_(U64_MAX) {}
+      head_(_isHead),
+      tail_(_isTail) {}
 
 Flit::~Flit() {}
 
@@ -42,7 +41,9 @@ bool Flit::isTail() const {
 }
 
 Packet* Flit::packet() const {
-  return packet_;
+  // the flits directly follow the packet object
+  const Flit* first = this - id_;
+  return reinterpret_cast<Packet*>(const_cast<Flit*>(first)) - 1;
 }
 
 u32 Flit::getVc() const {
@@ -54,7 +55,7 @@ void Flit::setVc(u32 _vc) {
 }
 
 u32 Flit::getProtocolClass() const {
-  return packet_->getProtocolClass();
+  return packet()->getProtocolClass();
 }
 
 void Flit::setSendTime(u64 _time) {
@@ -19,11 +19,13 @@
 
 class Packet;
 
+/*
+ * Flits only exist inside of their packet. They are stored contiguously right
+ * after the packet object (see Packet::create()) in a fixed-size layout without
+ * a vtable, which allows the packet to be derived from the flit's id.
+ */
 class Flit {
  public:
-  Flit(u32 _id, bool _isHead, bool _isTail, Packet* _packet);
-  virtual ~Flit();
-
   u32 id() const;
   bool isHead() const;
   bool isTail() const;
@@ -39,14 +41,17 @@ class Flit {
   u64 getReceiveTime() const;
 
  private:
-  u32 id_;
-  bool head_;
-  bool tail_;
-  Packet* packet_;
-  u32 vc_;
+  friend class Packet;
+
+  Flit(u32 _id, bool _isHead, bool _isTail);
+  ~Flit();
 
   u64 sendTime_;
   u64 receiveTime_;
+  u32 id_;
+  u32 vc_;
+  bool head_;
+  bool tail_;
 };
 
 #endif  // TYPES_FLIT_H_
@@ -17,8 +17,14 @@
 #include <cassert>
 
 #include "types/Packet.h"
+#include "util/ObjectPool.h"
 #include "workload/Terminal.h"
 
+static ObjectPool& pool() {
+  static ObjectPool* instance = new ObjectPool(sizeof(Message), 1024);
+  return *instance;
+}
+
 Message::Message(u32 _numPackets, void* _data)
     : data_(_data),
       transaction_(U32_MAX),
@@ -36,6 +42,43 @@ Message::~Message() {
   }
 }
 
+void* Message::operator new(std::size_t _size) {
+  assert(_size == sizeof(Message));
+  return pool().allocate();
+}
+
+void Message::operator delete(void* _object) {
+  pool().release(_object);
+}
+
+u64 Message::peakLive() {
+  return pool().peakLive();
+}
+
+Message* Message::create(u32 _numFlits, u32 _maxPacketSize, void* _data) {
+  assert(_numFlits > 0);
+  assert(_maxPacketSize > 0);
+
+  // determine the number of packets
+  u32 numPackets = _numFlits / _maxPacketSize;
+  if ((_numFlits % _maxPacketSize) > 0) {
+    numPackets++;
+  }
+
+  // create the message object
+  Message* message = new Message(numPackets, _data);
+
+  // create the packets, the flits are created with them
+  u32 flitsLeft = _numFlits;
+  for (u32 p = 0; p < numPackets; p++) {
+    u32 packetLength = flitsLeft > _maxPacketSize ? _maxPacketSize : flitsLeft;
+    Packet* packet = Packet::create(p, packetLength, message);
+    message->setPacket(p, packet);
+    flitsLeft -= packetLength;
+  }
+  return message;
+}
+
 Terminal* Message::getOwner() const {
   return owner_;
 }
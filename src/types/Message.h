@@ -15,6 +15,7 @@
 #ifndef TYPES_MESSAGE_H_
 #define TYPES_MESSAGE_H_
 
+#include <cstddef>
 #include <vector>
 
 #include "prim/prim.h"
@@ -29,6 +30,19 @@ class Message {
   // this deletes all packet data as well (as long as packets aren't nullptr)
   virtual ~Message();
 
+  // objects are allocated from and recycled to a free-list pool
+  static void* operator new(std::size_t _size);
+  static void operator delete(void* _object);
+  static u64 peakLive();
+
+  /*
+   * This creates a message of '_numFlits' flits split into packets of at most
+   * '_maxPacketSize' flits. The message and packets (with their inline flits)
+   * are allocated from their pools and are recycled when the message is
+   * deleted.
+   */
+  static Message* create(u32 _numFlits, u32 _maxPacketSize, void* _data);
+
   Terminal* getOwner() const;
   void setOwner(Terminal* _owner);
 
@@ -15,42 +15,107 @@
 #include "types/Packet.h"
 
 #include <cassert>
+#include <new>
+#include <vector>
 
 #include "types/Flit.h"
 #include "types/Message.h"
+#include "util/ObjectPool.h"
+
+// each allocation is [pool pointer][packet][flits...], this is the header size
+static const u64 kHeaderSize = sizeof(ObjectPool*);
+static_assert(alignof(Packet) <= kHeaderSize, "header breaks alignment");
+static_assert(sizeof(Packet) % alignof(Flit) == 0, "flits are misaligned");
+
+// these track the live packet and flit counts across all pools
+static u64 livePackets = 0;
+static u64 peakPackets = 0;
+static u64 liveFlits = 0;
+static u64 peakFlits = 0;
+
+// this returns the pool for packets of '_numFlits' flits
+static ObjectPool* pool(u32 _numFlits) {
+  static std::vector<ObjectPool*>* pools = new std::vector<ObjectPool*>();
+  if (pools->size() <= _numFlits) {
+    pools->resize(_numFlits + 1, nullptr);
+  }
+  ObjectPool*& sizePool = pools->at(_numFlits);
+  if (sizePool == nullptr) {
+    u64 size = kHeaderSize + sizeof(Packet) + (_numFlits * sizeof(Flit));
+    sizePool = new ObjectPool(size, 1024);
+  }
+  return sizePool;
+}
+
+Packet* Packet::create(u32 _id, u32 _numFlits, Message* _message) {
+  assert(_numFlits > 0);
+  ObjectPool* sizePool = pool(_numFlits);
+  u8* memory = reinterpret_cast<u8*>(sizePool->allocate());
+  *reinterpret_cast<ObjectPool**>(memory) = sizePool;
+
+  livePackets++;
+  if (livePackets > peakPackets) {
+    peakPackets = livePackets;
+  }
+  liveFlits += _numFlits;
+  if (liveFlits > peakFlits) {
+    peakFlits = liveFlits;
+  }
+
+  return new (memory + kHeaderSize) Packet(_id, _numFlits, _message);
+}
 
 Packet::Packet(u32 _id, u32 _numFlits, Message* _message)
     : id_(_id),
+      numFlits_(_numFlits),
       message_(_message),
       hopCount_(0),
       metadata_(U64_MAX),
       routingExtension_(nullptr) {
-  flits_.resize(_numFlits);
+  // construct the flits in place
+  Flit* flits = this->flits();
+  for (u32 f = 0; f < numFlits_; f++) {
+    new (&flits[f]) Flit(f, f == 0, f == (numFlits_ - 1));
+  }
 }
 
 Packet::~Packet() {
-  for (u32 f = 0; f < flits_.size(); f++) {
-    if (flits_.at(f)) {
-      delete flits_.at(f);
-    }
+  Flit* flits = this->flits();
+  for (u32 f = 0; f < numFlits_; f++) {
+    flits[f].~Flit();
   }
+  assert(livePackets > 0);
+  assert(liveFlits >= numFlits_);
+  livePackets--;
+  liveFlits -= numFlits_;
   assert(routingExtension_ == nullptr);
 }
 
+void Packet::operator delete(void* _object) {
+  u8* memory = reinterpret_cast<u8*>(_object) - kHeaderSize;
+  ObjectPool* sizePool = *reinterpret_cast<ObjectPool**>(memory);
+  sizePool->release(memory);
+}
+
+u64 Packet::peakLive() {
+  return peakPackets;
+}
+
+u64 Packet::peakLiveFlits() {
+  return peakFlits;
+}
+
 u32 Packet::id() const {
   return id_;
 }
 
 u32 Packet::numFlits() const {
-  return flits_.size();
+  return numFlits_;
 }
 
 Flit* Packet::getFlit(u32 _index) const {
-  return flits_.at(_index);
-}
-
-void Packet::setFlit(u32 _index, Flit* _flit) {
-  flits_.at(_index) = _flit;
+  assert(_index < numFlits_);
+  return &flits()[_index];
 }
 
 u32 Packet::getProtocolClass() const {
@@ -70,19 +135,19 @@ u32 Packet::getHopCount() const {
 }
 
 u64 Packet::headLatency() const {
-  Flit* head = flits_.at(0);
+  const Flit* head = &flits()[0];
   return head->getReceiveTime() - head->getSendTime();
 }
 
 u64 Packet::serializationLatency() const {
-  Flit* head = flits_.at(0);
-  Flit* tail = flits_.at(flits_.size() - 1);
+  const Flit* head = &flits()[0];
+  const Flit* tail = &flits()[numFlits_ - 1];
   return tail->getReceiveTime() - head->getReceiveTime();
 }
 
 u64 Packet::totalLatency() const {
-  Flit* head = flits_.at(0);
-  Flit* tail = flits_.at(flits_.size() - 1);
+  const Flit* head = &flits()[0];
+  const Flit* tail = &flits()[numFlits_ - 1];
   return tail->getReceiveTime() - head->getSendTime();
 }
 
@@ -103,3 +168,8 @@ void* Packet::getRoutingExtension() const {
 void Packet::setRoutingExtension(void* _ext) {
   routingExtension_ = _ext;
 }
+
+Flit* Packet::flits() const {
+  // the flits directly follow the packet object
+  return reinterpret_cast<Flit*>(const_cast<Packet*>(this) + 1);
+}
@@ -15,25 +15,33 @@
 #ifndef TYPES_PACKET_H_
 #define TYPES_PACKET_H_
 
-#include <vector>
+#include <cstddef>
 
 #include "prim/prim.h"
 
 class Flit;
 class Message;
 
-class Packet {
+class Packet final {
  public:
-  Packet(u32 _id, u32 _numFlits, Message* _message);
+  /*
+   * This creates a packet and its '_numFlits' flits in a single allocation.
+   * The flits are stored contiguously right after the packet object. The
+   * memory is allocated from and recycled to a free-list pool per packet size.
+   */
+  static Packet* create(u32 _id, u32 _numFlits, Message* _message);
+
+  // this deletes all flit data as well
+  ~Packet();
 
-  // this deletes all flit data as well (if they aren't nullptr)
-  virtual ~Packet();
+  static void operator delete(void* _object);
+  static u64 peakLive();
+  static u64 peakLiveFlits();
 
   u32 id() const;
 
   u32 numFlits() const;
   Flit* getFlit(u32 _index) const;
-  void setFlit(u32 _index, Flit* _flit);
 
   u32 getProtocolClass() const;
 
@@ -53,8 +61,11 @@ class Packet {
   void setRoutingExtension(void* _ext);
 
  private:
+  Packet(u32 _id, u32 _numFlits, Message* _message);
+  Flit* flits() const;
+
   u32 id_;
-  std::vector<Flit*> flits_;
+  u32 numFlits_;
   Message* message_;
 
   u32 hopCount_;
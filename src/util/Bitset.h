@@ -0,0 +1,116 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef UTIL_BITSET_H_
+#define UTIL_BITSET_H_
+
+#include "prim/prim.h"
+
+/*
+ * These functions operate on bitsets stored as arrays of u64 words. Bit 'b'
+ * is bit (b % 64) of word (b / 64). Unused bits in the last word must be zero.
+ * The loops over words are simple enough to be vectorized by the compiler.
+ */
+
+// returns the number of words needed to hold '_numBits' bits
+inline u32 bitsetWords(u32 _numBits) {
+  return (_numBits + 63) / 64;
+}
+
+inline bool bitsetTest(const u64* _words, u32 _bit) {
+  return (_words[_bit / 64] >> (_bit % 64)) & 1;
+}
+
+inline void bitsetSet(u64* _words, u32 _bit) {
+  _words[_bit / 64] |= (u64)1 << (_bit % 64);
+}
+
+inline void bitsetClear(u64* _words, u32 _bit) {
+  _words[_bit / 64] &= ~((u64)1 << (_bit % 64));
+}
+
+inline void bitsetClearAll(u64* _words, u32 _numWords) {
+  for (u32 w = 0; w < _numWords; w++) {
+    _words[w] = 0;
+  }
+}
+
+// returns true if any bit is set (OR-reduction)
+inline bool bitsetAny(const u64* _words, u32 _numWords) {
+  u64 any = 0;
+  for (u32 w = 0; w < _numWords; w++) {
+    any |= _words[w];
+  }
+  return any != 0;
+}
+
+// returns the number of set bits
+inline u32 bitsetCount(const u64* _words, u32 _numWords) {
+  u32 count = 0;
+  for (u32 w = 0; w < _numWords; w++) {
+    count += __builtin_popcountll(_words[w]);
+  }
+  return count;
+}
+
+// returns the first set bit at or after '_start', or U32_MAX if none
+inline u32 bitsetNext(const u64* _words, u32 _numWords, u32 _start) {
+  u32 w = _start / 64;
+  if (w >= _numWords) {
+    return U32_MAX;
+  }
+  u64 word = _words[w] & (~(u64)0 << (_start % 64));
+  while (true) {
+    if (word != 0) {
+      return (w * 64) + __builtin_ctzll(word);
+    }
+    w++;
+    if (w == _numWords) {
+      return U32_MAX;
+    }
+    word = _words[w];
+  }
+}
+
+// returns the first set bit at or after '_start' wrapping around at
+//  '_numBits', or U32_MAX if none
+inline u32 bitsetNextCyclic(const u64* _words, u32 _numBits, u32 _start) {
+  u32 numWords = bitsetWords(_numBits);
+  u32 bit = bitsetNext(_words, numWords, _start);
+  if (bit == U32_MAX && _start > 0) {
+    bit = bitsetNext(_words, numWords, 0);
+    if (bit >= _start) {
+      bit = U32_MAX;
+    }
+  }
+  return bit;
+}
+
+// returns the '_nth' (0-based) set bit, or U32_MAX if there are not enough
+inline u32 bitsetSelect(const u64* _words, u32 _numWords, u32 _nth) {
+  for (u32 w = 0; w < _numWords; w++) {
+    u64 word = _words[w];
+    u32 count = __builtin_popcountll(word);
+    if (_nth < count) {
+      for (; _nth > 0; _nth--) {
+        word &= word - 1;  // clear lowest set bit
+      }
+      return (w * 64) + __builtin_ctzll(word);
+    }
+    _nth -= count;
+  }
+  return U32_MAX;
+}
+
+#endif  // UTIL_BITSET_H_
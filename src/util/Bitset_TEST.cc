@@ -0,0 +1,87 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "util/Bitset.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "prim/prim.h"
+
+TEST(Bitset, words) {
+  ASSERT_EQ(bitsetWords(0), 0u);
+  ASSERT_EQ(bitsetWords(1), 1u);
+  ASSERT_EQ(bitsetWords(64), 1u);
+  ASSERT_EQ(bitsetWords(65), 2u);
+  ASSERT_EQ(bitsetWords(128), 2u);
+  ASSERT_EQ(bitsetWords(129), 3u);
+}
+
+TEST(Bitset, setClearTest) {
+  const u32 kBits = 150;
+  std::vector<u64> words(bitsetWords(kBits), 0);
+  ASSERT_FALSE(bitsetAny(words.data(), words.size()));
+
+  for (u32 bit = 0; bit < kBits; bit += 7) {
+    bitsetSet(words.data(), bit);
+  }
+  ASSERT_TRUE(bitsetAny(words.data(), words.size()));
+  ASSERT_EQ(bitsetCount(words.data(), words.size()), (kBits + 6) / 7);
+  for (u32 bit = 0; bit < kBits; bit++) {
+    ASSERT_EQ(bitsetTest(words.data(), bit), bit % 7 == 0);
+  }
+
+  for (u32 bit = 0; bit < kBits; bit += 14) {
+    bitsetClear(words.data(), bit);
+  }
+  for (u32 bit = 0; bit < kBits; bit++) {
+    ASSERT_EQ(bitsetTest(words.data(), bit), bit % 14 == 7);
+  }
+
+  bitsetClearAll(words.data(), words.size());
+  ASSERT_FALSE(bitsetAny(words.data(), words.size()));
+  ASSERT_EQ(bitsetCount(words.data(), words.size()), 0u);
+}
+
+TEST(Bitset, search) {
+  const u32 kBits = 150;
+  std::vector<u64> words(bitsetWords(kBits), 0);
+  ASSERT_EQ(bitsetNext(words.data(), words.size(), 0), U32_MAX);
+  ASSERT_EQ(bitsetNextCyclic(words.data(), kBits, 10), U32_MAX);
+  ASSERT_EQ(bitsetSelect(words.data(), words.size(), 0), U32_MAX);
+
+  const std::vector<u32> bits = {3, 63, 64, 100, 149};
+  for (u32 bit : bits) {
+    bitsetSet(words.data(), bit);
+  }
+
+  ASSERT_EQ(bitsetNext(words.data(), words.size(), 0), 3u);
+  ASSERT_EQ(bitsetNext(words.data(), words.size(), 4), 63u);
+  ASSERT_EQ(bitsetNext(words.data(), words.size(), 64), 64u);
+  ASSERT_EQ(bitsetNext(words.data(), words.size(), 65), 100u);
+  ASSERT_EQ(bitsetNext(words.data(), words.size(), 150), U32_MAX);
+  ASSERT_EQ(bitsetNext(words.data(), words.size(), 1000), U32_MAX);
+
+  ASSERT_EQ(bitsetNextCyclic(words.data(), kBits, 101), 149u);
+  ASSERT_EQ(bitsetNextCyclic(words.data(), kBits, 149), 149u);
+  bitsetClear(words.data(), 149);
+  ASSERT_EQ(bitsetNextCyclic(words.data(), kBits, 101), 3u);
+  ASSERT_EQ(bitsetNextCyclic(words.data(), kBits, 0), 3u);
+  bitsetSet(words.data(), 149);
+
+  for (u32 idx = 0; idx < bits.size(); idx++) {
+    ASSERT_EQ(bitsetSelect(words.data(), words.size(), idx), bits.at(idx));
+  }
+  ASSERT_EQ(bitsetSelect(words.data(), words.size(), bits.size()), U32_MAX);
+}
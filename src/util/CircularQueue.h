@@ -0,0 +1,53 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef UTIL_CIRCULARQUEUE_H_
+#define UTIL_CIRCULARQUEUE_H_
+
+#include <vector>
+
+#include "prim/prim.h"
+
+/*
+ * This is a FIFO queue kept in a circular buffer, a replacement for
+ *  std::queue where many queues exist but few hold many elements (e.g., flit
+ *  buffers). Unlike std::deque nothing is allocated until the first push, the
+ *  buffer then doubles in size whenever it is full and never shrinks.
+ */
+template <typename T>
+class CircularQueue {
+ public:
+  CircularQueue();
+  ~CircularQueue();
+
+  bool empty() const;
+  u64 size() const;
+  u64 capacity() const;
+
+  T& front();
+  const T& front() const;
+  void push(const T& _value);
+  void pop();
+
+ private:
+  void grow();
+
+  std::vector<T> slots_;  // the size is 0 or a power of 2
+  u64 head_;
+  u64 size_;
+};
+
+#include "util/CircularQueue.tcc"
+
+#endif  // UTIL_CIRCULARQUEUE_H_
@@ -0,0 +1,85 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef UTIL_CIRCULARQUEUE_TCC_
+#define UTIL_CIRCULARQUEUE_TCC_
+
+#ifndef UTIL_CIRCULARQUEUE_H_
+#error "don't include this file directly. use the .h file instead"
+#else  // UTIL_CIRCULARQUEUE_H_
+
+#include <cassert>
+
+template <typename T>
+CircularQueue<T>::CircularQueue() : head_(0), size_(0) {}
+
+template <typename T>
+CircularQueue<T>::~CircularQueue() {}
+
+template <typename T>
+bool CircularQueue<T>::empty() const {
+  return size_ == 0;
+}
+
+template <typename T>
+u64 CircularQueue<T>::size() const {
+  return size_;
+}
+
+template <typename T>
+u64 CircularQueue<T>::capacity() const {
+  return slots_.size();
+}
+
+template <typename T>
+T& CircularQueue<T>::front() {
+  assert(size_ > 0);
+  return slots_[head_];
+}
+
+template <typename T>
+const T& CircularQueue<T>::front() const {
+  assert(size_ > 0);
+  return slots_[head_];
+}
+
+template <typename T>
+void CircularQueue<T>::push(const T& _value) {
+  if (size_ == slots_.size()) {
+    grow();
+  }
+  slots_[(head_ + size_) & (slots_.size() - 1)] = _value;
+  size_++;
+}
+
+template <typename T>
+void CircularQueue<T>::pop() {
+  assert(size_ > 0);
+  head_ = (head_ + 1) & (slots_.size() - 1);
+  size_--;
+}
+
+template <typename T>
+void CircularQueue<T>::grow() {
+  // unwrap the elements to the front of the larger buffer
+  std::vector<T> slots(slots_.empty() ? 4 : slots_.size() * 2);
+  for (u64 idx = 0; idx < size_; idx++) {
+    slots[idx] = slots_[(head_ + idx) & (slots_.size() - 1)];
+  }
+  slots_.swap(slots);
+  head_ = 0;
+}
+
+#endif  // UTIL_CIRCULARQUEUE_H_
+#endif  // UTIL_CIRCULARQUEUE_TCC_
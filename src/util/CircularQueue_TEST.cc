@@ -0,0 +1,61 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "util/CircularQueue.h"
+
+#include <queue>
+
+#include "gtest/gtest.h"
+#include "prim/prim.h"
+
+TEST(CircularQueue, lazy) {
+  CircularQueue<u32> queue;
+  ASSERT_TRUE(queue.empty());
+  ASSERT_EQ(queue.size(), 0u);
+  ASSERT_EQ(queue.capacity(), 0u);
+
+  queue.push(7);
+  ASSERT_EQ(queue.capacity(), 4u);
+  ASSERT_EQ(queue.front(), 7u);
+  queue.pop();
+  ASSERT_TRUE(queue.empty());
+}
+
+TEST(CircularQueue, wrapAndGrow) {
+  // the queue grows while its elements wrap around the end of the buffer
+  CircularQueue<u32> queue;
+  std::queue<u32> exp;
+  u32 next = 0;
+  for (u32 round = 0; round < 200; round++) {
+    for (u32 idx = 0; idx < (round % 7) + 1; idx++) {
+      queue.push(next);
+      exp.push(next);
+      next++;
+    }
+    for (u32 idx = 0; idx < (round % 5) + 1 && !exp.empty(); idx++) {
+      ASSERT_EQ(queue.front(), exp.front());
+      queue.pop();
+      exp.pop();
+    }
+    ASSERT_EQ(queue.size(), exp.size());
+    ASSERT_EQ(queue.empty(), exp.empty());
+  }
+  while (!exp.empty()) {
+    ASSERT_EQ(queue.front(), exp.front());
+    queue.pop();
+    exp.pop();
+  }
+  ASSERT_TRUE(queue.empty());
+  ASSERT_EQ(queue.capacity() & (queue.capacity() - 1), 0u);
+}
@@ -0,0 +1,88 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "util/ObjectPool.h"
+
+#include <cassert>
+#include <cstddef>
+
+// slots are padded to keep every object at the default new alignment
+static u64 computeSlotSize(u64 _objectSize) {
+  const u64 align = alignof(std::max_align_t);
+  u64 size = _objectSize < sizeof(void*) ? sizeof(void*) : _objectSize;
+  return ((size + align - 1) / align) * align;
+}
+
+ObjectPool::ObjectPool(u64 _objectSize, u64 _chunkSize)
+    : slotSize_(computeSlotSize(_objectSize)),
+      chunkSize_(_chunkSize),
+      freeList_(nullptr),
+      live_(0),
+      peakLive_(0) {
+  assert(_objectSize > 0);
+  assert(chunkSize_ > 0);
+}
+
+ObjectPool::~ObjectPool() {
+  for (u8* chunk : chunks_) {
+    delete[] chunk;
+  }
+}
+
+void* ObjectPool::allocate() {
+  // when no free slots exist, create a new chunk and thread it on the list
+  if (freeList_ == nullptr) {
+    u8* chunk = new u8[slotSize_ * chunkSize_];
+    chunks_.push_back(chunk);
+    Slot* next = nullptr;
+    for (u64 idx = chunkSize_; idx > 0; idx--) {
+      Slot* slot = reinterpret_cast<Slot*>(chunk + ((idx - 1) * slotSize_));
+      slot->next = next;
+      next = slot;
+    }
+    freeList_ = next;
+  }
+
+  // pop the head of the free list
+  Slot* slot = freeList_;
+  freeList_ = slot->next;
+
+  live_++;
+  if (live_ > peakLive_) {
+    peakLive_ = live_;
+  }
+  return slot;
+}
+
+void ObjectPool::release(void* _object) {
+  assert(live_ > 0);
+  live_--;
+
+  // push onto the head of the free list
+  Slot* slot = reinterpret_cast<Slot*>(_object);
+  slot->next = freeList_;
+  freeList_ = slot;
+}
+
+u64 ObjectPool::live() const {
+  return live_;
+}
+
+u64 ObjectPool::peakLive() const {
+  return peakLive_;
+}
+
+u64 ObjectPool::capacity() const {
+  return chunks_.size() * chunkSize_;
+}
@@ -0,0 +1,54 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef UTIL_OBJECTPOOL_H_
+#define UTIL_OBJECTPOOL_H_
+
+#include <vector>
+
+#include "prim/prim.h"
+
+/*
+ * This is a free-list memory pool for objects of '_objectSize' bytes. Memory
+ * is allocated in chunks of '_chunkSize' objects and is never returned to the
+ * system, released objects are recycled by subsequent allocations. This only
+ * handles the raw memory, construction and destruction is done by the caller
+ * (e.g., class specific operator new and delete).
+ */
+class ObjectPool {
+ public:
+  ObjectPool(u64 _objectSize, u64 _chunkSize);
+  ~ObjectPool();
+
+  void* allocate();
+  void release(void* _object);
+
+  u64 live() const;
+  u64 peakLive() const;
+  u64 capacity() const;
+
+ private:
+  struct Slot {
+    Slot* next;
+  };
+
+  const u64 slotSize_;
+  const u64 chunkSize_;
+  std::vector<u8*> chunks_;
+  Slot* freeList_;
+  u64 live_;
+  u64 peakLive_;
+};
+
+#endif  // UTIL_OBJECTPOOL_H_
@@ -0,0 +1,66 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "util/ObjectPool.h"
+
+#include <unordered_set>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "prim/prim.h"
+
+namespace {
+struct Item {
+  u64 a;
+  u32 b;
+};
+}  // namespace
+
+TEST(ObjectPool, recycle) {
+  ObjectPool pool(sizeof(Item), 4);
+  ASSERT_EQ(pool.capacity(), 0u);
+
+  std::vector<void*> objects;
+  for (u32 idx = 0; idx < 10; idx++) {
+    objects.push_back(pool.allocate());
+  }
+  ASSERT_EQ(pool.live(), 10u);
+  ASSERT_EQ(pool.peakLive(), 10u);
+  ASSERT_EQ(pool.capacity(), 12u);
+
+  // all allocations are unique
+  std::unordered_set<void*> unique(objects.begin(), objects.end());
+  ASSERT_EQ(unique.size(), 10u);
+
+  // released objects are recycled without growing the pool
+  for (u32 idx = 0; idx < 6; idx++) {
+    pool.release(objects.back());
+    objects.pop_back();
+  }
+  ASSERT_EQ(pool.live(), 4u);
+  for (u32 idx = 0; idx < 8; idx++) {
+    void* object = pool.allocate();
+    ASSERT_EQ(unique.count(object) + (idx >= 6 ? 1 : 0), 1u);
+    objects.push_back(object);
+  }
+  ASSERT_EQ(pool.live(), 12u);
+  ASSERT_EQ(pool.peakLive(), 12u);
+  ASSERT_EQ(pool.capacity(), 12u);
+
+  for (void* object : objects) {
+    pool.release(object);
+  }
+  ASSERT_EQ(pool.live(), 0u);
+  ASSERT_EQ(pool.peakLive(), 12u);
+}
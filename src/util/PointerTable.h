@@ -0,0 +1,56 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef UTIL_POINTERTABLE_H_
+#define UTIL_POINTERTABLE_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "prim/prim.h"
+
+/*
+ * This is a table of pointers into other arrays (e.g., the request signals of
+ *  an arbiter). While the pointers are set in index order and are evenly
+ *  spaced, only the first pointer and the spacing are kept. Any other mapping
+ *  falls back to a full table of pointers which is built when first needed.
+ */
+template <typename T>
+class PointerTable {
+ public:
+  explicit PointerTable(u32 _size);
+  ~PointerTable();
+
+  u32 size() const;
+  void set(u32 _index, T* _pointer);
+  // sets all pointers at once, pointer 'i' is (_first + (i * _stride))
+  void setAll(T* _first, s64 _stride);
+  T* operator[](u32 _index) const;
+
+  // returns true if the full table of pointers has been built
+  bool irregular() const;
+
+ private:
+  void buildTable();
+
+  const u32 size_;
+  u32 regular_;  // number of leading pointers that are evenly spaced
+  uintptr_t base_;
+  s64 stride_;  // in bytes
+  std::vector<T*> table_;
+};
+
+#include "util/PointerTable.tcc"
+
+#endif  // UTIL_POINTERTABLE_H_
@@ -0,0 +1,96 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef UTIL_POINTERTABLE_TCC_
+#define UTIL_POINTERTABLE_TCC_
+
+#ifndef UTIL_POINTERTABLE_H_
+#error "don't include this file directly. use the .h file instead"
+#else  // UTIL_POINTERTABLE_H_
+
+#include <cassert>
+
+template <typename T>
+PointerTable<T>::PointerTable(u32 _size)
+    : size_(_size), regular_(0), base_(0), stride_(0) {}
+
+template <typename T>
+PointerTable<T>::~PointerTable() {}
+
+template <typename T>
+u32 PointerTable<T>::size() const {
+  return size_;
+}
+
+template <typename T>
+void PointerTable<T>::set(u32 _index, T* _pointer) {
+  assert(_index < size_);
+  uintptr_t pointer = reinterpret_cast<uintptr_t>(_pointer);
+  if (table_.empty()) {
+    if (_index == regular_) {
+      // the next pointer in order
+      if (regular_ == 0) {
+        base_ = pointer;
+        regular_++;
+        return;
+      } else if (regular_ == 1) {
+        stride_ = (s64)(pointer - base_);
+        regular_++;
+        return;
+      } else if (pointer == base_ + (stride_ * _index)) {
+        regular_++;
+        return;
+      }
+    } else if (_index < regular_ && pointer == base_ + (stride_ * _index)) {
+      // the same pointer again
+      return;
+    }
+    buildTable();
+  }
+  table_[_index] = _pointer;
+}
+
+template <typename T>
+void PointerTable<T>::setAll(T* _first, s64 _stride) {
+  regular_ = size_;
+  base_ = reinterpret_cast<uintptr_t>(_first);
+  stride_ = _stride * (s64)sizeof(T);
+  std::vector<T*>().swap(table_);
+}
+
+template <typename T>
+T* PointerTable<T>::operator[](u32 _index) const {
+  if (table_.empty()) {
+    assert(_index < regular_);
+    return reinterpret_cast<T*>(base_ + (stride_ * _index));
+  } else {
+    return table_[_index];
+  }
+}
+
+template <typename T>
+bool PointerTable<T>::irregular() const {
+  return !table_.empty();
+}
+
+template <typename T>
+void PointerTable<T>::buildTable() {
+  table_.resize(size_, nullptr);
+  for (u32 index = 0; index < regular_; index++) {
+    table_[index] = reinterpret_cast<T*>(base_ + (stride_ * index));
+  }
+}
+
+#endif  // UTIL_POINTERTABLE_H_
+#endif  // UTIL_POINTERTABLE_TCC_
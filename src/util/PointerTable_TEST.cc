@@ -0,0 +1,115 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "util/PointerTable.h"
+
+#include "gtest/gtest.h"
+#include "prim/prim.h"
+
+TEST(PointerTable, regular) {
+  const u32 kSize = 10;
+  u64 values[kSize * 3];
+  for (u32 stride : {1, 3}) {
+    PointerTable<u64> table(kSize);
+    ASSERT_EQ(table.size(), kSize);
+    for (u32 index = 0; index < kSize; index++) {
+      table.set(index, &values[index * stride]);
+    }
+    // setting the same pointer again keeps the table regular
+    table.set(4, &values[4 * stride]);
+    ASSERT_FALSE(table.irregular());
+    for (u32 index = 0; index < kSize; index++) {
+      ASSERT_EQ(table[index], &values[index * stride]);
+    }
+  }
+}
+
+TEST(PointerTable, backwards) {
+  const u32 kSize = 8;
+  bool values[kSize];
+  PointerTable<const bool> table(kSize);
+  for (u32 index = 0; index < kSize; index++) {
+    table.set(index, &values[kSize - 1 - index]);
+  }
+  ASSERT_FALSE(table.irregular());
+  for (u32 index = 0; index < kSize; index++) {
+    ASSERT_EQ(table[index], &values[kSize - 1 - index]);
+  }
+}
+
+TEST(PointerTable, irregular) {
+  const u32 kSize = 6;
+  u32 values[kSize * 2];
+
+  // uneven spacing
+  PointerTable<u32> uneven(kSize);
+  for (u32 index = 0; index < kSize; index++) {
+    uneven.set(index, &values[index * index / 2]);
+  }
+  ASSERT_TRUE(uneven.irregular());
+  for (u32 index = 0; index < kSize; index++) {
+    ASSERT_EQ(uneven[index], &values[index * index / 2]);
+  }
+
+  // out of order
+  PointerTable<u32> order(kSize);
+  order.set(0, &values[0]);
+  order.set(1, &values[1]);
+  order.set(3, &values[3]);
+  ASSERT_TRUE(order.irregular());
+  order.set(2, &values[2]);
+  order.set(5, &values[5]);
+  order.set(4, &values[4]);
+  for (u32 index = 0; index < kSize; index++) {
+    ASSERT_EQ(order[index], &values[index]);
+  }
+
+  // remapping a pointer
+  PointerTable<u32> remap(kSize);
+  for (u32 index = 0; index < kSize; index++) {
+    remap.set(index, &values[index]);
+  }
+  ASSERT_FALSE(remap.irregular());
+  remap.set(2, &values[kSize + 2]);
+  ASSERT_TRUE(remap.irregular());
+  for (u32 index = 0; index < kSize; index++) {
+    ASSERT_EQ(remap[index], index == 2 ? &values[kSize + 2] : &values[index]);
+  }
+}
+
+TEST(PointerTable, setAll) {
+  const u32 kSize = 5;
+  u64 values[kSize * 4];
+  PointerTable<u64> table(kSize);
+
+  // replaces a full table
+  table.set(0, &values[1]);
+  table.set(1, &values[0]);
+  table.set(2, &values[7]);
+  ASSERT_TRUE(table.irregular());
+  table.setAll(&values[2], 4);
+  ASSERT_FALSE(table.irregular());
+  for (u32 index = 0; index < kSize; index++) {
+    ASSERT_EQ(table[index], &values[2 + (index * 4)]);
+  }
+
+  // can be followed by single pointers
+  table.set(3, &values[2 + (3 * 4)]);
+  ASSERT_FALSE(table.irregular());
+  table.set(3, &values[0]);
+  ASSERT_TRUE(table.irregular());
+  for (u32 index = 0; index < kSize; index++) {
+    ASSERT_EQ(table[index], index == 3 ? &values[0] : &values[2 + (index * 4)]);
+  }
+}
@@ -0,0 +1,60 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef UTIL_SHAREDREGISTRY_H_
+#define UTIL_SHAREDREGISTRY_H_
+
+#include <functional>
+#include <unordered_map>
+
+#include "prim/prim.h"
+
+/*
+ * This is a reference counted registry of objects shared under a key (e.g.,
+ *  per router state shared by all instances on that router). The registry
+ *  doesn't own the objects, the caller deletes an object when release()
+ *  reports that its last reference was dropped.
+ */
+template <typename K, typename T, typename H = std::hash<K>>
+class SharedRegistry {
+ public:
+  SharedRegistry();
+  ~SharedRegistry();
+
+  // this returns the object shared under '_key' and adds a reference to it,
+  //  nullptr is returned if no object has been shared under the key
+  T* acquire(const K& _key);
+
+  // this shares '_object' under '_key' with one reference
+  void share(const K& _key, T* _object);
+
+  // this drops a reference of '_key', returns true when it was the last one
+  //  and the object has been removed from the registry
+  bool release(const K& _key);
+
+  u32 size() const;
+  u32 references(const K& _key) const;
+
+ private:
+  struct Entry {
+    T* object;
+    u32 references;
+  };
+
+  std::unordered_map<K, Entry, H> entries_;
+};
+
+#include "util/SharedRegistry.tcc"
+
+#endif  // UTIL_SHAREDREGISTRY_H_
@@ -0,0 +1,73 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef UTIL_SHAREDREGISTRY_TCC_
+#define UTIL_SHAREDREGISTRY_TCC_
+
+#ifndef UTIL_SHAREDREGISTRY_H_
+#error "don't include this file directly. use the .h file instead"
+#else  // UTIL_SHAREDREGISTRY_H_
+
+#include <cassert>
+
+template <typename K, typename T, typename H>
+SharedRegistry<K, T, H>::SharedRegistry() {}
+
+template <typename K, typename T, typename H>
+SharedRegistry<K, T, H>::~SharedRegistry() {}
+
+template <typename K, typename T, typename H>
+T* SharedRegistry<K, T, H>::acquire(const K& _key) {
+  auto it = entries_.find(_key);
+  if (it == entries_.end()) {
+    return nullptr;
+  }
+  it->second.references++;
+  return it->second.object;
+}
+
+template <typename K, typename T, typename H>
+void SharedRegistry<K, T, H>::share(const K& _key, T* _object) {
+  assert(_object != nullptr);
+  bool res = entries_.emplace(_key, Entry({_object, 1})).second;
+  (void)res;  // UNUSED
+  assert(res);
+}
+
+template <typename K, typename T, typename H>
+bool SharedRegistry<K, T, H>::release(const K& _key) {
+  auto it = entries_.find(_key);
+  assert(it != entries_.end());
+  assert(it->second.references > 0);
+  it->second.references--;
+  if (it->second.references == 0) {
+    entries_.erase(it);
+    return true;
+  }
+  return false;
+}
+
+template <typename K, typename T, typename H>
+u32 SharedRegistry<K, T, H>::size() const {
+  return entries_.size();
+}
+
+template <typename K, typename T, typename H>
+u32 SharedRegistry<K, T, H>::references(const K& _key) const {
+  auto it = entries_.find(_key);
+  return it == entries_.end() ? 0 : it->second.references;
+}
+
+#endif  // UTIL_SHAREDREGISTRY_H_
+#endif  // UTIL_SHAREDREGISTRY_TCC_
@@ -0,0 +1,79 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "util/SharedRegistry.h"
+
+#include <string>
+#include <tuple>
+
+#include "colhash/tuplehash.h"
+#include "gtest/gtest.h"
+#include "prim/prim.h"
+
+TEST(SharedRegistry, references) {
+  SharedRegistry<u32, u64> registry;
+  u64 a = 10;
+  u64 b = 20;
+
+  ASSERT_EQ(registry.acquire(1), nullptr);
+  registry.share(1, &a);
+  registry.share(2, &b);
+  ASSERT_EQ(registry.size(), 2u);
+  ASSERT_EQ(registry.references(1), 1u);
+
+  // each acquire adds a reference
+  ASSERT_EQ(registry.acquire(1), &a);
+  ASSERT_EQ(registry.acquire(1), &a);
+  ASSERT_EQ(registry.acquire(2), &b);
+  ASSERT_EQ(registry.references(1), 3u);
+  ASSERT_EQ(registry.references(2), 2u);
+
+  // only the last release removes the object
+  ASSERT_FALSE(registry.release(1));
+  ASSERT_FALSE(registry.release(1));
+  ASSERT_EQ(registry.acquire(1), &a);
+  ASSERT_FALSE(registry.release(1));
+  ASSERT_TRUE(registry.release(1));
+  ASSERT_EQ(registry.references(1), 0u);
+  ASSERT_EQ(registry.acquire(1), nullptr);
+  ASSERT_EQ(registry.size(), 1u);
+
+  ASSERT_FALSE(registry.release(2));
+  ASSERT_TRUE(registry.release(2));
+  ASSERT_EQ(registry.size(), 0u);
+
+  // a key can be shared again after its last release
+  registry.share(1, &b);
+  ASSERT_EQ(registry.acquire(1), &b);
+  ASSERT_FALSE(registry.release(1));
+  ASSERT_TRUE(registry.release(1));
+}
+
+TEST(SharedRegistry, tupleKey) {
+  typedef std::tuple<const void*, std::string> Key;
+  SharedRegistry<Key, u32> registry;
+  u32 a = 1;
+  u32 b = 2;
+  u32 c = 3;
+
+  // objects are distinct by every part of the key
+  registry.share(Key(&a, "x"), &a);
+  registry.share(Key(&a, "y"), &b);
+  registry.share(Key(&b, "x"), &c);
+  ASSERT_EQ(registry.acquire(Key(&a, "x")), &a);
+  ASSERT_EQ(registry.acquire(Key(&a, "y")), &b);
+  ASSERT_EQ(registry.acquire(Key(&b, "x")), &c);
+  ASSERT_EQ(registry.acquire(Key(&b, "y")), nullptr);
+  ASSERT_EQ(registry.size(), 3u);
+}
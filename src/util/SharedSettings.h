@@ -0,0 +1,63 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef UTIL_SHAREDSETTINGS_H_
+#define UTIL_SHAREDSETTINGS_H_
+
+#include <unordered_map>
+
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+
+/*
+ * This holds the typed settings 'T' parsed from a settings subtree. 'T' is
+ *  constructed from the subtree. All holders of identical subtrees (e.g., the
+ *  routing algorithms of every port of every router) share one instance of
+ *  'T', only the first of them parses the subtree.
+ */
+template <typename T>
+class SharedSettings {
+ public:
+  explicit SharedSettings(const nlohmann::json& _settings);
+  ~SharedSettings();
+
+  const T& operator*() const;
+  const T* operator->() const;
+
+  // returns the number of holders sharing these settings
+  u32 references() const;
+
+  // returns the number of distinct settings held
+  static u32 size();
+
+ private:
+  struct Entry {
+    T* settings;
+    u32 references;
+  };
+  typedef std::unordered_map<nlohmann::json, Entry> Map;
+
+  static Map entries_;
+  // holders are mostly created from a few subtrees at fixed addresses (e.g.,
+  //  the settings of each protocol class), comparing a subtree to the entry
+  //  last found for its address is cheaper than hashing it
+  static std::unordered_map<const nlohmann::json*, typename Map::value_type*>
+      addresses_;
+  typename Map::value_type* entry_;
+  const T* settings_;
+};
+
+#include "util/SharedSettings.tcc"
+
+#endif  // UTIL_SHAREDSETTINGS_H_
@@ -0,0 +1,88 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef UTIL_SHAREDSETTINGS_TCC_
+#define UTIL_SHAREDSETTINGS_TCC_
+
+#ifndef UTIL_SHAREDSETTINGS_H_
+#error "don't include this file directly. use the .h file instead"
+#else  // UTIL_SHAREDSETTINGS_H_
+
+#include <cassert>
+
+template <typename T>
+typename SharedSettings<T>::Map SharedSettings<T>::entries_;
+
+template <typename T>
+std::unordered_map<const nlohmann::json*,
+                   typename SharedSettings<T>::Map::value_type*>
+    SharedSettings<T>::addresses_;
+
+template <typename T>
+SharedSettings<T>::SharedSettings(const nlohmann::json& _settings) {
+  auto address = addresses_.find(&_settings);
+  if (address != addresses_.end() && address->second->first == _settings) {
+    entry_ = address->second;
+  } else {
+    auto it = entries_.find(_settings);
+    if (it == entries_.end()) {
+      it = entries_.emplace(_settings, Entry({new T(_settings), 0})).first;
+    }
+    // elements of the map don't move when it grows
+    entry_ = &*it;
+    addresses_[&_settings] = entry_;
+  }
+  entry_->second.references++;
+  settings_ = entry_->second.settings;
+}
+
+template <typename T>
+SharedSettings<T>::~SharedSettings() {
+  assert(entry_->second.references > 0);
+  entry_->second.references--;
+  if (entry_->second.references == 0) {
+    delete settings_;
+    for (auto it = addresses_.begin(); it != addresses_.end();) {
+      if (it->second == entry_) {
+        it = addresses_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    entries_.erase(entries_.find(entry_->first));
+  }
+}
+
+template <typename T>
+const T& SharedSettings<T>::operator*() const {
+  return *settings_;
+}
+
+template <typename T>
+const T* SharedSettings<T>::operator->() const {
+  return settings_;
+}
+
+template <typename T>
+u32 SharedSettings<T>::references() const {
+  return entry_->second.references;
+}
+
+template <typename T>
+u32 SharedSettings<T>::size() {
+  return entries_.size();
+}
+
+#endif  // UTIL_SHAREDSETTINGS_H_
+#endif  // UTIL_SHAREDSETTINGS_TCC_
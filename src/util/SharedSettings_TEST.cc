@@ -0,0 +1,81 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "util/SharedSettings.h"
+
+#include "gtest/gtest.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+
+namespace {
+
+struct TestSettings {
+  explicit TestSettings(const nlohmann::json& _settings)
+      : value(_settings["value"].get<u32>()) {
+    parses++;
+  }
+  const u32 value;
+  static u32 parses;
+};
+
+u32 TestSettings::parses = 0;
+
+}  // namespace
+
+TEST(SharedSettings, share) {
+  TestSettings::parses = 0;
+  nlohmann::json a = {{"value", 1}, {"name", "x"}};
+  nlohmann::json b = {{"value", 2}, {"name", "x"}};
+  nlohmann::json c = a;
+
+  // identical subtrees share a single parse, regardless of their address
+  SharedSettings<TestSettings>* sa = new SharedSettings<TestSettings>(a);
+  SharedSettings<TestSettings>* sb = new SharedSettings<TestSettings>(b);
+  SharedSettings<TestSettings>* sc = new SharedSettings<TestSettings>(c);
+  ASSERT_EQ(TestSettings::parses, 2u);
+  ASSERT_EQ(SharedSettings<TestSettings>::size(), 2u);
+  ASSERT_EQ((*sa)->value, 1u);
+  ASSERT_EQ((*sb)->value, 2u);
+  ASSERT_EQ(&**sa, &**sc);
+  ASSERT_EQ(sa->references(), 2u);
+  ASSERT_EQ(sb->references(), 1u);
+
+  // the same subtree again, then a changed subtree at the same address
+  SharedSettings<TestSettings>* sd = new SharedSettings<TestSettings>(c);
+  ASSERT_EQ(&**sd, &**sa);
+  c["value"] = 2;
+  SharedSettings<TestSettings>* se = new SharedSettings<TestSettings>(c);
+  ASSERT_EQ(&**se, &**sb);
+  ASSERT_EQ(TestSettings::parses, 2u);
+  ASSERT_EQ(sb->references(), 2u);
+  delete sd;
+  delete se;
+
+  // the settings live until their last holder is gone
+  delete sa;
+  ASSERT_EQ((*sc)->value, 1u);
+  ASSERT_EQ(sc->references(), 1u);
+  delete sc;
+  ASSERT_EQ(SharedSettings<TestSettings>::size(), 1u);
+
+  // settings are parsed again once all holders are gone
+  a["value"] = 3;
+  sa = new SharedSettings<TestSettings>(a);
+  ASSERT_EQ(TestSettings::parses, 3u);
+  ASSERT_EQ((*sa)->value, 3u);
+
+  delete sa;
+  delete sb;
+  ASSERT_EQ(SharedSettings<TestSettings>::size(), 0u);
+}
@@ -54,8 +54,14 @@ Workload::Workload(const std::string& _name, const Component* _parent,
         _settings["applications"][app]);
   }
 
+  // create the LatencyStats if a file is given
+  latencyStats_ = nullptr;
+  if (!_settings["latency_stats"]["file"].is_null()) {
+    latencyStats_ = new LatencyStats(_settings["latency_stats"]);
+  }
+
   // create a MessageLog
-  messageLog_ = new MessageLog(_settings["message_log"]);
+  messageLog_ = new MessageLog(_settings["message_log"], latencyStats_);
 }
 
 Workload::~Workload() {
@@ -66,6 +72,7 @@ Workload::~Workload() {
     delete dist;
   }
   delete messageLog_;
+  delete latencyStats_;
 }
 
 u32 Workload::numApplications() const {
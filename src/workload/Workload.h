@@ -21,6 +21,7 @@
 #include "event/Component.h"
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
+#include "stats/LatencyStats.h"
 #include "stats/MessageLog.h"
 #include "workload/MessageDistributor.h"
 
@@ -70,6 +71,7 @@ class Workload : public Component {
 
   std::vector<Application*> applications_;
   std::vector<MessageDistributor*> distributors_;
+  LatencyStats* latencyStats_;
   MessageLog* messageLog_;
 
   Fsm fsm_;
@@ -282,37 +282,13 @@ void GraphTerminal::generateMessage(u32 _destination, u64 _sequence_number,
   u64 transaction = createTransaction();
   application()->workload()->messageLog()->startTransaction(transaction);
 
-  // Determine the number of packets.
-  u32 numPackets = _size / maxPacketSize_;
-  if ((_size % maxPacketSize_) > 0) {
-    numPackets++;
-  }
-
   // Creates the message object
   u64* sequence_number = new u64;
   *sequence_number = _sequence_number;
-  Message* message = new Message(numPackets, sequence_number);
+  Message* message = Message::create(_size, maxPacketSize_, sequence_number);
   message->setProtocolClass(protocolClass_);
   message->setTransaction(transaction);
 
-  // Creates the packets
-  u32 flitsLeft = _size;
-  for (u32 p = 0; p < numPackets; p++) {
-    u32 packetLength = flitsLeft > maxPacketSize_ ? maxPacketSize_ : flitsLeft;
-
-    Packet* packet = new Packet(p, packetLength, message);
-    message->setPacket(p, packet);
-
-    // create flits
-    for (u32 f = 0; f < packetLength; f++) {
-      bool headFlit = f == 0;
-      bool tailFlit = f == (packetLength - 1);
-      Flit* flit = new Flit(f, headFlit, tailFlit, packet);
-      packet->setFlit(f, flit);
-    }
-    flitsLeft -= packetLength;
-  }
-
   // Sends the message
   u32 msgId = sendMessage(message, _destination);
   (void)msgId;  // unused
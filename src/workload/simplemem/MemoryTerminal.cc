@@ -128,31 +128,12 @@ void MemoryTerminal::sendMemoryResponse() {
     memcpy(memoryData, memOpReq->block(), blockSize);
   }
   messageLength /= bytesPerFlit;
-  u32 numPackets = messageLength / maxPacketSize;
-  if ((messageLength % maxPacketSize) > 0) {
-    numPackets++;
-  }
 
   // create the outgoing message, packets, and flits
-  Message* response = new Message(numPackets, memOpResp);
+  Message* response = Message::create(messageLength, maxPacketSize, memOpResp);
   response->setProtocolClass(protocolClass_);
   response->setTransaction(request->getTransaction());
 
-  u32 flitsLeft = messageLength;
-  for (u32 p = 0; p < numPackets; p++) {
-    u32 packetLength = flitsLeft > maxPacketSize ? maxPacketSize : flitsLeft;
-    Packet* packet = new Packet(p, packetLength, response);
-    response->setPacket(p, packet);
-
-    for (u32 f = 0; f < packetLength; f++) {
-      bool headFlit = f == 0;
-      bool tailFlit = f == (packetLength - 1);
-      Flit* flit = new Flit(f, headFlit, tailFlit, packet);
-      packet->setFlit(f, flit);
-    }
-    flitsLeft -= packetLength;
-  }
-
   // send the response to the requester
   u32 requesterId = request->getSourceId();
   assert((requesterId & 0x1) == 1);
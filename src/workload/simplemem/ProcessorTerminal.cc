@@ -141,33 +141,14 @@ void ProcessorTerminal::startNextMemoryAccess() {
   // determine message length
   u32 messageLength = headerOverhead + 1 + sizeof(u32) + blockSize;
   messageLength /= bytesPerFlit;
-  u32 numPackets = messageLength / maxPacketSize;
-  if ((messageLength % maxPacketSize) > 0) {
-    numPackets++;
-  }
 
   // create network message, packets, and flits
-  Message* message = new Message(numPackets, memOp);
+  Message* message = Message::create(messageLength, maxPacketSize, memOp);
   message->setProtocolClass(protocolClass_);
   u64 trans = createTransaction();
   message->setTransaction(trans);
   app->workload()->messageLog()->startTransaction(trans);
 
-  u32 flitsLeft = messageLength;
-  for (u32 p = 0; p < numPackets; p++) {
-    u32 packetLength = flitsLeft > maxPacketSize ? maxPacketSize : flitsLeft;
-    Packet* packet = new Packet(p, packetLength, message);
-    message->setPacket(p, packet);
-
-    for (u32 f = 0; f < packetLength; f++) {
-      bool headFlit = f == 0;
-      bool tailFlit = f == (packetLength - 1);
-      Flit* flit = new Flit(f, headFlit, tailFlit, packet);
-      packet->setFlit(f, flit);
-    }
-    flitsLeft -= packetLength;
-  }
-
   // send the request to the memory terminal
   dbgprintf("sending %s request to %u (address %u)",
             (op == MemoryOp::eOp::kWriteReq) ? "write" : "read",
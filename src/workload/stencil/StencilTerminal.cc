@@ -330,36 +330,12 @@ void StencilTerminal::generateMessage(u32 _destTerminal, u32 _size,
   // start the transaction in the application
   application()->workload()->messageLog()->startTransaction(transaction);
 
-  // determine the number of packets
-  u32 numPackets = messageSize / maxPacketSize_;
-  if ((messageSize % maxPacketSize_) > 0) {
-    numPackets++;
-  }
-
   // create the message object
-  Message* message = new Message(numPackets, nullptr);
+  Message* message = Message::create(messageSize, maxPacketSize_, nullptr);
   message->setProtocolClass(protocolClass);
   message->setTransaction(transaction);
   message->setOpCode(msgType);
 
-  // create the packets
-  u32 flitsLeft = messageSize;
-  for (u32 p = 0; p < numPackets; p++) {
-    u32 packetLength = flitsLeft > maxPacketSize_ ? maxPacketSize_ : flitsLeft;
-
-    Packet* packet = new Packet(p, packetLength, message);
-    message->setPacket(p, packet);
-
-    // create flits
-    for (u32 f = 0; f < packetLength; f++) {
-      bool headFlit = f == 0;
-      bool tailFlit = f == (packetLength - 1);
-      Flit* flit = new Flit(f, headFlit, tailFlit, packet);
-      packet->setFlit(f, flit);
-    }
-    flitsLeft -= packetLength;
-  }
-
   // send the message
   u32 msgId = sendMessage(message, destination);
   (void)msgId;  // unused
@@ -146,36 +146,14 @@ void StreamTerminal::sendNextMessage() {
 
   // pick a random message length
   u32 messageLength = messageSizeDistribution_->nextMessageSize();
-  u32 numPackets = messageLength / maxPacketSize_;
-  if ((messageLength % maxPacketSize_) > 0) {
-    numPackets++;
-  }
 
   // create the message object
-  Message* message = new Message(numPackets, nullptr);
+  Message* message = Message::create(messageLength, maxPacketSize_, nullptr);
   message->setProtocolClass(protocolClass_);
   u64 trans = createTransaction();
   message->setTransaction(trans);
   app->workload()->messageLog()->startTransaction(trans);
 
-  // create the packets
-  u32 flitsLeft = messageLength;
-  for (u32 p = 0; p < numPackets; p++) {
-    u32 packetLength = flitsLeft > maxPacketSize_ ? maxPacketSize_ : flitsLeft;
-
-    Packet* packet = new Packet(p, packetLength, message);
-    message->setPacket(p, packet);
-
-    // create flits
-    for (u32 f = 0; f < packetLength; f++) {
-      bool headFlit = f == 0;
-      bool tailFlit = f == (packetLength - 1);
-      Flit* flit = new Flit(f, headFlit, tailFlit, packet);
-      packet->setFlit(f, flit);
-    }
-    flitsLeft -= packetLength;
-  }
-
   // send the message
   sendMessage(message, destination);
 